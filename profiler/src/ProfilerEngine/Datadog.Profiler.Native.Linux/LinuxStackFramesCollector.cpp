@@ -6,9 +6,12 @@
 #include <cassert>
 #include <chrono>
 #include <errno.h>
+#include <linux/futex.h>
 #include <mutex>
 #include <signal.h>
 #include <sys/syscall.h>
+#include <thread>
+#include <time.h>
 #include <unordered_map>
 #include <iomanip>
 
@@ -23,6 +26,7 @@ error("unsupported architecture")
 #include "Log.h"
 #include "ManagedThreadInfo.h"
 #include "OpSysTools.h"
+#include "OsSpecificApi.h"
 #include "ScopeFinalizer.h"
 #include "StackSnapshotResultReusableBuffer.h"
 
@@ -33,18 +37,60 @@ std::mutex LinuxStackFramesCollector::s_stackWalkInProgressMutex;
 bool LinuxStackFramesCollector::s_isSignalHandlerSetup = false;
 int32_t LinuxStackFramesCollector::s_signalToSend = -1;
 LinuxStackFramesCollector* LinuxStackFramesCollector::s_pInstanceCurrentlyStackWalking = nullptr;
+std::atomic<LinuxStackFramesCollector*> LinuxStackFramesCollector::s_pInstanceCurrentlyBatchWalking{nullptr};
+std::atomic<LinuxStackFramesCollector*> LinuxStackFramesCollector::s_pCpuTimerInstance{nullptr};
+int32_t LinuxStackFramesCollector::s_cpuTimerSignal = -1;
+
+// glibc < 2.35 does not define it
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
 
 LinuxStackFramesCollector::LinuxStackFramesCollector(ICorProfilerInfo4* const _pCorProfilerInfo) :
     _pCorProfilerInfo(_pCorProfilerInfo),
     _lastStackWalkErrorCode{0},
     _stackWalkFinished{false},
-    _errorStatistics{}
+    _errorStatistics{},
+    _batchSlots{nullptr},
+    _batchSize{0},
+    _batchGeneration{0},
+    _pendingBatchSlotsCount{0},
+    _areCpuTimersInitialized{false},
+    _cpuTimerSlots{nullptr},
+    _cpuTimerSamples{nullptr},
+    _nextCpuTimerSample{0}
 {
     _pCorProfilerInfo->AddRef();
     InitializeSignalHandler();
 }
 LinuxStackFramesCollector::~LinuxStackFramesCollector()
 {
+    if (_cpuTimerSlots != nullptr)
+    {
+        std::unique_lock<std::mutex> lock(_cpuTimersLock);
+
+        // pending signals will be ignored
+        auto* pThis = this;
+        s_pCpuTimerInstance.compare_exchange_strong(pThis, nullptr, std::memory_order_release);
+        for (std::int32_t i = 0; i < MaxCpuTimerThreadsCount; i++)
+        {
+            if (_cpuTimerSlots[i].ThreadInfo != nullptr)
+            {
+                DeleteCpuTimer(i);
+            }
+        }
+
+        for (std::size_t i = 0; i < MaxCpuTimerSamplesCount; i++)
+        {
+            auto& sample = _cpuTimerSamples[i];
+            if (sample.ThreadInfo != nullptr)
+            {
+                sample.ThreadInfo->Release();
+                sample.ThreadInfo = nullptr;
+            }
+        }
+    }
+
     _pCorProfilerInfo->Release();
     _errorStatistics.Log();
     // !! @ToDo: We must uninstall the signal handler!!
@@ -98,7 +144,7 @@ StackSnapshotResultBuffer* LinuxStackFramesCollector::CollectStackSampleImplemen
 
     if (selfCollect)
     {
-        errorCode = CollectCallStackCurrentThread();
+        errorCode = CollectCallStackCurrentThread(GetReusableStackSnapshotResult(), _pCurrentCollectionThreadInfo);
     }
     else
     {
@@ -172,6 +218,610 @@ StackSnapshotResultBuffer* LinuxStackFramesCollector::CollectStackSampleImplemen
     return GetStackSnapshotResult();
 }
 
+bool LinuxStackFramesCollector::IsBatchCollectionSupported() const
+{
+    return s_isSignalHandlerSetup;
+}
+
+std::size_t LinuxStackFramesCollector::GetMaxBatchSize() const
+{
+    return MaxBatchSize;
+}
+
+std::size_t LinuxStackFramesCollector::CollectStackSamplesImplementation(ManagedThreadInfo* const* ppThreadInfos,
+                                                                         std::size_t threadsCount,
+                                                                         StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                                         uint32_t* pHRs)
+{
+    if (!s_isSignalHandlerSetup)
+    {
+        Log::Debug("LinuxStackFramesCollector::CollectStackSamplesImplementation: Signal handler not set up. Cannot collect callstacks."
+                   " (Earlier log entry may contain additinal details.)");
+        return 0;
+    }
+
+    // The slots are allocated the first time a batch is collected: no need to pay for them if batch mode is not used.
+    // They are reused for each batch because we cannot allocate memory while walking a stack from a signal handler.
+    if (_batchSlots == nullptr)
+    {
+        _batchSlots = std::make_unique<BatchSlot[]>(MaxBatchSize);
+        for (std::size_t i = 0; i < MaxBatchSize; i++)
+        {
+            _batchSlots[i].Buffer = std::make_unique<StackSnapshotResultReusableBuffer>();
+        }
+    }
+
+    _batchSize = (std::min)(threadsCount, MaxBatchSize);
+    if (_batchSize == 0)
+    {
+        return 0;
+    }
+
+    const auto processId = static_cast<::pid_t>(OpSysTools::GetProcId());
+    const auto pendingState = MakeBatchSlotState(++_batchGeneration, BatchSlotState::Pending);
+
+    for (std::size_t i = 0; i < _batchSize; i++)
+    {
+        auto& slot = _batchSlots[i];
+        slot.Buffer->Reset();
+        slot.ErrorCode = 0;
+        slot.ThreadInfo = ppThreadInfos[i];
+        slot.OsThreadId.store(static_cast<::pid_t>(ppThreadInfos[i]->GetOsThreadId()), std::memory_order_relaxed);
+        slot.State.store(pendingState, std::memory_order_release);
+    }
+    _pendingBatchSlotsCount.store(static_cast<std::int32_t>(_batchSize), std::memory_order_relaxed);
+
+    // publish the slots before the first signal is sent
+    s_pInstanceCurrentlyBatchWalking.store(this, std::memory_order_release);
+    auto scopeFinalizer = CreateScopeFinalizer(
+        [] {
+            s_pInstanceCurrentlyBatchWalking.store(nullptr, std::memory_order_release);
+        });
+
+    for (std::size_t i = 0; i < _batchSize; i++)
+    {
+        auto& slot = _batchSlots[i];
+        auto osThreadId = slot.OsThreadId.load(std::memory_order_relaxed);
+        if (syscall(SYS_tgkill, processId, osThreadId, s_signalToSend) == -1)
+        {
+            Log::Warn("LinuxStackFramesCollector::CollectStackSamplesImplementation:"
+                      " Unable to send signal to thread with osThreadId=",
+                      osThreadId, ". Error code: ",
+                      strerror(errno));
+
+            auto expected = pendingState;
+            if (slot.State.compare_exchange_strong(expected, MakeBatchSlotState(_batchGeneration, BatchSlotState::Abandoned)))
+            {
+                CompleteBatchSlot(slot, E_ABORT);
+            }
+        }
+    }
+
+    WaitForBatchCompletion(processId);
+
+    for (std::size_t i = 0; i < _batchSize; i++)
+    {
+        auto& slot = _batchSlots[i];
+
+        // errorCode domain values
+        // * < 0 : libunwind error codes
+        // * > 0 : other errors (ex: failed to create frame while walking the stack)
+        // * == 0 : success
+        if (slot.ErrorCode < 0)
+        {
+            UpdateErrorStats(slot.ErrorCode);
+        }
+
+        pHRs[i] = (slot.ErrorCode == 0) ? S_OK : E_FAIL;
+        ppStackSnapshotResults[i] = slot.Buffer.get();
+        slot.ThreadInfo = nullptr;
+    }
+
+    return _batchSize;
+}
+
+void LinuxStackFramesCollector::WaitForBatchCompletion(::pid_t processId)
+{
+    const auto deadline = std::chrono::steady_clock::now() + BatchCollectionTimeout;
+    std::chrono::steady_clock::time_point abortDeadline;
+    bool isAborted = false;
+
+    std::int32_t pendingCount;
+    while ((pendingCount = _pendingBatchSlotsCount.load(std::memory_order_acquire)) > 0)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (!isAborted && (IsCurrentCollectionAbortRequested() || now >= deadline))
+        {
+            // Some threads did not handle the signal in time (signal blocked, thread stuck in the kernel...):
+            // the ones walking their stack stop at the next frame and the others are marked as failed.
+            Log::Debug("LinuxStackFramesCollector::WaitForBatchCompletion: aborting the batch with ", pendingCount, " thread(s) not done yet.");
+            isAborted = true;
+            abortDeadline = now + BatchCollectionAbortTimeout;
+            RequestAbortCurrentCollection();
+            AbandonBatchSlots(processId, false, false);
+            continue;
+        }
+
+        if (isAborted && now >= abortDeadline)
+        {
+            // The handlers still walking did not reach the next frame (stuck in libunwind, thread stopped...):
+            // give up on them too instead of blocking the sampler thread.
+            Log::Debug("LinuxStackFramesCollector::WaitForBatchCompletion: giving up on ", pendingCount, " thread(s) still walking their stack.");
+            AbandonBatchSlots(processId, false, true);
+            continue;
+        }
+
+        struct timespec timeout = {0, BatchCollectionWaitTimeout.count()};
+        auto result = syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&_pendingBatchSlotsCount), FUTEX_WAIT_PRIVATE, pendingCount, &timeout, nullptr, 0);
+        if (result == -1 && errno == ETIMEDOUT)
+        {
+            // When the application ends and the CLR shuts down, it might happen that
+            // some of the signaled threads get terminated without noticing us.
+            // Give up on the slots of these threads without waiting for the deadline.
+            AbandonBatchSlots(processId, true, true);
+        }
+    }
+}
+
+void LinuxStackFramesCollector::AbandonBatchSlots(::pid_t processId, bool deadThreadsOnly, bool includeInProgress)
+{
+    const auto pendingState = MakeBatchSlotState(_batchGeneration, BatchSlotState::Pending);
+    const auto inProgressState = MakeBatchSlotState(_batchGeneration, BatchSlotState::InProgress);
+    const auto abandonedState = MakeBatchSlotState(_batchGeneration, BatchSlotState::Abandoned);
+
+    for (std::size_t i = 0; i < _batchSize; i++)
+    {
+        auto& slot = _batchSlots[i];
+        if (deadThreadsOnly && IsThreadAlive(processId, slot.OsThreadId.load(std::memory_order_relaxed)))
+        {
+            continue;
+        }
+
+        auto expected = pendingState;
+        if (slot.State.compare_exchange_strong(expected, abandonedState))
+        {
+            CompleteBatchSlot(slot, E_ABORT);
+            continue;
+        }
+
+        if (includeInProgress && expected == inProgressState && slot.State.compare_exchange_strong(expected, abandonedState))
+        {
+            // the late handler keeps its buffer: the slot gets a new one for the next batches
+            _abandonedBatchBuffers.push_back(std::move(slot.Buffer));
+            slot.Buffer = std::make_unique<StackSnapshotResultReusableBuffer>();
+            CompleteBatchSlot(slot, E_ABORT);
+        }
+    }
+}
+
+void LinuxStackFramesCollector::CompleteBatchSlot(BatchSlot& slot, std::int32_t errorCode)
+{
+    // /!\ called from a signal handler: only async-signal-safe operations
+    // (the caller moved the slot to its final state: the error code is read once the counter reaches 0)
+    slot.ErrorCode = errorCode;
+
+    if (_pendingBatchSlotsCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&_pendingBatchSlotsCount), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+}
+
+void LinuxStackFramesCollector::CollectBatchSlotForCurrentThread()
+{
+    const auto currentThreadId = static_cast<::pid_t>(syscall(SYS_gettid));
+
+    for (std::size_t i = 0; i < _batchSize; i++)
+    {
+        auto& slot = _batchSlots[i];
+        if (slot.OsThreadId.load(std::memory_order_relaxed) != currentThreadId)
+        {
+            continue;
+        }
+
+        auto state = slot.State.load(std::memory_order_acquire);
+        if (GetBatchSlotState(state) != BatchSlotState::Pending)
+        {
+            return;
+        }
+
+        // read before taking the slot: the sampler thread only replaces the buffer of an abandoned in-progress slot
+        auto* pBuffer = slot.Buffer.get();
+        auto* pThreadInfo = slot.ThreadInfo;
+
+        // The sampler thread may have given up on this slot
+        const auto generation = static_cast<std::uint32_t>(state >> 32);
+        auto inProgressState = MakeBatchSlotState(generation, BatchSlotState::InProgress);
+        if (!slot.State.compare_exchange_strong(state, inProgressState))
+        {
+            return;
+        }
+
+        std::int32_t resultErrorCode = CollectCallStackCurrentThread(pBuffer, pThreadInfo);
+
+        // The sampler thread may have given up on this slot while the stack was walked
+        if (!slot.State.compare_exchange_strong(inProgressState, MakeBatchSlotState(generation, BatchSlotState::Done)))
+        {
+            return;
+        }
+
+        CompleteBatchSlot(slot, resultErrorCode);
+        return;
+    }
+}
+
+bool LinuxStackFramesCollector::IsCpuTimerSupported()
+{
+    std::unique_lock<std::mutex> lock(_cpuTimersLock);
+
+    return InitializeCpuTimers();
+}
+
+std::size_t LinuxStackFramesCollector::GetMaxCpuTimerSamplesCount() const
+{
+    return MaxCpuTimerSamplesCount;
+}
+
+bool LinuxStackFramesCollector::InitializeCpuTimers()
+{
+    // This method must only be called while _cpuTimersLock is held!
+
+    if (_areCpuTimersInitialized)
+    {
+        return (_cpuTimerSlots != nullptr) && (s_cpuTimerSignal != -1);
+    }
+    _areCpuTimersInitialized = true;
+
+    // check that a timer can be created on the CPU clock of a thread
+    // (without signal: it is deleted before being armed)
+    struct sigevent probeEvent = {};
+    probeEvent.sigev_notify = SIGEV_NONE;
+    timer_t probeTimerId;
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &probeEvent, &probeTimerId) != 0)
+    {
+        Log::Info("LinuxStackFramesCollector::InitializeCpuTimers: Unable to create a thread CPU timer: CPU timers are disabled. Error code: ", strerror(errno));
+        return false;
+    }
+    timer_delete(probeTimerId);
+
+    // We cannot allocate memory from a signal handler: slots and samples buffers are allocated once
+    _cpuTimerSlots = std::make_unique<CpuTimerSlot[]>(MaxCpuTimerThreadsCount);
+    _freeCpuTimerSlots.reserve(MaxCpuTimerThreadsCount);
+    for (std::int32_t i = MaxCpuTimerThreadsCount - 1; i >= 0; i--)
+    {
+        _cpuTimerSlots[i].State.store(CpuTimerSlotState::Free, std::memory_order_relaxed);
+        _cpuTimerSlots[i].OsThreadId = 0;
+        _cpuTimerSlots[i].ThreadInfo = nullptr;
+        _freeCpuTimerSlots.push_back(i);
+    }
+
+    _cpuTimerSamples = std::make_unique<CpuTimerSample[]>(MaxCpuTimerSamplesCount);
+    for (std::size_t i = 0; i < MaxCpuTimerSamplesCount; i++)
+    {
+        auto& sample = _cpuTimerSamples[i];
+        sample.ThreadInfo = nullptr;
+        sample.CpuTime = 0;
+        sample.Buffer = std::make_unique<StackSnapshotResultReusableBuffer>();
+        sample.Buffer->Reset();
+        sample.State.store(CpuTimerSampleState::Free, std::memory_order_relaxed);
+    }
+
+    s_pCpuTimerInstance.store(this, std::memory_order_release);
+
+    // the signal handler is installed once for all the instances (only the last one receives the samples)
+    std::unique_lock<std::mutex> signalHandlerLock{s_signalHandlerInitLock};
+    if (s_cpuTimerSignal != -1)
+    {
+        return true;
+    }
+
+    // SIGPROF is not used by the CLR.
+    // SA_RESTART: the signal must not make the syscalls of the application fail with EINTR
+    struct sigaction timerAction;
+    timerAction.sa_flags = SA_SIGINFO | SA_RESTART;
+    timerAction.sa_sigaction = LinuxStackFramesCollector::CpuTimerSignalHandler;
+    sigemptyset(&timerAction.sa_mask);
+    if (s_signalToSend != -1)
+    {
+        // don't walk the stack for the wall time while it is walked for the CPU
+        sigaddset(&timerAction.sa_mask, s_signalToSend);
+    }
+
+    if (!TrySetHandlerForSignal(SIGPROF, timerAction))
+    {
+        Log::Error("LinuxStackFramesCollector::InitializeCpuTimers: Failed to setup signal handler for SIGPROF signal: CPU timers are disabled.");
+        return false;
+    }
+
+    // and don't walk the stack for the CPU while it is walked for the wall time:
+    // both handlers would use libunwind and the collector state at the same time on the same thread
+    // (the timers are created only once the wall time handler masks SIGPROF)
+    if (s_signalToSend != -1)
+    {
+        struct sigaction sampleAction;
+        bool isMasked = (sigaction(s_signalToSend, nullptr, &sampleAction) == 0);
+        if (isMasked)
+        {
+            sigaddset(&sampleAction.sa_mask, SIGPROF);
+            isMasked = (sigaction(s_signalToSend, &sampleAction, nullptr) == 0);
+        }
+
+        if (!isMasked)
+        {
+            Log::Error("LinuxStackFramesCollector::InitializeCpuTimers: Unable to mask SIGPROF in the handler of signal ", s_signalToSend, ": CPU timers are disabled. Reason: ", strerror(errno), ".");
+            return false;
+        }
+    }
+
+    s_cpuTimerSignal = SIGPROF;
+    Log::Info("LinuxStackFramesCollector::InitializeCpuTimers: Successfully setup signal handler for SIGPROF signal.");
+    return true;
+}
+
+bool LinuxStackFramesCollector::StartCpuTimer(ManagedThreadInfo* pThreadInfo, std::chrono::milliseconds interval)
+{
+    std::unique_lock<std::mutex> lock(_cpuTimersLock);
+
+    if (!InitializeCpuTimers())
+    {
+        return false;
+    }
+
+    // the managed thread might have been moved to another OS thread
+    if (pThreadInfo->GetCpuTimerSlot() != -1)
+    {
+        DeleteCpuTimer(pThreadInfo->GetCpuTimerSlot());
+    }
+
+    if (_freeCpuTimerSlots.empty())
+    {
+        static bool isLogged = false;
+        if (!isLogged)
+        {
+            isLogged = true;
+            Log::Warn("LinuxStackFramesCollector::StartCpuTimer: no more than ", MaxCpuTimerThreadsCount, " threads can be profiled with CPU timers.");
+        }
+        return false;
+    }
+
+    auto cpuClockId = pThreadInfo->GetCpuClockId();
+    if (cpuClockId == ManagedThreadInfo::InvalidCpuClockId)
+    {
+        return false;
+    }
+
+    auto slotIndex = _freeCpuTimerSlots.back();
+    auto& slot = _cpuTimerSlots[slotIndex];
+
+    auto osThreadId = static_cast<::pid_t>(pThreadInfo->GetOsThreadId());
+    slot.OsThreadId = osThreadId;
+    slot.CpuClockId = cpuClockId;
+
+    struct timespec cpuTime;
+    if (clock_gettime(slot.CpuClockId, &cpuTime) != 0)
+    {
+        // the thread is already dead
+        return false;
+    }
+    slot.LastCpuTime = static_cast<std::uint64_t>(cpuTime.tv_sec) * 1000000000 + cpuTime.tv_nsec;
+
+    struct sigevent timerEvent = {};
+    timerEvent.sigev_notify = SIGEV_THREAD_ID;
+    timerEvent.sigev_signo = s_cpuTimerSignal;
+    timerEvent.sigev_value.sival_int = slotIndex;
+    timerEvent.sigev_notify_thread_id = osThreadId;
+    if (timer_create(slot.CpuClockId, &timerEvent, &slot.TimerId) != 0)
+    {
+        Log::Debug("LinuxStackFramesCollector::StartCpuTimer: Unable to create the CPU timer of thread with osThreadId=", osThreadId, ". Error code: ", strerror(errno));
+        return false;
+    }
+
+    auto intervalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+    struct itimerspec timerSpec;
+    timerSpec.it_interval.tv_sec = intervalNs / 1000000000;
+    timerSpec.it_interval.tv_nsec = intervalNs % 1000000000;
+    timerSpec.it_value = timerSpec.it_interval;
+
+    // the slot must be ready before the first signal
+    slot.ThreadInfo = pThreadInfo;
+    pThreadInfo->AddRef();
+    pThreadInfo->SetCpuTimerSlot(slotIndex);
+    _freeCpuTimerSlots.pop_back();
+    slot.State.store(CpuTimerSlotState::Armed, std::memory_order_release);
+
+    if (timer_settime(slot.TimerId, 0, &timerSpec, nullptr) != 0)
+    {
+        Log::Debug("LinuxStackFramesCollector::StartCpuTimer: Unable to start the CPU timer of thread with osThreadId=", osThreadId, ". Error code: ", strerror(errno));
+        DeleteCpuTimer(slotIndex);
+        return false;
+    }
+
+    return true;
+}
+
+void LinuxStackFramesCollector::StopCpuTimer(ManagedThreadInfo* pThreadInfo)
+{
+    std::unique_lock<std::mutex> lock(_cpuTimersLock);
+
+    auto slotIndex = pThreadInfo->GetCpuTimerSlot();
+    if (slotIndex == -1)
+    {
+        return;
+    }
+
+    DeleteCpuTimer(slotIndex);
+}
+
+void LinuxStackFramesCollector::DeleteCpuTimer(std::int32_t slotIndex)
+{
+    // This method must only be called while _cpuTimersLock is held!
+
+    auto& slot = _cpuTimerSlots[slotIndex];
+
+    // wait for the signal handler to finish if it is walking the stack
+    // (it cannot be the current thread: the handler would have finished before returning here)
+    auto expected = CpuTimerSlotState::Armed;
+    while (!slot.State.compare_exchange_weak(expected, CpuTimerSlotState::Stopping))
+    {
+        expected = CpuTimerSlotState::Armed;
+        std::this_thread::yield();
+    }
+
+    timer_delete(slot.TimerId);
+
+    // a signal sent before the timer was deleted could still be received: it will be ignored
+    // because the slot is not armed anymore (or is armed for another thread)
+    slot.OsThreadId = 0;
+    slot.ThreadInfo->SetCpuTimerSlot(-1);
+    slot.ThreadInfo->Release();
+    slot.ThreadInfo = nullptr;
+
+    slot.State.store(CpuTimerSlotState::Free, std::memory_order_release);
+    _freeCpuTimerSlots.push_back(slotIndex);
+}
+
+std::size_t LinuxStackFramesCollector::GetCpuTimerSamples(ManagedThreadInfo** ppThreadInfos,
+                                                          StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                          std::uint64_t* pCpuTimes,
+                                                          std::size_t maxSamplesCount)
+{
+    if (_cpuTimerSamples == nullptr)
+    {
+        return 0;
+    }
+
+    std::size_t samplesCount = 0;
+    for (std::size_t i = 0; (i < MaxCpuTimerSamplesCount) && (samplesCount < maxSamplesCount); i++)
+    {
+        auto& sample = _cpuTimerSamples[i];
+        auto expected = CpuTimerSampleState::Ready;
+        if (!sample.State.compare_exchange_strong(expected, CpuTimerSampleState::Reading, std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        ppThreadInfos[samplesCount] = sample.ThreadInfo;
+        ppStackSnapshotResults[samplesCount] = sample.Buffer.get();
+        pCpuTimes[samplesCount] = sample.CpuTime;
+        samplesCount++;
+    }
+
+    return samplesCount;
+}
+
+void LinuxStackFramesCollector::ReleaseCpuTimerSamples()
+{
+    if (_cpuTimerSamples == nullptr)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < MaxCpuTimerSamplesCount; i++)
+    {
+        auto& sample = _cpuTimerSamples[i];
+        if (sample.State.load(std::memory_order_relaxed) != CpuTimerSampleState::Reading)
+        {
+            continue;
+        }
+
+        sample.ThreadInfo->Release();
+        sample.ThreadInfo = nullptr;
+        sample.Buffer->Reset();
+        sample.State.store(CpuTimerSampleState::Free, std::memory_order_release);
+    }
+}
+
+LinuxStackFramesCollector::CpuTimerSample* LinuxStackFramesCollector::TryAcquireCpuTimerSample()
+{
+    // /!\ called from a signal handler: only async-signal-safe operations
+
+    // start at a different position for each sample to limit the contention between threads
+    auto start = _nextCpuTimerSample.fetch_add(1, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < MaxCpuTimerSamplesCount; i++)
+    {
+        auto& sample = _cpuTimerSamples[(start + i) % MaxCpuTimerSamplesCount];
+        auto expected = CpuTimerSampleState::Free;
+        if (sample.State.compare_exchange_strong(expected, CpuTimerSampleState::Writing, std::memory_order_acquire))
+        {
+            return &sample;
+        }
+    }
+
+    return nullptr;
+}
+
+void LinuxStackFramesCollector::CollectCpuTimerSampleForCurrentThread(std::int32_t slotIndex)
+{
+    // /!\ called from a signal handler: only async-signal-safe operations
+
+    if ((slotIndex < 0) || (slotIndex >= MaxCpuTimerThreadsCount))
+    {
+        return;
+    }
+
+    // the timer might be being deleted
+    auto& slot = _cpuTimerSlots[slotIndex];
+    auto expected = CpuTimerSlotState::Armed;
+    if (!slot.State.compare_exchange_strong(expected, CpuTimerSlotState::Sampling, std::memory_order_acquire))
+    {
+        return;
+    }
+    auto slotFinalizer = CreateScopeFinalizer(
+        [&slot] {
+            slot.State.store(CpuTimerSlotState::Armed, std::memory_order_release);
+        });
+
+    // the signal might have been sent by the deleted timer of another thread
+    if (slot.OsThreadId != static_cast<::pid_t>(syscall(SYS_gettid)))
+    {
+        return;
+    }
+
+    struct timespec cpuTime;
+    if (clock_gettime(slot.CpuClockId, &cpuTime) != 0)
+    {
+        return;
+    }
+    auto currentCpuTime = static_cast<std::uint64_t>(cpuTime.tv_sec) * 1000000000 + cpuTime.tv_nsec;
+
+    // if no buffer is available, the CPU consumed since the last sample will be part of the next one
+    auto* pSample = TryAcquireCpuTimerSample();
+    if (pSample == nullptr)
+    {
+        return;
+    }
+
+    // the walk is aborted if a wall time collection is cancelled at the same time
+    std::int32_t resultErrorCode = CollectCallStackCurrentThread(pSample->Buffer.get(), slot.ThreadInfo);
+    if ((resultErrorCode == E_ABORT) || (pSample->Buffer->GetFramesCount() == 0))
+    {
+        pSample->Buffer->Reset();
+        pSample->State.store(CpuTimerSampleState::Free, std::memory_order_release);
+        return;
+    }
+
+    pSample->CpuTime = currentCpuTime - slot.LastCpuTime;
+    slot.LastCpuTime = currentCpuTime;
+
+    // the slot might be freed before the sample is read by the sampler thread
+    slot.ThreadInfo->AddRef();
+    pSample->ThreadInfo = slot.ThreadInfo;
+    pSample->State.store(CpuTimerSampleState::Ready, std::memory_order_release);
+}
+
+void LinuxStackFramesCollector::CpuTimerSignalHandler(int32_t signal, siginfo_t* pInfo, void* pContext)
+{
+    // the application might check errno after the interrupted code
+    auto savedErrno = errno;
+
+    LinuxStackFramesCollector* pCollector = s_pCpuTimerInstance.load(std::memory_order_acquire);
+    if ((pCollector != nullptr) && (pInfo != nullptr) && (pInfo->si_code == SI_TIMER))
+    {
+        pCollector->CollectCpuTimerSampleForCurrentThread(pInfo->si_value.sival_int);
+    }
+
+    errno = savedErrno;
+}
+
 void LinuxStackFramesCollector::NotifyStackWalkCompleted(std::int32_t resultErrorCode)
 {
     _lastStackWalkErrorCode = resultErrorCode;
@@ -290,7 +940,7 @@ char const* LinuxStackFramesCollector::ErrorCodeToString(int32_t errorCode)
     }
 }
 
-std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
+std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread(StackSnapshotResultReusableBuffer* pStackSnapshotResult, ManagedThreadInfo* pThreadInfo)
 {
     try
     {
@@ -298,7 +948,7 @@ std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
 
         {
             // Collect data for TraceContext tracking:
-            bool traceContextDataCollected = TryApplyTraceContextDataFromCurrentCollectionThreadToSnapshot();
+            bool traceContextDataCollected = TryApplyTraceContextDataToSnapshot(pThreadInfo, pStackSnapshotResult);
 
             // Now walk the stack:
 
@@ -311,7 +961,7 @@ std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
             // After every lib call that touches non-local state, check if the StackSamplerLoopManager requested this walk to abort:
             if (IsCurrentCollectionAbortRequested())
             {
-                AddFakeFrame();
+                pStackSnapshotResult->AddFakeFrame();
                 return E_ABORT;
             }
 
@@ -322,7 +972,7 @@ std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
                 // After every lib call that touches non-local state, check if the StackSamplerLoopManager requested this walk to abort:
                 if (IsCurrentCollectionAbortRequested())
                 {
-                    AddFakeFrame();
+                    pStackSnapshotResult->AddFakeFrame();
                     return E_ABORT;
                 }
 
@@ -333,7 +983,7 @@ std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
                     return resultErrorCode;
                 }
 
-                if (!AddFrame(nativeInstructionPointer))
+                if (!pStackSnapshotResult->AddFrame(nativeInstructionPointer))
                 {
                     return S_FALSE;
                 }
@@ -351,10 +1001,27 @@ std::int32_t LinuxStackFramesCollector::CollectCallStackCurrentThread()
 
 void LinuxStackFramesCollector::CollectStackSampleSignalHandler(int32_t signal)
 {
+    // In batch mode, each signaled thread walks its own callstack into its pre-assigned slot
+    // without synchronizing with the other threads of the batch.
+    LinuxStackFramesCollector* pCollectorInstanceCurrentlyBatchWalking = s_pInstanceCurrentlyBatchWalking.load(std::memory_order_acquire);
+    if (pCollectorInstanceCurrentlyBatchWalking != nullptr)
+    {
+        pCollectorInstanceCurrentlyBatchWalking->CollectBatchSlotForCurrentThread();
+        return;
+    }
+
     std::unique_lock<std::mutex> stackWalkInProgressLock(s_stackWalkInProgressMutex);
     LinuxStackFramesCollector* pCollectorInstanceCurrentlyStackWalking = s_pInstanceCurrentlyStackWalking;
 
-    std::int32_t resultErrorCode = pCollectorInstanceCurrentlyStackWalking->CollectCallStackCurrentThread();
+    // The signal was received after the sampler thread gave up on this thread (batch deadline)
+    if (pCollectorInstanceCurrentlyStackWalking == nullptr)
+    {
+        return;
+    }
+
+    std::int32_t resultErrorCode = pCollectorInstanceCurrentlyStackWalking->CollectCallStackCurrentThread(
+        pCollectorInstanceCurrentlyStackWalking->GetReusableStackSnapshotResult(),
+        pCollectorInstanceCurrentlyStackWalking->_pCurrentCollectionThreadInfo);
     stackWalkInProgressLock.unlock();
     pCollectorInstanceCurrentlyStackWalking->NotifyStackWalkCompleted(resultErrorCode);
 }
@@ -11,11 +11,14 @@
 #include "StackFramesCollectorBase.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <signal.h>
+#include <time.h>
 #include <unordered_map>
+#include <vector>
 
 class IManagedThreadList;
 
@@ -38,6 +41,111 @@ protected:
                                                                 uint32_t* pHR,
                                                                 bool selfCollect) override;
 
+    // In batch mode, the signal is sent to all threads of the batch at once.
+    // Each signal handler walks its own callstack into a pre-assigned slot and
+    // decrements a shared atomic counter; the last one wakes up the sampler thread (futex).
+    std::size_t CollectStackSamplesImplementation(ManagedThreadInfo* const* ppThreadInfos,
+                                                  std::size_t threadsCount,
+                                                  StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                  uint32_t* pHRs) override;
+
+public:
+    bool IsBatchCollectionSupported() const override;
+    std::size_t GetMaxBatchSize() const override;
+
+    // In CPU timer mode, a POSIX timer based on the CPU clock of each thread sends a signal to the thread
+    // each time it has consumed the given amount of CPU. The signal handler walks the callstack into
+    // a free buffer of a pool shared by all threads (the memory does not depend on the threads count).
+    // If no buffer is available, the sample is skipped and its CPU time is added to the next one.
+    // CPU timers are not supported if the signal handler cannot be installed or if the kernel does not
+    // provide per-thread CPU timers. A thread is not sampled by a timer (and must be polled) if its
+    // timer cannot be created or if MaxCpuTimerThreadsCount threads already have one.
+    bool IsCpuTimerSupported() override;
+    std::size_t GetMaxCpuTimerSamplesCount() const override;
+    bool StartCpuTimer(ManagedThreadInfo* pThreadInfo, std::chrono::milliseconds interval) override;
+    void StopCpuTimer(ManagedThreadInfo* pThreadInfo) override;
+    std::size_t GetCpuTimerSamples(ManagedThreadInfo** ppThreadInfos,
+                                   StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                   std::uint64_t* pCpuTimes,
+                                   std::size_t maxSamplesCount) override;
+    void ReleaseCpuTimerSamples() override;
+
+private:
+    static constexpr std::size_t MaxBatchSize = 32;
+    // The threads that did not walk their stack after this delay are marked as failed
+    static constexpr std::chrono::milliseconds BatchCollectionTimeout = std::chrono::milliseconds(1000);
+    // The threads still walking their stack this long after the abort are marked as failed
+    static constexpr std::chrono::milliseconds BatchCollectionAbortTimeout = std::chrono::milliseconds(500);
+    static constexpr std::chrono::nanoseconds BatchCollectionWaitTimeout = std::chrono::milliseconds(100);
+
+    enum class BatchSlotState : std::uint32_t
+    {
+        Pending,    // the signal has been (or will be) sent to the thread
+        InProgress, // the signal handler is walking the stack
+        Done,       // the signal handler has finished
+        Abandoned   // the sampler thread gave up (the thread died, could not be signaled or is stuck in its walk)
+    };
+
+    struct BatchSlot
+    {
+        std::atomic<::pid_t> OsThreadId;
+        // batch generation (high 32 bits) and BatchSlotState (low 32 bits): a handler that finishes
+        // after its slot was abandoned (and possibly reused by the next batch) fails to complete it
+        std::atomic<std::uint64_t> State;
+        std::int32_t ErrorCode;
+        ManagedThreadInfo* ThreadInfo;
+        std::unique_ptr<StackSnapshotResultReusableBuffer> Buffer;
+    };
+
+    static std::uint64_t MakeBatchSlotState(std::uint32_t generation, BatchSlotState state)
+    {
+        return (static_cast<std::uint64_t>(generation) << 32) | static_cast<std::uint32_t>(state);
+    }
+
+    static BatchSlotState GetBatchSlotState(std::uint64_t state)
+    {
+        return static_cast<BatchSlotState>(static_cast<std::uint32_t>(state));
+    }
+
+    static constexpr std::int32_t MaxCpuTimerThreadsCount = 4096;
+    static constexpr std::size_t MaxCpuTimerSamplesCount = 64;
+
+    enum class CpuTimerSlotState : std::int32_t
+    {
+        Free,     // no timer
+        Armed,    // the timer of the thread is running
+        Sampling, // the signal handler is walking the stack
+        Stopping  // the timer is being deleted
+    };
+
+    // The index of the slot is given to the timer and received by the signal handler
+    struct CpuTimerSlot
+    {
+        std::atomic<CpuTimerSlotState> State;
+        ::pid_t OsThreadId;
+        ManagedThreadInfo* ThreadInfo;
+        timer_t TimerId;
+        clockid_t CpuClockId;
+        // CPU consumed by the thread when its last sample was taken (only updated by the signal handler)
+        std::uint64_t LastCpuTime;
+    };
+
+    enum class CpuTimerSampleState : std::int32_t
+    {
+        Free,    // available for a signal handler
+        Writing, // a signal handler is walking the stack into the buffer
+        Ready,   // waiting for the sampler thread
+        Reading  // given to the sampler thread until ReleaseCpuTimerSamples is called
+    };
+
+    struct CpuTimerSample
+    {
+        std::atomic<CpuTimerSampleState> State;
+        ManagedThreadInfo* ThreadInfo;
+        std::uint64_t CpuTime;
+        std::unique_ptr<StackSnapshotResultReusableBuffer> Buffer;
+    };
+
 private:
     class ErrorStatistics
     {
@@ -70,6 +178,7 @@ private:
 private:
     static bool TrySetHandlerForSignal(int32_t signal, struct sigaction& action);
     static void CollectStackSampleSignalHandler(int32_t signal);
+    static void CpuTimerSignalHandler(int32_t signal, siginfo_t* pInfo, void* pContext);
 
     static char const* ErrorCodeToString(int32_t errorCode);
     static std::mutex s_stackWalkInProgressMutex;
@@ -78,8 +187,38 @@ private:
     static int32_t s_signalToSend;
 
     static LinuxStackFramesCollector* s_pInstanceCurrentlyStackWalking;
-
-    std::int32_t CollectCallStackCurrentThread();
+    static std::atomic<LinuxStackFramesCollector*> s_pInstanceCurrentlyBatchWalking;
+    static std::atomic<LinuxStackFramesCollector*> s_pCpuTimerInstance;
+    static int32_t s_cpuTimerSignal;
+
+    std::int32_t CollectCallStackCurrentThread(StackSnapshotResultReusableBuffer* pStackSnapshotResult, ManagedThreadInfo* pThreadInfo);
+
+    void CollectBatchSlotForCurrentThread();
+    void CompleteBatchSlot(BatchSlot& slot, std::int32_t errorCode);
+    void WaitForBatchCompletion(::pid_t processId);
+    void AbandonBatchSlots(::pid_t processId, bool deadThreadsOnly, bool includeInProgress);
+
+    std::unique_ptr<BatchSlot[]> _batchSlots;
+    std::size_t _batchSize;
+    std::uint32_t _batchGeneration;
+    // buffers of the slots abandoned while their handler was walking the stack: the handler may still write
+    // into them, so they are only freed with the collector
+    std::vector<std::unique_ptr<StackSnapshotResultReusableBuffer>> _abandonedBatchBuffers;
+    // Futex word: number of slots not yet in the Done or Abandoned state
+    std::atomic<std::int32_t> _pendingBatchSlotsCount;
 
     ErrorStatistics _errorStatistics;
+
+    bool InitializeCpuTimers();
+    void DeleteCpuTimer(std::int32_t slotIndex);
+    void CollectCpuTimerSampleForCurrentThread(std::int32_t slotIndex);
+    CpuTimerSample* TryAcquireCpuTimerSample();
+
+    // protect the slots allocation: only used when threads are created/destroyed
+    std::mutex _cpuTimersLock;
+    bool _areCpuTimersInitialized;
+    std::unique_ptr<CpuTimerSlot[]> _cpuTimerSlots;
+    std::vector<std::int32_t> _freeCpuTimerSlots;
+    std::unique_ptr<CpuTimerSample[]> _cpuTimerSamples;
+    std::atomic<std::uint32_t> _nextCpuTimerSample;
 };
@@ -3,8 +3,11 @@
 
 // OsSpecificApi for LINUX
 
-#include <fstream>
+#include <fcntl.h>
+#include <pthread.h>
 #include <string>
+#include <time.h>
+#include <unistd.h>
 
 #include <sys/syscall.h>
 #include "OsSpecificApi.h"
@@ -42,54 +45,110 @@ std::unique_ptr<StackFramesCollectorBase> CreateNewStackFramesCollectorInstance(
 // (15) Amount of time that this process has been scheduled in kernel mode, measured in clock ticks(divide by sysconf(_SC_CLK_TCK)).
 //      cutime %ld
 //
-// Another solution would be to use clock_gettime but without the Running status available
-//    pthread_getcpuclockid(pthread_self(), &clockid);
-//    if (clock_gettime(clockid, &cpu_time)) { ... }
+// The stat file of each thread is opened once and kept in the ManagedThreadInfo: pread() rereads it from the beginning.
+// The CPU time is read from the thread CPU clock with nanosecond precision (instead of clock ticks = 10 ms) and
+// the stat fields are used only if the clock is not available (it is retrieved by the thread itself when it is
+// assigned to the managed thread: pthread_getcpuclockid needs the pthread_t, not the tid).
 //
 static bool firstError = true;
+static const int64_t ClockTicksPerSecond = sysconf(_SC_CLK_TCK);
 
-bool GetCpuInfo(pid_t tid, bool& isRunning, uint64_t& cpuTime)
+bool GetCurrentThreadCpuClockId(clockid_t& cpuClockId)
 {
+    return pthread_getcpuclockid(pthread_self(), &cpuClockId) == 0;
+}
+
+static bool GetThreadCpuClockTime(ManagedThreadInfo* pThreadInfo, uint64_t& cpuTime)
+{
+    auto cpuClockId = pThreadInfo->GetCpuClockId();
+    if (cpuClockId == ManagedThreadInfo::InvalidCpuClockId)
+    {
+        return false;
+    }
+
+    struct timespec ts;
+    if (clock_gettime(cpuClockId, &ts) != 0)
+    {
+        return false;
+    }
+
+    cpuTime = static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    return true;
+}
+
+static int32_t GetProcStatFileDescriptor(ManagedThreadInfo* pThreadInfo)
+{
+    auto fd = pThreadInfo->GetProcStatFileDescriptor();
+    if (fd != -1)
+    {
+        return fd;
+    }
+
     char statPath[64];
-    snprintf(statPath, sizeof(statPath), "/proc/self/task/%d/stat", tid);
+    snprintf(statPath, sizeof(statPath), "/proc/self/task/%d/stat", static_cast<pid_t>(pThreadInfo->GetOsThreadId()));
+    fd = open(statPath, O_RDONLY | O_CLOEXEC);
+    if (fd != -1)
+    {
+        pThreadInfo->SetProcStatFileDescriptor(fd);
+    }
+
+    return fd;
+}
+
+bool GetCpuInfo(ManagedThreadInfo* pThreadInfo, bool& isRunning, uint64_t& cpuTime)
+{
+    auto fd = GetProcStatFileDescriptor(pThreadInfo);
+    if (fd == -1)
+    {
+        return false;
+    }
 
     // load the line to be able to parse it in memory
-    std::ifstream file;
-    file.open(statPath);
-    std::string sline;
-    std::getline(file, sline);
-    file.close();
-    if (sline.empty())
+    // (no allocation: the stat line of a thread is much smaller than 512 bytes)
+    char line[512];
+    auto length = pread(fd, line, sizeof(line) - 1, 0);
+    if (length <= 0)
     {
+        // the thread is dead
         return false;
     }
+    line[length] = '\0';
 
     char state = ' ';
     int32_t userTime = 0;
     int32_t kernelTime = 0;
-    bool success = OpSysTools::ParseThreadInfo(sline, state, userTime, kernelTime);
+    bool success = OpSysTools::ParseThreadInfo(line, static_cast<std::size_t>(length), state, userTime, kernelTime);
     if (!success)
     {
         // log the first error to be able to analyze unexpected string format
         if (firstError)
         {
             firstError = false;
-            Log::Error("Unexpected /proc/self/task/", tid, "/stat: ", sline);
+            Log::Error("Unexpected /proc/self/task/", pThreadInfo->GetOsThreadId(), "/stat: ", line);
         }
 
         return false;
     }
 
-    cpuTime = ((userTime + kernelTime) * 1000) / sysconf(_SC_CLK_TCK);
+    if (!GetThreadCpuClockTime(pThreadInfo, cpuTime))
+    {
+        cpuTime = ((static_cast<uint64_t>(userTime) + kernelTime) * 1000000000) / ClockTicksPerSecond;
+    }
+
     isRunning = (state == 'R') || (state == 'D') || (state == 'W');
     return true;
 }
 
 uint64_t GetThreadCpuTime(ManagedThreadInfo* pThreadInfo)
 {
-    bool isRunning = false;
     uint64_t cpuTime = 0;
-    if (!GetCpuInfo(pThreadInfo->GetOsThreadId(), isRunning, cpuTime))
+    if (GetThreadCpuClockTime(pThreadInfo, cpuTime))
+    {
+        return cpuTime;
+    }
+
+    bool isRunning = false;
+    if (!GetCpuInfo(pThreadInfo, isRunning, cpuTime))
     {
         return 0;
     }
@@ -100,7 +159,7 @@ uint64_t GetThreadCpuTime(ManagedThreadInfo* pThreadInfo)
 bool IsRunning(ManagedThreadInfo* pThreadInfo, uint64_t& cpuTime)
 {
     bool isRunning = false;
-    if (!GetCpuInfo(pThreadInfo->GetOsThreadId(), isRunning, cpuTime))
+    if (!GetCpuInfo(pThreadInfo, isRunning, cpuTime))
     {
         cpuTime = 0;
         return false;
@@ -36,7 +36,7 @@ uint64_t GetThreadCpuTime(ManagedThreadInfo* pThreadInfo)
     if (::GetThreadTimes(pThreadInfo->GetOsThreadHandle(), &creationTime, &exitTime, &kernelTime, &userTime))
     {
         uint64_t milliseconds = GetTotalMilliseconds(userTime) + GetTotalMilliseconds(kernelTime);
-        return milliseconds;
+        return milliseconds * 1000000;
     }
 
     return 0;
@@ -146,7 +146,7 @@ bool IsRunning(ManagedThreadInfo* pThreadInfo, uint64_t& cpuTime)
         return false;
     }
 
-    cpuTime = GetTotalMilliseconds(sti.UserTime) + GetTotalMilliseconds(sti.KernelTime);
+    cpuTime = (GetTotalMilliseconds(sti.UserTime) + GetTotalMilliseconds(sti.KernelTime)) * 1000000;
 
     return IsRunning(sti.ThreadState);
 }
@@ -78,11 +78,6 @@ AdaptiveSampler::AdaptiveSampler(
 
     _countsRef = &_countsSlots[0];
 
-    // Initialize RNG
-    std::random_device rd;
-    _rng = std::mt19937(rd());
-    _distribution = std::uniform_real_distribution<>(0.0, 1.0);
-
     if (windowDuration != std::chrono::milliseconds::zero())
     {
         _timer.Start();
@@ -119,8 +114,11 @@ bool AdaptiveSampler::Drop()
 
 double AdaptiveSampler::NextDouble()
 {
-    std::lock_guard lock(_rngMutex);
-    return _distribution(_rng);
+    // Sample() is called by application threads: each one has its own RNG to avoid contention
+    thread_local std::mt19937 rng(std::random_device{}());
+    thread_local std::uniform_real_distribution<> distribution(0.0, 1.0);
+
+    return distribution(rng);
 }
 
 double AdaptiveSampler::ComputeIntervalAlpha(int32_t lookback)
@@ -186,6 +184,11 @@ void AdaptiveSampler::RollWindow()
     }
 }
 
+double AdaptiveSampler::GetProbability() const
+{
+    return _probability;
+}
+
 AdaptiveSampler::State AdaptiveSampler::GetInternalState()
 {
     auto* counts = _countsRef.load();
@@ -41,6 +41,9 @@ public:
 
     void RollWindow();
 
+    // Probability for an event to be sampled in the current window
+    double GetProbability() const;
+
     // For tests
     State GetInternalState();
 
@@ -65,10 +68,6 @@ private:
     Timer _timer;
     std::function<void()> _rollWindowCallback;
 
-    std::mutex _rngMutex;
-    std::uniform_real_distribution<> _distribution;
-    std::mt19937 _rng;
-
     static double ComputeIntervalAlpha(int32_t lookback);
 
     double NextDouble();
@@ -0,0 +1,150 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "AllocationsProvider.h"
+
+#include <cstring>
+
+#include "HResultConverter.h"
+#include "Log.h"
+#include "OsSpecificApi.h"
+#include "shared/src/native-src/string.h"
+
+// allocations are sampled on the allocating thread: its stack frames collector is created for the first sample
+// and reused for the next ones (it is bound to the ICorProfilerInfo of the provider that created it)
+thread_local ICorProfilerInfo4* AllocationsStackFramesCollectorOwner = nullptr;
+thread_local std::unique_ptr<StackFramesCollectorBase> AllocationsStackFramesCollector;
+
+// AllocationTick payload, see https://github.com/dotnet/runtime/blob/main/src/coreclr/vm/ClrEtwAll.man
+//  AllocationAmount     uint32
+//  AllocationKind       uint32
+//  ClrInstanceID        uint16
+//  AllocationAmount64   uint64
+//  TypeID               pointer
+//  TypeName             null terminated UTF16 string
+//  HeapIndex            uint32
+//  Address              pointer      (v3+)
+//  ObjectSize           uint64       (v4+)
+constexpr ULONG TypeNameOffset = 4 + 4 + 2 + 8 + sizeof(void*);
+constexpr ULONG ObjectSizeOffsetAfterTypeName = 4 + sizeof(void*);
+
+AllocationsProvider::AllocationsProvider(
+    ICorProfilerInfo4* pCorProfilerInfo,
+    IManagedThreadList* pManagedThreadList,
+    IFrameStore* pFrameStore,
+    IThreadsCpuManager* pThreadsCpuManager,
+    IAppDomainStore* pAppDomainStore,
+    IRuntimeIdStore* pRuntimeIdStore)
+    :
+    CollectorBase<RawAllocationSample>("AllocationsProvider", pThreadsCpuManager, pFrameStore, pAppDomainStore, pRuntimeIdStore),
+    _pCorProfilerInfo(pCorProfilerInfo),
+    _pManagedThreadList(pManagedThreadList),
+    _loggedPayloadError(false)
+{
+}
+
+bool AllocationsProvider::OnEventPipeEvent(DWORD eventId, DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData)
+{
+    if (eventId != AllocationTickEventId)
+    {
+        return false;
+    }
+
+    return OnAllocationTick(eventVersion, cbEventData, eventData);
+}
+
+bool AllocationsProvider::OnAllocationTick(DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData)
+{
+    std::string typeName;
+    std::uint64_t objectSize;
+
+    if (!TryParseAllocationTick(eventVersion, cbEventData, eventData, typeName, objectSize))
+    {
+        if (!_loggedPayloadError)
+        {
+            _loggedPayloadError = true;
+            Log::Warn("Unexpected AllocationTick event (version ", eventVersion, ", ", cbEventData, " bytes)");
+        }
+        return false;
+    }
+
+    ManagedThreadInfo* threadInfo;
+    HRESULT hr = _pManagedThreadList->TryGetCurrentThreadInfo(&threadInfo);
+    if (FAILED(hr))
+    {
+        Log::Warn("Profiler call failed with result ", HResultConverter::ToStringWithCode(hr), ": TryGetCurrentThreadInfo");
+        return false;
+    }
+
+    // the allocating thread is not tracked by the profiler
+    if ((hr == S_FALSE) || (threadInfo == nullptr))
+    {
+        return false;
+    }
+
+    if ((AllocationsStackFramesCollector == nullptr) || (AllocationsStackFramesCollectorOwner != _pCorProfilerInfo))
+    {
+        AllocationsStackFramesCollector = OsSpecificApi::CreateNewStackFramesCollectorInstance(_pCorProfilerInfo);
+        AllocationsStackFramesCollectorOwner = _pCorProfilerInfo;
+    }
+
+    uint32_t hrCollectStack = E_FAIL;
+    const auto pStackFramesCollector = AllocationsStackFramesCollector.get();
+
+    pStackFramesCollector->PrepareForNextCollection();
+    const auto result = pStackFramesCollector->CollectStackSample(threadInfo, &hrCollectStack);
+
+    if (result->GetFramesCount() == 0)
+    {
+        Log::Debug("Failed to walk stack for sampled allocation: ", HResultConverter::ToStringWithCode(hrCollectStack));
+        return false;
+    }
+
+    result->DetermineAppDomain(threadInfo->GetClrThreadId(), _pCorProfilerInfo);
+
+    RawAllocationSample rawSample;
+
+    rawSample.Timestamp = result->GetUnixTimeUtc();
+    rawSample.LocalRootSpanId = result->GetLocalRootSpanId();
+    rawSample.SpanId = result->GetSpanId();
+    rawSample.AppDomainId = result->GetAppDomainId();
+    result->CopyInstructionPointers(rawSample.Stack);
+    rawSample.ThreadInfo = threadInfo;
+    threadInfo->AddRef();
+    rawSample.AllocationClass = std::move(typeName);
+    rawSample.AllocationSize = objectSize;
+    Add(std::move(rawSample));
+
+    return true;
+}
+
+bool AllocationsProvider::TryParseAllocationTick(DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData, std::string& typeName, std::uint64_t& objectSize)
+{
+    // the size of the allocated object was added in v4 (.NET 5)
+    if (eventVersion < 4 || eventData == nullptr || cbEventData < TypeNameOffset)
+    {
+        return false;
+    }
+
+    // the type name is the only variable length field
+    ULONG typeNameEnd = TypeNameOffset;
+    while (typeNameEnd + 1 < cbEventData && (eventData[typeNameEnd] != 0 || eventData[typeNameEnd + 1] != 0))
+    {
+        typeNameEnd += 2;
+    }
+
+    const ULONG objectSizeOffset = typeNameEnd + 2 + ObjectSizeOffsetAfterTypeName;
+    if (typeNameEnd + 1 >= cbEventData || objectSizeOffset + sizeof(objectSize) > cbEventData)
+    {
+        return false;
+    }
+
+    // the fields are not aligned in the payload
+    shared::WSTRING name((typeNameEnd - TypeNameOffset) / sizeof(WCHAR), WStr('\0'));
+    std::memcpy(name.data(), eventData + TypeNameOffset, typeNameEnd - TypeNameOffset);
+    typeName = shared::ToString(name);
+
+    std::memcpy(&objectSize, eventData + objectSizeOffset, sizeof(objectSize));
+
+    return true;
+}
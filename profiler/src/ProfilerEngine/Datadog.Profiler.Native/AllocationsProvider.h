@@ -0,0 +1,46 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+
+#include "CollectorBase.h"
+#include "IFrameStore.h"
+#include "IManagedThreadList.h"
+#include "RawAllocationSample.h"
+#include "cor.h"
+#include "corprof.h"
+
+class AllocationsProvider
+    : public CollectorBase<RawAllocationSample>
+{
+public:
+    // GC keyword and GCAllocationTick event of the Microsoft-Windows-DotNETRuntime provider
+    // AllocationTick is emitted at the verbose level
+    static constexpr inline ULONGLONG EventPipeKeyword = 0x1;
+    static constexpr inline COR_PRF_EVENTPIPE_LEVEL EventPipeLevel = COR_PRF_EVENTPIPE_VERBOSE;
+    static constexpr inline DWORD AllocationTickEventId = 10;
+
+public:
+    AllocationsProvider(
+        ICorProfilerInfo4* pCorProfilerInfo,
+        IManagedThreadList* pManagedThreadList,
+        IFrameStore* pFrameStore,
+        IThreadsCpuManager* pThreadsCpuManager,
+        IAppDomainStore* pAppDomainStore,
+        IRuntimeIdStore* pRuntimeIdStore);
+
+    // Called on the allocating thread by EventPipeEventDelivered for each event of the session:
+    // returns false if the event is not an AllocationTick or was not sampled
+    bool OnEventPipeEvent(DWORD eventId, DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData);
+
+    // Reads the type name and the size of the allocated object from a v4+ AllocationTick payload
+    static bool TryParseAllocationTick(DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData, std::string& typeName, std::uint64_t& objectSize);
+
+private:
+    bool OnAllocationTick(DWORD eventVersion, ULONG cbEventData, LPCBYTE eventData);
+
+private:
+    ICorProfilerInfo4* _pCorProfilerInfo;
+    IManagedThreadList* _pManagedThreadList;
+    bool _loggedPayloadError;
+};
@@ -151,10 +151,7 @@ private:
         }
 
         sample.SetAppDomainName(appDomainName);
-
-        std::stringstream builder;
-        builder << std::dec << pid;
-        sample.SetPid(builder.str());
+        sample.SetPid(std::to_string(pid));
     }
 
     void SetThreadDetails(const TRawSample& rawSample, Sample& sample)
@@ -168,25 +165,10 @@ private:
             return;
         }
 
-        // build the ID
-        std::stringstream builder;
-        auto profTid = rawSample.ThreadInfo->GetProfilerThreadInfoId();
-        auto osTid = rawSample.ThreadInfo->GetOsThreadId();
-        builder << "<" << std::dec << profTid << "> [#" << osTid << "]";
-        sample.SetThreadId(builder.str());
-
-        // build the name
-        std::stringstream nameBuilder;
-        if (rawSample.ThreadInfo->GetThreadName().empty())
-        {
-            nameBuilder << "Managed thread (name unknown)";
-        }
-        else
-        {
-            nameBuilder << shared::ToString(rawSample.ThreadInfo->GetThreadName());
-        }
-        nameBuilder << " [#" << rawSample.ThreadInfo->GetOsThreadId() << "]";
-        sample.SetThreadName(nameBuilder.str());
+        // the ID and name labels are formatted by ManagedThreadInfo only when they change
+        auto threadLabels = rawSample.ThreadInfo->GetThreadLabels();
+        sample.SetThreadId(threadLabels->Id);
+        sample.SetThreadName(threadLabels->Name);
 
         // don't forget to release the ManagedThreadInfo
         rawSample.ThreadInfo->Release();
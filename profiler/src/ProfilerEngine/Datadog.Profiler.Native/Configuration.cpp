@@ -32,11 +32,14 @@ Configuration::Configuration()
     _debugLogEnabled = GetEnvironmentValue(EnvironmentVariables::DebugLogEnabled, GetDefaultDebugLogEnabled());
     _logDirectory = ExtractLogDirectory();
     _pprofDirectory = ExtractPprofDirectory();
+    _exportSpoolDirectory = ExtractExportSpoolDirectory();
     _isOperationalMetricsEnabled = GetEnvironmentValue(EnvironmentVariables::OperationalMetricsEnabled, false);
     _isNativeFrameEnabled = GetEnvironmentValue(EnvironmentVariables::NativeFramesEnabled, false);
     _isCpuProfilingEnabled = GetEnvironmentValue(EnvironmentVariables::CpuProfilingEnabled, false);
     _isWallTimeProfilingEnabled = GetEnvironmentValue(EnvironmentVariables::WallTimeProfilingEnabled, true);
     _isExceptionProfilingEnabled = GetEnvironmentValue(EnvironmentVariables::ExceptionProfilingEnabled, false);
+    _isAllocationProfilingEnabled = GetEnvironmentValue(EnvironmentVariables::AllocationProfilingEnabled, false);
+    _isContentionProfilingEnabled = GetEnvironmentValue(EnvironmentVariables::ContentionProfilingEnabled, false);
     _uploadPeriod = ExtractUploadInterval();
     _userTags = ExtractUserTags();
     _version = GetEnvironmentValue(EnvironmentVariables::Version, DefaultVersion);
@@ -50,6 +53,9 @@ Configuration::Configuration()
     _serviceName = GetEnvironmentValue(EnvironmentVariables::ServiceName, OpSysTools::GetProcessName());
     _isAgentLess = GetEnvironmentValue(EnvironmentVariables::Agentless, false);
     _exceptionSampleLimit = GetEnvironmentValue(EnvironmentVariables::ExceptionSampleLimit, 100);
+    _contentionSampleLimit = GetEnvironmentValue(EnvironmentVariables::ContentionSampleLimit, 100);
+    _isBatchedSamplingEnabled = GetEnvironmentValue(EnvironmentVariables::BatchedSamplingEnabled, false);
+    _cpuTimerInterval = ExtractCpuTimerInterval();
 }
 
 fs::path Configuration::ExtractLogDirectory()
@@ -80,6 +86,20 @@ fs::path const& Configuration::GetProfilesOutputDirectory() const
     return _pprofDirectory;
 }
 
+fs::path Configuration::ExtractExportSpoolDirectory()
+{
+    auto value = shared::GetEnvironmentValue(EnvironmentVariables::ExportSpoolDir);
+    if (value.empty())
+        return fs::path();
+
+    return fs::path(value);
+}
+
+fs::path const& Configuration::GetExportSpoolDirectory() const
+{
+    return _exportSpoolDirectory;
+}
+
 bool Configuration::IsOperationalMetricsEnabled() const
 {
     return _isOperationalMetricsEnabled;
@@ -110,6 +130,31 @@ int32_t Configuration::ExceptionSampleLimit() const
     return _exceptionSampleLimit;
 }
 
+bool Configuration::IsAllocationProfilingEnabled() const
+{
+    return _isAllocationProfilingEnabled;
+}
+
+bool Configuration::IsContentionProfilingEnabled() const
+{
+    return _isContentionProfilingEnabled;
+}
+
+int32_t Configuration::ContentionSampleLimit() const
+{
+    return _contentionSampleLimit;
+}
+
+bool Configuration::IsBatchedSamplingEnabled() const
+{
+    return _isBatchedSamplingEnabled;
+}
+
+std::chrono::milliseconds Configuration::GetCpuTimerInterval() const
+{
+    return _cpuTimerInterval;
+}
+
 std::chrono::seconds Configuration::GetUploadInterval() const
 {
     return _uploadPeriod;
@@ -275,6 +320,18 @@ std::chrono::seconds Configuration::ExtractUploadInterval()
     return GetDefaultUploadInterval();
 }
 
+std::chrono::milliseconds Configuration::ExtractCpuTimerInterval()
+{
+    auto r = shared::GetEnvironmentValue(EnvironmentVariables::CpuTimerInterval);
+    int32_t interval;
+    if (TryParse(r, interval) && (interval > 0))
+    {
+        return std::chrono::milliseconds(interval);
+    }
+
+    return std::chrono::milliseconds::zero();
+}
+
 bool Configuration::GetDefaultDebugLogEnabled()
 {
     auto r = shared::GetEnvironmentValue(EnvironmentVariables::DevelopmentConfiguration);
@@ -21,6 +21,7 @@ public:
 
     fs::path const& GetLogDirectory() const override;
     fs::path const& GetProfilesOutputDirectory() const override;
+    fs::path const& GetExportSpoolDirectory() const override;
     bool IsOperationalMetricsEnabled() const override;
     bool IsNativeFramesEnabled() const override;
     std::chrono::seconds GetUploadInterval() const override;
@@ -41,16 +42,23 @@ public:
     bool IsWallTimeProfilingEnabled() const override;
     bool IsExceptionProfilingEnabled() const override;
     int32_t ExceptionSampleLimit() const override;
+    bool IsAllocationProfilingEnabled() const override;
+    bool IsContentionProfilingEnabled() const override;
+    int32_t ContentionSampleLimit() const override;
+    bool IsBatchedSamplingEnabled() const override;
+    std::chrono::milliseconds GetCpuTimerInterval() const override;
 
 private:
     static tags ExtractUserTags();
     static std::string GetDefaultSite();
     static std::string ExtractSite();
     static std::chrono::seconds ExtractUploadInterval();
+    static std::chrono::milliseconds ExtractCpuTimerInterval();
     static fs::path GetDefaultLogDirectoryPath();
     static fs::path GetApmBaseDirectory();
     static fs::path ExtractLogDirectory();
     static fs::path ExtractPprofDirectory();
+    static fs::path ExtractExportSpoolDirectory();
     static std::chrono::seconds GetDefaultUploadInterval();
     static bool GetDefaultDebugLogEnabled();
     template <typename T>
@@ -71,9 +79,12 @@ private:
     bool _isCpuProfilingEnabled;
     bool _isWallTimeProfilingEnabled;
     bool _isExceptionProfilingEnabled;
+    bool _isAllocationProfilingEnabled;
+    bool _isContentionProfilingEnabled;
     bool _debugLogEnabled;
     fs::path _logDirectory;
     fs::path _pprofDirectory;
+    fs::path _exportSpoolDirectory;
     bool _isOperationalMetricsEnabled;
     std::string _version;
     std::string _serviceName;
@@ -89,4 +100,7 @@ private:
     bool _isNativeFrameEnabled;
     bool _isAgentLess;
     int32_t _exceptionSampleLimit;
+    int32_t _contentionSampleLimit;
+    bool _isBatchedSamplingEnabled;
+    std::chrono::milliseconds _cpuTimerInterval;
 };
@@ -0,0 +1,148 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "ContentionProvider.h"
+
+#include <algorithm>
+
+#include "HResultConverter.h"
+#include "Log.h"
+#include "OpSysTools.h"
+#include "OsSpecificApi.h"
+
+// ContentionStart and ContentionStop are emitted on the waiting thread: the start of the
+// current wait is kept per thread (0 when the thread is not waiting for a lock)
+thread_local std::int64_t ContentionStartTimestamp = 0;
+
+// the stack frames collector of the waiting thread is created for its first sample and reused for the next ones
+// (it is bound to the ICorProfilerInfo of the provider that created it)
+thread_local ICorProfilerInfo4* ContentionStackFramesCollectorOwner = nullptr;
+thread_local std::unique_ptr<StackFramesCollectorBase> ContentionStackFramesCollector;
+
+ContentionProvider::ContentionProvider(
+    ICorProfilerInfo4* pCorProfilerInfo,
+    IManagedThreadList* pManagedThreadList,
+    IFrameStore* pFrameStore,
+    IThreadsCpuManager* pThreadsCpuManager,
+    IAppDomainStore* pAppDomainStore,
+    IRuntimeIdStore* pRuntimeIdStore,
+    IConfiguration* pConfiguration)
+    :
+    CollectorBase<RawContentionSample>("ContentionProvider", pThreadsCpuManager, pFrameStore, pAppDomainStore, pRuntimeIdStore),
+    _pCorProfilerInfo(pCorProfilerInfo),
+    _pManagedThreadList(pManagedThreadList),
+    _sampler(SamplingWindow(pConfiguration), SamplesPerWindow(pConfiguration), SamplingWindowsPerRecording(pConfiguration), 16, nullptr)
+{
+}
+
+bool ContentionProvider::OnEventPipeEvent(DWORD eventId)
+{
+    if (eventId == ContentionStartEventId)
+    {
+        OnContentionStart();
+        return true;
+    }
+
+    if (eventId == ContentionStopEventId)
+    {
+        return OnContentionStop();
+    }
+
+    return false;
+}
+
+void ContentionProvider::OnContentionStart()
+{
+    ContentionStartTimestamp = OpSysTools::GetHighPrecisionNanoseconds();
+}
+
+bool ContentionProvider::OnContentionStop()
+{
+    const auto start = ContentionStartTimestamp;
+    ContentionStartTimestamp = 0;
+
+    // the session may have been started while this thread was already waiting
+    if (start == 0)
+    {
+        return false;
+    }
+
+    // the sampling decision is taken before walking the stack to bound the overhead under heavy contention
+    const auto samplingProbability = _sampler.GetProbability();
+    if (!_sampler.Sample())
+    {
+        return false;
+    }
+
+    return AddContention(OpSysTools::GetHighPrecisionNanoseconds() - start, samplingProbability);
+}
+
+bool ContentionProvider::AddContention(std::int64_t duration, double samplingProbability)
+{
+    ManagedThreadInfo* threadInfo;
+    HRESULT hr = _pManagedThreadList->TryGetCurrentThreadInfo(&threadInfo);
+    if (FAILED(hr))
+    {
+        Log::Warn("Profiler call failed with result ", HResultConverter::ToStringWithCode(hr), ": TryGetCurrentThreadInfo");
+        return false;
+    }
+
+    // the waiting thread is not tracked by the profiler
+    if ((hr == S_FALSE) || (threadInfo == nullptr))
+    {
+        return false;
+    }
+
+    if ((ContentionStackFramesCollector == nullptr) || (ContentionStackFramesCollectorOwner != _pCorProfilerInfo))
+    {
+        ContentionStackFramesCollector = OsSpecificApi::CreateNewStackFramesCollectorInstance(_pCorProfilerInfo);
+        ContentionStackFramesCollectorOwner = _pCorProfilerInfo;
+    }
+
+    uint32_t hrCollectStack = E_FAIL;
+    const auto pStackFramesCollector = ContentionStackFramesCollector.get();
+
+    pStackFramesCollector->PrepareForNextCollection();
+    const auto result = pStackFramesCollector->CollectStackSample(threadInfo, &hrCollectStack);
+
+    if (result->GetFramesCount() == 0)
+    {
+        Log::Debug("Failed to walk stack for lock contention: ", HResultConverter::ToStringWithCode(hrCollectStack));
+        return false;
+    }
+
+    result->DetermineAppDomain(threadInfo->GetClrThreadId(), _pCorProfilerInfo);
+
+    RawContentionSample rawSample;
+
+    rawSample.Timestamp = result->GetUnixTimeUtc();
+    rawSample.LocalRootSpanId = result->GetLocalRootSpanId();
+    rawSample.SpanId = result->GetSpanId();
+    rawSample.AppDomainId = result->GetAppDomainId();
+    result->CopyInstructionPointers(rawSample.Stack);
+    rawSample.ThreadInfo = threadInfo;
+    threadInfo->AddRef();
+    rawSample.Duration = duration;
+    rawSample.SamplingProbability = samplingProbability;
+    Add(std::move(rawSample));
+
+    return true;
+}
+
+std::chrono::milliseconds ContentionProvider::SamplingWindow(const IConfiguration* pConfiguration)
+{
+    const auto uploadIntervalMs = std::chrono::duration_cast<std::chrono::milliseconds>(pConfiguration->GetUploadInterval());
+    const auto sampleLimit = (std::max)(pConfiguration->ContentionSampleLimit(), 1);
+    return (std::max)(MinSamplingWindow, uploadIntervalMs / sampleLimit);
+}
+
+int32_t ContentionProvider::SamplingWindowsPerRecording(const IConfiguration* pConfiguration)
+{
+    const auto uploadIntervalMs = std::chrono::duration_cast<std::chrono::milliseconds>(pConfiguration->GetUploadInterval());
+    return static_cast<int32_t>(std::clamp<int64_t>(uploadIntervalMs / SamplingWindow(pConfiguration), 1, INT32_MAX));
+}
+
+int32_t ContentionProvider::SamplesPerWindow(const IConfiguration* pConfiguration)
+{
+    return (std::max)(pConfiguration->ContentionSampleLimit() / SamplingWindowsPerRecording(pConfiguration), 1);
+}
@@ -0,0 +1,58 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+
+#include "AdaptiveSampler.h"
+#include "CollectorBase.h"
+#include "IConfiguration.h"
+#include "IFrameStore.h"
+#include "IManagedThreadList.h"
+#include "RawContentionSample.h"
+#include "cor.h"
+#include "corprof.h"
+
+class ContentionProvider
+    : public CollectorBase<RawContentionSample>
+{
+public:
+    // Contention keyword and ContentionStart/ContentionStop events of the Microsoft-Windows-DotNETRuntime provider
+    static constexpr inline ULONGLONG EventPipeKeyword = 0x4000;
+    static constexpr inline COR_PRF_EVENTPIPE_LEVEL EventPipeLevel = COR_PRF_EVENTPIPE_INFORMATIONAL;
+    static constexpr inline DWORD ContentionStartEventId = 81;
+    static constexpr inline DWORD ContentionStopEventId = 91;
+
+public:
+    ContentionProvider(
+        ICorProfilerInfo4* pCorProfilerInfo,
+        IManagedThreadList* pManagedThreadList,
+        IFrameStore* pFrameStore,
+        IThreadsCpuManager* pThreadsCpuManager,
+        IAppDomainStore* pAppDomainStore,
+        IRuntimeIdStore* pRuntimeIdStore,
+        IConfiguration* pConfiguration);
+
+    // Called on the waiting thread by EventPipeEventDelivered for each event of the session:
+    // returns false if the event is not a ContentionStart/ContentionStop or the wait was not sampled
+    bool OnEventPipeEvent(DWORD eventId);
+
+    void OnContentionStart();
+    bool OnContentionStop();
+
+    // Called once the wait is over to record the stack of the current thread
+    bool AddContention(std::int64_t duration, double samplingProbability);
+
+private:
+    static constexpr inline std::chrono::milliseconds MinSamplingWindow = std::chrono::milliseconds(500);
+
+    // The ContentionSampleLimit samples of a recording are spread over its windows, with at least one sample per window:
+    // the windows are longer than MinSamplingWindow when the limit is lower than the number of such windows.
+    static std::chrono::milliseconds SamplingWindow(const IConfiguration* pConfiguration);
+    static int32_t SamplingWindowsPerRecording(const IConfiguration* pConfiguration);
+    static int32_t SamplesPerWindow(const IConfiguration* pConfiguration);
+
+private:
+    ICorProfilerInfo4* _pCorProfilerInfo;
+    IManagedThreadList* _pManagedThreadList;
+    AdaptiveSampler _sampler;
+};
@@ -8,6 +8,7 @@
 
 #include "CorProfilerCallback.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
 #ifdef _WINDOWS
@@ -19,10 +20,12 @@
 #include "ApplicationStore.h"
 #include "ClrLifetime.h"
 #include "Configuration.h"
+#include "ContentionProvider.h"
 #include "CpuTimeProvider.h"
 #include "EnvironmentVariables.h"
 #include "ExceptionsProvider.h"
 #include "FrameStore.h"
+#include "HResultConverter.h"
 #include "IMetricsSender.h"
 #include "IMetricsSenderFactory.h"
 #include "LibddprofExporter.h"
@@ -124,6 +127,29 @@ bool CorProfilerCallback::InitializeServices()
             pRuntimeIdStore);
     }
 
+    if (_pConfiguration->IsAllocationProfilingEnabled())
+    {
+        _pAllocationsProvider = RegisterService<AllocationsProvider>(
+            _pCorProfilerInfo,
+            _pManagedThreadList,
+            _pFrameStore.get(),
+            _pThreadsCpuManager,
+            _pAppDomainStore.get(),
+            pRuntimeIdStore);
+    }
+
+    if (_pConfiguration->IsContentionProfilingEnabled())
+    {
+        _pContentionProvider = RegisterService<ContentionProvider>(
+            _pCorProfilerInfo,
+            _pManagedThreadList,
+            _pFrameStore.get(),
+            _pThreadsCpuManager,
+            _pAppDomainStore.get(),
+            pRuntimeIdStore,
+            _pConfiguration.get());
+    }
+
     _pStackSamplerLoopManager = RegisterService<StackSamplerLoopManager>(
         _pCorProfilerInfo,
         _pConfiguration.get(),
@@ -157,6 +183,16 @@ bool CorProfilerCallback::InitializeServices()
         _pSamplesCollector->Register(_pExceptionsProvider);
     }
 
+    if (_pConfiguration->IsAllocationProfilingEnabled())
+    {
+        _pSamplesCollector->Register(_pAllocationsProvider);
+    }
+
+    if (_pConfiguration->IsContentionProfilingEnabled())
+    {
+        _pSamplesCollector->Register(_pContentionProvider);
+    }
+
     _pSamplesAggregator = RegisterService<SamplesAggregator>(_pConfiguration.get(), _pThreadsCpuManager, _pExporter.get(), _metricsSender.get(), _pSamplesCollector);
 
     auto started = StartServices();
@@ -169,6 +205,42 @@ bool CorProfilerCallback::InitializeServices()
     return started;
 }
 
+bool CorProfilerCallback::StartEventPipeSession(ICorProfilerInfo12* pCorProfilerInfo)
+{
+    // a single session listens to the keywords of all the providers fed by runtime events
+    // at the most verbose level they need
+    ULONGLONG keywords = 0;
+    COR_PRF_EVENTPIPE_LEVEL level = COR_PRF_EVENTPIPE_LOGALWAYS;
+
+    if (_pAllocationsProvider != nullptr)
+    {
+        keywords |= AllocationsProvider::EventPipeKeyword;
+        level = (std::max)(level, AllocationsProvider::EventPipeLevel);
+    }
+
+    if (_pContentionProvider != nullptr)
+    {
+        keywords |= ContentionProvider::EventPipeKeyword;
+        level = (std::max)(level, ContentionProvider::EventPipeLevel);
+    }
+
+    COR_PRF_EVENTPIPE_PROVIDER_CONFIG providers[] =
+    {
+        {WStr("Microsoft-Windows-DotNETRuntime"), keywords, level, nullptr}
+    };
+
+    EVENTPIPE_SESSION session;
+    HRESULT hr = pCorProfilerInfo->EventPipeStartSession(1, providers, false, &session);
+    if (FAILED(hr))
+    {
+        Log::Warn("EventPipeStartSession(0x", std::hex, keywords, std::dec, ") failed with result ", HResultConverter::ToStringWithCode(hr));
+        return false;
+    }
+
+    Log::Info("EventPipe session started for the keywords 0x", std::hex, keywords, std::dec, ".");
+    return true;
+}
+
 bool CorProfilerCallback::StartServices()
 {
     bool result = true;
@@ -597,13 +669,47 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::Initialize(IUnknown* corProfilerI
         eventMask |= COR_PRF_MONITOR_EXCEPTIONS | COR_PRF_MONITOR_MODULE_LOADS;
     }
 
-    hr = _pCorProfilerInfo->SetEventMask(eventMask);
+    // the events of the EventPipe session are only delivered with COR_PRF_HIGH_MONITOR_EVENT_PIPE
+    DWORD highEventMask = COR_PRF_HIGH_MONITOR_NONE;
+    ICorProfilerInfo12* pCorProfilerInfo12 = nullptr;
+    if (_pConfiguration->IsAllocationProfilingEnabled() || _pConfiguration->IsContentionProfilingEnabled())
+    {
+        hr = corProfilerInfoUnk->QueryInterface(__uuidof(ICorProfilerInfo12), (void**)&pCorProfilerInfo12);
+        if (SUCCEEDED(hr))
+        {
+            highEventMask |= COR_PRF_HIGH_MONITOR_EVENT_PIPE;
+        }
+        else
+        {
+            pCorProfilerInfo12 = nullptr;
+            Log::Warn("Allocation and contention profiling require ICorProfilerInfo12 (.NET 5 or later): no event will be received.");
+        }
+    }
+
+    if (pCorProfilerInfo12 != nullptr)
+    {
+        hr = pCorProfilerInfo12->SetEventMask2(eventMask, highEventMask);
+    }
+    else
+    {
+        hr = _pCorProfilerInfo->SetEventMask(eventMask);
+    }
     if (FAILED(hr))
     {
-        Log::Error("SetEventMask(0x", std::hex, eventMask, ") returned an unexpected result: 0x", std::hex, hr, std::dec, ".");
+        Log::Error("SetEventMask2(0x", std::hex, eventMask, ", 0x", highEventMask, ") returned an unexpected result: 0x", std::hex, hr, std::dec, ".");
+        if (pCorProfilerInfo12 != nullptr)
+        {
+            pCorProfilerInfo12->Release();
+        }
         return E_FAIL;
     }
 
+    if (pCorProfilerInfo12 != nullptr)
+    {
+        StartEventPipeSession(pCorProfilerInfo12);
+        pCorProfilerInfo12->Release();
+    }
+
     // Initialization complete:
     _isInitialized.store(true);
     ProfilerEngineStatus::WriteIsProfilerEngineActive(true);
@@ -635,6 +741,14 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::Shutdown(void)
     {
         _pExceptionsProvider->Stop();
     }
+    if (_pAllocationsProvider != nullptr)
+    {
+        _pAllocationsProvider->Stop();
+    }
+    if (_pContentionProvider != nullptr)
+    {
+        _pContentionProvider->Stop();
+    }
 
     // dump all threads time
     _pThreadsCpuManager->LogCpuTimes();
@@ -807,6 +921,7 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::ThreadDestroyed(ThreadID threadId
         // The docs require that we do not allow to destroy a thread while it is being stack-walked.
         // TO ensure this, SetThreadDestroyed(..) acquires the StackWalkLock associated with this ThreadInfo.
         pThreadInfo->SetThreadDestroyed();
+        _pStackSamplerLoopManager->StopCpuTimer(pThreadInfo);
         pThreadInfo->Release();
     }
 
@@ -847,6 +962,22 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::ThreadAssignedToOSThread(ThreadID
 
     _pManagedThreadList->SetThreadOsInfo(managedThreadId, osThreadId, dupOsThreadHandle);
 
+    // the CPU timer (if any) must target the new OS thread
+    ManagedThreadInfo* pThreadInfo = _pManagedThreadList->GetThreadInfo(managedThreadId);
+    if (pThreadInfo != nullptr)
+    {
+#ifndef _WINDOWS
+        // this callback is executed by the assigned thread: the only one able to get its CPU clock
+        clockid_t cpuClockId;
+        if ((osThreadId == static_cast<DWORD>(OpSysTools::GetThreadId())) && OsSpecificApi::GetCurrentThreadCpuClockId(cpuClockId))
+        {
+            pThreadInfo->SetCpuClockId(cpuClockId);
+        }
+#endif
+        _pStackSamplerLoopManager->StartCpuTimer(pThreadInfo);
+        pThreadInfo->Release();
+    }
+
     return S_OK;
 }
 
@@ -1205,6 +1336,23 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::EventPipeEventDelivered(EVENTPIPE
                                                                        ULONG numStackFrames,
                                                                        UINT_PTR stackFrames[])
 {
+    if (false == _isInitialized.load())
+    {
+        // If this CorProfilerCallback has not yet initialized, or if it has already shut down, then this callback is a No-Op.
+        return S_OK;
+    }
+
+    // only the runtime provider is enabled, see CorProfilerCallback::StartEventPipeSession
+    if (_pAllocationsProvider != nullptr)
+    {
+        _pAllocationsProvider->OnEventPipeEvent(eventId, eventVersion, cbEventData, eventData);
+    }
+
+    if (_pContentionProvider != nullptr)
+    {
+        _pContentionProvider->OnEventPipeEvent(eventId);
+    }
+
     return S_OK;
 }
 
@@ -9,6 +9,8 @@
 // end
 
 #include "ApplicationStore.h"
+#include "AllocationsProvider.h"
+#include "ContentionProvider.h"
 #include "ExceptionsProvider.h"
 #include "IAppDomainStore.h"
 #include "IClrLifetime.h"
@@ -177,6 +179,7 @@ public:
     IManagedThreadList* GetManagedThreadList() { return _pManagedThreadList; }
     IStackSamplerLoopManager* GetStackSamplerLoopManager() { return _pStackSamplerLoopManager; }
     IApplicationStore* GetApplicationStore() { return _pApplicationStore; }
+    SamplesAggregator* GetSamplesAggregator() { return _pSamplesAggregator; }
 
 private :
     static CorProfilerCallback* _this;
@@ -195,6 +198,8 @@ private :
     IManagedThreadList* _pManagedThreadList = nullptr;
     IApplicationStore* _pApplicationStore = nullptr;
     ExceptionsProvider* _pExceptionsProvider = nullptr;
+    AllocationsProvider* _pAllocationsProvider = nullptr;
+    ContentionProvider* _pContentionProvider = nullptr;
     WallTimeProvider* _pWallTimeProvider = nullptr;
     CpuTimeProvider* _pCpuTimeProvider = nullptr;
     SamplesAggregator* _pSamplesAggregator = nullptr;
@@ -219,6 +224,7 @@ private:
     bool DisposeServices();
     bool StartServices();
     bool StopServices();
+    bool StartEventPipeSession(ICorProfilerInfo12* pCorProfilerInfo);
 
 
     template <class T, typename... ArgTypes>
@@ -7,6 +7,11 @@
 
 #include "DogstatsdService.h"
 
+#include <cerrno>
+#include <cstring>
+
+#include "Log.h"
+
 /// How to add a new type of Metric ?
 /// - Update the IMetricsSender interface
 ///     add a new `MyMetric(const std::string& name, std::uint64_t value, const Tags& tags) = 0` pure virtual method
@@ -14,14 +19,64 @@
 ///     declare `MyMetric(const std::string& name, std::uint64_t value, const Tags& tags) override`
 ///     add the new metric (MyMetric in this example) in the enum `MetricType`
 ///     implements `MyMetric(const std::string& name, std::uint64_t value, const Tags& tags)` (you can take Counter as an example)
-/// - Add a conversion to DogFood::MetricType in the Convert function :
-///     Add a new `if constexpr(...)` statement in Convert() for the new metric type
+///     define how values are aggregated between two flushes in Add()
+/// - Add the type suffix in the GetTypeSuffix function
+
+using namespace std::chrono_literals;
+
+const std::chrono::milliseconds DogstatsdService::DefaultFlushInterval = 10s;
+const std::size_t DogstatsdService::MaxUdpDatagramSize;
+const std::size_t DogstatsdService::MaxUdsDatagramSize;
 
-DogstatsdService::DogstatsdService(const std::string& host, int32_t port, const Tags& tags) :
+#ifdef _WINDOWS
+#define INVALID_METRICS_SOCKET static_cast<std::uintptr_t>(INVALID_SOCKET)
+#else
+#define INVALID_METRICS_SOCKET -1
+#endif
+
+DogstatsdService::DogstatsdService(const std::string& host, int32_t port, const Tags& tags, std::chrono::milliseconds flushInterval) :
     _commonTags{tags},
+    _serializedCommonTags{DogFood::ExtractTags(tags)},
     _host{host},
-    _port{port}
+    _port{port},
+    _isUnixSocket{false},
+    _maxDatagramSize{MaxUdpDatagramSize},
+    _socket{INVALID_METRICS_SOCKET}
 {
+#ifdef _WINDOWS
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+
+    _flushTimer = std::make_unique<Timer>([this]() { Flush(); }, flushInterval);
+    _flushTimer->Start();
+}
+
+#ifndef _WINDOWS
+DogstatsdService::DogstatsdService(const std::string& socketPath, const Tags& tags, std::chrono::milliseconds flushInterval) :
+    _commonTags{tags},
+    _serializedCommonTags{DogFood::ExtractTags(tags)},
+    _host{socketPath},
+    _port{-1},
+    _isUnixSocket{true},
+    _maxDatagramSize{MaxUdsDatagramSize},
+    _socket{INVALID_METRICS_SOCKET}
+{
+    _flushTimer = std::make_unique<Timer>([this]() { Flush(); }, flushInterval);
+    _flushTimer->Start();
+}
+#endif
+
+DogstatsdService::~DogstatsdService()
+{
+    // stop the timer thread before sending the last metrics
+    _flushTimer.reset();
+    Flush();
+    CloseSocket();
+
+#ifdef _WINDOWS
+    WSACleanup();
+#endif
 }
 
 enum class DogstatsdService::MetricType
@@ -32,52 +87,243 @@ enum class DogstatsdService::MetricType
 
 bool DogstatsdService::Gauge(const std::string& name, double value)
 {
-    return Send<DogstatsdService::MetricType::Gauge>(name, value);
+    return Add<DogstatsdService::MetricType::Gauge>(name, value);
 }
 
 bool DogstatsdService::Counter(const std::string& name, std::uint64_t value, const Tags& additionalTags)
 {
-    return Send<DogstatsdService::MetricType::Counter>(name, value, additionalTags);
+    return Add<DogstatsdService::MetricType::Counter>(name, static_cast<double>(value), additionalTags);
 }
 
-/// <summary>
-/// /!\ This function must resides in the CPP file to avoid exposing DogFood::* types (compilation and linking errors)
-/// This constexpr function converts our metric type to DogFood metric type at compile-time.
+DogstatsdService::Tags DogstatsdService::MergeTags(const Tags& tags_, const Tags& other)
+{
+    Tags result;
+
+    result.insert(result.end(), tags_.cbegin(), tags_.cend());
+    result.insert(result.end(), other.cbegin(), other.cend());
+    return result;
+}
 
+/// <summary>
+/// This constexpr function returns the DogStatsD type of our metric type at compile-time.
 /// If no conversion is possible, there is a compilation error
 /// </summary>
 template <DogstatsdService::MetricType metricType>
-constexpr DogFood::MetricType Convert()
+constexpr const char* GetTypeSuffix()
 {
     if constexpr (metricType == DogstatsdService::MetricType::Counter)
-        return DogFood::MetricType::Counter;
+        return "|c";
 
     if constexpr (metricType == DogstatsdService::MetricType::Gauge)
-        return DogFood::MetricType::Gauge;
+        return "|g";
 
-    return static_cast<DogFood::MetricType>(-1);
+    return nullptr;
 }
 
-DogstatsdService::Tags DogstatsdService::MergeTags(const Tags& tags_, const Tags& other)
+template <DogstatsdService::MetricType metric>
+bool DogstatsdService::Add(const std::string& name, double value, const Tags& additionalTags)
 {
-    Tags result;
+    static_assert(GetTypeSuffix<metric>() != nullptr, "No metric type conversion found.");
 
-    result.insert(result.end(), tags_.cbegin(), tags_.cend());
-    result.insert(result.end(), other.cbegin(), other.cend());
-    return result;
+    if (!DogFood::ValidateMetricName(name))
+    {
+        return false;
+    }
+
+    std::string serializedTags = additionalTags.empty() ? _serializedCommonTags : DogFood::ExtractTags(MergeTags(_commonTags, additionalTags));
+
+    // the same metric with different tags is a different time serie
+    std::string key = name + GetTypeSuffix<metric>() + serializedTags;
+
+    std::lock_guard<std::mutex> lock(_metricsLock);
+
+    auto it = _metrics.find(key);
+    if (it == _metrics.end())
+    {
+        _metrics.emplace(std::move(key), AggregatedMetric{name, std::move(serializedTags), metric, value});
+        return true;
+    }
+
+    if constexpr (metric == DogstatsdService::MetricType::Counter)
+    {
+        it->second.Value += value;
+    }
+    else
+    {
+        // only the last value of a gauge is meaningful
+        it->second.Value = value;
+    }
+
+    return true;
+}
+
+void DogstatsdService::AppendMetric(std::string& buffer, AggregatedMetric const& metric)
+{
+    buffer += metric.Name;
+    buffer += ':';
+    if (metric.Type == MetricType::Counter)
+    {
+        buffer += std::to_string(static_cast<std::uint64_t>(metric.Value));
+        buffer += GetTypeSuffix<MetricType::Counter>();
+    }
+    else
+    {
+        buffer += std::to_string(metric.Value);
+        buffer += GetTypeSuffix<MetricType::Gauge>();
+    }
+    buffer += metric.SerializedTags;
 }
 
-template <DogstatsdService::MetricType metric, typename ValueType>
-bool DogstatsdService::Send(const std::string& name, ValueType value, const Tags& additionalTags)
+bool DogstatsdService::Flush()
 {
-    constexpr DogFood::MetricType dogFoodMetric = Convert<metric>();
-    static_assert(dogFoodMetric != -1, "No metric type conversion found.");
+    std::unordered_map<std::string, AggregatedMetric> metrics;
+    {
+        std::lock_guard<std::mutex> lock(_metricsLock);
+        metrics.swap(_metrics);
+    }
+
+    if (metrics.empty())
+    {
+        return true;
+    }
+
+    // pack as many metrics as possible (one per line) in each datagram
+    bool success = true;
+    std::string datagram;
+    std::string line;
+    datagram.reserve(_maxDatagramSize);
+    for (auto const& [key, metric] : metrics)
+    {
+        line.clear();
+        AppendMetric(line, metric);
+
+        if (!datagram.empty() && (datagram.size() + 1 + line.size() > _maxDatagramSize))
+        {
+            success &= SendDatagram(datagram);
+            datagram.clear();
+        }
+
+        if (!datagram.empty())
+        {
+            datagram += '\n';
+        }
+        datagram += line;
+    }
+
+    if (!datagram.empty())
+    {
+        success &= SendDatagram(datagram);
+    }
+
+    return success;
+}
+
+bool DogstatsdService::SendDatagram(std::string const& datagram)
+{
+    std::lock_guard<std::mutex> lock(_socketLock);
+
+    if ((_socket == INVALID_METRICS_SOCKET) && !OpenSocket())
+    {
+        return false;
+    }
+
+#ifdef _WINDOWS
+    auto sent = send(static_cast<SOCKET>(_socket), datagram.data(), static_cast<int>(datagram.size()), 0);
+    if (sent == SOCKET_ERROR)
+#else
+    auto sent = send(_socket, datagram.data(), datagram.size(), MSG_NOSIGNAL);
+    if (sent == -1)
+#endif
+    {
+        // the agent might have been restarted: a new socket will be opened for the next datagram
+        Log::Debug("DogstatsdService: failed to send ", datagram.size(), " bytes of metrics.");
+        CloseSocket();
+        return false;
+    }
+
+    return true;
+}
 
-    if (!additionalTags.empty())
+bool DogstatsdService::OpenSocket()
+{
+    // This method must only be called while _socketLock is held!
+
+#ifdef _WINDOWS
+    SOCKET fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd == INVALID_SOCKET)
     {
-        auto tags = MergeTags(_commonTags, additionalTags);
-        return DogFood::Send(DogFood::Metric(name, value, dogFoodMetric, 1.0, tags), DogFood::Configuration(DogFood::Mode::UDP, _host, _port));
+        return false;
     }
 
-    return DogFood::Send(DogFood::Metric(name, value, dogFoodMetric, 1.0, _commonTags), DogFood::Configuration(DogFood::Mode::UDP, _host, _port));
-}
\ No newline at end of file
+    // the flushing thread must never wait for the agent
+    u_long nonBlocking = 1;
+    ioctlsocket(fd, FIONBIO, &nonBlocking);
+
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<u_short>(_port));
+    address.sin_addr.s_addr = inet_addr(_host.c_str());
+    if (connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR)
+    {
+        closesocket(fd);
+        return false;
+    }
+
+    _socket = static_cast<std::uintptr_t>(fd);
+#else
+    int fd = socket(_isUnixSocket ? AF_UNIX : AF_INET, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    int result;
+    if (_isUnixSocket)
+    {
+        struct sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (_host.size() >= sizeof(address.sun_path))
+        {
+            Log::Error("DogstatsdService: the socket path ", _host, " is too long.");
+            close(fd);
+            return false;
+        }
+        std::strcpy(address.sun_path, _host.c_str());
+        result = connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    }
+    else
+    {
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(_port));
+        address.sin_addr.s_addr = inet_addr(_host.c_str());
+        result = connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    }
+
+    if (result == -1)
+    {
+        Log::Debug("DogstatsdService: failed to connect to ", _host, " (", strerror(errno), ")");
+        close(fd);
+        return false;
+    }
+
+    _socket = fd;
+#endif
+
+    return true;
+}
+
+void DogstatsdService::CloseSocket()
+{
+    if (_socket == INVALID_METRICS_SOCKET)
+    {
+        return;
+    }
+
+#ifdef _WINDOWS
+    closesocket(static_cast<SOCKET>(_socket));
+#else
+    close(_socket);
+#endif
+    _socket = INVALID_METRICS_SOCKET;
+}
@@ -3,31 +3,88 @@
 
 #pragma once
 
-#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "IMetricsSender.h"
+#include "Timer.h"
 
+// Metrics are aggregated in memory (counters are summed and the last value of a gauge is kept)
+// and flushed on a timer from a background thread: one datagram contains as many metrics
+// as possible within the size limit of the transport (UDP or Unix domain socket).
+// The socket is kept open between flushes and reopened after a send failure.
 class DogstatsdService : public IMetricsSender
 {
 public:
-    DogstatsdService(const std::string& host, int32_t port, const Tags& tags);
-    ~DogstatsdService() override = default;
+    // UDP
+    DogstatsdService(const std::string& host, int32_t port, const Tags& tags, std::chrono::milliseconds flushInterval = DefaultFlushInterval);
+#ifndef _WINDOWS
+    // Unix domain socket
+    DogstatsdService(const std::string& socketPath, const Tags& tags, std::chrono::milliseconds flushInterval = DefaultFlushInterval);
+#endif
+    ~DogstatsdService() override;
+
+    DogstatsdService(DogstatsdService const&) = delete;
+    DogstatsdService& operator=(DogstatsdService const&) = delete;
 
     bool Gauge(const std::string& name, double value) override;
-    bool Counter(const std::string& name, std::uint64_t value, const Tags& additionalTasg = {}) override;
+    bool Counter(const std::string& name, std::uint64_t value, const Tags& additionalTags = {}) override;
+
+    // Sends the aggregated metrics now (called by the timer)
+    bool Flush();
 
 public:
     enum class MetricType;
 
+    static const std::chrono::milliseconds DefaultFlushInterval;
+
+    // recommended max payload to avoid IP fragmentation on the default 1500 bytes MTU
+    static const std::size_t MaxUdpDatagramSize = 1432;
+    static const std::size_t MaxUdsDatagramSize = 8192;
+
 private:
+    struct AggregatedMetric
+    {
+        std::string Name;
+        std::string SerializedTags;
+        MetricType Type;
+        double Value;
+    };
+
     static Tags MergeTags(const Tags& tags_, const Tags& other);
 
-    template <DogstatsdService::MetricType metricType, typename ValueType>
-    bool Send(const std::string& name, ValueType value, const Tags& additionalTasg = {});
+    template <DogstatsdService::MetricType metricType>
+    bool Add(const std::string& name, double value, const Tags& additionalTags = {});
+
+    static void AppendMetric(std::string& buffer, AggregatedMetric const& metric);
+    bool SendDatagram(std::string const& datagram);
+    bool OpenSocket();
+    void CloseSocket();
 
 private:
     const Tags _commonTags;
+    const std::string _serializedCommonTags;
     const std::string _host;
     int32_t _port;
-};
\ No newline at end of file
+    const bool _isUnixSocket;
+    const std::size_t _maxDatagramSize;
+
+    // protect the aggregated metrics: metrics are added by different threads
+    std::mutex _metricsLock;
+    std::unordered_map<std::string, AggregatedMetric> _metrics;
+
+    // only used by the flushing thread (or the destructor once the timer is stopped)
+    std::mutex _socketLock;
+#ifdef _WINDOWS
+    std::uintptr_t _socket;
+#else
+    int _socket;
+#endif
+
+    // must be the last field: the timer thread uses the fields above
+    std::unique_ptr<Timer> _flushTimer;
+};
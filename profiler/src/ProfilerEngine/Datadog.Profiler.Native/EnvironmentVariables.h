@@ -13,6 +13,7 @@ public:
     inline static const shared::WSTRING LogPath                     = WStr("SIGNALFX_PROFILING_LOG_PATH");
     inline static const shared::WSTRING LogDirectory                = WStr("SIGNALFX_PROFILING_LOG_DIR");
     inline static const shared::WSTRING OperationalMetricsEnabled   = WStr("SIGNALFX_INTERNAL_OPERATIONAL_METRICS_ENABLED");
+    inline static const shared::WSTRING OperationalMetricsSocket    = WStr("SIGNALFX_INTERNAL_OPERATIONAL_METRICS_SOCKET");
     inline static const shared::WSTRING Version                     = WStr("SIGNALFX_VERSION");
     inline static const shared::WSTRING ServiceName                 = WStr("SIGNALFX_SERVICE");
     inline static const shared::WSTRING Environment                 = WStr("SIGNALFX_ENV");
@@ -29,9 +30,15 @@ public:
     inline static const shared::WSTRING WallTimeProfilingEnabled    = WStr("SIGNALFX_PROFILING_WALLTIME_ENABLED");
     inline static const shared::WSTRING ExceptionProfilingEnabled   = WStr("SIGNALFX_PROFILING_EXCEPTION_ENABLED");
     inline static const shared::WSTRING ExceptionSampleLimit        = WStr("SIGNALFX_PROFILING_EXCEPTION_SAMPLE_LIMIT");
+    inline static const shared::WSTRING AllocationProfilingEnabled  = WStr("SIGNALFX_PROFILING_ALLOCATION_ENABLED");
+    inline static const shared::WSTRING ContentionProfilingEnabled  = WStr("SIGNALFX_PROFILING_CONTENTION_ENABLED");
+    inline static const shared::WSTRING ContentionSampleLimit       = WStr("SIGNALFX_PROFILING_CONTENTION_SAMPLE_LIMIT");
     inline static const shared::WSTRING ProfilesOutputDir           = WStr("SIGNALFX_PROFILING_OUTPUT_DIR");
+    inline static const shared::WSTRING ExportSpoolDir              = WStr("SIGNALFX_PROFILING_EXPORT_SPOOL_DIR");
     inline static const shared::WSTRING DevelopmentConfiguration    = WStr("SIGNALFX_INTERNAL_USE_DEVELOPMENT_CONFIGURATION");
     inline static const shared::WSTRING Agentless                   = WStr("SIGNALFX_PROFILING_AGENTLESS");
+    inline static const shared::WSTRING BatchedSamplingEnabled      = WStr("SIGNALFX_INTERNAL_PROFILING_BATCHED_SAMPLING_ENABLED");
+    inline static const shared::WSTRING CpuTimerInterval            = WStr("SIGNALFX_INTERNAL_PROFILING_CPU_TIMER_INTERVAL");
 
     // feature flags
     inline static const shared::WSTRING FF_LibddprofEnabled = WStr("SIGNALFX_INTERNAL_PROFILING_LIBDDPROF_ENABLED");
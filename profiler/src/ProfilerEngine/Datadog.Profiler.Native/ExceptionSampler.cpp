@@ -1,38 +1,64 @@
 #include "ExceptionSampler.h"
 
 ExceptionSampler::ExceptionSampler(const IConfiguration* configuration) :
+    _knownExceptions{},
+    _currentEpoch{1},
     _sampler(SamplingWindow, SamplesPerWindow(configuration), SamplingWindowsPerRecording(configuration), 16, [this] { RollWindow(); })
 {
 }
 
 ExceptionSampler::ExceptionSampler(std::chrono::milliseconds windowDuration, int32_t samplesPerWindow, int32_t lookback) :
+    _knownExceptions{},
+    _currentEpoch{1},
     _sampler(windowDuration, samplesPerWindow, lookback, 16, [this] { RollWindow(); })
 {
 }
 
-bool ExceptionSampler::Sample(const std::string exceptionType)
+bool ExceptionSampler::Sample(ClassID exceptionType)
 {
+    const auto epoch = _currentEpoch.load(std::memory_order_relaxed);
+
+    // ClassIDs are aligned addresses: drop the low bits before hashing
+    auto index = static_cast<size_t>((exceptionType >> 3) * 0x9E3779B97F4A7C15ull);
+
+    for (size_t probe = 0; probe < MaxProbesCount; probe++)
     {
-        std::unique_lock lock(_knownExceptionsMutex);
+        auto& slot = _knownExceptions[(index + probe) % KnownExceptionsSlotsCount];
+
+        auto type = slot.Type.load(std::memory_order_acquire);
+        if (type == 0)
+        {
+            // on failure, type contains the type stored by another thread
+            if (slot.Type.compare_exchange_strong(type, exceptionType, std::memory_order_acq_rel))
+            {
+                type = exceptionType;
+            }
+        }
 
-        if (_knownExceptions.find(exceptionType) == _knownExceptions.end())
+        if (type != exceptionType)
+        {
+            continue;
+        }
+
+        auto lastSeenEpoch = slot.Epoch.load(std::memory_order_relaxed);
+        if ((lastSeenEpoch != epoch) && slot.Epoch.compare_exchange_strong(lastSeenEpoch, epoch, std::memory_order_relaxed))
         {
             // This is the first time we see this exception in this time window,
             // force the sampling decision
-            _knownExceptions.insert(exceptionType);
-
             return _sampler.Keep();
         }
+
+        break;
     }
 
-    // We've already seen this exception, let the sampler decide
+    // We've already seen this exception (or too many types are known), let the sampler decide
     return _sampler.Sample();
 }
 
 void ExceptionSampler::RollWindow()
 {
-    std::unique_lock lock(_knownExceptionsMutex);
-    _knownExceptions.clear();
+    // all the known exceptions are seen as new in the next window
+    _currentEpoch.fetch_add(1, std::memory_order_relaxed);
 }
 
 int32_t ExceptionSampler::SamplingWindowsPerRecording(const IConfiguration* configuration)
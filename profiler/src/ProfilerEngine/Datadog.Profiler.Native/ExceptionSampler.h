@@ -1,5 +1,9 @@
 #pragma once
-#include <unordered_set>
+#include <array>
+#include <atomic>
+
+#include "cor.h"
+#include "corprof.h"
 
 #include "AdaptiveSampler.h"
 #include "IConfiguration.h"
@@ -10,14 +14,29 @@ public:
     explicit ExceptionSampler(const IConfiguration* configuration);
     ExceptionSampler(std::chrono::milliseconds windowDuration, int32_t samplesPerWindow, int32_t lookback);
 
-    bool Sample(std::string exceptionType);
+    // Called on application threads for each thrown exception: the decision is lock-free
+    // and only depends on the exception type ClassID so that no name needs to be resolved
+    // for exceptions that are not kept
+    bool Sample(ClassID exceptionType);
 
 private:
     static constexpr inline std::chrono::milliseconds SamplingWindow = std::chrono::milliseconds(500);
 
+    // Open addressing table of the known exception types: a slot is never freed, only its epoch
+    // is compared to the current window to know if the type has already been seen in this window
+    static constexpr inline size_t KnownExceptionsSlotsCount = 1024;
+    static constexpr inline size_t MaxProbesCount = 16;
+
+    struct KnownException
+    {
+        std::atomic<ClassID> Type;
+        std::atomic<uint32_t> Epoch;
+    };
+
+    // declared before the sampler because its timer calls RollWindow()
+    std::array<KnownException, KnownExceptionsSlotsCount> _knownExceptions;
+    std::atomic<uint32_t> _currentEpoch;
     AdaptiveSampler _sampler;
-    std::unordered_set<std::string> _knownExceptions;
-    std::mutex _knownExceptionsMutex;
 
     void RollWindow();
     int32_t SamplingWindowsPerRecording(const IConfiguration* configuration);
@@ -92,6 +92,13 @@ bool ExceptionsProvider::OnExceptionThrown(ObjectID thrownObjectId)
 
     INVOKE(_pCorProfilerInfo->GetClassFromObject(thrownObjectId, &classId))
 
+    // the sampling decision is taken before resolving the type name and the message
+    // so that nothing is allocated for the exceptions that are not kept
+    if (!_sampler.Sample(classId))
+    {
+        return true;
+    }
+
     std::string name;
 
     if (!GetExceptionType(classId, name))
@@ -99,11 +106,6 @@ bool ExceptionsProvider::OnExceptionThrown(ObjectID thrownObjectId)
         return false;
     }
 
-    if (!_sampler.Sample(name))
-    {
-        return true;
-    }
-
     const auto messageAddress = *reinterpret_cast<UINT_PTR*>(thrownObjectId + _messageFieldOffset.ulOffset);
 
     std::string message;
@@ -43,15 +43,28 @@ std::tuple<bool, std::string, std::string> FrameStore::GetFrame(uintptr_t instru
     }
 }
 
-// It should be possible to use dbghlp.dll on Windows (and something else on Linux?)
-// to get function name + offset
+// On Linux, the module is found in a sorted index of the loaded modules address ranges
+// and the function name is resolved from the ELF symbols of the module file.
+// It should be possible to use dbghlp.dll on Windows to get function name + offset
 // see https://docs.microsoft.com/en-us/windows/win32/api/dbghelp/nf-dbghelp-symfromaddr for more details
-// However, today, no symbol resolution is done; only the module implementing the function is provided
+// However, today, only the module implementing the function is provided on Windows
 std::pair<std::string, std::string> FrameStore::GetNativeFrame(uintptr_t instructionPointer)
 {
     static const std::string UnknownNativeFrame("|lm:Unknown-Native-Module |ns:NativeCode |ct:Unknown-Native-Module |fn:Function");
     static const std::string UnknowNativeModule = "Unknown-Native-Module";
 
+    std::string_view indexedModuleName;
+    std::string_view indexedFrame;
+    if (_nativeModulesIndex.TryGetFrame(instructionPointer, indexedModuleName, indexedFrame))
+    {
+        return {std::string(indexedModuleName), std::string(indexedFrame)};
+    }
+
+#ifndef _WINDOWS
+    // the index knows the loaded modules (except the ones loaded less than a second ago):
+    // dladdr would not find the address either
+    return {UnknowNativeModule, UnknownNativeFrame};
+#else
     auto moduleName = OpSysTools::GetModuleName(reinterpret_cast<void*>(instructionPointer));
     if (moduleName.empty())
     {
@@ -80,6 +93,7 @@ std::pair<std::string, std::string> FrameStore::GetNativeFrame(uintptr_t instruc
         auto it = _framePerNativeModule.emplace(std::move(moduleName), builder.str()).first;
         return {it->first, it->second};
     }
+#endif
 }
 
 
@@ -370,7 +384,7 @@ bool FrameStore::GetAssemblyName(ICorProfilerInfo4* pInfo, ModuleID moduleId, st
     }
 
     // convert from UTF16 to UTF8
-    assemblyName = shared::ToString(shared::WSTRING(buffer.get()));
+    assemblyName = shared::ToString(buffer.get(), WStrLen(buffer.get()));
     return true;
 }
 
@@ -413,7 +427,7 @@ std::string FrameStore::GetTypeNameFromMetadata(IMetaDataImport2* pMetadata, mdT
     FixTrailingGeneric(pBuffer);
 
     // convert from UTF16 to UTF8
-    return shared::ToString(shared::WSTRING(pBuffer));
+    return shared::ToString(pBuffer, WStrLen(pBuffer));
 }
 
 std::pair<std::string, std::string> FrameStore::GetTypeWithNamespace(IMetaDataImport2* pMetadata, mdTypeDef mdTokenType)
@@ -492,7 +506,7 @@ std::string FrameStore::FormatGenericTypeParameters(IMetaDataImport2* pMetadata,
             if (SUCCEEDED(hr))
             {
                 // need to convert from UTF16 to UTF8
-                builder << shared::ToString(shared::WSTRING(paramName));
+                builder << shared::ToString(paramName, WStrLen(paramName));
             }
             else
             {
@@ -624,7 +638,7 @@ std::pair<std::string, mdTypeDef> FrameStore::GetMethodNameFromMetadata(IMetaDat
     }
 
     // convert from UTF16 to UTF8
-    return std::make_pair(shared::ToString(shared::WSTRING(buffer.get())), mdTokenType);
+    return std::make_pair(shared::ToString(buffer.get(), WStrLen(buffer.get())), mdTokenType);
 }
 
 std::pair<std::string, std::string> FrameStore::GetManagedTypeName(ICorProfilerInfo4* pInfo, ClassID classId)
@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <string>
 #include "IFrameStore.h"
+#include "NativeModulesIndex.h"
 
 #include "shared/src/native-src/com_ptr.h"
 
@@ -86,6 +87,7 @@ private:
     std::unordered_map<FunctionID, std::pair<std::string, std::string>> _methods;
     std::unordered_map<ClassID, TypeDesc> _types;
     std::unordered_map<std::string, std::string> _framePerNativeModule;
+    NativeModulesIndex _nativeModulesIndex;
 
     bool _resolveNativeFrames;
     // TODO: dump stats about caches size at the end of the application
@@ -20,6 +20,7 @@ public:
     virtual bool IsDebugLogEnabled() const = 0;
     virtual fs::path const& GetLogDirectory() const = 0;
     virtual fs::path const& GetProfilesOutputDirectory() const = 0;
+    virtual fs::path const& GetExportSpoolDirectory() const = 0;
     virtual bool IsNativeFramesEnabled() const = 0;
     virtual bool IsOperationalMetricsEnabled() const = 0;
     virtual std::chrono::seconds GetUploadInterval() const = 0;
@@ -38,4 +39,10 @@ public:
     virtual bool IsWallTimeProfilingEnabled() const = 0;
     virtual bool IsExceptionProfilingEnabled() const = 0;
     virtual int32_t ExceptionSampleLimit() const = 0;
+    virtual bool IsAllocationProfilingEnabled() const = 0;
+    virtual bool IsContentionProfilingEnabled() const = 0;
+    virtual int32_t ContentionSampleLimit() const = 0;
+    virtual bool IsBatchedSamplingEnabled() const = 0;
+    // 0 = CPU is sampled by polling the threads state
+    virtual std::chrono::milliseconds GetCpuTimerInterval() const = 0;
 };
\ No newline at end of file
@@ -27,4 +27,6 @@ public:
                           const uint32_t threadNameBuffLen,
                           uint32_t* pActualThreadNameLen) = 0;
     virtual HRESULT TryGetCurrentThreadInfo(ManagedThreadInfo** ppThreadInfo) = 0;
+    // Returns nullptr if the thread is not in the list (the caller must release the returned ManagedThreadInfo*)
+    virtual ManagedThreadInfo* GetThreadInfo(ThreadID clrThreadId) = 0;
 };
\ No newline at end of file
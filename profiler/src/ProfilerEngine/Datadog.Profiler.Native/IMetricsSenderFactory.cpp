@@ -45,6 +45,16 @@ std::shared_ptr<IMetricsSender> IMetricsSenderFactory::Create()
     std::string environment = shared::ToString(shared::GetEnvironmentValue(EnvironmentVariables::Environment));
     auto tags = IMetricsSender::Tags{{"profiler_version", profilerVersion}, {"service_name", serviceName}, {"environment", environment}};
 
+#ifndef _WINDOWS
+    // The agent might only listen to a Unix domain socket (i.e. in containers)
+    std::string socketPath = shared::ToString(shared::GetEnvironmentValue(EnvironmentVariables::OperationalMetricsSocket));
+    if (!socketPath.empty())
+    {
+        Log::Info("Operational metrics are sent to ", socketPath);
+        return std::make_shared<DogstatsdService>(socketPath, tags);
+    }
+#endif
+
     // Operational metrics are activated only in reliability environment.
     // We assume that the datadog agent is installed localhost and is listening on port 8125
     return std::make_shared<DogstatsdService>("127.0.0.1", 8125, tags);
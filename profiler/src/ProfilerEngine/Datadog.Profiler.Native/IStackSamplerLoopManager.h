@@ -14,4 +14,13 @@ public:
     virtual void NotifyCollectionStart() = 0;
     virtual void NotifyCollectionEnd() = 0;
     virtual void NotifyIterationFinished() = 0;
+    virtual bool AllowBatchStackWalk(ManagedThreadInfo* pThreadInfo) = 0;
+    virtual void NotifyBatchIterationFinished(ManagedThreadInfo* const* ppThreadInfos, std::size_t threadsCount) = 0;
+
+    // Mean duration of a stack collection (0 if none has been done yet)
+    virtual std::int64_t GetMeanCollectionTime() = 0;
+
+    // Per-thread CPU timers (no-op if the CPU timer mode is not enabled)
+    virtual void StartCpuTimer(ManagedThreadInfo* pThreadInfo) = 0;
+    virtual void StopCpuTimer(ManagedThreadInfo* pThreadInfo) = 0;
 };
@@ -0,0 +1,20 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "ManagedThreadInfo.h"
+
+
+// Decides which threads are sampled by the StackSamplerLoop during a wall time iteration
+class IWallTimeThreadsScheduler
+{
+public:
+    virtual ~IWallTimeThreadsScheduler() = default;
+
+    // Adds up to maxThreadsCount threads to selectedThreads.
+    // The caller must release each selected thread.
+    virtual void SelectThreads(std::int64_t currentTimestampNs, std::size_t maxThreadsCount, std::vector<ManagedThreadInfo*>& selectedThreads) = 0;
+};
@@ -11,7 +11,9 @@
 #include "Sample.h"
 #include "dd_profiler_version.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -46,19 +48,64 @@ std::string const LibddprofExporter::ProfilePeriodType = "RealTime";
 
 std::string const LibddprofExporter::ProfilePeriodUnit = "Nanoseconds";
 
+std::size_t const LibddprofExporter::MaxPendingExports = 16;
+
+std::chrono::milliseconds const LibddprofExporter::MaxShutdownSendDuration = std::chrono::milliseconds(3000);
+
+std::uintmax_t const LibddprofExporter::MaxSpoolSize = 64 * 1024 * 1024;
+
+std::string const LibddprofExporter::SpoolFileExtension = ".spool";
+
 LibddprofExporter::LibddprofExporter(IConfiguration* configuration, IApplicationStore* applicationStore) :
     _locationsAndLinesSize{512},
-    _applicationStore{applicationStore}
+    _applicationStore{applicationStore},
+    _stopRequested{false},
+    _spoolerStopRequested{false},
+    _spoolSequence{0}
 {
     _exporterBaseTags = CreateTags(configuration);
     _endpoint = CreateEndpoint(configuration);
     _pprofOutputPath = CreatePprofOutputPath(configuration);
-    _locations.resize(_locationsAndLinesSize);
-    _lines.resize(_locationsAndLinesSize);
+    _spoolPath = CreateExportSpoolPath(configuration);
+    ResizeLocationsAndLines(_locationsAndLinesSize);
+
+    _senderThread = std::thread(&LibddprofExporter::SenderWork, this);
+    OpSysTools::SetNativeThreadName(&_senderThread, SenderThreadName);
+
+    if (!_spoolPath.empty())
+    {
+        _spoolerThread = std::thread(&LibddprofExporter::SpoolerWork, this);
+        OpSysTools::SetNativeThreadName(&_spoolerThread, SpoolerThreadName);
+    }
 }
 
 LibddprofExporter::~LibddprofExporter()
 {
+    // the profiles that are still pending are sent (or spooled) before leaving
+    {
+        std::lock_guard<std::mutex> lock(_pendingExportsLock);
+        _stopRequested = true;
+        _stopRequestTime = std::chrono::steady_clock::now();
+    }
+    _pendingExportsCondition.notify_one();
+
+    if (_senderThread.joinable())
+    {
+        _senderThread.join();
+    }
+
+    // the sender thread is done: nothing else can be added to the spool
+    {
+        std::lock_guard<std::mutex> lock(_spooledExportsLock);
+        _spoolerStopRequested = true;
+    }
+    _spooledExportsCondition.notify_one();
+
+    if (_spoolerThread.joinable())
+    {
+        _spoolerThread.join();
+    }
+
     for (auto [runtimeId, appInfo] : _perAppInfo)
     {
         ddprof_ffi_Profile_free(appInfo.profile);
@@ -178,27 +225,15 @@ void LibddprofExporter::Add(Sample const& sample)
     if (nbFrames > _locationsAndLinesSize)
     {
         _locationsAndLinesSize = nbFrames;
-        _locations.resize(_locationsAndLinesSize);
-        _lines.resize(_locationsAndLinesSize);
+        ResizeLocationsAndLines(_locationsAndLinesSize);
     }
 
+    // only the function and module names change from one sample to another
     std::size_t idx = 0UL;
     for (auto const& frame : callstack)
     {
-        auto& line = _lines[idx];
-        auto& location = _locations[idx];
-
-        line = {};
-        line.function.filename = {};
-        line.function.start_line = 0;
-        line.function.name = FfiHelper::StringToCharSlice(frame.second);
-
-        // add filename mapping
-        location.mapping = {};
-        location.mapping.filename = FfiHelper::StringToCharSlice(frame.first);
-        location.address = 0; // TODO check if we can get that information in the provider
-        location.lines = {&line, 1};
-        location.is_folded = false;
+        _lines[idx].function.name = FfiHelper::StringToCharSlice(frame.second);
+        _locations[idx].mapping.filename = FfiHelper::StringToCharSlice(frame.first);
 
         ++idx;
     }
@@ -206,16 +241,15 @@ void LibddprofExporter::Add(Sample const& sample)
     auto ffiSample = ddprof_ffi_Sample{};
     ffiSample.locations = {_locations.data(), nbFrames};
 
-    // Labels
+    // Labels: the buffer is reused from one sample to another
     auto const& labels = sample.GetLabels();
-    std::vector<ddprof_ffi_Label> ffiLabels;
-    ffiLabels.reserve(labels.size());
+    _labels.clear();
 
     for (auto const& [label, value] : labels)
     {
-        ffiLabels.push_back({{label.data(), label.size()}, {value.data(), value.size()}});
+        _labels.push_back({{label.data(), label.size()}, {value.data(), value.size()}});
     }
-    ffiSample.labels = {ffiLabels.data(), ffiLabels.size()};
+    ffiSample.labels = {_labels.data(), _labels.size()};
 
     // values
     auto const& values = sample.GetValues();
@@ -257,39 +291,217 @@ bool LibddprofExporter::Export()
             ExportToDisk(applicationInfo.ServiceName, serializedProfile, idx++);
         }
 
-        auto* exporter = CreateExporter(_exporterBaseTags.GetFfiTags(), _endpoint);
-
-        if (exporter == nullptr)
-        {
-            Log::Error("Unable to create exporter for application ", runtimeId);
-            return false;
-        }
-
         // Count is incremented BEFORE creating and sending the .pprof
         // so that it will be possible to detect "missing" profiles
         // in the back end
         profileInfo.exportsCount++;
 
-        Tags additionalTags;
-        additionalTags.Add("env", applicationInfo.Environment);
-        additionalTags.Add("version", applicationInfo.Version);
-        additionalTags.Add("service", applicationInfo.ServiceName);
-        additionalTags.Add("runtime-id", std::string(runtimeId));
-        additionalTags.Add("profile_seq", std::to_string(profileInfo.exportsCount));
+        // the serialized profile is copied because the libddprof profile is reset when leaving the scope
+        auto buffer = serializedProfile.GetBuffer();
+
+        ExportItem item;
+        item.buffer.assign(buffer.ptr, buffer.ptr + buffer.len);
+        item.start = serializedProfile.GetStart();
+        item.end = serializedProfile.GetEnd();
+        item.tags = {
+            {"env", applicationInfo.Environment},
+            {"version", applicationInfo.Version},
+            {"service", applicationInfo.ServiceName},
+            {"runtime-id", std::string(runtimeId)},
+            {"profile_seq", std::to_string(profileInfo.exportsCount)}};
+
+        // sending is done by the sender thread
+        Enqueue(std::move(item));
+        exported = true;
+    }
+    return exported;
+}
+
+void LibddprofExporter::Enqueue(ExportItem&& item)
+{
+    bool hasDroppedItem = false;
+    ExportItem droppedItem;
+
+    {
+        std::lock_guard<std::mutex> lock(_pendingExportsLock);
+
+        // the agent is not fast enough (or not reachable): keep the most recent profiles in memory
+        if (_pendingExports.size() >= MaxPendingExports)
+        {
+            droppedItem = std::move(_pendingExports.front());
+            _pendingExports.pop_front();
+            hasDroppedItem = true;
+        }
 
-        auto* request = CreateRequest(serializedProfile, exporter, additionalTags);
-        if (request != nullptr)
+        _pendingExports.push_back(std::move(item));
+    }
+    _pendingExportsCondition.notify_one();
+
+    if (hasDroppedItem)
+    {
+        if (_spoolPath.empty())
         {
-            exported &= Send(request, exporter);
+            Log::Warn("Too many profiles are waiting to be sent: the oldest one is dropped.");
         }
         else
         {
-            exported = false;
-            Log::Error("Unable to create a request to send the profile.");
+            Log::Info("Too many profiles are waiting to be sent: the oldest one is spooled to disk.");
+            EnqueueForSpooling(std::move(droppedItem));
         }
-        ddprof_ffi_ProfileExporterV3_delete(exporter);
     }
-    return exported;
+}
+
+void LibddprofExporter::SenderWork()
+{
+    // when a send fails, the profiles left at shutdown are spooled without waiting for another timeout
+    bool isAgentReachable = true;
+
+    while (true)
+    {
+        ExportItem item;
+        bool isStopping;
+        std::chrono::steady_clock::time_point stopRequestTime;
+        {
+            std::unique_lock<std::mutex> lock(_pendingExportsLock);
+            _pendingExportsCondition.wait(lock, [this] { return _stopRequested || !_pendingExports.empty(); });
+
+            if (_pendingExports.empty())
+            {
+                // stop requested and nothing left to send
+                break;
+            }
+
+            item = std::move(_pendingExports.front());
+            _pendingExports.pop_front();
+            isStopping = _stopRequested;
+            stopRequestTime = _stopRequestTime;
+        }
+
+        auto timeoutMs = RequestTimeOutMs;
+        if (isStopping)
+        {
+            // the application is not kept alive by a slow agent: the request has to end before the shutdown deadline
+            auto remainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   stopRequestTime + MaxShutdownSendDuration - std::chrono::steady_clock::now())
+                                   .count();
+            if (!isAgentReachable || (remainingMs <= 0))
+            {
+                EnqueueForSpooling(std::move(item));
+                continue;
+            }
+            timeoutMs = static_cast<std::int32_t>((std::min)(static_cast<std::int64_t>(timeoutMs), static_cast<std::int64_t>(remainingMs)));
+        }
+
+        isAgentReachable = Send(item, timeoutMs);
+        if (!isAgentReachable)
+        {
+            EnqueueForSpooling(std::move(item));
+        }
+        else if (!isStopping)
+        {
+            // the agent is back: replay one previously spooled profile per successful send
+            // so that the backlog is drained without delaying the fresh profiles too much
+            TryReplaySpooledItem();
+        }
+    }
+}
+
+void LibddprofExporter::EnqueueForSpooling(ExportItem&& item)
+{
+    if (_spoolPath.empty())
+    {
+        Log::Warn("Failed to send the profile: it is dropped.");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_spooledExportsLock);
+
+        // the disk is not fast enough: keep the most recent profiles
+        if (_spooledExports.size() >= MaxPendingExports)
+        {
+            _spooledExports.pop_front();
+            Log::Warn("Too many profiles are waiting to be spooled: the oldest one is dropped.");
+        }
+
+        _spooledExports.push_back(std::move(item));
+    }
+    _spooledExportsCondition.notify_one();
+}
+
+void LibddprofExporter::SpoolerWork()
+{
+    while (true)
+    {
+        ExportItem item;
+        {
+            std::unique_lock<std::mutex> lock(_spooledExportsLock);
+            _spooledExportsCondition.wait(lock, [this] { return _spoolerStopRequested || !_spooledExports.empty(); });
+
+            if (_spooledExports.empty())
+            {
+                // stop requested and nothing left to spool
+                break;
+            }
+
+            item = std::move(_spooledExports.front());
+            _spooledExports.pop_front();
+        }
+
+        Spool(item);
+    }
+}
+
+bool LibddprofExporter::Send(ExportItem const& item, std::int32_t timeoutMs)
+{
+    auto* exporter = CreateExporter(_exporterBaseTags.GetFfiTags(), _endpoint);
+    if (exporter == nullptr)
+    {
+        Log::Error("Unable to create exporter to send the profile.");
+        return false;
+    }
+
+    Tags additionalTags;
+    for (auto const& [name, value] : item.tags)
+    {
+        additionalTags.Add(name, value);
+    }
+
+    bool sent = false;
+    auto* request = CreateRequest(item, exporter, additionalTags, timeoutMs);
+    if (request != nullptr)
+    {
+        sent = Send(request, exporter);
+    }
+    else
+    {
+        Log::Error("Unable to create a request to send the profile.");
+    }
+
+    ddprof_ffi_ProfileExporterV3_delete(exporter);
+    return sent;
+}
+
+void LibddprofExporter::ResizeLocationsAndLines(std::size_t size)
+{
+    _locations.resize(size);
+    _lines.resize(size);
+
+    // the lines might have moved: fix the pointers and reset the fields that never change
+    for (std::size_t idx = 0; idx < size; idx++)
+    {
+        auto& line = _lines[idx];
+        auto& location = _locations[idx];
+
+        line = {};
+        line.function.filename = {};
+        line.function.start_line = 0;
+
+        location.mapping = {};
+        location.address = 0; // TODO check if we can get that information in the provider
+        location.lines = {&line, 1};
+        location.is_folded = false;
+    }
 }
 
 std::string LibddprofExporter::GeneratePprofFilePath(const std::string& applicationName, int32_t idx) const
@@ -341,20 +553,16 @@ void LibddprofExporter::ExportToDisk(const std::string& applicationName, Seriali
     }
 }
 
-ddprof_ffi_Request* LibddprofExporter::CreateRequest(SerializedProfile const& encodedProfile, ddprof_ffi_ProfileExporterV3* exporter, const Tags& additionalTags) const
+ddprof_ffi_Request* LibddprofExporter::CreateRequest(ExportItem const& item, ddprof_ffi_ProfileExporterV3* exporter, const Tags& additionalTags, std::int32_t timeoutMs) const
 {
-    auto start = encodedProfile.GetStart();
-    auto end = encodedProfile.GetEnd();
-    auto buffer = encodedProfile.GetBuffer();
-
-    ddprof_ffi_File file{FfiHelper::StringToCharSlice(RequestFileName), ddprof_ffi_Vec_u8_as_slice(&buffer)};
+    ddprof_ffi_File file{FfiHelper::StringToCharSlice(RequestFileName), {item.buffer.data(), item.buffer.size()}};
 
     struct ddprof_ffi_Slice_file files
     {
         &file, 1
     };
 
-    return ddprof_ffi_ProfileExporterV3_build(exporter, start, end, files, additionalTags.GetFfiTags(), RequestTimeOutMs);
+    return ddprof_ffi_ProfileExporterV3_build(exporter, item.start, item.end, files, additionalTags.GetFfiTags(), timeoutMs);
 }
 
 bool LibddprofExporter::Send(ddprof_ffi_Request* request, ddprof_ffi_ProfileExporterV3* exporter) const
@@ -398,6 +606,211 @@ fs::path LibddprofExporter::CreatePprofOutputPath(IConfiguration* configuration)
     return {};
 }
 
+fs::path LibddprofExporter::CreateExportSpoolPath(IConfiguration* configuration) const
+{
+    auto const& spoolPath = configuration->GetExportSpoolDirectory();
+    if (spoolPath.empty())
+    {
+        return spoolPath;
+    }
+
+    std::error_code errorCode;
+    if (fs::create_directories(spoolPath, errorCode) || (errorCode.value() == 0))
+    {
+        return spoolPath;
+    }
+
+    Log::Error("Unable to create export spool directory '", spoolPath, "'. Error (code): ", errorCode.message(), " (", errorCode.value(), ")");
+
+    return {};
+}
+
+//
+// Spooled profiles are stored in files with the following layout:
+//   <start seconds> <start nanoseconds> <end seconds> <end nanoseconds>\n
+//   <tag name>:<tag value>\n  (for each tag)
+//   \n
+//   <serialized profile>
+// The file names start with a timestamp so that the oldest ones are replayed first.
+// Only called by the spooler thread: the files are never written/evicted concurrently by this process.
+//
+void LibddprofExporter::Spool(ExportItem const& item)
+{
+    if (_spoolPath.empty())
+    {
+        Log::Warn("Failed to send the profile: it is dropped.");
+        return;
+    }
+
+    std::ostringstream header;
+    header << item.start.seconds << " " << item.start.nanoseconds << " " << item.end.seconds << " " << item.end.nanoseconds << "\n";
+    for (auto const& [name, value] : item.tags)
+    {
+        header << name << ":" << value << "\n";
+    }
+    header << "\n";
+    auto headerContent = header.str();
+
+    std::uintmax_t fileSize = headerContent.size() + item.buffer.size();
+    if (fileSize > MaxSpoolSize)
+    {
+        Log::Warn("The profile is too large to be spooled: it is dropped.");
+        return;
+    }
+
+    // make room by deleting the oldest spooled profiles
+    std::uintmax_t totalSize = 0;
+    auto spooledFiles = GetSpooledFiles(totalSize);
+    for (auto const& spooledFile : spooledFiles)
+    {
+        if (totalSize + fileSize <= MaxSpoolSize)
+        {
+            break;
+        }
+
+        std::error_code errorCode;
+        auto size = fs::file_size(spooledFile, errorCode);
+        if (fs::remove(spooledFile, errorCode))
+        {
+            Log::Info("Spool directory is full: ", spooledFile, " is deleted.");
+            totalSize -= std::min(totalSize, size);
+        }
+    }
+
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::ostringstream filename;
+    filename << std::setw(16) << std::setfill('0') << now << "_" << ProcessId << "_" << _spoolSequence++;
+
+    // the file is renamed only when completely written to avoid replaying partial profiles
+    auto temporaryFilePath = _spoolPath / (filename.str() + ".tmp");
+    auto spoolFilePath = _spoolPath / (filename.str() + SpoolFileExtension);
+
+    std::ofstream file{temporaryFilePath, std::ios::out | std::ios::binary};
+    file.write(headerContent.data(), headerContent.size());
+    file.write((char const*)item.buffer.data(), item.buffer.size());
+    file.close();
+
+    std::error_code errorCode;
+    if (file.fail())
+    {
+        Log::Error("Unable to spool the profile in ", temporaryFilePath);
+        fs::remove(temporaryFilePath, errorCode);
+        return;
+    }
+
+    fs::rename(temporaryFilePath, spoolFilePath, errorCode);
+    if (errorCode)
+    {
+        Log::Error("Unable to spool the profile in ", spoolFilePath, ". Error (code): ", errorCode.message(), " (", errorCode.value(), ")");
+        fs::remove(temporaryFilePath, errorCode);
+        return;
+    }
+
+    Log::Debug("Profile spooled in ", spoolFilePath);
+}
+
+std::vector<fs::path> LibddprofExporter::GetSpooledFiles(std::uintmax_t& totalSize) const
+{
+    std::vector<fs::path> files;
+    totalSize = 0;
+
+    std::error_code errorCode;
+    for (auto const& entry : fs::directory_iterator(_spoolPath, errorCode))
+    {
+        if (!entry.is_regular_file(errorCode) || (entry.path().extension() != SpoolFileExtension))
+        {
+            continue;
+        }
+
+        totalSize += entry.file_size(errorCode);
+        files.push_back(entry.path());
+    }
+
+    // oldest first
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+bool LibddprofExporter::TryReplaySpooledItem()
+{
+    if (_spoolPath.empty())
+    {
+        return false;
+    }
+
+    std::uintmax_t totalSize;
+    for (auto const& spooledFile : GetSpooledFiles(totalSize))
+    {
+        // the spool directory could be shared by several processes: renaming the file ensures
+        // that only one of them is replaying it
+        auto claimedFile = spooledFile;
+        claimedFile.replace_extension(".sending" + ProcessId);
+
+        std::error_code errorCode;
+        fs::rename(spooledFile, claimedFile, errorCode);
+        if (errorCode)
+        {
+            continue;
+        }
+
+        ExportItem item;
+        if (!ReadSpooledItem(claimedFile, item))
+        {
+            Log::Warn("Invalid spooled profile ", spooledFile, " is deleted.");
+            fs::remove(claimedFile, errorCode);
+            continue;
+        }
+
+        if (Send(item, RequestTimeOutMs))
+        {
+            Log::Debug("Spooled profile ", spooledFile, " was sent.");
+            fs::remove(claimedFile, errorCode);
+            return true;
+        }
+
+        // will be retried later
+        fs::rename(claimedFile, spooledFile, errorCode);
+        return false;
+    }
+
+    return false;
+}
+
+bool LibddprofExporter::ReadSpooledItem(fs::path const& filePath, ExportItem& item) const
+{
+    std::ifstream file{filePath, std::ios::in | std::ios::binary};
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line))
+    {
+        return false;
+    }
+
+    std::istringstream timestamps(line);
+    if (!(timestamps >> item.start.seconds >> item.start.nanoseconds >> item.end.seconds >> item.end.nanoseconds))
+    {
+        return false;
+    }
+
+    while (std::getline(file, line) && !line.empty())
+    {
+        auto separator = line.find(':');
+        if (separator == std::string::npos)
+        {
+            return false;
+        }
+
+        item.tags.emplace_back(line.substr(0, separator), line.substr(separator + 1));
+    }
+
+    item.buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !item.buffer.empty();
+}
+
 //
 // LibddprofExporter::SerializedProfile class
 //
@@ -11,9 +11,15 @@ extern "C"
 #include "ddprof/ffi.h"
 }
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <forward_list>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -86,17 +92,39 @@ private:
         std::int32_t exportsCount;
     };
 
+    // Serialized profile waiting to be sent by the sender thread (or replayed from the spool directory)
+    class ExportItem
+    {
+    public:
+        std::vector<std::uint8_t> buffer;
+        ddprof_ffi_Timespec start;
+        ddprof_ffi_Timespec end;
+        std::vector<std::pair<std::string, std::string>> tags;
+    };
+
     static Tags CreateTags(IConfiguration* configuration);
     static ddprof_ffi_ProfileExporterV3* CreateExporter(const ddprof_ffi_Vec_tag* tags, ddprof_ffi_EndpointV3 endpoint);
     static ddprof_ffi_Profile* CreateProfile();
 
-    ddprof_ffi_Request* CreateRequest(SerializedProfile const& encodedProfile, ddprof_ffi_ProfileExporterV3* exporter,  const Tags& additionalTags) const;
+    ddprof_ffi_Request* CreateRequest(ExportItem const& item, ddprof_ffi_ProfileExporterV3* exporter, const Tags& additionalTags, std::int32_t timeoutMs) const;
     ddprof_ffi_EndpointV3 CreateEndpoint(IConfiguration* configuration);
     ProfileInfo& GetInfo(std::string_view runtimeId);
+    void ResizeLocationsAndLines(std::size_t size);
 
     void ExportToDisk(const std::string& applicationName, SerializedProfile const& encodedProfile, int idx);
 
     bool Send(ddprof_ffi_Request* request, ddprof_ffi_ProfileExporterV3* exporter) const;
+    bool Send(ExportItem const& item, std::int32_t timeoutMs);
+    void Enqueue(ExportItem&& item);
+    void SenderWork();
+
+    void EnqueueForSpooling(ExportItem&& item);
+    void SpoolerWork();
+    void Spool(ExportItem const& item);
+    bool TryReplaySpooledItem();
+    bool ReadSpooledItem(fs::path const& filePath, ExportItem& item) const;
+    std::vector<fs::path> GetSpooledFiles(std::uintmax_t& totalSize) const;
+    fs::path CreateExportSpoolPath(IConfiguration* configuration) const;
     std::string GeneratePprofFilePath(const std::string& applicationName, int idx) const;
     fs::path CreatePprofOutputPath(IConfiguration* configuration) const;
 
@@ -111,10 +139,21 @@ private:
     static std::string const ProfilePeriodType;
     static std::string const ProfilePeriodUnit;
 
+    // number of serialized profiles waiting to be sent before the oldest one is spooled (or dropped)
+    static std::size_t const MaxPendingExports;
+    // when the exporter is destroyed, the pending profiles are sent during this delay at most: the other ones are spooled
+    static std::chrono::milliseconds const MaxShutdownSendDuration;
+    // max size of all the spooled profiles: the oldest ones are deleted to make room
+    static std::uintmax_t const MaxSpoolSize;
+    static std::string const SpoolFileExtension;
+    inline static const WCHAR* SenderThreadName = WStr("DD.Profiler.LibddprofExporter.SenderThread");
+    inline static const WCHAR* SpoolerThreadName = WStr("DD.Profiler.LibddprofExporter.SpoolerThread");
+
     fs::path _pprofOutputPath;
 
     std::vector<ddprof_ffi_Location> _locations;
     std::vector<ddprof_ffi_Line> _lines;
+    std::vector<ddprof_ffi_Label> _labels;
     std::string _agentUrl;
     std::size_t _locationsAndLinesSize;
 
@@ -123,4 +162,23 @@ private:
     ddprof_ffi_EndpointV3 _endpoint;
     Tags _exporterBaseTags;
     IApplicationStore* const _applicationStore;
+
+    // Export() only serializes the profiles: they are sent by a dedicated thread so that
+    // the samples processing is never blocked by network I/O
+    std::mutex _pendingExportsLock;
+    std::condition_variable _pendingExportsCondition;
+    std::deque<ExportItem> _pendingExports;
+    bool _stopRequested;
+    std::chrono::steady_clock::time_point _stopRequestTime;
+    std::thread _senderThread;
+
+    // the profiles that cannot be sent are written to disk by another thread (the only one writing the spool files)
+    // so that neither the samples processing nor the sending of the next profiles waits for the disk
+    std::mutex _spooledExportsLock;
+    std::condition_variable _spooledExportsCondition;
+    std::deque<ExportItem> _spooledExports;
+    bool _spoolerStopRequested;
+    fs::path _spoolPath;
+    std::atomic<std::uint64_t> _spoolSequence;
+    std::thread _spoolerThread;
 };
\ No newline at end of file
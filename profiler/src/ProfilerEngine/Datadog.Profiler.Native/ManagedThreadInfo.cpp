@@ -4,6 +4,12 @@
 #include "ManagedThreadInfo.h"
 #include "shared/src/native-src/string.h"
 
+#include <sstream>
+
+#ifndef _WINDOWS
+#include <unistd.h>
+#endif
+
 std::atomic<std::uint32_t> ManagedThreadInfo::s_nextProfilerThreadInfoId{1};
 
 std::uint32_t ManagedThreadInfo::GenerateProfilerThreadInfoId(void)
@@ -31,6 +37,7 @@ ManagedThreadInfo::ManagedThreadInfo(ThreadID clrThreadId, DWORD osThreadId, HAN
     _osThreadHandle(osThreadHandle),
     _pThreadName(std::move(pThreadName)),
     _lastSampleHighPrecisionTimestampNanoseconds{0},
+    _lastSampledSpanId{0},
     _lastKnownSampleUnixTimeUtc{0},
     _highPrecisionNanosecsAtLastUnixTimeUpdate{0},
     _snapshotsPerformedSuccessCount{0},
@@ -41,6 +48,83 @@ ManagedThreadInfo::ManagedThreadInfo(ThreadID clrThreadId, DWORD osThreadId, HAN
     _stackWalkLock(1),
     _isThreadDestroyed{false},
     _traceContextTrackingInfo{},
-    _cpuConsumptionMilliseconds{0}
+    _cpuConsumptionNanoseconds{0}
+#ifndef _WINDOWS
+    ,
+    _procStatFd{-1},
+    _isProcStatFdStale{false},
+    _cpuTimerSlot{-1},
+    _cpuClockId{InvalidCpuClockId}
+#endif
+{
+    UpdateThreadLabels();
+}
+
+ManagedThreadInfo::~ManagedThreadInfo()
+{
+#ifndef _WINDOWS
+    if (_procStatFd != -1)
+    {
+        close(_procStatFd);
+        _procStatFd = -1;
+    }
+#endif
+}
+
+void ManagedThreadInfo::SetOsInfo(DWORD osThreadId, HANDLE osThreadHandle)
 {
+#ifndef _WINDOWS
+    bool isOsThreadChanged = (osThreadId != _osThreadId);
+#endif
+
+    _osThreadId = osThreadId;
+    _osThreadHandle = osThreadHandle;
+
+#ifndef _WINDOWS
+    // the stat file and the CPU clock belong to the previous OS thread: the sampler thread might be
+    // reading the stat file, so it is closed (and reopened for the new OS thread) by the sampler thread
+    if (isOsThreadChanged)
+    {
+        SetCpuClockId(InvalidCpuClockId);
+        _isProcStatFdStale.store(true, std::memory_order_release);
+    }
+#endif
+
+    UpdateThreadLabels();
+}
+
+#ifndef _WINDOWS
+std::int32_t ManagedThreadInfo::GetProcStatFileDescriptor()
+{
+    if (_isProcStatFdStale.exchange(false, std::memory_order_acquire) && (_procStatFd != -1))
+    {
+        close(_procStatFd);
+        _procStatFd = -1;
+    }
+
+    return _procStatFd;
+}
+#endif
+
+void ManagedThreadInfo::UpdateThreadLabels()
+{
+    auto labels = std::make_shared<ThreadLabels>();
+
+    std::stringstream idBuilder;
+    idBuilder << "<" << std::dec << _profilerThreadInfoId << "> [#" << _osThreadId << "]";
+    labels->Id = idBuilder.str();
+
+    std::stringstream nameBuilder;
+    if (_pThreadName.empty())
+    {
+        nameBuilder << "Managed thread (name unknown)";
+    }
+    else
+    {
+        nameBuilder << shared::ToString(_pThreadName);
+    }
+    nameBuilder << " [#" << _osThreadId << "]";
+    labels->Name = nameBuilder.str();
+
+    std::atomic_store(&_threadLabels, std::shared_ptr<const ThreadLabels>(std::move(labels)));
 }
@@ -3,8 +3,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 
+#ifndef _WINDOWS
+#include <time.h>
+#endif
+
 #include "cor.h"
 #include "corprof.h"
 
@@ -24,6 +30,14 @@ public:
     std::uint64_t _currentSpanId;
 };
 
+// Thread labels attached to each sample
+struct ThreadLabels
+{
+public:
+    std::string Id;
+    std::string Name;
+};
+
 struct ManagedThreadInfo : public RefCountingObject
 {
 private:
@@ -32,7 +46,7 @@ private:
 
 public:
     explicit ManagedThreadInfo(ThreadID clrThreadId);
-    ~ManagedThreadInfo() override = default;
+    ~ManagedThreadInfo() override;
 
     inline std::uint32_t GetProfilerThreadInfoId(void) const;
 
@@ -40,15 +54,37 @@ public:
 
     inline DWORD GetOsThreadId(void) const;
     inline HANDLE GetOsThreadHandle(void) const;
-    inline void SetOsInfo(DWORD osThreadId, HANDLE osThreadHandle);
+    void SetOsInfo(DWORD osThreadId, HANDLE osThreadHandle);
 
     inline const shared::WSTRING& GetThreadName(void) const;
     inline void SetThreadName(shared::WSTRING pThreadName);
 
+    // The labels are formatted once and again only when the thread is renamed (or its OS id changes)
+    // so that they are not recomputed for each sample
+    inline std::shared_ptr<const ThreadLabels> GetThreadLabels(void) const;
+
     inline std::uint64_t GetLastSampleHighPrecisionTimestampNanoseconds(void) const;
     inline std::uint64_t SetLastSampleHighPrecisionTimestampNanoseconds(std::uint64_t value);
-    inline std::uint64_t GetCpuConsumptionMilliseconds(void) const;
-    inline std::uint64_t SetCpuConsumptionMilliseconds(std::uint64_t value);
+    inline std::uint64_t GetCpuConsumptionNanoseconds(void) const;
+    inline std::uint64_t SetCpuConsumptionNanoseconds(std::uint64_t value);
+
+#ifndef _WINDOWS
+    // Keep /proc/self/task/<tid>/stat opened to avoid an open/close pair each time the thread state is read.
+    // Only called by the sampler thread: when the managed thread moves to another OS thread, the descriptor
+    // is closed by the next GetProcStatFileDescriptor call (that returns -1) and never while it is being read.
+    std::int32_t GetProcStatFileDescriptor(void);
+    inline void SetProcStatFileDescriptor(std::int32_t fd);
+
+    // Index of the CPU timer slot in the stack frames collector (-1 if no CPU timer is armed for this thread).
+    // Read by the sampler thread to poll the threads without CPU timer.
+    inline std::int32_t GetCpuTimerSlot(void) const;
+    inline void SetCpuTimerSlot(std::int32_t slot);
+
+    // CPU clock of the thread as returned by pthread_getcpuclockid (InvalidCpuClockId if unknown)
+    static constexpr clockid_t InvalidCpuClockId = -1;
+    inline clockid_t GetCpuClockId(void) const;
+    inline void SetCpuClockId(clockid_t cpuClockId);
+#endif
 
     inline void GetLastKnownSampleUnixTimestamp(std::uint64_t* realUnixTimeUtc, std::int64_t* highPrecisionNanosecsAtLastUnixTimeUpdate) const;
     inline void SetLastKnownSampleUnixTimestamp(std::uint64_t realUnixTimeUtc, std::int64_t highPrecisionNanosecsAtThisUnixTimeUpdate);
@@ -76,6 +112,14 @@ public:
     inline std::uint64_t GetSpanId() const;
     inline bool CanReadTraceContext() const;
 
+    // Span id seen when the thread was last selected for a wall time sample:
+    // used to detect threads that started/stopped working on a span since then
+    inline std::uint64_t GetLastSampledSpanId() const;
+    inline void SetLastSampledSpanId(std::uint64_t spanId);
+
+private:
+    void UpdateThreadLabels();
+
 private:
     static constexpr std::uint32_t MaxProfilerThreadInfoId = 0xFFFFFF; // = 16,777,215
     static std::atomic<std::uint32_t> s_nextProfilerThreadInfoId;
@@ -85,9 +129,19 @@ private:
     DWORD _osThreadId;
     HANDLE _osThreadHandle;
     shared::WSTRING _pThreadName;
+    // read by the samples transformation thread while updated by the CLR callbacks: atomic_load/atomic_store only
+    std::shared_ptr<const ThreadLabels> _threadLabels;
 
     std::uint64_t _lastSampleHighPrecisionTimestampNanoseconds;
-    std::uint64_t _cpuConsumptionMilliseconds;
+    std::uint64_t _lastSampledSpanId;
+    std::uint64_t _cpuConsumptionNanoseconds;
+#ifndef _WINDOWS
+    std::int32_t _procStatFd;
+    // set by SetOsInfo (CLR callback) when _procStatFd belongs to the previous OS thread
+    std::atomic<bool> _isProcStatFdStale;
+    std::atomic<std::int32_t> _cpuTimerSlot;
+    std::atomic<clockid_t> _cpuClockId;
+#endif
     std::uint64_t _lastKnownSampleUnixTimeUtc;
     std::int64_t _highPrecisionNanosecsAtLastUnixTimeUpdate;
 
@@ -125,12 +179,6 @@ inline HANDLE ManagedThreadInfo::GetOsThreadHandle(void) const
     return _osThreadHandle;
 }
 
-inline void ManagedThreadInfo::SetOsInfo(DWORD osThreadId, HANDLE osThreadHandle)
-{
-    _osThreadId = osThreadId;
-    _osThreadHandle = osThreadHandle;
-}
-
 inline const shared::WSTRING& ManagedThreadInfo::GetThreadName(void) const
 {
     return _pThreadName;
@@ -139,6 +187,12 @@ inline const shared::WSTRING& ManagedThreadInfo::GetThreadName(void) const
 inline void ManagedThreadInfo::SetThreadName(shared::WSTRING pThreadName)
 {
     _pThreadName = std::move(pThreadName);
+    UpdateThreadLabels();
+}
+
+inline std::shared_ptr<const ThreadLabels> ManagedThreadInfo::GetThreadLabels(void) const
+{
+    return std::atomic_load(&_threadLabels);
 }
 
 inline std::uint64_t ManagedThreadInfo::GetLastSampleHighPrecisionTimestampNanoseconds(void) const
@@ -153,18 +207,45 @@ inline std::uint64_t ManagedThreadInfo::SetLastSampleHighPrecisionTimestampNanos
     return prevValue;
 }
 
-inline std::uint64_t ManagedThreadInfo::GetCpuConsumptionMilliseconds(void) const
+inline std::uint64_t ManagedThreadInfo::GetCpuConsumptionNanoseconds(void) const
 {
-    return _cpuConsumptionMilliseconds;
+    return _cpuConsumptionNanoseconds;
 }
 
-inline std::uint64_t ManagedThreadInfo::SetCpuConsumptionMilliseconds(std::uint64_t value)
+inline std::uint64_t ManagedThreadInfo::SetCpuConsumptionNanoseconds(std::uint64_t value)
 {
-    std::uint64_t prevValue = _cpuConsumptionMilliseconds;
-    _cpuConsumptionMilliseconds = value;
+    std::uint64_t prevValue = _cpuConsumptionNanoseconds;
+    _cpuConsumptionNanoseconds = value;
     return prevValue;
 }
 
+#ifndef _WINDOWS
+inline void ManagedThreadInfo::SetProcStatFileDescriptor(std::int32_t fd)
+{
+    _procStatFd = fd;
+}
+
+inline std::int32_t ManagedThreadInfo::GetCpuTimerSlot(void) const
+{
+    return _cpuTimerSlot.load(std::memory_order_relaxed);
+}
+
+inline void ManagedThreadInfo::SetCpuTimerSlot(std::int32_t slot)
+{
+    _cpuTimerSlot.store(slot, std::memory_order_relaxed);
+}
+
+inline clockid_t ManagedThreadInfo::GetCpuClockId(void) const
+{
+    return _cpuClockId.load(std::memory_order_relaxed);
+}
+
+inline void ManagedThreadInfo::SetCpuClockId(clockid_t cpuClockId)
+{
+    _cpuClockId.store(cpuClockId, std::memory_order_relaxed);
+}
+#endif
+
 inline void ManagedThreadInfo::GetLastKnownSampleUnixTimestamp(std::uint64_t* realUnixTimeUtc, std::int64_t* highPrecisionNanosecsAtLastUnixTimeUpdate) const
 {
     if (realUnixTimeUtc != nullptr)
@@ -298,3 +379,13 @@ inline bool ManagedThreadInfo::CanReadTraceContext() const
     std::atomic_thread_fence(std::memory_order_acquire);
     return canReadTraceContext == 0;
 }
+
+inline std::uint64_t ManagedThreadInfo::GetLastSampledSpanId() const
+{
+    return _lastSampledSpanId;
+}
+
+inline void ManagedThreadInfo::SetLastSampledSpanId(std::uint64_t spanId)
+{
+    _lastSampledSpanId = spanId;
+}
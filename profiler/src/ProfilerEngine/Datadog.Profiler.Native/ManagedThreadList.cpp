@@ -5,11 +5,73 @@
 #include "Log.h"
 #include "OpSysTools.h"
 
+#include <algorithm>
+
 
 const std::uint32_t ManagedThreadList::MinBufferSize = 50;
+const std::uint32_t ManagedThreadList::MaxIteratorsCount;
+
+
+ManagedThreadList::ThreadsSnapshot::ThreadsSnapshot(std::vector<Entry> threads) :
+    Threads{std::move(threads)}
+{
+    ThreadsByClrId.reserve(Threads.size());
+    for (auto const& entry : Threads)
+    {
+        entry.pInfo->AddRef();
+        ThreadsByClrId.emplace_back(entry.pInfo->GetClrThreadId(), entry.pInfo);
+    }
+
+    std::sort(ThreadsByClrId.begin(), ThreadsByClrId.end(),
+              [](auto const& left, auto const& right) { return left.first < right.first; });
+}
+
+ManagedThreadList::ThreadsSnapshot::~ThreadsSnapshot()
+{
+    for (auto const& entry : Threads)
+    {
+        entry.pInfo->Release();
+    }
+}
+
+ManagedThreadList::SnapshotReader::SnapshotReader(ManagedThreadList* pThreadList) :
+    _pThreadList{pThreadList}
+{
+    // the reader must be counted in the current epoch before the snapshot is loaded (see ReclaimRetiredSnapshots)
+    while (true)
+    {
+        _epoch = _pThreadList->_epoch.load(std::memory_order_seq_cst);
+        auto& activeReadersCount = _pThreadList->_activeReadersCount[_epoch % 2];
+        activeReadersCount.fetch_add(1, std::memory_order_seq_cst);
+        if (_pThreadList->_epoch.load(std::memory_order_seq_cst) == _epoch)
+        {
+            break;
+        }
 
+        // a writer moved to the next epoch in between: the count of the previous one might already be checked
+        activeReadersCount.fetch_sub(1, std::memory_order_release);
+    }
+
+    _pSnapshot = _pThreadList->_pSnapshot.load(std::memory_order_seq_cst);
+}
+
+ManagedThreadList::SnapshotReader::~SnapshotReader()
+{
+    _pThreadList->_activeReadersCount[_epoch % 2].fetch_sub(1, std::memory_order_release);
+}
+
+const ManagedThreadList::ThreadsSnapshot* ManagedThreadList::SnapshotReader::operator->() const
+{
+    return _pSnapshot;
+}
 
 ManagedThreadList::ManagedThreadList(ICorProfilerInfo4* pCorProfilerInfo) :
+    _nextInsertionOrder{0},
+    _pSnapshot{new ThreadsSnapshot({})},
+    _epoch{0},
+    _activeReadersCount{},
+    _iterators{},
+    _iteratorsCount{0},
     _pCorProfilerInfo{pCorProfilerInfo}
 {
     _threads.reserve(MinBufferSize);
@@ -27,9 +89,17 @@ ManagedThreadList::~ManagedThreadList()
 {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-    for (auto* pInfo: _threads)
+    // no reader is expected at that point
+    for (auto const& retired : _retiredSnapshots)
+    {
+        delete retired.pSnapshot;
+    }
+    _retiredSnapshots.clear();
+    delete _pSnapshot.exchange(nullptr);
+
+    for (auto const& entry : _threads)
     {
-        pInfo->Release();
+        entry.pInfo->Release();
     }
 
     ICorProfilerInfo4* pCorProfilerInfo = _pCorProfilerInfo;
@@ -71,85 +141,84 @@ ManagedThreadInfo* ManagedThreadList::GetOrCreate(ThreadID clrThreadId)
     {
         pInfo = new ManagedThreadInfo(clrThreadId);
         pInfo->AddRef();
-        _threads.push_back(pInfo);
+        _threads.push_back({_nextInsertionOrder++, pInfo});
 
         _lookupByClrThreadId[clrThreadId] = pInfo;
         _lookupByProfilerThreadInfoId[pInfo->GetProfilerThreadInfoId()] = pInfo;
+
+        PublishSnapshot();
     }
 
     return pInfo;
 }
 
-void ManagedThreadList::UpdateIterators(uint32_t removalPos)
+void ManagedThreadList::PublishSnapshot()
 {
-    // Interators are positions (in the threads vector) pointing to the next thread to return via LoopNext.
-    // So, when a thread is removed from the vector at a position BEFORE an iterator position,
-    // this iterator needs to be moved left by 1 to keep on pointing to the same thread.
-    // There is no need to update iterators pointing to threads before or at the same spot
-    // as the removal position because they will point to the same thread
-    //
-    // In the following example, the thread at position 1 will be removed and an iterator
-    // is pointing to ^ the thread in the third position (i.e. at pos = 2).
-    //      x
-    //  T0  T1  T2  T3
-    //          ^ = 2
-    // -->          |
-    //  T0  T2  T3  v
-    //      ^ = 1 =(2 - 1)
-    //
-    // After the removal, this iterator should now point to the thread at position 1 instead of 2
-    //
-    // If the new pos is beyond the vector (i.e. the last element was removed),
-    // then reset the iterator to the beginning of the vector:
-    //          x
-    //  T0  T1  T2  (_threads.size() == 2 when this function is called)
-    //          ^ = 2
-    // -->
-    //  T0  T1
-    //  ^ = 0  (reset)
-    //
-    for (auto i = _iterators.begin(); i != _iterators.end(); ++i)
-    {
-        uint32_t pos = *i;
-        if (removalPos < pos)
-        {
-            pos = pos - 1;
-        }
+    // !!! This helper method must be called under the update lock (_mutex) !!!
+
+    auto* pOldSnapshot = _pSnapshot.exchange(new ThreadsSnapshot(_threads), std::memory_order_seq_cst);
+    _retiredSnapshots.push_back({pOldSnapshot, _epoch.load(std::memory_order_relaxed)});
 
-        // reset iterator if needed
-        if (pos >= _threads.size())  // the thread has already been removed from the vector
+    ReclaimRetiredSnapshots();
+}
+
+void ManagedThreadList::ReclaimRetiredSnapshots()
+{
+    // !!! This helper method must be called under the update lock (_mutex) !!!
+
+    // A reader is counted in the epoch it started in BEFORE loading the current snapshot.
+    // So a retired snapshot could only be seen by readers of its retirement epoch or of an older one.
+    // The epoch N+1 starts only when no reader of the epoch N-1 is active (same counter):
+    // when the current epoch is N, no reader of the epochs up to N-2 is active.
+    // Try to move forward twice to reclaim the snapshot that has just been retired if possible.
+    auto epoch = _epoch.load(std::memory_order_relaxed);
+    for (auto i = 0; i < 2; i++)
+    {
+        if (_activeReadersCount[(epoch + 1) % 2].load(std::memory_order_seq_cst) != 0)
         {
-            pos = 0;
+            break;
         }
 
-        *i = pos;
+        epoch++;
+        _epoch.store(epoch, std::memory_order_seq_cst);
     }
+
+    // the others will be deleted by the next updates
+    auto it = std::remove_if(_retiredSnapshots.begin(), _retiredSnapshots.end(),
+                             [epoch](auto const& retired) {
+                                 if (retired.Epoch + 2 > epoch)
+                                 {
+                                     return false;
+                                 }
+
+                                 delete retired.pSnapshot;
+                                 return true;
+                             });
+    _retiredSnapshots.erase(it, _retiredSnapshots.end());
 }
 
 bool ManagedThreadList::UnregisterThread(ThreadID clrThreadId, ManagedThreadInfo** ppThreadInfo)
 {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-    uint32_t pos = 0;
     for (auto i = _threads.begin(); i != _threads.end(); ++i)
     {
-        auto pInfo = *i;
+        auto pInfo = i->pInfo;
         if (pInfo->GetClrThreadId() == clrThreadId)
         {
             // NOTE: the caller needs to release the returned ManagedThreadInfo*
             *ppThreadInfo = pInfo;
 
             // remove it from the storage and index
+            // (iterators are insertion orders so they don't need to be updated)
             _threads.erase(i);
             _lookupByClrThreadId.erase(pInfo->GetClrThreadId());
             _lookupByProfilerThreadInfoId.erase(pInfo->GetProfilerThreadInfoId());
 
-            // iterators might need to be updated
-            UpdateIterators(pos);
+            PublishSnapshot();
 
             return true;
         }
-        pos++;
     }
 
     Log::Error("ManagedThreadList: thread ", std::dec, clrThreadId, "cannot be unregister because not in the list");
@@ -200,46 +269,57 @@ bool ManagedThreadList::SetThreadName(ThreadID clrThreadId, const shared::WSTRIN
 
 uint32_t ManagedThreadList::Count(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
-    return static_cast<uint32_t>(_threads.size());
+    SnapshotReader snapshot(this);
+    return static_cast<uint32_t>(snapshot->Threads.size());
 }
 
 uint32_t ManagedThreadList::CreateIterator()
 {
-    uint32_t iterator = static_cast<uint32_t>(_iterators.size());
-    _iterators.push_back(0);
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    uint32_t iterator = _iteratorsCount.load();
+    if (iterator >= MaxIteratorsCount)
+    {
+        Log::Error("ManagedThreadList: no more than ", MaxIteratorsCount, " iterators can be created");
+        return MaxIteratorsCount;
+    }
+
+    _iterators[iterator] = 0;
+    _iteratorsCount.store(iterator + 1, std::memory_order_release);
     return iterator;
 }
 
 ManagedThreadInfo* ManagedThreadList::LoopNext(uint32_t iterator)
 {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
-
-    auto activeThreadCount = _threads.size();
-    if (activeThreadCount == 0)
+    if (iterator >= _iteratorsCount.load(std::memory_order_acquire))
     {
         return nullptr;
     }
 
-    if (iterator >= _iterators.size())
+    SnapshotReader snapshot(this);
+
+    auto const& threads = snapshot->Threads;
+    if (threads.empty())
     {
         return nullptr;
     }
 
-    uint32_t pos = _iterators[iterator];
-    ManagedThreadInfo* pInfo = _threads[pos];
+    // The iterator is the insertion order of the next thread to return: if this thread has been
+    // removed since the previous call, the next one still in the list is returned instead.
+    // Go back to the first thread if the end is reached.
+    auto next = std::lower_bound(
+        threads.cbegin(), threads.cend(), _iterators[iterator],
+        [](ThreadsSnapshot::Entry const& entry, std::uint64_t order) { return entry.Order < order; });
+    if (next == threads.cend())
+    {
+        next = threads.cbegin();
+    }
+
+    ManagedThreadInfo* pInfo = next->pInfo;
     pInfo->AddRef(); // Caller must release
 
     // move the iterator to the next thread
-    if (pos < activeThreadCount - 1)
-    {
-        pos++;
-    }
-    else // go back to the first thread if the end is reached
-    {
-        pos = 0;
-    }
-    _iterators[iterator] = pos;
+    _iterators[iterator] = next->Order + 1;
 
     return pInfo;
 }
@@ -349,15 +429,35 @@ HRESULT ManagedThreadList::TryGetCurrentThreadInfo(ManagedThreadInfo** ppThreadI
         return E_FAIL;
     }
 
-    *ppThreadInfo = FindByClrId(clrThreadId);
-    if (*ppThreadInfo != nullptr)
+    // lock-free lookup: this is called for each exception/P/Invoke
+    SnapshotReader snapshot(this);
+
+    auto const& threads = snapshot->ThreadsByClrId;
+    auto elem = std::lower_bound(
+        threads.cbegin(), threads.cend(), clrThreadId,
+        [](std::pair<ThreadID, ManagedThreadInfo*> const& entry, ThreadID id) { return entry.first < id; });
+    if ((elem == threads.cend()) || (elem->first != clrThreadId))
     {
-        return S_OK;
+        *ppThreadInfo = nullptr;
+        return S_FALSE;
     }
-    else
+
+    // the current thread cannot be unregistered while it is running so there is no need to AddRef
+    *ppThreadInfo = elem->second;
+    return S_OK;
+}
+
+ManagedThreadInfo* ManagedThreadList::GetThreadInfo(ThreadID clrThreadId)
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    ManagedThreadInfo* pInfo = FindByClrId(clrThreadId);
+    if (pInfo != nullptr)
     {
-        return S_FALSE;
+        pInfo->AddRef(); // caller must release
     }
+
+    return pInfo;
 }
 
 ManagedThreadInfo* ManagedThreadList::FindByClrId(ThreadID clrThreadId)
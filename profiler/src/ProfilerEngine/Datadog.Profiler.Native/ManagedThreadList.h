@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -45,29 +47,89 @@ public:
                           const std::uint32_t threadNameBuffLen,
                           std::uint32_t* pActualThreadNameLen) override;
     HRESULT TryGetCurrentThreadInfo(ManagedThreadInfo** ppThreadInfo) override;
+    ManagedThreadInfo* GetThreadInfo(ThreadID clrThreadId) override;
+
+private:
+    // Immutable view of the threads published each time a thread is created or destroyed.
+    // A snapshot keeps a reference on each of its threads so they stay alive as long as it can be read.
+    class ThreadsSnapshot
+    {
+    public:
+        struct Entry
+        {
+            // order of insertion in the list: used as iterator position
+            std::uint64_t Order;
+            ManagedThreadInfo* pInfo;
+        };
+
+        ThreadsSnapshot(std::vector<Entry> threads);
+        ~ThreadsSnapshot();
+
+        // sorted by insertion order
+        const std::vector<Entry> Threads;
+        // sorted by CLR thread id
+        std::vector<std::pair<ThreadID, ManagedThreadInfo*>> ThreadsByClrId;
+    };
+
+    // Readers (LoopNext, Count and TryGetCurrentThreadInfo) never take the lock: they only
+    // increment the active readers count of the current epoch while they are using the current snapshot.
+    // A writer moves to the next epoch once the readers of the previous one are gone; a replaced snapshot
+    // is deleted when two epochs have passed since it was retired (none of its readers can be active).
+    // New readers are counted in the other epoch, so a continuous flow of readers does not prevent
+    // the retired snapshots from being reclaimed.
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(ManagedThreadList* pThreadList);
+        ~SnapshotReader();
+
+        const ThreadsSnapshot* operator->() const;
+
+    private:
+        ManagedThreadList* _pThreadList;
+        const ThreadsSnapshot* _pSnapshot;
+        std::uint64_t _epoch;
+    };
+
+    struct RetiredSnapshot
+    {
+        const ThreadsSnapshot* pSnapshot;
+        // epoch when the snapshot was replaced
+        std::uint64_t Epoch;
+    };
 
 private:
     ManagedThreadInfo* GetOrCreate(ThreadID clrThreadId);
+    void PublishSnapshot();
+    void ReclaimRetiredSnapshots();
 
 private:
     const char* _serviceName = "ManagedThreadList";
     static const std::uint32_t MinBufferSize;
+    static const std::uint32_t MaxIteratorsCount = 8;
 
 private:
-    // We do most operations under this lock.
-    // We expect very little contention on this lock:
-    // Modifying operations are expected to be rare and, especially in a thread-pooled architecture.
-    // Reading (i.e., LoopNext(..)) happens from the same sampler-thread.
+    // Modifying operations are done under this lock.
+    // They are expected to be rare, especially in a thread-pooled architecture.
     std::recursive_mutex _mutex;
 
     // Threads are stored in a vector where new threads are added at the end
     // Also, threads are "directly" accessible from their CLR ThreadID via an index
-    std::vector<ManagedThreadInfo*> _threads;
+    std::vector<ThreadsSnapshot::Entry> _threads;
+    std::uint64_t _nextInsertionOrder;
     std::unordered_map<ThreadID, ManagedThreadInfo*> _lookupByClrThreadId;
 
-    // An iterator is just a position in the vector corresponding to the next thread to be returned by LoopNext
-    // so keep track of them in a vector of positions initialized to 0
-    std::vector<uint32_t> _iterators;
+    std::atomic<const ThreadsSnapshot*> _pSnapshot;
+    std::atomic<std::uint64_t> _epoch;
+    // active readers count of the even and odd epochs
+    std::array<std::atomic<std::int32_t>, 2> _activeReadersCount;
+    std::vector<RetiredSnapshot> _retiredSnapshots;
+
+    // An iterator is the insertion order of the next thread to be returned by LoopNext:
+    // removing threads does not require to update the iterators
+    // (each iterator is expected to be used by a single thread)
+    std::array<std::uint64_t, MaxIteratorsCount> _iterators;
+    std::atomic<std::uint32_t> _iteratorsCount;
 
     // ProfilerThreadInfoId is unique numeric ID of a ManagedThreadInfo record.
     // We cannot use the OS id, because we do not always have it, and we cannot use the Clr internal thread id,
@@ -85,7 +147,6 @@ private:
     ICorProfilerInfo4* _pCorProfilerInfo;
 
 private:
-    void UpdateIterators(uint32_t pos);
     ManagedThreadInfo* FindByClrId(ThreadID clrThreadId);
     ManagedThreadInfo* FindByProfilerId(uint32_t profilerThreadInfoId);
 };
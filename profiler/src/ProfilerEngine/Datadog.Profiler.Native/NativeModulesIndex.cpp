@@ -0,0 +1,407 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "NativeModulesIndex.h"
+
+#include <algorithm>
+#include <sstream>
+
+#ifndef _WINDOWS
+#include <cxxabi.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Log.h"
+#include "ScopeFinalizer.h"
+
+#include "shared/src/native-src/dd_filesystem.hpp"
+// namespace fs is an alias defined in "dd_filesystem.hpp"
+
+NativeModulesIndex::NativeModulesIndex() :
+    _pCurrentSnapshot{nullptr},
+    _lastRefreshCheckNs{0}
+{
+}
+
+NativeModulesIndex::~NativeModulesIndex() = default;
+
+#ifdef _WINDOWS
+
+bool NativeModulesIndex::TryGetFrame(uintptr_t instructionPointer, std::string_view& moduleName, std::string_view& frame)
+{
+    return false;
+}
+
+#else
+
+bool NativeModulesIndex::TryGetFrame(uintptr_t instructionPointer, std::string_view& moduleName, std::string_view& frame)
+{
+    const Snapshot* pSnapshot = _pCurrentSnapshot.load(std::memory_order_acquire);
+    const AddressRange* pRange = Find(pSnapshot, instructionPointer);
+    if (pRange == nullptr)
+    {
+        // the module might have been loaded after the snapshot was built
+        pSnapshot = TryRefresh(pSnapshot);
+        pRange = Find(pSnapshot, instructionPointer);
+        if (pRange == nullptr)
+        {
+            return false;
+        }
+    }
+
+    moduleName = pRange->pModule->Path;
+    frame = pRange->pModule->GetFrame(instructionPointer);
+    return true;
+}
+
+const NativeModulesIndex::AddressRange* NativeModulesIndex::Find(const Snapshot* pSnapshot, uintptr_t instructionPointer)
+{
+    if (pSnapshot == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto const& ranges = pSnapshot->Ranges;
+
+    // first range starting after the address: the candidate is the one before
+    auto it = std::upper_bound(
+        ranges.cbegin(), ranges.cend(), instructionPointer,
+        [](uintptr_t ip, AddressRange const& range) { return ip < range.Start; });
+
+    if (it == ranges.cbegin())
+    {
+        return nullptr;
+    }
+
+    --it;
+    if (instructionPointer >= it->End)
+    {
+        return nullptr;
+    }
+
+    return &(*it);
+}
+
+namespace {
+struct LoadCounters
+{
+    unsigned long long Adds;
+    unsigned long long Subs;
+};
+
+struct LoadedSegment
+{
+    std::string Path;
+    uintptr_t LoadBias;
+    uintptr_t Start;
+    uintptr_t End;
+};
+
+int GetLoadCounters(struct dl_phdr_info* info, size_t size, void* data)
+{
+    auto* pCounters = static_cast<LoadCounters*>(data);
+    pCounters->Adds = info->dlpi_adds;
+    pCounters->Subs = info->dlpi_subs;
+
+    // the counters are the same for all modules: stop the iteration
+    return 1;
+}
+
+int GetLoadedSegments(struct dl_phdr_info* info, size_t size, void* data)
+{
+    auto* pSegments = static_cast<std::vector<LoadedSegment>*>(data);
+
+    std::string path;
+    if ((info->dlpi_name == nullptr) || (info->dlpi_name[0] == '\0'))
+    {
+        // the main executable has no name
+        char buffer[4096];
+        auto length = readlink("/proc/self/exe", buffer, sizeof(buffer) - 1);
+        if (length <= 0)
+        {
+            return 0;
+        }
+        path.assign(buffer, length);
+    }
+    else
+    {
+        path = info->dlpi_name;
+    }
+
+    for (auto i = 0; i < info->dlpi_phnum; i++)
+    {
+        auto const& header = info->dlpi_phdr[i];
+        if ((header.p_type != PT_LOAD) || ((header.p_flags & PF_X) == 0))
+        {
+            continue;
+        }
+
+        auto start = static_cast<uintptr_t>(info->dlpi_addr + header.p_vaddr);
+        pSegments->push_back({path, static_cast<uintptr_t>(info->dlpi_addr), start, start + header.p_memsz});
+    }
+
+    return 0;
+}
+} // namespace
+
+const NativeModulesIndex::Snapshot* NativeModulesIndex::TryRefresh(const Snapshot* pCurrent)
+{
+    std::unique_lock<std::mutex> lock(_refreshLock, std::defer_lock);
+    if (pCurrent == nullptr)
+    {
+        // the first snapshot is always needed
+        lock.lock();
+    }
+    else
+    {
+        // addresses that do not belong to any module (such as JIT stubs) do not pay for the check
+        // each time they are looked up; neither do they wait for another thread already checking
+        auto nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        auto lastRefreshCheckNs = _lastRefreshCheckNs.load(std::memory_order_relaxed);
+        if ((nowNs - lastRefreshCheckNs < std::chrono::nanoseconds(MinRefreshInterval).count()) || !lock.try_lock())
+        {
+            return nullptr;
+        }
+        _lastRefreshCheckNs.store(nowNs, std::memory_order_relaxed);
+    }
+
+    // another thread might have already rebuilt the snapshot
+    auto* pLatest = _pCurrentSnapshot.load(std::memory_order_acquire);
+    if (pLatest != pCurrent)
+    {
+        return pLatest;
+    }
+
+    // cheap check (no module iteration) to avoid rebuilding the same snapshot
+    LoadCounters counters = {0, 0};
+    dl_iterate_phdr(GetLoadCounters, &counters);
+    if ((pLatest != nullptr) && (pLatest->Adds == counters.Adds) && (pLatest->Subs == counters.Subs))
+    {
+        return nullptr;
+    }
+
+    std::vector<LoadedSegment> segments;
+    dl_iterate_phdr(GetLoadedSegments, &segments);
+
+    auto pSnapshot = std::make_unique<Snapshot>();
+    pSnapshot->Adds = counters.Adds;
+    pSnapshot->Subs = counters.Subs;
+    pSnapshot->Ranges.reserve(segments.size());
+
+    for (auto& segment : segments)
+    {
+        auto key = std::make_pair(segment.Path, segment.LoadBias);
+        auto it = _modules.find(key);
+        if (it == _modules.end())
+        {
+            it = _modules.emplace(std::move(key), std::make_unique<Module>(std::move(segment.Path), segment.LoadBias)).first;
+        }
+
+        pSnapshot->Ranges.push_back({segment.Start, segment.End, it->second.get()});
+    }
+
+    std::sort(
+        pSnapshot->Ranges.begin(), pSnapshot->Ranges.end(),
+        [](AddressRange const& left, AddressRange const& right) { return left.Start < right.Start; });
+
+    Log::Debug("NativeModulesIndex: ", pSnapshot->Ranges.size(), " executable ranges found in ", _modules.size(), " modules.");
+
+    pLatest = pSnapshot.get();
+    _snapshots.push_back(std::move(pSnapshot));
+    _pCurrentSnapshot.store(pLatest, std::memory_order_release);
+
+    return pLatest;
+}
+
+NativeModulesIndex::Module::Module(std::string path, uintptr_t loadBias) :
+    Path{std::move(path)},
+    _loadBias{loadBias},
+    _frames{nullptr}
+{
+    // keep only the filename
+    _filename = fs::path(Path).filename().string();
+
+    std::stringstream builder;
+    builder << "|lm:" << _filename << " |ns:NativeCode |ct:" << _filename << " |fn:Function";
+    _moduleFrame = builder.str();
+}
+
+NativeModulesIndex::Module::~Module()
+{
+    if (_frames == nullptr)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < _symbols.size(); i++)
+    {
+        delete _frames[i].load(std::memory_order_relaxed);
+    }
+}
+
+std::string_view NativeModulesIndex::Module::GetFrame(uintptr_t instructionPointer)
+{
+    std::call_once(_symbolsLoaded, [this]() { LoadSymbols(); });
+
+    const Symbol* pSymbol = FindSymbol(instructionPointer - _loadBias);
+    if (pSymbol == nullptr)
+    {
+        return _moduleFrame;
+    }
+
+    auto& frameSlot = _frames[pSymbol - _symbols.data()];
+    const std::string* pFrame = frameSlot.load(std::memory_order_acquire);
+    if (pFrame != nullptr)
+    {
+        return *pFrame;
+    }
+
+    // if another thread builds the same frame at the same time, its frame is kept
+    const std::string* pNewFrame = CreateFrame(pSymbol);
+    if (frameSlot.compare_exchange_strong(pFrame, pNewFrame, std::memory_order_acq_rel))
+    {
+        return *pNewFrame;
+    }
+
+    delete pNewFrame;
+    return *pFrame;
+}
+
+std::string* NativeModulesIndex::Module::CreateFrame(const Symbol* pSymbol) const
+{
+    const char* name = _stringTable.data() + pSymbol->NameOffset;
+
+    int status = 0;
+    char* demangledName = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    auto demangledNameFinalizer = CreateScopeFinalizer([demangledName] { free(demangledName); });
+
+    std::stringstream builder;
+    builder << "|lm:" << _filename << " |ns:NativeCode |ct:" << _filename << " |fn:" << ((status == 0) ? demangledName : name);
+
+    return new std::string(builder.str());
+}
+
+const NativeModulesIndex::Symbol* NativeModulesIndex::Module::FindSymbol(uintptr_t relativeAddress) const
+{
+    auto it = std::upper_bound(
+        _symbols.cbegin(), _symbols.cend(), relativeAddress,
+        [](uintptr_t address, Symbol const& symbol) { return address < symbol.Start; });
+
+    if (it == _symbols.cbegin())
+    {
+        return nullptr;
+    }
+
+    --it;
+    if (relativeAddress >= it->Start + it->Size)
+    {
+        return nullptr;
+    }
+
+    return &(*it);
+}
+
+void NativeModulesIndex::Module::LoadSymbols()
+{
+    int fd = open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+        // vdso or deleted file: only the module will be provided
+        return;
+    }
+    auto fdFinalizer = CreateScopeFinalizer([fd] { close(fd); });
+
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) != 0) || (static_cast<size_t>(fileStat.st_size) < sizeof(ElfW(Ehdr))))
+    {
+        return;
+    }
+
+    auto fileSize = static_cast<size_t>(fileStat.st_size);
+    void* pFile = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (pFile == MAP_FAILED)
+    {
+        return;
+    }
+    auto mapFinalizer = CreateScopeFinalizer([pFile, fileSize] { munmap(pFile, fileSize); });
+
+    auto* pBase = static_cast<const uint8_t*>(pFile);
+    auto* pHeader = reinterpret_cast<const ElfW(Ehdr)*>(pBase);
+    if ((memcmp(pHeader->e_ident, ELFMAG, SELFMAG) != 0) ||
+        (pHeader->e_shentsize != sizeof(ElfW(Shdr))) ||
+        (pHeader->e_shoff + pHeader->e_shnum * sizeof(ElfW(Shdr)) > fileSize))
+    {
+        Log::Debug("NativeModulesIndex: invalid ELF header for ", Path);
+        return;
+    }
+
+    auto* pSections = reinterpret_cast<const ElfW(Shdr)*>(pBase + pHeader->e_shoff);
+
+    // .symtab contains all functions but is removed from stripped binaries: fallback to .dynsym
+    const ElfW(Shdr)* pSymbolsSection = nullptr;
+    for (auto i = 0; i < pHeader->e_shnum; i++)
+    {
+        if (pSections[i].sh_type == SHT_SYMTAB)
+        {
+            pSymbolsSection = &pSections[i];
+            break;
+        }
+
+        if ((pSections[i].sh_type == SHT_DYNSYM) && (pSymbolsSection == nullptr))
+        {
+            pSymbolsSection = &pSections[i];
+        }
+    }
+
+    if ((pSymbolsSection == nullptr) ||
+        (pSymbolsSection->sh_link >= pHeader->e_shnum) ||
+        (pSymbolsSection->sh_offset + pSymbolsSection->sh_size > fileSize))
+    {
+        return;
+    }
+
+    auto const& stringsSection = pSections[pSymbolsSection->sh_link];
+    if ((stringsSection.sh_size == 0) || (stringsSection.sh_offset + stringsSection.sh_size > fileSize))
+    {
+        return;
+    }
+
+    auto* pSymbols = reinterpret_cast<const ElfW(Sym)*>(pBase + pSymbolsSection->sh_offset);
+    auto symbolsCount = pSymbolsSection->sh_size / sizeof(ElfW(Sym));
+    for (size_t i = 0; i < symbolsCount; i++)
+    {
+        auto const& symbol = pSymbols[i];
+        if ((ELF64_ST_TYPE(symbol.st_info) != STT_FUNC) ||
+            (symbol.st_shndx == SHN_UNDEF) ||
+            (symbol.st_value == 0) ||
+            (symbol.st_size == 0) ||
+            (symbol.st_name >= stringsSection.sh_size))
+        {
+            continue;
+        }
+
+        _symbols.push_back({static_cast<uintptr_t>(symbol.st_value), static_cast<uintptr_t>(symbol.st_size), symbol.st_name});
+    }
+
+    std::sort(
+        _symbols.begin(), _symbols.end(),
+        [](Symbol const& left, Symbol const& right) { return left.Start < right.Start; });
+
+    // keep a copy of the names with a trailing '\0' in case the section is not properly terminated
+    auto* pStrings = reinterpret_cast<const char*>(pBase + stringsSection.sh_offset);
+    _stringTable.assign(pStrings, pStrings + stringsSection.sh_size);
+    _stringTable.push_back('\0');
+
+    _frames = std::make_unique<std::atomic<const std::string*>[]>(_symbols.size());
+
+    Log::Debug("NativeModulesIndex: ", _symbols.size(), " functions found in ", Path);
+}
+
+#endif
@@ -0,0 +1,113 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Maps native instruction pointers to the module (and function when symbols are available)
+// that contains them.
+// The executable address ranges of all loaded modules are kept in an immutable sorted snapshot
+// so that a lookup is a lock-free binary search. A new snapshot is built only when an address
+// is not found and modules were loaded/unloaded since the previous one (i.e. after a dlopen/dlclose).
+// Since most addresses that are not found do not belong to any module (JIT-compiled code, stubs),
+// the loaded modules are checked at most once per MinRefreshInterval.
+// Function names come from the .symtab section of the module file (or .dynsym if stripped) and are
+// loaded lazily the first time an address of the module is resolved. Each frame is built once and
+// never changed afterwards so that it is shared without lock nor copy.
+//
+// /!\ Only implemented on Linux: on Windows, TryGetFrame always returns false.
+class NativeModulesIndex
+{
+public:
+    NativeModulesIndex();
+    ~NativeModulesIndex();
+
+    NativeModulesIndex(NativeModulesIndex const&) = delete;
+    NativeModulesIndex& operator=(NativeModulesIndex const&) = delete;
+
+    // Returns false if the given address does not belong to any loaded module.
+    // The returned views are valid as long as the index is alive.
+    bool TryGetFrame(uintptr_t instructionPointer, std::string_view& moduleName, std::string_view& frame);
+
+private:
+    struct Symbol
+    {
+        uintptr_t Start;
+        uintptr_t Size;
+        uint32_t NameOffset;
+    };
+
+    class Module
+    {
+    public:
+        Module(std::string path, uintptr_t loadBias);
+        ~Module();
+
+        Module(Module const&) = delete;
+        Module& operator=(Module const&) = delete;
+
+        std::string_view GetFrame(uintptr_t instructionPointer);
+
+    private:
+        void LoadSymbols();
+        const Symbol* FindSymbol(uintptr_t relativeAddress) const;
+        std::string* CreateFrame(const Symbol* pSymbol) const;
+
+    public:
+        const std::string Path;
+
+    private:
+        const uintptr_t _loadBias;
+        std::string _moduleFrame;
+        std::string _filename;
+
+        std::once_flag _symbolsLoaded;
+        std::vector<Symbol> _symbols;
+        std::vector<char> _stringTable;
+
+        // frame of each symbol (same index as in _symbols) set the first time the symbol is resolved
+        std::unique_ptr<std::atomic<const std::string*>[]> _frames;
+    };
+
+    struct AddressRange
+    {
+        uintptr_t Start;
+        uintptr_t End;
+        Module* pModule;
+    };
+
+    struct Snapshot
+    {
+        std::vector<AddressRange> Ranges;
+        unsigned long long Adds;
+        unsigned long long Subs;
+    };
+
+    static const AddressRange* Find(const Snapshot* pSnapshot, uintptr_t instructionPointer);
+    // Returns nullptr if no newer snapshot is available
+    const Snapshot* TryRefresh(const Snapshot* pCurrent);
+
+private:
+    static constexpr std::chrono::milliseconds MinRefreshInterval = std::chrono::milliseconds(1000);
+
+    std::atomic<const Snapshot*> _pCurrentSnapshot;
+    std::atomic<std::int64_t> _lastRefreshCheckNs;
+
+    // protect the fields below: only used when the snapshot needs to be rebuilt
+    std::mutex _refreshLock;
+
+    // previous snapshots might still be read by another thread so they are kept alive
+    // (modules are rarely loaded so this list stays small)
+    std::vector<std::unique_ptr<Snapshot>> _snapshots;
+
+    // modules are shared between snapshots to avoid loading their symbols more than once
+    std::map<std::pair<std::string, uintptr_t>, std::unique_ptr<Module>> _modules;
+};
@@ -49,6 +49,13 @@ public:
     static std::string GetProcessName();
 
     static bool ParseThreadInfo(std::string line, char& state, int32_t& userTime, int32_t& kernelTime)
+    {
+        return ParseThreadInfo(line.c_str(), line.size(), state, userTime, kernelTime);
+    }
+
+    // Allocation-free parsing of the content of /proc/self/task/<tid>/stat.
+    // The output parameters are updated only if the parsing succeeds.
+    static bool ParseThreadInfo(const char* line, std::size_t length, char& state, int32_t& userTime, int32_t& kernelTime)
     {
         // based on https://linux.die.net/man/5/proc
         // state  = 3rd position  and 'R' for Running
@@ -57,16 +64,53 @@ public:
 
         // The thread name is in second position and wrapped by ()
         // Since the name can contain SPACE and () characters, skip it before scanning the values
-        auto pos = line.find_last_of(")");
-        const char* pEnd = line.c_str() + pos + 1;
+        const char* pos = line + length;
+        while ((pos > line) && (*(pos - 1) != ')'))
+        {
+            pos--;
+        }
+        if (pos == line)
+        {
+            return false;
+        }
 
-#ifdef _WINDOWS
-        bool result = sscanf_s(pEnd, " %c %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %d %d", &state, 1, &userTime, &kernelTime) == 3;
-#else
-        bool result = sscanf(pEnd, " %c %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %d %d", &state, &userTime, &kernelTime) == 3;
-#endif
+        const char* end = line + length;
+
+        // " R" --> state
+        if ((end - pos < 2) || (pos[0] != ' '))
+        {
+            return false;
+        }
+        char parsedState = pos[1];
+        pos += 2;
+
+        // skip fields 4 to 13
+        for (int i = 0; i < 10; i++)
+        {
+            pos = SkipStatField(pos, end);
+            if (pos == nullptr)
+            {
+                return false;
+            }
+        }
+
+        int32_t parsedUserTime;
+        int32_t parsedKernelTime;
+        pos = ParseStatNumber(pos, end, parsedUserTime);
+        if (pos == nullptr)
+        {
+            return false;
+        }
+        pos = ParseStatNumber(pos, end, parsedKernelTime);
+        if (pos == nullptr)
+        {
+            return false;
+        }
 
-        return result;
+        state = parsedState;
+        userTime = parsedUserTime;
+        kernelTime = parsedKernelTime;
+        return true;
     }
 
     static bool IsSafeToStartProfiler();
@@ -79,6 +123,50 @@ private:
 
     static std::int64_t GetHighPrecisionNanosecondsFallback(void);
 
+    // skip " <field>" and return the position after the field (nullptr if the field is missing)
+    static const char* SkipStatField(const char* pos, const char* end)
+    {
+        if ((pos >= end) || (*pos != ' '))
+        {
+            return nullptr;
+        }
+        pos++;
+
+        const char* fieldStart = pos;
+        while ((pos < end) && (*pos != ' ') && (*pos != '\n'))
+        {
+            pos++;
+        }
+
+        return (pos == fieldStart) ? nullptr : pos;
+    }
+
+    // parse " <number>" and return the position after the number (nullptr if it is not a number)
+    static const char* ParseStatNumber(const char* pos, const char* end, int32_t& value)
+    {
+        if ((pos >= end) || (*pos != ' '))
+        {
+            return nullptr;
+        }
+        pos++;
+
+        const char* numberStart = pos;
+        int64_t result = 0;
+        while ((pos < end) && (*pos >= '0') && (*pos <= '9'))
+        {
+            result = result * 10 + (*pos - '0');
+            pos++;
+        }
+
+        if ((pos == numberStart) || ((pos < end) && (*pos != ' ') && (*pos != '\n')))
+        {
+            return nullptr;
+        }
+
+        value = static_cast<int32_t>(result);
+        return pos;
+    }
+
 #ifdef _WINDOWS
     typedef HRESULT(__stdcall* SetThreadDescriptionDelegate_t)(HANDLE threadHandle, PCWSTR pThreadDescription);
     typedef HRESULT(__stdcall* GetThreadDescriptionDelegate_t)(HANDLE hThread, PWSTR* ppThreadDescription);
@@ -5,6 +5,11 @@
 #include "cor.h"
 #include "corprof.h"
 
+#ifndef _WINDOWS
+#include <sys/types.h>
+#include <time.h>
+#endif
+
 #include "StackFramesCollectorBase.h"
 
 // forward declarations
@@ -19,6 +24,11 @@ class IManagedThreadList;
 // Here are forward declarations to avoid hard coupling
 namespace OsSpecificApi {
 std::unique_ptr<StackFramesCollectorBase> CreateNewStackFramesCollectorInstance(ICorProfilerInfo4* pCorProfilerInfo);
+// CPU times are expressed in nanoseconds
 uint64_t GetThreadCpuTime(ManagedThreadInfo* pThreadInfo);
 bool IsRunning(ManagedThreadInfo* pThreadInfo, uint64_t& cpuTime);
+#ifndef _WINDOWS
+// CPU clock of the current thread (usable with clock_gettime and timer_create)
+bool GetCurrentThreadCpuClockId(clockid_t& cpuClockId);
+#endif
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Log.h"
 #include "ManagedThreadList.h"
 #include "ProfilerEngineStatus.h"
+#include "SamplesAggregator.h"
 #include "ThreadsCpuManager.h"
 
 #include "shared/src/native-src/loader.h"
@@ -109,4 +110,28 @@ extern "C" void __stdcall SetApplicationInfoForAppDomain(const char* runtimeId,
         serviceName ? serviceName : std::string(),
         environment ? environment : std::string(),
         version ? version : std::string());
+}
+
+extern "C" BOOL __stdcall GetRootSpansTimes(const std::uint64_t* pLocalRootSpanIds, std::int64_t* pCpuTimes, std::int64_t* pWallTimes, std::int32_t count)
+{
+    if (!CorProfilerCallback::GetClrLifetime()->IsRunning())
+    {
+        return FALSE;
+    }
+
+    const auto profiler = CorProfilerCallback::GetInstance();
+
+    if (profiler == nullptr)
+    {
+        Log::Error("GetRootSpansTimes is called BEFORE CLR initialize");
+        return FALSE;
+    }
+
+    if (pLocalRootSpanIds == nullptr || pCpuTimes == nullptr || pWallTimes == nullptr || count < 0)
+    {
+        return FALSE;
+    }
+
+    profiler->GetSamplesAggregator()->GetRootSpansTimes(pLocalRootSpanIds, pCpuTimes, pWallTimes, count);
+    return TRUE;
 }
\ No newline at end of file
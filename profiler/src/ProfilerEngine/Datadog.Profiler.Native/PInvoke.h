@@ -38,4 +38,6 @@ extern "C" void* __stdcall GetNativeProfilerIsReadyPtr();
 
 extern "C" void* __stdcall GetPointerToNativeTraceContext();
 
-extern "C" void __stdcall SetApplicationInfoForAppDomain(const char* runtimeId, const char* serviceName, const char* environment, const char* version);
\ No newline at end of file
+extern "C" void __stdcall SetApplicationInfoForAppDomain(const char* runtimeId, const char* serviceName, const char* environment, const char* version);
+
+extern "C" BOOL __stdcall GetRootSpansTimes(const std::uint64_t* pLocalRootSpanIds, std::int64_t* pCpuTimes, std::int64_t* pWallTimes, std::int32_t count);
\ No newline at end of file
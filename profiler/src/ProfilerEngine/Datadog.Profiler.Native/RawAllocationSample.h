@@ -0,0 +1,32 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+#include <cmath>
+
+#include "RawSample.h"
+#include "Sample.h"
+
+class RawAllocationSample : public RawSample
+{
+public:
+    // The CLR emits an AllocationTick event each time ~100 KB have been allocated: the event is received
+    // for the object crossing the threshold, so larger objects are more likely to be sampled.
+    static constexpr inline double AllocationTickThreshold = 100 * 1024;
+
+    inline void OnTransform(Sample& sample) const override
+    {
+        // As for a Poisson process of mean AllocationTickThreshold, an object of AllocationSize bytes is sampled
+        // with the probability p = 1 - e^(-size/threshold): the sample stands for 1/p allocations of that size.
+        const double size = static_cast<double>(AllocationSize);
+        const double probability = 1 - std::exp(-size / AllocationTickThreshold);
+        const double scale = probability > 0 ? 1 / probability : 1;
+
+        sample.AddValue(std::llround(scale), SampleValue::AllocationCount);
+        sample.AddValue(std::llround(size * scale), SampleValue::AllocationSize);
+        sample.AddLabel(Label(Sample::AllocationClassLabel, AllocationClass));
+    }
+
+    std::string AllocationClass;
+    std::uint64_t AllocationSize = 0;
+};
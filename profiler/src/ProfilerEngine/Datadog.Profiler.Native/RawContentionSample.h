@@ -0,0 +1,27 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+#include <cmath>
+
+#include "RawSample.h"
+#include "Sample.h"
+
+class RawContentionSample : public RawSample
+{
+public:
+    inline void OnTransform(Sample& sample) const override
+    {
+        // the sample stands for the 1/p waits of the same duration which were not sampled
+        const double scale = SamplingProbability > 0 ? 1 / SamplingProbability : 1;
+
+        sample.AddValue(std::llround(scale), SampleValue::ContentionCount);
+        sample.AddValue(std::llround(static_cast<double>(Duration) * scale), SampleValue::ContentionDuration);
+    }
+
+    // time spent waiting for the lock (in nanoseconds)
+    std::int64_t Duration = 0;
+
+    // probability for the wait to be sampled, see ContentionProvider::OnContentionStop
+    double SamplingProbability = 1;
+};
@@ -11,8 +11,8 @@ class RawCpuSample : public RawSample
 public:
     inline void OnTransform(Sample& sample) const override
     {
-        sample.AddValue(Duration * 1000000, SampleValue::CpuTimeDuration);
+        sample.AddValue(Duration, SampleValue::CpuTimeDuration);
     }
 
-    std::uint64_t Duration;  // in milliseconds
+    std::uint64_t Duration;  // in nanoseconds
 };
@@ -23,6 +23,10 @@ SampleValueType const SampleTypeDefinitions[] =
     {"wall", "nanoseconds"}, // WallTimeDuration
     {"cpu", "nanoseconds"},  // CPUTimeDuration
     {"exception", "count"},
+    {"alloc-samples", "count"},
+    {"alloc-size", "bytes"},
+    {"lock-count", "count"},
+    {"lock-time", "nanoseconds"},
 
     // the new ones should be added here at the same time
     // new identifiers are added to SampleValue
@@ -43,11 +47,12 @@ enum class SampleValue : size_t
     ExceptionCount = 2,
 
     // Allocation tick profiler
-    //AllocationCount = 3,
+    AllocationCount = 3,
+    AllocationSize = 4,
 
     // Thread contention profiler
-    //ContentionCount = 4,
-    //ContentionDuration = 5,
+    ContentionCount = 5,
+    ContentionDuration = 6,
 
 
 };
@@ -105,6 +110,7 @@ public:
     static const std::string SpanIdLabel;
     static const std::string ExceptionTypeLabel;
     static const std::string ExceptionMessageLabel;
+    static const std::string AllocationClassLabel;
 
 private:
     uint64_t _timestamp;
@@ -13,6 +13,7 @@
 #include "OpSysTools.h"
 #include "Sample.h"
 
+#include <cstdlib>
 #include <forward_list>
 #include <list>
 #include <memory>
@@ -101,18 +102,89 @@ void SamplesAggregator::Work()
 void SamplesAggregator::ProcessSamples()
 {
     const auto samples = _pSamplesCollector->GetSamples();
+    const auto now = std::chrono::steady_clock::now();
 
     for (auto const& sample : samples)
     {
         if (!sample.GetCallstack().empty())
         {
+            AggregateSpanTimes(sample, now);
             _exporter->Add(sample);
         }
     }
 
+    ForgetInactiveSpanTimes(now);
     Export();
 }
 
+void SamplesAggregator::AggregateSpanTimes(const Sample& sample, std::chrono::time_point<std::chrono::steady_clock> now)
+{
+    auto const& values = sample.GetValues();
+    auto cpuTime = values[static_cast<size_t>(SampleValue::CpuTimeDuration)];
+    auto wallTime = values[static_cast<size_t>(SampleValue::WallTimeDuration)];
+    if (cpuTime == 0 && wallTime == 0)
+    {
+        return;
+    }
+
+    // the span labels are only set for samples collected while a span was active
+    for (auto const& [name, value] : sample.GetLabels())
+    {
+        if (name != Sample::LocalRootSpanIdLabel)
+        {
+            continue;
+        }
+
+        const auto localRootSpanId = std::strtoull(value.c_str(), nullptr, 10);
+
+        std::lock_guard<std::mutex> lock(_spanTimesLock);
+        auto& times = _spanTimes[localRootSpanId];
+        times.CpuTime += cpuTime;
+        times.WallTime += wallTime;
+        times.LastSampleTime = now;
+        return;
+    }
+}
+
+void SamplesAggregator::ForgetInactiveSpanTimes(std::chrono::time_point<std::chrono::steady_clock> now)
+{
+    // the root spans of traces that are never written would be kept forever
+    std::lock_guard<std::mutex> lock(_spanTimesLock);
+
+    for (auto it = _spanTimes.begin(); it != _spanTimes.end();)
+    {
+        if (now - it->second.LastSampleTime > SpanTimesRetention)
+        {
+            it = _spanTimes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void SamplesAggregator::GetRootSpansTimes(const std::uint64_t* localRootSpanIds, std::int64_t* cpuTimes, std::int64_t* wallTimes, std::int32_t count)
+{
+    std::lock_guard<std::mutex> lock(_spanTimesLock);
+
+    for (std::int32_t i = 0; i < count; i++)
+    {
+        auto it = _spanTimes.find(localRootSpanIds[i]);
+        if (it == _spanTimes.end())
+        {
+            cpuTimes[i] = 0;
+            wallTimes[i] = 0;
+            continue;
+        }
+
+        // the times are read once the trace of the root span is written
+        cpuTimes[i] = it->second.CpuTime;
+        wallTimes[i] = it->second.WallTime;
+        _spanTimes.erase(it);
+    }
+}
+
 void SamplesAggregator::Export()
 {
     auto now = std::chrono::steady_clock::now();
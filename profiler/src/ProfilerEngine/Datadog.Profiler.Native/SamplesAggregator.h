@@ -10,6 +10,8 @@
 #include <thread>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <unordered_map>
 
 #include "IService.h"
 #include <shared/src/native-src/string.h>
@@ -35,15 +37,31 @@ public:
     virtual bool Start() override;
     virtual bool Stop() override;
 
+    // CPU and wall time (in nanoseconds) sampled so far for each of the count local root spans, 0 if there is no sample.
+    // Samples are aggregated each ProcessingInterval: the last ones of a root span that just ended are only
+    // counted after the next aggregation. The times of a root span are forgotten once they have been read.
+    void GetRootSpansTimes(const std::uint64_t* localRootSpanIds, std::int64_t* cpuTimes, std::int64_t* wallTimes, std::int32_t count);
+
+private:
+    struct SpanTimes
+    {
+        std::int64_t CpuTime = 0;
+        std::int64_t WallTime = 0;
+        std::chrono::time_point<std::chrono::steady_clock> LastSampleTime;
+    };
+
 private:
     void Work();
     void ProcessSamples();
+    void AggregateSpanTimes(const Sample& sample, std::chrono::time_point<std::chrono::steady_clock> now);
+    void ForgetInactiveSpanTimes(std::chrono::time_point<std::chrono::steady_clock> now);
     void Export();
     void SendHeartBeatMetric(bool success);
 
 private:
     const char* _serviceName = "SamplesAggregator";
     inline static const std::chrono::seconds ProcessingInterval = 1s;
+    inline static const std::chrono::seconds SpanTimesRetention = 30s;
     const WCHAR* WorkerThreadName = WStr("DD.Profiler.SamplesAggregator.WorkerThread");
     const WCHAR* RawSampleThreadName = WStr("DD.Profiler.SamplesAggregator.RawSampleThread");
     inline static std::string const SuccessfulExportsMetricName = "datadog.profiling.dotnet.operational.exports";
@@ -57,4 +75,8 @@ private:
     bool _mustStop;
     std::promise<void> _exitWorkerPromise;
     IMetricsSender* _metricsSender;
+
+    // root spans without samples during SpanTimesRetention are forgotten even if their times were not read
+    std::unordered_map<std::uint64_t, SpanTimes> _spanTimes;
+    std::mutex _spanTimesLock;
 };
@@ -13,6 +13,8 @@
 
 StackFramesCollectorBase::StackFramesCollectorBase()
 {
+    // also checked by the CPU timer signal handlers before any collection is prepared
+    _isCurrentCollectionAbortRequested.store(false);
     _isRequestedCollectionAbortSuccessful = false;
     _pReusableStackSnapshotResult = new StackSnapshotResultReusableBuffer();
     _pCurrentCollectionThreadInfo = nullptr;
@@ -98,22 +100,79 @@ StackSnapshotResultBuffer* StackFramesCollectorBase::CollectStackSampleImplement
     return GetStackSnapshotResult();
 }
 
+std::size_t StackFramesCollectorBase::CollectStackSamplesImplementation(ManagedThreadInfo* const* ppThreadInfos,
+                                                                       std::size_t threadsCount,
+                                                                       StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                                       uint32_t* pHRs)
+{
+    // The actual business logic provided by a subclass goes into the XxxImplementation(..) methods.
+    // Collectors that do not support batch collection are never called here (see IsBatchCollectionSupported)
+    // so no thread is handled.
+
+    return 0;
+}
+
+bool StackFramesCollectorBase::IsBatchCollectionSupported() const
+{
+    return false;
+}
+
+std::size_t StackFramesCollectorBase::GetMaxBatchSize() const
+{
+    return 0;
+}
+
+bool StackFramesCollectorBase::IsCpuTimerSupported()
+{
+    return false;
+}
+
+std::size_t StackFramesCollectorBase::GetMaxCpuTimerSamplesCount() const
+{
+    return 0;
+}
+
+bool StackFramesCollectorBase::StartCpuTimer(ManagedThreadInfo* pThreadInfo, std::chrono::milliseconds interval)
+{
+    return false;
+}
+
+void StackFramesCollectorBase::StopCpuTimer(ManagedThreadInfo* pThreadInfo)
+{
+}
+
+std::size_t StackFramesCollectorBase::GetCpuTimerSamples(ManagedThreadInfo** ppThreadInfos,
+                                                         StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                         std::uint64_t* pCpuTimes,
+                                                         std::size_t maxSamplesCount)
+{
+    return 0;
+}
+
+void StackFramesCollectorBase::ReleaseCpuTimerSamples()
+{
+}
+
 bool StackFramesCollectorBase::IsCurrentCollectionAbortRequested()
 {
     return _isCurrentCollectionAbortRequested.load();
 }
 
 bool StackFramesCollectorBase::TryApplyTraceContextDataFromCurrentCollectionThreadToSnapshot()
+{
+    return TryApplyTraceContextDataToSnapshot(_pCurrentCollectionThreadInfo, _pReusableStackSnapshotResult);
+}
+
+bool StackFramesCollectorBase::TryApplyTraceContextDataToSnapshot(ManagedThreadInfo* pThreadInfo, StackSnapshotResultReusableBuffer* pStackSnapshotResult)
 {
     // If TraceContext Tracking is not enabled, then we will simply get zero IDs.
-    ManagedThreadInfo* pCurrentCollectionThreadInfo = _pCurrentCollectionThreadInfo;
-    if (nullptr != pCurrentCollectionThreadInfo && pCurrentCollectionThreadInfo->CanReadTraceContext())
+    if (nullptr != pThreadInfo && pThreadInfo->CanReadTraceContext())
     {
-        std::uint64_t localRootSpanId = pCurrentCollectionThreadInfo->GetLocalRootSpanId();
-        std::uint64_t spanId = pCurrentCollectionThreadInfo->GetSpanId();
+        std::uint64_t localRootSpanId = pThreadInfo->GetLocalRootSpanId();
+        std::uint64_t spanId = pThreadInfo->GetSpanId();
 
-        _pReusableStackSnapshotResult->SetLocalRootSpanId(localRootSpanId);
-        _pReusableStackSnapshotResult->SetSpanId(spanId);
+        pStackSnapshotResult->SetLocalRootSpanId(localRootSpanId);
+        pStackSnapshotResult->SetSpanId(spanId);
 
         return true;
     }
@@ -126,6 +185,11 @@ StackSnapshotResultBuffer* StackFramesCollectorBase::GetStackSnapshotResult()
     return _pReusableStackSnapshotResult;
 }
 
+StackSnapshotResultReusableBuffer* StackFramesCollectorBase::GetReusableStackSnapshotResult()
+{
+    return _pReusableStackSnapshotResult;
+}
+
 // ----------- Inline stubs for APIs that are specific to overriding implementations: -----------
 // They perform the work required for the shared base implementation (this class) and then invoke the respective XxxImplementaiton(..) method.
 // This is less error-prone than simply making these methods virtual and relying on the sub-classes to remember calling the base class method.
@@ -186,6 +250,29 @@ StackSnapshotResultBuffer* StackFramesCollectorBase::CollectStackSample(ManagedT
     return result;
 }
 
+std::size_t StackFramesCollectorBase::CollectStackSamples(ManagedThreadInfo* const* ppThreadInfos,
+                                                         std::size_t threadsCount,
+                                                         StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                         uint32_t* pHRs)
+{
+    // Execute the actual collection:
+    std::size_t handledThreadsCount = CollectStackSamplesImplementation(ppThreadInfos, threadsCount, ppStackSnapshotResults, pHRs);
+
+    // If someone has requested an abort, notify them now:
+
+    if (IsCurrentCollectionAbortRequested())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_collectionAbortNotificationLock);
+            _isRequestedCollectionAbortSuccessful = true;
+        }
+
+        _collectionAbortPerformedSignal.notify_all();
+    }
+
+    return handledThreadsCount;
+}
+
 void StackFramesCollectorBase::OnDeadlock()
 {
     // In 32bits, we use the method DoStackSnapshot to walk and collect a thread callstack.
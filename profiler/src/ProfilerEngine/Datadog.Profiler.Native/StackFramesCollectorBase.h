@@ -20,8 +20,11 @@ protected:
     void AddFakeFrame();
 
     StackSnapshotResultBuffer* GetStackSnapshotResult(void);
+    StackSnapshotResultReusableBuffer* GetReusableStackSnapshotResult(void);
     bool IsCurrentCollectionAbortRequested();
 
+    static bool TryApplyTraceContextDataToSnapshot(ManagedThreadInfo* pThreadInfo, StackSnapshotResultReusableBuffer* pStackSnapshotResult);
+
     // The XxxImplementation(..) methods below are the key routines to be implemented by the specific stack sample collectors.
     // We make them virtual but NOT astract, so that if a particular collector does not need to implement some
     // of these methods (because they are no-op for that specific collector), then they do not have to.
@@ -30,6 +33,10 @@ protected:
     virtual bool SuspendTargetThreadImplementation(ManagedThreadInfo* pThreadInfo, bool* pIsTargetThreadSuspended);
     virtual void ResumeTargetThreadIfRequiredImplementation(ManagedThreadInfo* pThreadInfo, bool isTargetThreadSuspended, uint32_t* pErrorCodeHR);
     virtual StackSnapshotResultBuffer* CollectStackSampleImplementation(ManagedThreadInfo* pThreadInfo, uint32_t* pHR, bool selfCollect);
+    virtual std::size_t CollectStackSamplesImplementation(ManagedThreadInfo* const* ppThreadInfos,
+                                                          std::size_t threadsCount,
+                                                          StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                                          uint32_t* pHRs);
 
 public:
     virtual ~StackFramesCollectorBase();
@@ -44,6 +51,35 @@ public:
     void ResumeTargetThreadIfRequired(ManagedThreadInfo* pThreadInfo, bool isTargetThreadSuspended, uint32_t* pErrorCodeHR);
     StackSnapshotResultBuffer* CollectStackSample(ManagedThreadInfo* pThreadInfo, uint32_t* pHR);
 
+    // Batch collection: collectors that do not need to suspend the target threads (i.e. signal-based ones)
+    // can walk the callstacks of several threads during the same round. Each thread gets its own result buffer
+    // so ppStackSnapshotResults[i] and pHRs[i] correspond to ppThreadInfos[i].
+    // Returns the number of threads that were handled (it could be less than threadsCount if the collector
+    // is not able to handle so many threads at once).
+    virtual bool IsBatchCollectionSupported() const;
+    virtual std::size_t GetMaxBatchSize() const;
+    std::size_t CollectStackSamples(ManagedThreadInfo* const* ppThreadInfos,
+                                    std::size_t threadsCount,
+                                    StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                    uint32_t* pHRs);
+
+    // CPU timer collection: collectors able to interrupt a thread each time it has consumed a given
+    // amount of CPU let the thread walk its own callstack into a pre-allocated buffer.
+    // The sampler thread regularly gets the samples collected since the previous call:
+    // ppStackSnapshotResults[i] and pCpuTimes[i] (in nanoseconds) correspond to ppThreadInfos[i].
+    // These samples must be given back with ReleaseCpuTimerSamples before the next call.
+    // IsCpuTimerSupported initializes the CPU timers: if it returns false (or if StartCpuTimer fails
+    // for a thread), the CPU consumption of the thread must be polled instead.
+    virtual bool IsCpuTimerSupported();
+    virtual std::size_t GetMaxCpuTimerSamplesCount() const;
+    virtual bool StartCpuTimer(ManagedThreadInfo* pThreadInfo, std::chrono::milliseconds interval);
+    virtual void StopCpuTimer(ManagedThreadInfo* pThreadInfo);
+    virtual std::size_t GetCpuTimerSamples(ManagedThreadInfo** ppThreadInfos,
+                                           StackSnapshotResultBuffer** ppStackSnapshotResults,
+                                           std::uint64_t* pCpuTimes,
+                                           std::size_t maxSamplesCount);
+    virtual void ReleaseCpuTimerSamples();
+
 protected:
     ManagedThreadInfo* _pCurrentCollectionThreadInfo;
 
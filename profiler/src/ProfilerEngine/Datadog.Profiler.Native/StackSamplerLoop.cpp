@@ -3,6 +3,7 @@
 
 #include "StackSamplerLoop.h"
 
+#include <algorithm>
 #include <chrono>
 #include <inttypes.h>
 #include <iomanip>
@@ -26,6 +27,7 @@
 #include "StackFramesCollectorBase.h"
 #include "StackSamplerLoopManager.h"
 #include "ThreadsCpuManager.h"
+#include "WallTimeThreadsScheduler.h"
 
 #include "shared/src/native-src/string.h"
 
@@ -34,6 +36,15 @@ using namespace std::chrono_literals;
 constexpr std::chrono::nanoseconds SamplingPeriod = 9ms;
 constexpr uint64_t SamplingPeriodMs = SamplingPeriod.count() / 1000000;
 constexpr int32_t MaxThreadsPerIterationForWallTime = 5;
+// The number of threads sampled per iteration for wall time is adjusted to keep the time
+// spent collecting their stacks around this duration (the default is used until collection
+// statistics are available)
+constexpr std::chrono::nanoseconds TargetCollectionDurationPerIterationForWallTime = 500us;
+constexpr int32_t MinThreadsPerIterationForWallTime = 1;
+constexpr int32_t MaxAdaptiveThreadsPerIterationForWallTime = 16;
+// In batch mode, threads are stopped in parallel so more threads can be sampled per iteration
+// without lengthening the time any single thread is stopped.
+constexpr int32_t MaxThreadsPerBatchForWallTime = 32;
 constexpr int32_t MaxThreadsPerIterationForCpuTime = 60;
 constexpr const WCHAR* ThreadName = WStr("DD.Profiler.StackSamplerLoop.Thread");
 
@@ -66,14 +77,33 @@ StackSamplerLoop::StackSamplerLoop(
     _pLoopThread{nullptr},
     _loopThreadOsId{0},
     _targetThread(nullptr),
-    _iteratorWallTime{0},
     _iteratorCpuTime{0}
 {
     _pCorProfilerInfo->AddRef();
 
-    _iteratorWallTime = _pManagedThreadList->CreateIterator();
+    _pWallTimeThreadsScheduler = std::make_unique<WallTimeThreadsScheduler>(_pManagedThreadList);
+    _wallTimeThreads.reserve(MaxAdaptiveThreadsPerIterationForWallTime);
     _iteratorCpuTime = _pManagedThreadList->CreateIterator();
 
+    if (_pConfiguration->IsBatchedSamplingEnabled() && _pStackFramesCollector->IsBatchCollectionSupported())
+    {
+        // allocate once to avoid allocations in each iteration
+        auto maxBatchSize = (std::min)(static_cast<std::size_t>(MaxThreadsPerBatchForWallTime), _pStackFramesCollector->GetMaxBatchSize());
+        _batchThreads.reserve(maxBatchSize);
+        _wallTimeThreads.reserve(maxBatchSize);
+        _batchDurations.reserve(maxBatchSize);
+        _batchResults.resize(maxBatchSize);
+        _batchHRs.resize(maxBatchSize);
+    }
+
+    if (_pManager->IsCpuTimerEnabled())
+    {
+        auto maxSamplesCount = _pStackFramesCollector->GetMaxCpuTimerSamplesCount();
+        _cpuTimerThreads.resize(maxSamplesCount);
+        _cpuTimerResults.resize(maxSamplesCount);
+        _cpuTimerDurations.resize(maxSamplesCount);
+    }
+
     _pLoopThread = new std::thread(&StackSamplerLoop::MainLoop, this);
     OpSysTools::SetNativeThreadName(_pLoopThread, ThreadName);
 }
@@ -159,50 +189,167 @@ void StackSamplerLoop::WaitOnePeriod(void)
 
 void StackSamplerLoop::MainLoopIteration(void)
 {
-    // In each iteration, a few threads (up to MaxThreadsPerIterationForWallTime) are sampled
-    // to compute wall time.
+    // In each iteration, a few threads chosen by the wall time scheduler are sampled
+    // to compute wall time (their count depends on the mean collection time).
     if (_pConfiguration->IsWallTimeProfilingEnabled())
     {
-        WalltimeProfilingIteration();
+        // In batch mode, up to MaxThreadsPerBatchForWallTime threads are sampled at once
+        if (!_batchResults.empty())
+        {
+            WalltimeProfilingBatchIteration();
+        }
+        else
+        {
+            WalltimeProfilingIteration();
+        }
     }
 
     // When CPU profiling is enabled, most of the threads (up to MaxThreadsPerIterationForCpuTime)
     // are scanned and if they are currently running, they are sampled.
+    // With CPU timers, the threads sample themselves and the samples are just processed here
+    // (the threads without CPU timer are still scanned).
     if (_pConfiguration->IsCpuProfilingEnabled())
     {
+        if (!_cpuTimerResults.empty())
+        {
+            CpuTimerProfilingIteration();
+        }
+
         CpuProfilingIteration();
     }
 }
 
 void StackSamplerLoop::WalltimeProfilingIteration(void)
 {
-    int32_t managedThreadsCount = _pManagedThreadList->Count();
-    int32_t sampledThreadsCount = (std::min)(managedThreadsCount, MaxThreadsPerIterationForWallTime);
+    _wallTimeThreads.clear();
+    _pWallTimeThreadsScheduler->SelectThreads(OpSysTools::GetHighPrecisionNanoseconds(), ComputeWallTimeThreadsBudget(), _wallTimeThreads);
 
-    for (int32_t i = 0; i < sampledThreadsCount && !_shutdownRequested; i++)
+    for (auto* pThreadInfo : _wallTimeThreads)
     {
-        _targetThread = _pManagedThreadList->LoopNext(_iteratorWallTime);
-        if (_targetThread != nullptr)
+        _targetThread = pThreadInfo;
+        if (!_shutdownRequested)
         {
             int64_t thisSampleTimestampNanosecs = OpSysTools::GetHighPrecisionNanoseconds();
             int64_t prevSampleTimestampNanosecs = _targetThread->SetLastSampleHighPrecisionTimestampNanoseconds(thisSampleTimestampNanosecs);
             int64_t duration = ComputeWallTime(thisSampleTimestampNanosecs, prevSampleTimestampNanosecs);
 
             CollectOneThreadStackSample(_targetThread, thisSampleTimestampNanosecs, duration, PROFILING_TYPE::WallTime);
+        }
 
-            // LoopNext() calls AddRef() on the threadInfo before returning it.
-            // This is because it needs to happen under the managedThreads's internal lock
-            // so that a concurrently dying thread cannot delete our threadInfo while we
-            // are just about to start processing it.
-            _targetThread->Release();
-            _targetThread = nullptr;
+        // The scheduler calls AddRef() on the selected threads so that a concurrently dying
+        // thread cannot delete our threadInfo while we are just about to start processing it.
+        _targetThread->Release();
+        _targetThread = nullptr;
 
-            // @ToDo: Investigate whether the OpSysTools::StartPreciseTimerServices(..) invocation made by
-            // the StackSamplerLoopManager ctor really ensures that this yield for 1ms or less.
-            // If not, we should not be yielding here.
-            std::this_thread::yield();
+        // @ToDo: Investigate whether the OpSysTools::StartPreciseTimerServices(..) invocation made by
+        // the StackSamplerLoopManager ctor really ensures that this yield for 1ms or less.
+        // If not, we should not be yielding here.
+        std::this_thread::yield();
+    }
+
+    _wallTimeThreads.clear();
+}
+
+std::size_t StackSamplerLoop::ComputeWallTimeThreadsBudget(void)
+{
+    auto meanCollectionTime = _pManager->GetMeanCollectionTime();
+    if (meanCollectionTime <= 0)
+    {
+        return MaxThreadsPerIterationForWallTime;
+    }
+
+    auto budget = static_cast<int64_t>(TargetCollectionDurationPerIterationForWallTime.count()) / meanCollectionTime;
+    return static_cast<std::size_t>(std::clamp(budget, static_cast<int64_t>(MinThreadsPerIterationForWallTime), static_cast<int64_t>(MaxAdaptiveThreadsPerIterationForWallTime)));
+}
+
+void StackSamplerLoop::WalltimeProfilingBatchIteration(void)
+{
+    _batchThreads.clear();
+    _batchDurations.clear();
+
+    // The scheduler calls AddRef() on the selected threads and skip the ones without OS handle.
+    // In batch mode, threads are stopped in parallel so the batch size is not adapted to the collection time.
+    _wallTimeThreads.clear();
+    _pWallTimeThreadsScheduler->SelectThreads(OpSysTools::GetHighPrecisionNanoseconds(), _batchResults.size(), _wallTimeThreads);
+
+    for (auto* pThreadInfo : _wallTimeThreads)
+    {
+        // The StackSamplerLoopManager may determine that the target thread is not fit for a sample collection right now.
+        // If accepted, the thread stack walk lock is held until NotifyBatchIterationFinished is called.
+        if (_shutdownRequested || !_pManager->AllowBatchStackWalk(pThreadInfo))
+        {
+            pThreadInfo->Release();
+            continue;
         }
+
+        _batchThreads.push_back(pThreadInfo);
+    }
+    _wallTimeThreads.clear();
+
+    if (_batchThreads.empty())
+    {
+        return;
+    }
+
+    // Get the timestamp of the current collection
+    // /!\ Must not be called while the threads are walking their stack:
+    // current implementation uses time function which allocates
+    time_t currentUnixTimestamp = GetCurrentTimestamp();
+    int64_t thisSampleTimestampNanosecs = OpSysTools::GetHighPrecisionNanoseconds();
+    for (auto* pThreadInfo : _batchThreads)
+    {
+        int64_t prevSampleTimestampNanosecs = pThreadInfo->SetLastSampleHighPrecisionTimestampNanoseconds(thisSampleTimestampNanosecs);
+        _batchDurations.push_back(ComputeWallTime(thisSampleTimestampNanosecs, prevSampleTimestampNanosecs));
+        pThreadInfo->SetLastKnownSampleUnixTimestamp(currentUnixTimestamp, thisSampleTimestampNanosecs);
     }
+
+    std::size_t collectedThreadsCount = 0;
+    {
+        // Notify the loop manager that the batch is finished when we get out of this scope
+        // (releases the stack walk lock and the reference of each thread)
+        auto iterationScope = CreateScopeFinalizer(
+            [this] {
+                _pManager->NotifyBatchIterationFinished(_batchThreads.data(), _batchThreads.size());
+            });
+
+        // Reset the abort request state: each batch slot buffer is reset by the collector itself
+        _pStackFramesCollector->PrepareForNextCollection();
+
+        // Signal-based collectors do not suspend the target threads
+        _pManager->NotifyThreadState(false);
+        {
+            auto endCollectionScope = CreateScopeFinalizer([this] { _pManager->NotifyCollectionEnd(); });
+
+            _pManager->NotifyCollectionStart();
+            collectedThreadsCount = _pStackFramesCollector->CollectStackSamples(_batchThreads.data(), _batchThreads.size(), _batchResults.data(), _batchHRs.data());
+        }
+
+        for (std::size_t i = 0; i < collectedThreadsCount; i++)
+        {
+            ManagedThreadInfo* pThreadInfo = _batchThreads[i];
+            StackSnapshotResultBuffer* pStackSnapshotResult = _batchResults[i];
+
+            std::size_t countCollectedStackFrames = pStackSnapshotResult->GetFramesCount();
+            bool isStackSnapshotSuccessful = (countCollectedStackFrames > 0);
+            pThreadInfo->IncSnapshotsPerformedCount(isStackSnapshotSuccessful);
+
+            if (isStackSnapshotSuccessful)
+            {
+                UpdateSnapshotInfos(pStackSnapshotResult, _batchDurations[i], currentUnixTimestamp);
+                pStackSnapshotResult->DetermineAppDomain(pThreadInfo->GetClrThreadId(), _pCorProfilerInfo);
+
+                // the wall time scheduler prefers the threads whose span changed since this sample
+                pThreadInfo->SetLastSampledSpanId(pStackSnapshotResult->GetSpanId());
+            }
+
+            UpdateStatistics(_batchHRs[i], countCollectedStackFrames);
+
+            // Store stack-walk results into the results buffer:
+            PersistStackSnapshotResults(pStackSnapshotResult, pThreadInfo, PROFILING_TYPE::WallTime);
+        }
+    }
+
+    LogEncounteredStackSnapshotResultStatistics(thisSampleTimestampNanosecs);
 }
 
 void StackSamplerLoop::CpuProfilingIteration(void)
@@ -216,9 +363,19 @@ void StackSamplerLoop::CpuProfilingIteration(void)
         _targetThread = _pManagedThreadList->LoopNext(_iteratorCpuTime);
         if (_targetThread != nullptr)
         {
+#ifndef _WINDOWS
+            // the thread samples itself when its CPU timer expires
+            if (_targetThread->GetCpuTimerSlot() != -1)
+            {
+                _targetThread->Release();
+                _targetThread = nullptr;
+                continue;
+            }
+#endif
+
             // sample only if the thread is currently running on a core
             uint64_t currentConsumption = 0;
-            uint64_t lastConsumption = _targetThread->GetCpuConsumptionMilliseconds();
+            uint64_t lastConsumption = _targetThread->GetCpuConsumptionNanoseconds();
             bool isRunning = OsSpecificApi::IsRunning(_targetThread, currentConsumption);
             // Note: it is not possible to get this information on Windows 32-bit
             //       so true is returned if this thread consumed some CPU since
@@ -233,7 +390,7 @@ void StackSamplerLoop::CpuProfilingIteration(void)
 
             if (isRunning)
             {
-                _targetThread->SetCpuConsumptionMilliseconds(currentConsumption);
+                _targetThread->SetCpuConsumptionNanoseconds(currentConsumption);
                 uint64_t cpuForSample = currentConsumption - lastConsumption;
 
                 // we don't collect a sample for this thread is no CPU was consumed since the last check
@@ -256,6 +413,40 @@ void StackSamplerLoop::CpuProfilingIteration(void)
     }
 }
 
+void StackSamplerLoop::CpuTimerProfilingIteration(void)
+{
+    std::size_t samplesCount = _pStackFramesCollector->GetCpuTimerSamples(
+        _cpuTimerThreads.data(), _cpuTimerResults.data(), _cpuTimerDurations.data(), _cpuTimerResults.size());
+    if (samplesCount == 0)
+    {
+        return;
+    }
+
+    // the sample buffers are given back to the collector (and the threads released) at the end of the iteration
+    auto releaseScope = CreateScopeFinalizer([this] { _pStackFramesCollector->ReleaseCpuTimerSamples(); });
+
+    // the samples have been collected since the previous iteration: use the same timestamp for all of them
+    time_t currentUnixTimestamp = GetCurrentTimestamp();
+    for (std::size_t i = 0; (i < samplesCount) && !_shutdownRequested; i++)
+    {
+        ManagedThreadInfo* pThreadInfo = _cpuTimerThreads[i];
+        StackSnapshotResultBuffer* pStackSnapshotResult = _cpuTimerResults[i];
+
+        // the collector only keeps successful samples
+        std::size_t countCollectedStackFrames = pStackSnapshotResult->GetFramesCount();
+        pThreadInfo->IncSnapshotsPerformedCount(true);
+
+        UpdateSnapshotInfos(pStackSnapshotResult, static_cast<int64_t>(_cpuTimerDurations[i]), currentUnixTimestamp);
+        pStackSnapshotResult->DetermineAppDomain(pThreadInfo->GetClrThreadId(), _pCorProfilerInfo);
+
+        UpdateStatistics(S_OK, countCollectedStackFrames);
+
+        PersistStackSnapshotResults(pStackSnapshotResult, pThreadInfo, PROFILING_TYPE::CpuTime);
+    }
+
+    LogEncounteredStackSnapshotResultStatistics(OpSysTools::GetHighPrecisionNanoseconds());
+}
+
 void StackSamplerLoop::CollectOneThreadStackSample(
     ManagedThreadInfo* pThreadInfo,
     int64_t thisSampleTimestampNanosecs,
@@ -355,6 +546,12 @@ void StackSamplerLoop::CollectOneThreadStackSample(
             {
                 UpdateSnapshotInfos(pStackSnapshotResult, duration, currentUnixTimestamp);
                 pStackSnapshotResult->DetermineAppDomain(pThreadInfo->GetClrThreadId(), _pCorProfilerInfo);
+
+                // the wall time scheduler prefers the threads whose span changed since this sample
+                if (profilingType == PROFILING_TYPE::WallTime)
+                {
+                    pThreadInfo->SetLastSampledSpanId(pStackSnapshotResult->GetSpanId());
+                }
             }
 
             // If we got here, then either target thread == sampler thread (we are sampling the current thread),
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 // from dotnet coreclr includes
 #include "cor.h"
@@ -18,6 +19,7 @@
 
 #include "ManagedThreadInfo.h"
 #include "ICollector.h"
+#include "IWallTimeThreadsScheduler.h"
 #include "RawCpuSample.h"
 #include "RawWallTimeSample.h"
 
@@ -74,9 +76,23 @@ private:
     DWORD _loopThreadOsId;
     volatile bool _shutdownRequested = false;
     ManagedThreadInfo* _targetThread;
-    uint32_t _iteratorWallTime;
     uint32_t _iteratorCpuTime;
 
+    // select the threads to sample for wall time
+    std::unique_ptr<IWallTimeThreadsScheduler> _pWallTimeThreadsScheduler;
+    std::vector<ManagedThreadInfo*> _wallTimeThreads;
+
+    // batch mode: threads sampled during the same signal round
+    std::vector<ManagedThreadInfo*> _batchThreads;
+    std::vector<int64_t> _batchDurations;
+    std::vector<StackSnapshotResultBuffer*> _batchResults;
+    std::vector<uint32_t> _batchHRs;
+
+    // CPU timer mode: samples collected by the per-thread CPU timers since the last iteration
+    std::vector<ManagedThreadInfo*> _cpuTimerThreads;
+    std::vector<StackSnapshotResultBuffer*> _cpuTimerResults;
+    std::vector<uint64_t> _cpuTimerDurations;
+
 private:
     std::unordered_map<HRESULT, uint64_t> _encounteredStackSnapshotHRs;
     std::unordered_map<size_t, uint64_t> _encounteredStackSnapshotDepths;
@@ -89,7 +105,10 @@ private:
     void WaitOnePeriod(void);
     void MainLoopIteration(void);
     void CpuProfilingIteration(void);
+    void CpuTimerProfilingIteration(void);
     void WalltimeProfilingIteration(void);
+    void WalltimeProfilingBatchIteration(void);
+    std::size_t ComputeWallTimeThreadsBudget(void);
     void CollectOneThreadStackSample(ManagedThreadInfo* pThreadInfo,
                                      int64_t thisSampleTimestampNanosecs,
                                      int64_t duration,
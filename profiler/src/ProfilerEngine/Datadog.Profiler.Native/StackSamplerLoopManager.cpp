@@ -3,6 +3,7 @@
 
 #include "StackSamplerLoopManager.h"
 #include "IClrLifetime.h"
+#include "IConfiguration.h"
 #include "OpSysTools.h"
 #include "OsSpecificApi.h"
 #include "ThreadsCpuManager.h"
@@ -23,6 +24,9 @@ constexpr std::chrono::nanoseconds StatsAggregationPeriodNs = StatsAggregationPe
 const WCHAR* WatcherThreadName = WStr("DD.Profiler.StackSamplerLoopManager.WatcherThread");
 const std::chrono::nanoseconds StackSamplerLoopManager::StatisticAggregationPeriodNs = 10s;
 
+// below this count, the mean collection time of the previous statistics period is used
+constexpr std::uint64_t MinCollectionsCountForMeanCollectionTime = 100;
+
 StackSamplerLoopManager::StackSamplerLoopManager(
     ICorProfilerInfo4* pCorProfilerInfo,
     IConfiguration* pConfiguration,
@@ -49,6 +53,7 @@ StackSamplerLoopManager::StackSamplerLoopManager(
     _totalDeadlockDetectionsCount{0},
     _metricsSender{metricsSender},
     _statisticsReadyToSend{nullptr},
+    _previousMeanCollectionTime{0},
     _pClrLifetime{clrLifetime},
     _pThreadsCpuManager{pThreadsCpuManager},
     _pManagedThreadList{pManagedThreadList},
@@ -61,6 +66,20 @@ StackSamplerLoopManager::StackSamplerLoopManager(
 
     _currentStatistics = std::make_unique<Statistics>();
     _statisticCollectionStartNs = OpSysTools::GetHighPrecisionNanoseconds();
+
+    _cpuTimerInterval = std::chrono::milliseconds::zero();
+    if (_pConfiguration->IsCpuProfilingEnabled() && (_pConfiguration->GetCpuTimerInterval() > std::chrono::milliseconds::zero()))
+    {
+        if (_pStackFramesCollector->IsCpuTimerSupported())
+        {
+            _cpuTimerInterval = _pConfiguration->GetCpuTimerInterval();
+            Log::Info("CPU profiling uses per-thread timers (interval = ", _cpuTimerInterval.count(), " ms).");
+        }
+        else
+        {
+            Log::Info("CPU timers are not supported: fallback to threads polling for CPU profiling.");
+        }
+    }
 }
 
 StackSamplerLoopManager::~StackSamplerLoopManager()
@@ -231,6 +250,12 @@ void StackSamplerLoopManager::WatcherLoopIteration()
     if (_deadlockInterventionInProgress >= 1)
     {
         _deadlockInterventionInProgress++;
+        if (_pTargetThread == nullptr)
+        {
+            Log::Error("StackSamplerLoopManager::WatcherLoopIteration - Deadlock intervention still in progress for a batch collection");
+            return;
+        }
+
         Log::Error("StackSamplerLoopManager::WatcherLoopIteration - Deadlock intervention still in progress for thread ", _pTargetThread->GetOsThreadId(),
                    std::hex, " (= 0x", _pTargetThread->GetOsThreadId(), ")");
         // TODO: Validate that calling resuming again (and again) could unlock the situation.
@@ -279,6 +304,14 @@ void StackSamplerLoopManager::WatcherLoopIteration()
 
     _currentStatistics->IncrDeadlockCount();
 
+    // In batch mode, there is no single target thread to resume: no thread is suspended so the collector
+    // is always asked to give up on the threads that did not walk their stack yet
+    if (_pTargetThread == nullptr)
+    {
+        AbortBatchCollection();
+        return;
+    }
+
     if (AllowDeadlockIntervention)
     {
         PerformDeadlockIntervention(collectionDurationNs);
@@ -293,6 +326,19 @@ bool StackSamplerLoopManager::HasMadeProgress(FILETIME userTime, FILETIME kernel
            kernelTime.dwHighDateTime != _kernelTime.dwHighDateTime;
 }
 
+void StackSamplerLoopManager::AbortBatchCollection()
+{
+    // This private method is invoked by WatcherLoopIteration().
+    // It MUST be invoked ONLY while holding the _watcherActivityLock.
+    _deadlockInterventionInProgress = 1;
+    _deadlocksInPeriod++;
+    _totalDeadlockDetectionsCount++;
+
+    // the signaled threads stop walking their stack at the next frame and the ones
+    // that did not handle the signal yet are marked as failed
+    _pStackFramesCollector->RequestAbortCurrentCollection();
+}
+
 void StackSamplerLoopManager::PerformDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs)
 {
     _deadlockInterventionInProgress = 1;
@@ -432,6 +478,41 @@ bool StackSamplerLoopManager::AllowStackWalk(ManagedThreadInfo* pThreadInfo)
 {
     std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
 
+    if (!TryAcquireStackWalk(pThreadInfo, "AllowStackWalk"))
+    {
+        return false;
+    }
+
+    pThreadInfo->AddRef();
+    _pTargetThread = pThreadInfo;
+    _isTargetThreadSuspended = false;
+    _isForceTerminated = false;
+
+    return true;
+}
+
+bool StackSamplerLoopManager::AllowBatchStackWalk(ManagedThreadInfo* pThreadInfo)
+{
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+
+    // In batch mode, there is no single target thread:
+    // the stack walk lock of each thread of the batch is held until NotifyBatchIterationFinished is called
+    if (!TryAcquireStackWalk(pThreadInfo, "AllowBatchStackWalk"))
+    {
+        return false;
+    }
+
+    pThreadInfo->AddRef();
+    _isTargetThreadSuspended = false;
+    _isForceTerminated = false;
+
+    return true;
+}
+
+bool StackSamplerLoopManager::TryAcquireStackWalk(ManagedThreadInfo* pThreadInfo, const char* caller)
+{
+    // This method must only be called while _watcherActivityLock is held!
+
     bool isThreadSafeStatusChanged;
     bool isThreadSafeForStackSampleCollection = GetUpdateIsThreadSafeForStackSampleCollection(pThreadInfo, &isThreadSafeStatusChanged);
 
@@ -445,7 +526,7 @@ bool StackSamplerLoopManager::AllowStackWalk(ManagedThreadInfo* pThreadInfo)
                                        &threadUsedDeadlocksAggPeriodIndex);
 
         // At that step, the target thread is not suspended so no deadlock risk when logging
-        Log::Info("ShouldCollectThread status changed in AllowStackWalk",
+        Log::Info("ShouldCollectThread status changed in ", caller,
                   " for thread (OsThreadId=", pThreadInfo->GetOsThreadId(),
                   ", ClrThreadId=0x", std::hex, pThreadInfo->GetClrThreadId(), std::dec,
                   ", ThreadName=\"", pThreadInfo->GetThreadName(), "\"):",
@@ -475,11 +556,6 @@ bool StackSamplerLoopManager::AllowStackWalk(ManagedThreadInfo* pThreadInfo)
         return false;
     }
 
-    pThreadInfo->AddRef();
-    _pTargetThread = pThreadInfo;
-    _isTargetThreadSuspended = false;
-    _isForceTerminated = false;
-
     return true;
 }
 
@@ -527,12 +603,79 @@ void StackSamplerLoopManager::NotifyIterationFinished()
     _collectionStartNs = 0;
     _isTargetThreadSuspended = false;
 
+    UpdateSuspensionStatistics();
+}
+
+void StackSamplerLoopManager::NotifyBatchIterationFinished(ManagedThreadInfo* const* ppThreadInfos, std::size_t threadsCount)
+{
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+
+    for (std::size_t i = 0; i < threadsCount; i++)
+    {
+        ppThreadInfos[i]->GetStackWalkLock().Release();
+        ppThreadInfos[i]->Release();
+    }
+    _collectionStartNs = 0;
+    _isTargetThreadSuspended = false;
+
+    UpdateSuspensionStatistics();
+}
+
+std::int64_t StackSamplerLoopManager::GetMeanCollectionTime()
+{
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+
+    // don't rely on the few first collections of a new period
+    if (_currentStatistics->GetCollectionsCount() < MinCollectionsCountForMeanCollectionTime)
+    {
+        return _previousMeanCollectionTime;
+    }
+
+    return static_cast<std::int64_t>(_currentStatistics->GetMeanCollectionTime());
+}
+
+bool StackSamplerLoopManager::IsCpuTimerEnabled() const
+{
+    return _cpuTimerInterval > std::chrono::milliseconds::zero();
+}
+
+void StackSamplerLoopManager::StartCpuTimer(ManagedThreadInfo* pThreadInfo)
+{
+    if (!IsCpuTimerEnabled() || _isStopped)
+    {
+        return;
+    }
+
+    if (!_pStackFramesCollector->StartCpuTimer(pThreadInfo, _cpuTimerInterval))
+    {
+        Log::Debug("Failed to start the CPU timer for thread with osThreadId=", pThreadInfo->GetOsThreadId());
+    }
+}
+
+void StackSamplerLoopManager::StopCpuTimer(ManagedThreadInfo* pThreadInfo)
+{
+    if (!IsCpuTimerEnabled())
+    {
+        return;
+    }
+
+    _pStackFramesCollector->StopCpuTimer(pThreadInfo);
+}
+
+void StackSamplerLoopManager::UpdateSuspensionStatistics()
+{
+    // This method must only be called while _watcherActivityLock is held!
+
     std::int64_t threadCollectionEndTimeNs = OpSysTools::GetHighPrecisionNanoseconds();
     _currentStatistics->AddSuspensionTime(threadCollectionEndTimeNs - _threadSuspensionStart);
 
     if (threadCollectionEndTimeNs - _statisticCollectionStartNs >= StatisticAggregationPeriodNs.count())
     {
         Log::Debug("Notify-ThreadStackSampleCollection-Finished invoked - Prepare statistics to be sent.");
+        if (_currentStatistics->GetCollectionsCount() != 0)
+        {
+            _previousMeanCollectionTime = static_cast<std::int64_t>(_currentStatistics->GetMeanCollectionTime());
+        }
         _statisticsReadyToSend.reset(_currentStatistics.release());
         _currentStatistics = std::make_unique<Statistics>();
         _statisticCollectionStartNs = threadCollectionEndTimeNs;
@@ -100,10 +100,21 @@ public:
     void NotifyCollectionStart() override;
     void NotifyCollectionEnd() override;
     void NotifyIterationFinished() override;
+    bool AllowBatchStackWalk(ManagedThreadInfo* pThreadInfo) override;
+    void NotifyBatchIterationFinished(ManagedThreadInfo* const* ppThreadInfos, std::size_t threadsCount) override;
+    std::int64_t GetMeanCollectionTime() override;
+    void StartCpuTimer(ManagedThreadInfo* pThreadInfo) override;
+    void StopCpuTimer(ManagedThreadInfo* pThreadInfo) override;
+
+    // true if CPU samples are collected by per-thread timers instead of polling the threads
+    bool IsCpuTimerEnabled() const;
 
 private:
     StackSamplerLoopManager() = delete;
 
+    bool TryAcquireStackWalk(ManagedThreadInfo* pThreadInfo, const char* caller);
+    void UpdateSuspensionStatistics();
+
     inline bool GetUpdateIsThreadSafeForStackSampleCollection(ManagedThreadInfo* pThreadInfo, bool* pIsStatusChanged);
     inline bool ShouldCollectThread(std::uint64_t threadAggPeriodDeadlockCount, std::uint64_t globalAggPeriodDeadlockCount) const;
 
@@ -116,6 +127,7 @@ private:
     void WatcherLoop(void);
     void WatcherLoopIteration(void);
     void PerformDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs);
+    void AbortBatchCollection();
     void LogDeadlockIntervention(
         const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs,
         bool wasThreadSafeForStackSampleCollection,
@@ -172,6 +184,10 @@ private:
         {
             return (double)_totalCollectionTime / _totalCollections;
         }
+        std::uint64_t GetCollectionsCount() const
+        {
+            return _totalCollections;
+        }
 
         void IncrDeadlockCount()
         {
@@ -238,7 +254,12 @@ private:
     std::int64_t _threadSuspensionStart;
     std::unique_ptr<Statistics> _statisticsReadyToSend;
     std::unique_ptr<Statistics> _currentStatistics;
+    // used by the sampler loop until enough collections are done in the current period
+    std::int64_t _previousMeanCollectionTime;
 
     IClrLifetime const* _pClrLifetime;
     bool _isStopped = false;
+
+    // 0 when the threads are polled for CPU time
+    std::chrono::milliseconds _cpuTimerInterval;
 };
@@ -14,8 +14,9 @@
 /// <summary>
 /// Allocating when a thread is suspended can lead to deadlocks.
 /// This container holds a buffer that is used while walking stacks to temporarily hold results.
-/// If we wanted to walk stacks of more than one thread concurrently, there would need to be more then once instance of this class.
-/// However, since StackFrameCollector implementations currently all walk one stack at a time, they use one instance of this class each.
+/// Walking stacks of more than one thread concurrently requires one instance of this class per walked thread.
+/// Most StackFrameCollector implementations walk one stack at a time and use one instance of this class each;
+/// collectors supporting batch collection (see StackFramesCollectorBase::CollectStackSamples) own one instance per batch slot.
 /// </summary>
 class StackSnapshotResultBuffer
 {
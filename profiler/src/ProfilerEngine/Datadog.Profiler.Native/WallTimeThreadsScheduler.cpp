@@ -0,0 +1,104 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "WallTimeThreadsScheduler.h"
+
+#include <algorithm>
+
+#include "IManagedThreadList.h"
+
+
+WallTimeThreadsScheduler::WallTimeThreadsScheduler(IManagedThreadList* pManagedThreadList) :
+    _pManagedThreadList{pManagedThreadList}
+{
+    _iterator = _pManagedThreadList->CreateIterator();
+    _candidates.reserve(MaxCandidatesPerIteration);
+}
+
+WallTimeThreadsScheduler::~WallTimeThreadsScheduler() = default;
+
+void WallTimeThreadsScheduler::SelectThreads(std::int64_t currentTimestampNs, std::size_t maxThreadsCount, std::vector<ManagedThreadInfo*>& selectedThreads)
+{
+    // don't go through the list more than once per iteration
+    auto candidatesCount = (std::min)(_pManagedThreadList->Count(), MaxCandidatesPerIteration);
+
+    _candidates.clear();
+    for (std::uint32_t i = 0; i < candidatesCount; i++)
+    {
+        // LoopNext() calls AddRef() on the threadInfo before returning it.
+        ManagedThreadInfo* pThreadInfo = _pManagedThreadList->LoopNext(_iterator);
+        if (pThreadInfo == nullptr)
+        {
+            continue;
+        }
+
+        // The thread was already registered, but the OS handle is not associated yet.
+        if (pThreadInfo->GetOsThreadHandle() == static_cast<HANDLE>(0))
+        {
+            pThreadInfo->Release();
+            continue;
+        }
+
+        _candidates.push_back(ComputePriority(pThreadInfo, currentTimestampNs));
+    }
+
+    auto selectedCount = (std::min)(maxThreadsCount, _candidates.size());
+    if (selectedCount < _candidates.size())
+    {
+        std::partial_sort(
+            _candidates.begin(), _candidates.begin() + selectedCount, _candidates.end(),
+            [](Candidate const& left, Candidate const& right) {
+                if (left.IsOverdue != right.IsOverdue)
+                {
+                    return left.IsOverdue;
+                }
+                return left.Priority > right.Priority;
+            });
+    }
+
+    for (std::size_t i = 0; i < _candidates.size(); i++)
+    {
+        auto* pThreadInfo = _candidates[i].pThreadInfo;
+        if (i < selectedCount)
+        {
+            // the last sampled span is updated by the sampler thread once the stack is collected:
+            // the walk of a selected thread might still be refused
+            selectedThreads.push_back(pThreadInfo);
+        }
+        else
+        {
+            pThreadInfo->Release();
+        }
+    }
+
+    _candidates.clear();
+}
+
+WallTimeThreadsScheduler::Candidate WallTimeThreadsScheduler::ComputePriority(ManagedThreadInfo* pThreadInfo, std::int64_t currentTimestampNs)
+{
+    auto lastSampleTimestampNs = static_cast<std::int64_t>(pThreadInfo->GetLastSampleHighPrecisionTimestampNanoseconds());
+
+    // a thread that has never been sampled is considered as waiting since MaxSampleGap
+    std::uint64_t elapsedNs = (lastSampleTimestampNs == 0)
+                                  ? static_cast<std::uint64_t>(MaxSampleGap.count())
+                                  : static_cast<std::uint64_t>((std::max)(static_cast<std::int64_t>(0), currentTimestampNs - lastSampleTimestampNs));
+
+    if (elapsedNs >= static_cast<std::uint64_t>(MaxSampleGap.count()))
+    {
+        return {pThreadInfo, true, elapsedNs};
+    }
+
+    // The trace context might be updated at the same time: this is only a hint so no need for consistency
+    std::uint64_t weight = 1;
+    auto spanId = pThreadInfo->GetSpanId();
+    if (pThreadInfo->GetLocalRootSpanId() != 0)
+    {
+        weight *= ActiveSpanWeight;
+    }
+    if (spanId != pThreadInfo->GetLastSampledSpanId())
+    {
+        weight *= SpanChangedWeight;
+    }
+
+    return {pThreadInfo, false, elapsedNs * weight};
+}
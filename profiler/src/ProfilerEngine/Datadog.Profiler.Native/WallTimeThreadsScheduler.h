@@ -0,0 +1,57 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "IWallTimeThreadsScheduler.h"
+#include "ManagedThreadInfo.h"
+
+// forward declarations
+class IManagedThreadList;
+
+
+// In each iteration, a window of candidate threads is taken (round-robin) from the managed threads list
+// and the ones with the highest priority are selected:
+// - threads that were not sampled for more than MaxSampleGap are always selected first
+//   (the longest waiting first) so that no thread is starved
+// - otherwise, the priority is the time elapsed since the last sample weighted by the thread activity:
+//   threads running a traced request (i.e. with an active span) or whose span changed since their
+//   last sample are preferred to idle threads
+// Threads without OS handle yet cannot be sampled and are skipped.
+class WallTimeThreadsScheduler : public IWallTimeThreadsScheduler
+{
+public:
+    static constexpr std::chrono::nanoseconds MaxSampleGap = std::chrono::seconds(1);
+    static constexpr std::uint32_t MaxCandidatesPerIteration = 64;
+    static constexpr std::uint64_t ActiveSpanWeight = 4;
+    static constexpr std::uint64_t SpanChangedWeight = 2;
+
+public:
+    WallTimeThreadsScheduler(IManagedThreadList* pManagedThreadList);
+    ~WallTimeThreadsScheduler() override;
+
+    WallTimeThreadsScheduler(WallTimeThreadsScheduler const&) = delete;
+    WallTimeThreadsScheduler& operator=(WallTimeThreadsScheduler const&) = delete;
+
+    void SelectThreads(std::int64_t currentTimestampNs, std::size_t maxThreadsCount, std::vector<ManagedThreadInfo*>& selectedThreads) override;
+
+private:
+    struct Candidate
+    {
+        ManagedThreadInfo* pThreadInfo;
+        bool IsOverdue;
+        std::uint64_t Priority;
+    };
+
+    static Candidate ComputePriority(ManagedThreadInfo* pThreadInfo, std::int64_t currentTimestampNs);
+
+private:
+    IManagedThreadList* _pManagedThreadList;
+    std::uint32_t _iterator;
+
+    // allocated once to avoid allocations in each iteration
+    std::vector<Candidate> _candidates;
+};
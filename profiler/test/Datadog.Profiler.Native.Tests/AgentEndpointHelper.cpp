@@ -0,0 +1,146 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#ifndef _WINDOWS
+
+#include "AgentEndpointHelper.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+AgentEndpointHelper::AgentEndpointHelper() :
+    _listenSocket{-1},
+    _port{0},
+    _holdResponses{false},
+    _responseDelayMs{0},
+    _stopRequested{false},
+    _answeredRequestsCount{0}
+{
+    _listenSocket = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0; // let the system pick a free port
+
+    bind(_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    listen(_listenSocket, 64);
+
+    socklen_t length = sizeof(address);
+    getsockname(_listenSocket, reinterpret_cast<sockaddr*>(&address), &length);
+    _port = ntohs(address.sin_port);
+
+    _worker = std::thread(&AgentEndpointHelper::Work, this);
+}
+
+AgentEndpointHelper::~AgentEndpointHelper()
+{
+    _stopRequested = true;
+    _worker.join();
+    close(_listenSocket);
+}
+
+std::string AgentEndpointHelper::GetUrl() const
+{
+    return "http://127.0.0.1:" + std::to_string(_port);
+}
+
+void AgentEndpointHelper::HoldResponses(bool hold)
+{
+    _holdResponses = hold;
+}
+
+void AgentEndpointHelper::DelayResponses(std::chrono::milliseconds delay)
+{
+    _responseDelayMs = delay.count();
+}
+
+int32_t AgentEndpointHelper::GetAnsweredRequestsCount() const
+{
+    return _answeredRequestsCount;
+}
+
+void AgentEndpointHelper::Work()
+{
+    static const char Response[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+    // The request content is not parsed: a request is considered complete
+    // when nothing has been received on the connection for a while
+    struct Connection
+    {
+        int Socket;
+        bool HasReceivedData;
+        std::chrono::steady_clock::time_point LastReceived;
+    };
+    std::vector<Connection> connections;
+    char buffer[16 * 1024];
+
+    while (!_stopRequested)
+    {
+        std::vector<pollfd> fds;
+        fds.push_back({_listenSocket, POLLIN, 0});
+        for (auto const& connection : connections)
+        {
+            fds.push_back({connection.Socket, POLLIN, 0});
+        }
+
+        poll(fds.data(), fds.size(), 20);
+
+        if (fds[0].revents & POLLIN)
+        {
+            auto socket = accept4(_listenSocket, nullptr, nullptr, SOCK_CLOEXEC);
+            if (socket != -1)
+            {
+                connections.push_back({socket, false, std::chrono::steady_clock::now()});
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        for (auto i = 1u; i < fds.size(); i++)
+        {
+            auto& connection = connections[i - 1];
+            if (fds[i].revents & POLLIN)
+            {
+                auto received = recv(connection.Socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (received > 0)
+                {
+                    connection.HasReceivedData = true;
+                    connection.LastReceived = now;
+                }
+                else if (received == 0)
+                {
+                    // closed by the client
+                    close(connection.Socket);
+                    connection.Socket = -1;
+                }
+            }
+
+            if ((connection.Socket != -1) && !_holdResponses && connection.HasReceivedData &&
+                (now - connection.LastReceived > std::chrono::milliseconds(100 + _responseDelayMs)))
+            {
+                send(connection.Socket, Response, sizeof(Response) - 1, MSG_NOSIGNAL);
+                close(connection.Socket);
+                connection.Socket = -1;
+                _answeredRequestsCount++;
+            }
+        }
+
+        connections.erase(
+            std::remove_if(connections.begin(), connections.end(), [](Connection const& connection) { return connection.Socket == -1; }),
+            connections.end());
+    }
+
+    for (auto const& connection : connections)
+    {
+        close(connection.Socket);
+    }
+}
+
+#endif
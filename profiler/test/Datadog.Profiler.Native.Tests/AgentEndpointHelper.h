@@ -0,0 +1,40 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#pragma once
+
+#ifndef _WINDOWS
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+// Minimal local HTTP endpoint standing in for the agent:
+// every request is answered with a 200 status unless the responses are held
+// (or delayed) to simulate a slow agent.
+class AgentEndpointHelper
+{
+public:
+    AgentEndpointHelper();
+    ~AgentEndpointHelper();
+
+    std::string GetUrl() const;
+    void HoldResponses(bool hold);
+    void DelayResponses(std::chrono::milliseconds delay);
+    int32_t GetAnsweredRequestsCount() const;
+
+private:
+    void Work();
+
+private:
+    int _listenSocket;
+    int _port;
+    std::atomic<bool> _holdResponses;
+    std::atomic<std::int64_t> _responseDelayMs;
+    std::atomic<bool> _stopRequested;
+    std::atomic<int32_t> _answeredRequestsCount;
+    std::thread _worker;
+};
+
+#endif
@@ -145,6 +145,43 @@ TEST(ConfigurationTest, CheckProfileDirectoryWhenVariableIsSet)
     ASSERT_EQ(expectedValue, configuration.GetProfilesOutputDirectory());
 }
 
+TEST(ConfigurationTest, CheckNoDefaultExportSpoolDirectoryWhenVariableIsNotSet)
+{
+    unsetenv(EnvironmentVariables::ExportSpoolDir);
+    auto configuration = Configuration{};
+    auto expectedValue = shared::WSTRING();
+    ASSERT_EQ(expectedValue, configuration.GetExportSpoolDirectory());
+}
+
+TEST(ConfigurationTest, CheckExportSpoolDirectoryWhenVariableIsSet)
+{
+    auto expectedValue = fs::path(WStr("MyFolder/WhereIWantIt/ToBeSpooled"));
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::ExportSpoolDir, shared::ToWSTRING(expectedValue.string()));
+    auto configuration = Configuration{};
+    ASSERT_EQ(expectedValue, configuration.GetExportSpoolDirectory());
+}
+
+TEST(ConfigurationTest, CheckCpuTimerIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::CpuTimerInterval);
+    auto configuration = Configuration{};
+    ASSERT_EQ(0ms, configuration.GetCpuTimerInterval());
+}
+
+TEST(ConfigurationTest, CheckCpuTimerIntervalWhenVariableIsSet)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::CpuTimerInterval, WStr("10"));
+    auto configuration = Configuration{};
+    ASSERT_EQ(10ms, configuration.GetCpuTimerInterval());
+}
+
+TEST(ConfigurationTest, CheckCpuTimerIsDisabledWhenVariableIsInvalid)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::CpuTimerInterval, WStr("-10"));
+    auto configuration = Configuration{};
+    ASSERT_EQ(0ms, configuration.GetCpuTimerInterval());
+}
+
 TEST(ConfigurationTest, CheckDefaultUploadIntervalInDevMode)
 {
     unsetenv(EnvironmentVariables::UploadInterval);
@@ -331,4 +368,18 @@ TEST(ConfigurationTest, CheckUserTagsWhenVariableIsSetWithIncompleteTag)
     EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::Tags, WStr("foo:bar,foobar:barbar,lab1:"));
     auto configuration = Configuration{};
     EXPECT_THAT(configuration.GetUserTags(), ::testing::ContainerEq(tags{{"foo", "bar"}, {"foobar", "barbar"}, {"lab1", ""}}));
-}
\ No newline at end of file
+}
+
+TEST(ConfigurationTest, CheckIfBatchedSamplingIsNotEnabledWhenVariableIsNotSet)
+{
+    unsetenv(EnvironmentVariables::BatchedSamplingEnabled);
+    auto configuration = Configuration{};
+    ASSERT_FALSE(configuration.IsBatchedSamplingEnabled());
+}
+
+TEST(ConfigurationTest, CheckIfBatchedSamplingIsEnabledWhenEnvVariableIsSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::BatchedSamplingEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_TRUE(configuration.IsBatchedSamplingEnabled());
+}
@@ -0,0 +1,419 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "CorProfilerInfoHelper.h"
+
+CorProfilerInfoHelper::CorProfilerInfoHelper() :
+    _refCount{0}
+{
+}
+
+ULONG CorProfilerInfoHelper::GetRefCount() const
+{
+    return _refCount.load();
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::QueryInterface(REFIID riid, void** ppvObject)
+{
+    return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE CorProfilerInfoHelper::AddRef()
+{
+    return _refCount.fetch_add(1) + 1;
+}
+
+ULONG STDMETHODCALLTYPE CorProfilerInfoHelper::Release()
+{
+    return _refCount.fetch_sub(1) - 1;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassFromObject(ObjectID objectId, ClassID* pClassId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassFromToken(ModuleID moduleId, mdTypeDef typeDef, ClassID* pClassId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetCodeInfo(FunctionID functionId, LPCBYTE* pStart, ULONG* pcSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetEventMask(DWORD* pdwEvents)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionFromIP(LPCBYTE ip, FunctionID* pFunctionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionFromToken(ModuleID moduleId, mdToken token, FunctionID* pFunctionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetHandleFromThread(ThreadID threadId, HANDLE* phThread)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetObjectSize(ObjectID objectId, ULONG* pcSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::IsArrayClass(ClassID classId, CorElementType* pBaseElemType, ClassID* pBaseClassId, ULONG* pcRank)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetThreadInfo(ThreadID threadId, DWORD* pdwWin32ThreadId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetCurrentThreadID(ThreadID* pThreadId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassIDInfo(ClassID classId, ModuleID* pModuleId, mdTypeDef* pTypeDefToken)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionInfo(FunctionID functionId, ClassID* pClassId, ModuleID* pModuleId, mdToken* pToken)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetEventMask(DWORD dwEvents)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetEnterLeaveFunctionHooks(FunctionEnter* pFuncEnter, FunctionLeave* pFuncLeave, FunctionTailcall* pFuncTailcall)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetFunctionIDMapper(FunctionIDMapper* pFunc)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetTokenAndMetaDataFromFunction(FunctionID functionId, REFIID riid, IUnknown** ppImport, mdToken* pToken)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetModuleInfo(ModuleID moduleId, LPCBYTE* ppBaseLoadAddress, ULONG cchName, ULONG* pcchName, WCHAR szName[], AssemblyID* pAssemblyId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetModuleMetaData(ModuleID moduleId, DWORD dwOpenFlags, REFIID riid, IUnknown** ppOut)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetILFunctionBody(ModuleID moduleId, mdMethodDef methodId, LPCBYTE* ppMethodHeader, ULONG* pcbMethodSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetILFunctionBodyAllocator(ModuleID moduleId, IMethodMalloc** ppMalloc)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetILFunctionBody(ModuleID moduleId, mdMethodDef methodid, LPCBYTE pbNewILMethodHeader)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetAppDomainInfo(AppDomainID appDomainId, ULONG cchName, ULONG* pcchName, WCHAR szName[], ProcessID* pProcessId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetAssemblyInfo(AssemblyID assemblyId, ULONG cchName, ULONG* pcchName, WCHAR szName[], AppDomainID* pAppDomainId, ModuleID* pModuleId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetFunctionReJIT(FunctionID functionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::ForceGC(void)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetILInstrumentedCodeMap(FunctionID functionId, BOOL fStartJit, ULONG cILMapEntries, COR_IL_MAP rgILMapEntries[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetInprocInspectionInterface(IUnknown** ppicd)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetInprocInspectionIThisThread(IUnknown** ppicd)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetThreadContext(ThreadID threadId, ContextID* pContextId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::BeginInprocDebugging(BOOL fThisThreadOnly, DWORD* pdwProfilerContext)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EndInprocDebugging(DWORD dwProfilerContext)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetILToNativeMapping(FunctionID functionId, ULONG32 cMap, ULONG32* pcMap, COR_DEBUG_IL_TO_NATIVE_MAP map[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::DoStackSnapshot(ThreadID thread, StackSnapshotCallback* callback, ULONG32 infoFlags, void* clientData, BYTE context[], ULONG32 contextSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetEnterLeaveFunctionHooks2(FunctionEnter2* pFuncEnter, FunctionLeave2* pFuncLeave, FunctionTailcall2* pFuncTailcall)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionInfo2(FunctionID funcId, COR_PRF_FRAME_INFO frameInfo, ClassID* pClassId, ModuleID* pModuleId, mdToken* pToken, ULONG32 cTypeArgs, ULONG32* pcTypeArgs, ClassID typeArgs[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetStringLayout(ULONG* pBufferLengthOffset, ULONG* pStringLengthOffset, ULONG* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassLayout(ClassID classID, COR_FIELD_OFFSET rFieldOffset[], ULONG cFieldOffset, ULONG* pcFieldOffset, ULONG* pulClassSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassIDInfo2(ClassID classId, ModuleID* pModuleId, mdTypeDef* pTypeDefToken, ClassID* pParentClassId, ULONG32 cNumTypeArgs, ULONG32* pcNumTypeArgs, ClassID typeArgs[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetCodeInfo2(FunctionID functionID, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetClassFromTokenAndTypeArgs(ModuleID moduleID, mdTypeDef typeDef, ULONG32 cTypeArgs, ClassID typeArgs[], ClassID* pClassID)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionFromTokenAndTypeArgs(ModuleID moduleID, mdMethodDef funcDef, ClassID classId, ULONG32 cTypeArgs, ClassID typeArgs[], FunctionID* pFunctionID)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EnumModuleFrozenObjects(ModuleID moduleID, ICorProfilerObjectEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetArrayObjectInfo(ObjectID objectId, ULONG32 cDimensions, ULONG32 pDimensionSizes[], int pDimensionLowerBounds[], BYTE** ppData)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetBoxClassLayout(ClassID classId, ULONG32* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetThreadAppDomain(ThreadID threadId, AppDomainID* pAppDomainId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetRVAStaticAddress(ClassID classId, mdFieldDef fieldToken, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetAppDomainStaticAddress(ClassID classId, mdFieldDef fieldToken, AppDomainID appDomainId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetThreadStaticAddress(ClassID classId, mdFieldDef fieldToken, ThreadID threadId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetContextStaticAddress(ClassID classId, mdFieldDef fieldToken, ContextID contextId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetStaticFieldInfo(ClassID classId, mdFieldDef fieldToken, COR_PRF_STATIC_TYPE* pFieldInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetGenerationBounds(ULONG cObjectRanges, ULONG* pcObjectRanges, COR_PRF_GC_GENERATION_RANGE ranges[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetObjectGeneration(ObjectID objectId, COR_PRF_GC_GENERATION_RANGE* range)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetNotifiedExceptionClauseInfo(COR_PRF_EX_CLAUSE_INFO* pinfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EnumJITedFunctions(ICorProfilerFunctionEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::RequestProfilerDetach(DWORD dwExpectedCompletionMilliseconds)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetFunctionIDMapper2(FunctionIDMapper2* pFunc, void* clientData)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetStringLayout2(ULONG* pStringLengthOffset, ULONG* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetEnterLeaveFunctionHooks3(FunctionEnter3* pFuncEnter3, FunctionLeave3* pFuncLeave3, FunctionTailcall3* pFuncTailcall3)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::SetEnterLeaveFunctionHooks3WithInfo(FunctionEnter3WithInfo* pFuncEnter3WithInfo, FunctionLeave3WithInfo* pFuncLeave3WithInfo, FunctionTailcall3WithInfo* pFuncTailcall3WithInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionEnter3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo, ULONG* pcbArgumentInfo, COR_PRF_FUNCTION_ARGUMENT_INFO* pArgumentInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionLeave3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo, COR_PRF_FUNCTION_ARGUMENT_RANGE* pRetvalRange)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionTailcall3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EnumModules(ICorProfilerModuleEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetRuntimeInformation(USHORT* pClrInstanceId, COR_PRF_RUNTIME_TYPE* pRuntimeType, USHORT* pMajorVersion, USHORT* pMinorVersion, USHORT* pBuildNumber, USHORT* pQFEVersion, ULONG cchVersionString, ULONG* pcchVersionString, WCHAR szVersionString[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetThreadStaticAddress2(ClassID classId, mdFieldDef fieldToken, AppDomainID appDomainId, ThreadID threadId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetAppDomainsContainingModule(ModuleID moduleId, ULONG32 cAppDomainIds, ULONG32* pcAppDomainIds, AppDomainID appDomainIds[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetModuleInfo2(ModuleID moduleId, LPCBYTE* ppBaseLoadAddress, ULONG cchName, ULONG* pcchName, WCHAR szName[], AssemblyID* pAssemblyId, DWORD* pdwModuleFlags)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EnumThreads(ICorProfilerThreadEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::InitializeCurrentThread(void)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::RequestReJIT(ULONG cFunctions, ModuleID moduleIds[], mdMethodDef methodIds[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::RequestRevert(ULONG cFunctions, ModuleID moduleIds[], mdMethodDef methodIds[], HRESULT status[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetCodeInfo3(FunctionID functionID, ReJITID reJitId, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetFunctionFromIP2(LPCBYTE ip, FunctionID* pFunctionId, ReJITID* pReJitId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetReJITIDs(FunctionID functionId, ULONG cReJitIds, ULONG* pcReJitIds, ReJITID reJitIds[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetILToNativeMapping2(FunctionID functionId, ReJITID reJitId, ULONG32 cMap, ULONG32* pcMap, COR_DEBUG_IL_TO_NATIVE_MAP map[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::EnumJITedFunctions2(ICorProfilerFunctionEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE CorProfilerInfoHelper::GetObjectSize2(ObjectID objectId, SIZE_T* pcSize)
+{
+    return E_NOTIMPL;
+}
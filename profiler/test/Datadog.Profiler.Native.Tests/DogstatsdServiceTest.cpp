@@ -0,0 +1,244 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#ifndef _WINDOWS
+
+#include "gtest/gtest.h"
+
+#include "DogstatsdService.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+// Local datagram socket standing in for the agent DogStatsD endpoint
+class DogstatsdListener
+{
+public:
+    // UDP on a free port
+    DogstatsdListener()
+    {
+        _socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0; // let the system pick a free port
+        bind(_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+
+        socklen_t length = sizeof(address);
+        getsockname(_socket, reinterpret_cast<sockaddr*>(&address), &length);
+        _port = ntohs(address.sin_port);
+    }
+
+    // Unix domain socket
+    explicit DogstatsdListener(std::string path) :
+        _path{std::move(path)}
+    {
+        _socket = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        strcpy(address.sun_path, _path.c_str());
+        unlink(_path.c_str());
+        bind(_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+
+    ~DogstatsdListener()
+    {
+        close(_socket);
+        if (!_path.empty())
+        {
+            unlink(_path.c_str());
+        }
+    }
+
+    int32_t GetPort() const
+    {
+        return _port;
+    }
+
+    // Returns the received datagrams until nothing is received for the given duration
+    std::vector<std::string> Receive(std::chrono::milliseconds timeout = 500ms)
+    {
+        std::vector<std::string> datagrams;
+        char buffer[64 * 1024];
+
+        pollfd pfd = {_socket, POLLIN, 0};
+        while (poll(&pfd, 1, static_cast<int>(timeout.count())) > 0)
+        {
+            auto size = recv(_socket, buffer, sizeof(buffer), 0);
+            if (size <= 0)
+            {
+                break;
+            }
+            datagrams.emplace_back(buffer, size);
+        }
+
+        return datagrams;
+    }
+
+    static std::vector<std::string> GetLines(std::vector<std::string> const& datagrams)
+    {
+        std::vector<std::string> lines;
+        for (auto const& datagram : datagrams)
+        {
+            std::istringstream stream(datagram);
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                lines.push_back(line);
+            }
+        }
+        return lines;
+    }
+
+private:
+    int _socket;
+    int32_t _port = 0;
+    std::string _path;
+};
+
+bool Contains(std::vector<std::string> const& lines, std::string const& expected)
+{
+    return std::find(lines.cbegin(), lines.cend(), expected) != lines.cend();
+}
+} // namespace
+
+TEST(DogstatsdServiceTest, CheckCountersAreSummedAndLastGaugeValueIsSent)
+{
+    DogstatsdListener listener;
+    DogstatsdService service("127.0.0.1", listener.GetPort(), {{"env", "test"}}, 1h);
+
+    ASSERT_TRUE(service.Counter("test.counter", 1));
+    ASSERT_TRUE(service.Counter("test.counter", 2));
+    ASSERT_TRUE(service.Counter("test.counter", 3));
+    ASSERT_TRUE(service.Gauge("test.gauge", 1.5));
+    ASSERT_TRUE(service.Gauge("test.gauge", 2.5));
+    ASSERT_TRUE(service.Flush());
+
+    auto datagrams = listener.Receive();
+    ASSERT_EQ(1, datagrams.size());
+
+    auto lines = DogstatsdListener::GetLines(datagrams);
+    ASSERT_EQ(2, lines.size());
+    ASSERT_TRUE(Contains(lines, "test.counter:6|c|#env:test"));
+    ASSERT_TRUE(Contains(lines, "test.gauge:2.500000|g|#env:test"));
+
+    // nothing is sent if no metric was added since the last flush
+    ASSERT_TRUE(service.Flush());
+    ASSERT_TRUE(listener.Receive(100ms).empty());
+}
+
+TEST(DogstatsdServiceTest, CheckCountersWithDifferentTagsAreNotAggregated)
+{
+    DogstatsdListener listener;
+    DogstatsdService service("127.0.0.1", listener.GetPort(), {{"env", "test"}}, 1h);
+
+    service.Counter("test.exports", 1, {{"success", "1"}});
+    service.Counter("test.exports", 1, {{"success", "0"}});
+    service.Counter("test.exports", 1, {{"success", "1"}});
+    service.Flush();
+
+    auto lines = DogstatsdListener::GetLines(listener.Receive());
+    ASSERT_EQ(2, lines.size());
+    ASSERT_TRUE(Contains(lines, "test.exports:2|c|#env:test,success:1"));
+    ASSERT_TRUE(Contains(lines, "test.exports:1|c|#env:test,success:0"));
+}
+
+TEST(DogstatsdServiceTest, CheckInvalidMetricNameIsRejected)
+{
+    DogstatsdListener listener;
+    DogstatsdService service("127.0.0.1", listener.GetPort(), {}, 1h);
+
+    ASSERT_FALSE(service.Counter("invalid|name", 1));
+    ASSERT_FALSE(service.Gauge("", 1));
+    service.Flush();
+
+    ASSERT_TRUE(listener.Receive(100ms).empty());
+}
+
+TEST(DogstatsdServiceTest, CheckMetricsArePackedInDatagramsSmallerThanTheLimit)
+{
+    DogstatsdListener listener;
+    DogstatsdService service("127.0.0.1", listener.GetPort(), {{"service_name", "DogstatsdServiceTest"}}, 1h);
+
+    const int metricsCount = 200;
+    for (int i = 0; i < metricsCount; i++)
+    {
+        service.Counter("test.counter_" + std::to_string(i), i);
+    }
+    ASSERT_TRUE(service.Flush());
+
+    auto datagrams = listener.Receive();
+
+    // each line is about 50 bytes long
+    ASSERT_LT(1, datagrams.size());
+    ASSERT_GT(metricsCount / 10, datagrams.size());
+    for (auto const& datagram : datagrams)
+    {
+        ASSERT_GE(DogstatsdService::MaxUdpDatagramSize, datagram.size());
+    }
+
+    auto lines = DogstatsdListener::GetLines(datagrams);
+    ASSERT_EQ(metricsCount, lines.size());
+    for (int i = 0; i < metricsCount; i++)
+    {
+        ASSERT_TRUE(Contains(lines, "test.counter_" + std::to_string(i) + ":" + std::to_string(i) + "|c|#service_name:DogstatsdServiceTest"));
+    }
+}
+
+TEST(DogstatsdServiceTest, CheckMetricsAreFlushedByTheTimer)
+{
+    DogstatsdListener listener;
+    DogstatsdService service("127.0.0.1", listener.GetPort(), {}, 50ms);
+
+    service.Counter("test.counter", 42);
+
+    auto lines = DogstatsdListener::GetLines(listener.Receive(2s));
+    ASSERT_EQ(1, lines.size());
+    ASSERT_EQ("test.counter:42|c", lines[0]);
+}
+
+TEST(DogstatsdServiceTest, CheckPendingMetricsAreSentWhenDestroyed)
+{
+    DogstatsdListener listener;
+    {
+        DogstatsdService service("127.0.0.1", listener.GetPort(), {}, 1h);
+        service.Gauge("test.gauge", 3);
+    }
+
+    auto lines = DogstatsdListener::GetLines(listener.Receive());
+    ASSERT_EQ(1, lines.size());
+    ASSERT_EQ("test.gauge:3.000000|g", lines[0]);
+}
+
+TEST(DogstatsdServiceTest, CheckMetricsAreSentThroughUnixDomainSocket)
+{
+    std::string path = "/tmp/DogstatsdServiceTest_" + std::to_string(getpid()) + ".socket";
+    DogstatsdListener listener(path);
+    DogstatsdService service(path, {{"env", "test"}}, 1h);
+
+    service.Counter("test.counter", 1);
+    service.Counter("test.counter", 1);
+    ASSERT_TRUE(service.Flush());
+
+    auto lines = DogstatsdListener::GetLines(listener.Receive());
+    ASSERT_EQ(1, lines.size());
+    ASSERT_EQ("test.counter:2|c|#env:test", lines[0]);
+}
+
+#endif
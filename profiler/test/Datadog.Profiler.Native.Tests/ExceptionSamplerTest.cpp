@@ -0,0 +1,71 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "ExceptionSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// With no samples per window, only the first exception of each type is kept
+// (the window is never rolled because its duration is 0)
+
+TEST(ExceptionSamplerTest, CheckFirstExceptionOfEachTypeIsKept)
+{
+    ExceptionSampler sampler(std::chrono::milliseconds::zero(), 0, 1);
+
+    ASSERT_TRUE(sampler.Sample(0x1000));
+    ASSERT_FALSE(sampler.Sample(0x1000));
+
+    ASSERT_TRUE(sampler.Sample(0x2000));
+    ASSERT_FALSE(sampler.Sample(0x2000));
+    ASSERT_FALSE(sampler.Sample(0x1000));
+}
+
+TEST(ExceptionSamplerTest, CheckManyTypesAreKeptOnce)
+{
+    ExceptionSampler sampler(std::chrono::milliseconds::zero(), 0, 1);
+
+    const ClassID typesCount = 200;
+    for (ClassID type = 1; type <= typesCount; type++)
+    {
+        ASSERT_TRUE(sampler.Sample(type * 8));
+    }
+
+    for (ClassID type = 1; type <= typesCount; type++)
+    {
+        ASSERT_FALSE(sampler.Sample(type * 8));
+    }
+}
+
+TEST(ExceptionSamplerTest, CheckFirstExceptionIsKeptOnceWhenThrownFromManyThreads)
+{
+    ExceptionSampler sampler(std::chrono::milliseconds::zero(), 0, 1);
+
+    const int32_t threadsCount = 8;
+    const ClassID typesCount = 100;
+    std::atomic<int32_t> keptCount = 0;
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadsCount; i++)
+    {
+        threads.emplace_back([&sampler, &keptCount, typesCount]() {
+            for (ClassID type = 1; type <= typesCount; type++)
+            {
+                if (sampler.Sample(type * 8))
+                {
+                    keptCount++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(typesCount, keptCount);
+}
@@ -4,11 +4,16 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "AgentEndpointHelper.h"
 #include "LibddprofExporter.h"
 #include "OpSysTools.h"
 
 #include "ProfilerMockedInterface.h"
 
+#include <chrono>
+#include <memory>
+#include <thread>
+
 #include "shared/src/native-src/dd_filesystem.hpp"
 
 using ::testing::_;
@@ -29,6 +34,8 @@ TEST(LibddprofExporterTest, CheckProfileIsWrittenToDisk)
 
     fs::path pprofTempDir = fs::temp_directory_path() / tmpnam(nullptr);
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofTempDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::string agentUrl;
     EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
@@ -120,6 +127,8 @@ TEST(LibddprofExporterTest, EnsureOnlyProfileWithSamplesIsWrittenToDisk)
 
     fs::path pprofTempDir = fs::temp_directory_path() / tmpnam(nullptr);
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofTempDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::string agentUrl;
     EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
@@ -204,6 +213,8 @@ TEST(LibddprofExporterTest, EnsureTwoPprofFilesAreWrittenToDiskForTwoApplication
 
     fs::path pprofTempDir = fs::temp_directory_path() / tmpnam(nullptr);
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofTempDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::string agentUrl;
     EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
@@ -303,6 +314,8 @@ TEST(LibddprofExporterTest, MustCreateAgentBasedExporterIfAgentUrlIsSet)
 
     fs::path pprofDir;
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::vector<std::pair<std::string, std::string>> tags;
     EXPECT_CALL(mockConfiguration, GetUserTags()).Times(1).WillOnce(ReturnRef(tags));
@@ -333,6 +346,8 @@ TEST(LibddprofExporterTest, MustCreateAgentBasedExporterIfAgentUrlIsNotSet)
 
     fs::path pprofDir;
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::vector<std::pair<std::string, std::string>> tags;
     EXPECT_CALL(mockConfiguration, GetUserTags()).Times(1).WillOnce(ReturnRef(tags));
@@ -362,6 +377,8 @@ TEST(LibddprofExporterTest, MustCreateAgentLessExporterIfAgentless)
 
     fs::path pprofDir;
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::vector<std::pair<std::string, std::string>> tags;
     EXPECT_CALL(mockConfiguration, GetUserTags()).Times(1).WillOnce(ReturnRef(tags));
@@ -377,6 +394,8 @@ TEST(LibddprofExporterTest, MakeSureNoCrashForReallyLongCallstack)
 
     fs::path pprofTempDir;
     EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofTempDir));
+    fs::path spoolDir;
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
 
     std::string agentUrl;
     EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
@@ -402,4 +421,149 @@ TEST(LibddprofExporterTest, MakeSureNoCrashForReallyLongCallstack)
                                 42);
 
     EXPECT_NO_THROW(exporter.Add(sample1));
-}
\ No newline at end of file
+}
+
+#ifndef _WINDOWS
+namespace {
+// the profiles are written to disk by the spooler thread
+int32_t WaitForSpooledFiles(fs::path const& spoolDir, int32_t expectedCount)
+{
+    int32_t spooledCount = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    do
+    {
+        spooledCount = 0;
+        std::error_code errorCode;
+        for (auto const& file : fs::directory_iterator(spoolDir, errorCode))
+        {
+            if (file.path().extension() == ".spool")
+            {
+                spooledCount++;
+            }
+        }
+
+        if (spooledCount >= expectedCount)
+        {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return spooledCount;
+}
+} // namespace
+
+TEST(LibddprofExporterTest, CheckExportIsNotBlockedBySlowAgent)
+{
+    // must be greater than the number of profiles kept in memory by the exporter
+    const int32_t ExportsCount = 24;
+    const int32_t MaxPendingExports = 16;
+
+    AgentEndpointHelper agent;
+    agent.HoldResponses(true);
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    fs::path pprofDir;
+    EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofDir));
+    fs::path spoolDir = fs::temp_directory_path() / tmpnam(nullptr);
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
+
+    std::string agentUrl = agent.GetUrl();
+    EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
+    std::string host = "localhost";
+    EXPECT_CALL(mockConfiguration, GetHostname()).Times(1).WillOnce(ReturnRef(host));
+    EXPECT_CALL(mockConfiguration, IsAgentless()).Times(1).WillOnce(Return(false));
+
+    std::vector<std::pair<std::string, std::string>> tags;
+    EXPECT_CALL(mockConfiguration, GetUserTags()).Times(1).WillOnce(ReturnRef(tags));
+
+    auto applicationStore = MockApplicationStore();
+    std::string runtimeId = "MyRid";
+    ApplicationInfo applicationInfo("MyApp", "myenv", "1.0.2");
+    EXPECT_CALL(applicationStore, GetApplicationInfo(runtimeId)).WillRepeatedly(Return(applicationInfo));
+
+    {
+        auto exporter = LibddprofExporter(&mockConfiguration, &applicationStore);
+
+        for (auto i = 0; i < ExportsCount; i++)
+        {
+            auto sample = CreateSample(runtimeId,
+                                       std::initializer_list<std::pair<std::string, std::string>>({{"module", "frame1"}, {"module", "frame2"}}),
+                                       {{"label1", "value1"}},
+                                       42);
+            exporter.Add(sample);
+
+            // the agent does not answer but the export must not wait for it
+            auto start = std::chrono::steady_clock::now();
+            ASSERT_TRUE(exporter.Export());
+            ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+        }
+
+        // the first profile is being sent and at most MaxPendingExports are waiting in memory:
+        // the oldest other ones must have been spooled
+        ASSERT_GE(WaitForSpooledFiles(spoolDir, ExportsCount - MaxPendingExports - 1), ExportsCount - MaxPendingExports - 1);
+
+        // the pending profiles are sent when the exporter is destroyed
+        agent.HoldResponses(false);
+    }
+
+    ASSERT_GE(agent.GetAnsweredRequestsCount(), MaxPendingExports + 1);
+
+    fs::remove_all(spoolDir);
+}
+
+TEST(LibddprofExporterTest, CheckShutdownDoesNotWaitForSlowAgent)
+{
+    // each profile takes more than a second to be sent: all of them cannot be sent before the shutdown deadline
+    const int32_t ExportsCount = 6;
+
+    AgentEndpointHelper agent;
+    agent.DelayResponses(std::chrono::milliseconds(1500));
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    fs::path pprofDir;
+    EXPECT_CALL(mockConfiguration, GetProfilesOutputDirectory()).Times(1).WillOnce(ReturnRef(pprofDir));
+    fs::path spoolDir = fs::temp_directory_path() / tmpnam(nullptr);
+    EXPECT_CALL(mockConfiguration, GetExportSpoolDirectory()).Times(1).WillOnce(ReturnRef(spoolDir));
+
+    std::string agentUrl = agent.GetUrl();
+    EXPECT_CALL(mockConfiguration, GetAgentUrl()).Times(1).WillOnce(ReturnRef(agentUrl));
+    std::string host = "localhost";
+    EXPECT_CALL(mockConfiguration, GetHostname()).Times(1).WillOnce(ReturnRef(host));
+    EXPECT_CALL(mockConfiguration, IsAgentless()).Times(1).WillOnce(Return(false));
+
+    std::vector<std::pair<std::string, std::string>> tags;
+    EXPECT_CALL(mockConfiguration, GetUserTags()).Times(1).WillOnce(ReturnRef(tags));
+
+    auto applicationStore = MockApplicationStore();
+    std::string runtimeId = "MyRid";
+    ApplicationInfo applicationInfo("MyApp", "myenv", "1.0.2");
+    EXPECT_CALL(applicationStore, GetApplicationInfo(runtimeId)).WillRepeatedly(Return(applicationInfo));
+
+    auto exporter = std::make_unique<LibddprofExporter>(&mockConfiguration, &applicationStore);
+    for (auto i = 0; i < ExportsCount; i++)
+    {
+        auto sample = CreateSample(runtimeId,
+                                   std::initializer_list<std::pair<std::string, std::string>>({{"module", "frame1"}, {"module", "frame2"}}),
+                                   {{"label1", "value1"}},
+                                   42);
+        exporter->Add(sample);
+        ASSERT_TRUE(exporter->Export());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    exporter.reset();
+    auto shutdownDuration = std::chrono::steady_clock::now() - start;
+
+    // the profile being sent when the shutdown starts + the shutdown deadline (3 seconds)
+    ASSERT_LT(shutdownDuration, std::chrono::seconds(6));
+
+    // the profiles that were not sent are spooled (the spooler is done when the exporter is destroyed)
+    ASSERT_GT(WaitForSpooledFiles(spoolDir, 1), 0);
+
+    fs::remove_all(spoolDir);
+}
+#endif
@@ -0,0 +1,472 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#ifndef _WINDOWS
+
+#include "gtest/gtest.h"
+
+#include "CorProfilerInfoHelper.h"
+#include "ManagedThreadInfo.h"
+#include "OsSpecificApi.h"
+#include "StackFramesCollectorBase.h"
+#include "StackSnapshotResultReusableBuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <link.h>
+#include <memory>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+// Thread spinning until it is stopped.
+// When the sampling signals are blocked, it never walks its own stack (as a thread stuck in the kernel would do)
+class SampledThread
+{
+public:
+    explicit SampledThread(bool blockSamplingSignals) :
+        _isStopped{false},
+        _osThreadId{0}
+    {
+        _thread = std::thread(
+            [this, blockSamplingSignals] {
+                if (blockSamplingSignals)
+                {
+                    sigset_t signals;
+                    sigemptyset(&signals);
+                    sigaddset(&signals, SIGUSR1);
+                    sigaddset(&signals, SIGUSR2);
+                    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+                }
+
+                _osThreadId = static_cast<pid_t>(syscall(SYS_gettid));
+                while (!_isStopped)
+                {
+                    std::this_thread::sleep_for(1ms);
+                }
+            });
+
+        while (_osThreadId == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~SampledThread()
+    {
+        // pending signals are discarded when the thread exits
+        _isStopped = true;
+        _thread.join();
+    }
+
+    DWORD GetOsThreadId() const
+    {
+        return static_cast<DWORD>(_osThreadId.load());
+    }
+
+private:
+    std::atomic<bool> _isStopped;
+    std::atomic<pid_t> _osThreadId;
+    std::thread _thread;
+};
+
+// Thread sleeping in a function that the other tests never walk: libunwind has no cached
+// unwind info for its frames and looks them up through dl_iterate_phdr
+class UncachedThread
+{
+public:
+    UncachedThread() :
+        _isStopped{false},
+        _osThreadId{0}
+    {
+        _thread = std::thread(
+            [this] {
+                _osThreadId = static_cast<pid_t>(syscall(SYS_gettid));
+                while (!_isStopped)
+                {
+                    std::this_thread::sleep_for(2ms);
+                }
+            });
+
+        while (_osThreadId == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~UncachedThread()
+    {
+        _isStopped = true;
+        _thread.join();
+    }
+
+    DWORD GetOsThreadId() const
+    {
+        return static_cast<DWORD>(_osThreadId.load());
+    }
+
+private:
+    std::atomic<bool> _isStopped;
+    std::atomic<pid_t> _osThreadId;
+    std::thread _thread;
+};
+
+// Thread consuming CPU until it is stopped (its CPU timer expires)
+class BusyThread
+{
+public:
+    BusyThread() :
+        _isStopped{false},
+        _osThreadId{0},
+        _cpuClockId{ManagedThreadInfo::InvalidCpuClockId}
+    {
+        _thread = std::thread(
+            [this] {
+                clockid_t cpuClockId;
+                if (OsSpecificApi::GetCurrentThreadCpuClockId(cpuClockId))
+                {
+                    _cpuClockId = cpuClockId;
+                }
+
+                _osThreadId = static_cast<pid_t>(syscall(SYS_gettid));
+                while (!_isStopped)
+                {
+                }
+            });
+
+        while (_osThreadId == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~BusyThread()
+    {
+        _isStopped = true;
+        _thread.join();
+    }
+
+    void SetOsInfo(ManagedThreadInfo* pThreadInfo) const
+    {
+        pThreadInfo->SetOsInfo(static_cast<DWORD>(_osThreadId.load()), static_cast<HANDLE>(nullptr));
+        pThreadInfo->SetCpuClockId(_cpuClockId);
+    }
+
+private:
+    std::atomic<bool> _isStopped;
+    std::atomic<pid_t> _osThreadId;
+    std::atomic<clockid_t> _cpuClockId;
+    std::thread _thread;
+};
+
+struct BatchResult
+{
+    std::size_t HandledThreadsCount;
+    std::vector<StackSnapshotResultBuffer*> Results;
+    std::vector<uint32_t> HRs;
+    std::chrono::milliseconds Duration;
+};
+
+BatchResult CollectOsThreadsBatch(StackFramesCollectorBase* pCollector, const std::vector<DWORD>& osThreadIds)
+{
+    std::vector<std::unique_ptr<ManagedThreadInfo>> threadInfos;
+    std::vector<ManagedThreadInfo*> ppThreadInfos;
+    for (std::size_t i = 0; i < osThreadIds.size(); i++)
+    {
+        auto threadInfo = std::make_unique<ManagedThreadInfo>(static_cast<ThreadID>(i + 1));
+        threadInfo->SetOsInfo(osThreadIds[i], static_cast<HANDLE>(nullptr));
+        ppThreadInfos.push_back(threadInfo.get());
+        threadInfos.push_back(std::move(threadInfo));
+    }
+
+    BatchResult result;
+    result.Results.resize(osThreadIds.size());
+    result.HRs.resize(osThreadIds.size());
+
+    auto start = std::chrono::steady_clock::now();
+    result.HandledThreadsCount = pCollector->CollectStackSamples(ppThreadInfos.data(), ppThreadInfos.size(), result.Results.data(), result.HRs.data());
+    result.Duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    return result;
+}
+
+BatchResult CollectBatch(StackFramesCollectorBase* pCollector, const std::vector<SampledThread*>& threads)
+{
+    std::vector<DWORD> osThreadIds;
+    for (auto* pThread : threads)
+    {
+        osThreadIds.push_back(pThread->GetOsThreadId());
+    }
+
+    return CollectOsThreadsBatch(pCollector, osThreadIds);
+}
+} // namespace
+
+TEST(LinuxStackFramesCollectorTest, CheckBatchCollectionWalksEachThreadStack)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+    ASSERT_TRUE(collector->IsBatchCollectionSupported());
+
+    SampledThread thread1(false);
+    SampledThread thread2(false);
+    SampledThread thread3(false);
+
+    collector->PrepareForNextCollection();
+    auto result = CollectBatch(collector.get(), {&thread1, &thread2, &thread3});
+
+    ASSERT_EQ(result.HandledThreadsCount, 3);
+    for (std::size_t i = 0; i < result.HandledThreadsCount; i++)
+    {
+        EXPECT_EQ(result.HRs[i], S_OK);
+        EXPECT_GT(result.Results[i]->GetFramesCount(), 0);
+    }
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckBatchCollectionMarksUnansweredThreadsAsFailed)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+
+    SampledThread answeringThread(false);
+    SampledThread stuckThread(true);
+
+    collector->PrepareForNextCollection();
+    auto result = CollectBatch(collector.get(), {&answeringThread, &stuckThread});
+
+    // the sampler thread gives up after the batch deadline instead of waiting for ever
+    ASSERT_EQ(result.HandledThreadsCount, 2);
+    EXPECT_EQ(result.HRs[0], S_OK);
+    EXPECT_GT(result.Results[0]->GetFramesCount(), 0);
+    EXPECT_EQ(result.HRs[1], E_FAIL);
+    EXPECT_LT(result.Duration, 5s);
+
+    // the next batch is not impacted
+    collector->PrepareForNextCollection();
+    result = CollectBatch(collector.get(), {&answeringThread});
+
+    ASSERT_EQ(result.HandledThreadsCount, 1);
+    EXPECT_EQ(result.HRs[0], S_OK);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckBatchCollectionStopsWhenAbortIsRequested)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+
+    SampledThread stuckThread(true);
+
+    // same as the StackSamplerLoopManager watcher when the collection takes too long
+    collector->PrepareForNextCollection();
+    std::thread watcher(
+        [&collector] {
+            std::this_thread::sleep_for(50ms);
+            collector->RequestAbortCurrentCollection();
+        });
+
+    auto result = CollectBatch(collector.get(), {&stuckThread});
+    watcher.join();
+
+    ASSERT_EQ(result.HandledThreadsCount, 1);
+    EXPECT_EQ(result.HRs[0], E_FAIL);
+    EXPECT_LT(result.Duration, 900ms);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckBatchCollectionGivesUpOnStuckWalks)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+
+    UncachedThread thread;
+
+    // libunwind looks up the unwind info of the frames with dl_iterate_phdr: while its lock is held,
+    // the signal handler is stuck in unw_step and cannot check the abort request
+    struct LoaderLock
+    {
+        std::atomic<bool> IsHeld{false};
+        std::atomic<bool> IsReleased{false};
+    } loaderLock;
+    std::thread lockHolder(
+        [&loaderLock] {
+            dl_iterate_phdr(
+                [](dl_phdr_info*, size_t, void* data) {
+                    auto* pLoaderLock = static_cast<LoaderLock*>(data);
+                    pLoaderLock->IsHeld = true;
+                    while (!pLoaderLock->IsReleased)
+                    {
+                        std::this_thread::sleep_for(1ms);
+                    }
+                    return 1;
+                },
+                &loaderLock);
+        });
+    while (!loaderLock.IsHeld)
+    {
+        std::this_thread::yield();
+    }
+
+    collector->PrepareForNextCollection();
+    auto result = CollectOsThreadsBatch(collector.get(), {thread.GetOsThreadId()});
+
+    loaderLock.IsReleased = true;
+    lockHolder.join();
+
+    ASSERT_EQ(result.HandledThreadsCount, 1);
+    EXPECT_EQ(result.HRs[0], E_FAIL);
+    EXPECT_LT(result.Duration, 5s);
+
+    // the late handler must not complete the slot of the next batch
+    std::this_thread::sleep_for(100ms);
+    collector->PrepareForNextCollection();
+    result = CollectOsThreadsBatch(collector.get(), {thread.GetOsThreadId()});
+
+    ASSERT_EQ(result.HandledThreadsCount, 1);
+    EXPECT_EQ(result.HRs[0], S_OK);
+    EXPECT_GT(result.Results[0]->GetFramesCount(), 0);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckProfilerInfoIsReleased)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    {
+        auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+        ASSERT_EQ(corProfilerInfo.GetRefCount(), 1);
+    }
+
+    ASSERT_EQ(corProfilerInfo.GetRefCount(), 0);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckCpuTimerSamplesBusyThread)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+    ASSERT_TRUE(collector->IsCpuTimerSupported());
+
+    BusyThread thread;
+    ManagedThreadInfo* pThreadInfo = new ManagedThreadInfo(1);
+    pThreadInfo->AddRef();
+    thread.SetOsInfo(pThreadInfo);
+
+    ASSERT_TRUE(collector->StartCpuTimer(pThreadInfo, 10ms));
+    EXPECT_NE(pThreadInfo->GetCpuTimerSlot(), -1);
+
+    auto maxSamplesCount = collector->GetMaxCpuTimerSamplesCount();
+    std::vector<ManagedThreadInfo*> threadInfos(maxSamplesCount);
+    std::vector<StackSnapshotResultBuffer*> results(maxSamplesCount);
+    std::vector<std::uint64_t> cpuTimes(maxSamplesCount);
+
+    std::size_t samplesCount = 0;
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while ((samplesCount == 0) && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(20ms);
+        samplesCount = collector->GetCpuTimerSamples(threadInfos.data(), results.data(), cpuTimes.data(), maxSamplesCount);
+    }
+
+    EXPECT_GT(samplesCount, 0);
+    for (std::size_t i = 0; i < samplesCount; i++)
+    {
+        EXPECT_EQ(threadInfos[i], pThreadInfo);
+        EXPECT_GT(results[i]->GetFramesCount(), 0);
+        // the timer expires each time the thread consumed 10 ms of CPU
+        EXPECT_GE(cpuTimes[i], std::chrono::nanoseconds(5ms).count());
+    }
+    collector->ReleaseCpuTimerSamples();
+
+    collector->StopCpuTimer(pThreadInfo);
+    EXPECT_EQ(pThreadInfo->GetCpuTimerSlot(), -1);
+
+    // the samples collected after the timer was stopped keep a reference on the thread
+    collector->GetCpuTimerSamples(threadInfos.data(), results.data(), cpuTimes.data(), maxSamplesCount);
+    collector->ReleaseCpuTimerSamples();
+    EXPECT_EQ(pThreadInfo->Release(), 0);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckWallTimeAndCpuTimerWalksDoNotInterruptEachOther)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+    ASSERT_TRUE(collector->IsCpuTimerSupported());
+
+    // each handler masks the signal of the other one
+    int wallTimeSignal = -1;
+    for (auto signal : {SIGUSR1, SIGUSR2})
+    {
+        struct sigaction action;
+        ASSERT_EQ(sigaction(signal, nullptr, &action), 0);
+        if ((action.sa_handler != SIG_DFL) && (action.sa_handler != SIG_IGN))
+        {
+            wallTimeSignal = signal;
+            EXPECT_EQ(sigismember(&action.sa_mask, SIGPROF), 1);
+        }
+    }
+    ASSERT_NE(wallTimeSignal, -1);
+
+    struct sigaction cpuTimerAction;
+    ASSERT_EQ(sigaction(SIGPROF, nullptr, &cpuTimerAction), 0);
+    EXPECT_EQ(sigismember(&cpuTimerAction.sa_mask, wallTimeSignal), 1);
+
+    // walk the stack of the thread for the wall time while its CPU timer keeps firing
+    BusyThread thread;
+    ManagedThreadInfo* pThreadInfo = new ManagedThreadInfo(1);
+    pThreadInfo->AddRef();
+    thread.SetOsInfo(pThreadInfo);
+    ASSERT_TRUE(collector->StartCpuTimer(pThreadInfo, 1ms));
+
+    auto maxSamplesCount = collector->GetMaxCpuTimerSamplesCount();
+    std::vector<ManagedThreadInfo*> threadInfos(maxSamplesCount);
+    std::vector<StackSnapshotResultBuffer*> cpuResults(maxSamplesCount);
+    std::vector<std::uint64_t> cpuTimes(maxSamplesCount);
+
+    std::size_t cpuSamplesCount = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        StackSnapshotResultBuffer* pResult = nullptr;
+        uint32_t hr = E_FAIL;
+        collector->PrepareForNextCollection();
+        ASSERT_EQ(collector->CollectStackSamples(&pThreadInfo, 1, &pResult, &hr), 1);
+        EXPECT_EQ(hr, S_OK);
+        EXPECT_GT(pResult->GetFramesCount(), 0);
+
+        auto samplesCount = collector->GetCpuTimerSamples(threadInfos.data(), cpuResults.data(), cpuTimes.data(), maxSamplesCount);
+        for (std::size_t j = 0; j < samplesCount; j++)
+        {
+            EXPECT_GT(cpuResults[j]->GetFramesCount(), 0);
+        }
+        cpuSamplesCount += samplesCount;
+        collector->ReleaseCpuTimerSamples();
+
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GT(cpuSamplesCount, 0);
+
+    collector->StopCpuTimer(pThreadInfo);
+    collector->GetCpuTimerSamples(threadInfos.data(), cpuResults.data(), cpuTimes.data(), maxSamplesCount);
+    collector->ReleaseCpuTimerSamples();
+    EXPECT_EQ(pThreadInfo->Release(), 0);
+}
+
+TEST(LinuxStackFramesCollectorTest, CheckCpuTimerIsNotStartedWithoutCpuClock)
+{
+    CorProfilerInfoHelper corProfilerInfo;
+    auto collector = OsSpecificApi::CreateNewStackFramesCollectorInstance(&corProfilerInfo);
+    ASSERT_TRUE(collector->IsCpuTimerSupported());
+
+    SampledThread thread(false);
+    ManagedThreadInfo* pThreadInfo = new ManagedThreadInfo(1);
+    pThreadInfo->AddRef();
+    pThreadInfo->SetOsInfo(thread.GetOsThreadId(), static_cast<HANDLE>(nullptr));
+
+    // the thread must be polled by the sampler thread instead
+    ASSERT_FALSE(collector->StartCpuTimer(pThreadInfo, 10ms));
+    EXPECT_EQ(pThreadInfo->GetCpuTimerSlot(), -1);
+    EXPECT_EQ(pThreadInfo->Release(), 0);
+}
+
+#endif
@@ -3,11 +3,17 @@
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include <atomic>
 #include <thread>
+#include <vector>
 
 #include "ManagedThreadList.h"
 #include "ManagedThreadInfo.h"
 
+#ifndef _WINDOWS
+#include <fcntl.h>
+#endif
+
 
 TEST(ManagedThreadListTest, CheckAdd)
 {
@@ -225,3 +231,165 @@ TEST(ManagedThreadListTest, CheckMultipleIterators)
 
     ASSERT_TRUE(true);
 }
+
+
+TEST(ManagedThreadListTest, CheckThreadLabelsAreUpdatedWhenThreadIsRenamed)
+{
+    ManagedThreadList threads(nullptr);
+    auto iterator = threads.CreateIterator();
+
+    threads.GetOrCreateThread(1);
+    threads.SetThreadOsInfo(1, 42, static_cast<HANDLE>(0));
+
+    ManagedThreadInfo* pInfo = threads.LoopNext(iterator);
+    ASSERT_TRUE(pInfo != nullptr);
+
+    auto labels = pInfo->GetThreadLabels();
+    ASSERT_EQ(labels->Name, "Managed thread (name unknown) [#42]");
+    ASSERT_THAT(labels->Id, ::testing::EndsWith("> [#42]"));
+
+    // same labels are returned as long as the thread is not renamed
+    ASSERT_EQ(labels, pInfo->GetThreadLabels());
+
+    threads.SetThreadName(1, WStr("MyThread"));
+
+    auto newLabels = pInfo->GetThreadLabels();
+    ASSERT_NE(labels, newLabels);
+    ASSERT_EQ(newLabels->Name, "MyThread [#42]");
+    ASSERT_EQ(newLabels->Id, labels->Id);
+
+    // labels that were already retrieved are not modified
+    ASSERT_EQ(labels->Name, "Managed thread (name unknown) [#42]");
+
+    pInfo->Release();
+}
+
+TEST(ManagedThreadListTest, CheckLoopNextWhileThreadsAreAddedAndRemoved)
+{
+    ManagedThreadList threads(nullptr);
+    auto iterator = threads.CreateIterator();
+
+    // thread 1 is never removed
+    threads.GetOrCreateThread(1);
+
+    std::atomic<bool> stopRequested = false;
+    std::thread churner([&threads, &stopRequested]() {
+        ThreadID clrThreadId = 2;
+        while (!stopRequested)
+        {
+            threads.GetOrCreateThread(clrThreadId);
+
+            ManagedThreadInfo* pInfo = nullptr;
+            threads.UnregisterThread(clrThreadId, &pInfo);
+            pInfo->Release();
+
+            clrThreadId++;
+        }
+    });
+
+    bool permanentThreadFound = false;
+    for (auto i = 0; i < 100000; i++)
+    {
+        // the churner thread must be joined before leaving the test: no ASSERT_xxx here
+        ManagedThreadInfo* pInfo = threads.LoopNext(iterator);
+        EXPECT_NE(pInfo, nullptr);
+        if (pInfo == nullptr)
+        {
+            continue;
+        }
+
+        if (pInfo->GetClrThreadId() == 1)
+        {
+            permanentThreadFound = true;
+        }
+
+        pInfo->Release();
+    }
+
+    stopRequested = true;
+    churner.join();
+
+    ASSERT_TRUE(permanentThreadFound);
+    ASSERT_EQ(threads.Count(), 1);
+}
+
+TEST(ManagedThreadListTest, CheckRetiredSnapshotsAreReclaimedWhileReadersAreActive)
+{
+    ManagedThreadList threads(nullptr);
+    threads.GetOrCreateThread(1);
+
+    // keep the removed thread alive to check the references held by the snapshots
+    ManagedThreadInfo* pRemovedInfo = threads.GetThreadInfo(1);
+
+    // there is always a reader using a snapshot
+    std::atomic<bool> stopRequested = false;
+    std::vector<std::thread> readers;
+    for (auto i = 0; i < 2; i++)
+    {
+        readers.emplace_back([&threads, &stopRequested]() {
+            while (!stopRequested)
+            {
+                threads.Count();
+            }
+        });
+    }
+
+    ManagedThreadInfo* pInfo = nullptr;
+    threads.UnregisterThread(1, &pInfo);
+    pInfo->Release();
+
+    // the snapshots still referencing the removed thread are deleted by the next updates
+    ThreadID clrThreadId = 2;
+    for (auto i = 0; (i < 100000) && (pRemovedInfo->GetRefCount() != 1); i++)
+    {
+        threads.GetOrCreateThread(clrThreadId);
+        threads.UnregisterThread(clrThreadId, &pInfo);
+        pInfo->Release();
+
+        clrThreadId++;
+    }
+
+    stopRequested = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_EQ(pRemovedInfo->GetRefCount(), 1);
+    pRemovedInfo->Release();
+}
+
+#ifndef _WINDOWS
+TEST(ManagedThreadListTest, CheckOsThreadChangeReleasesOsResources)
+{
+    ManagedThreadList threads(nullptr);
+    threads.GetOrCreateThread(1);
+    threads.SetThreadOsInfo(1, 1001, static_cast<HANDLE>(nullptr));
+
+    ManagedThreadInfo* pInfo = threads.GetThreadInfo(1);
+    ASSERT_NE(pInfo, nullptr);
+
+    // same as the sampler thread: the stat file is opened when there is no descriptor for the OS thread
+    EXPECT_EQ(pInfo->GetProcStatFileDescriptor(), -1);
+    auto fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    ASSERT_NE(fd, -1);
+    pInfo->SetProcStatFileDescriptor(fd);
+    pInfo->SetCpuClockId(CLOCK_THREAD_CPUTIME_ID);
+
+    // same OS thread: nothing is released
+    threads.SetThreadOsInfo(1, 1001, static_cast<HANDLE>(nullptr));
+    EXPECT_EQ(pInfo->GetProcStatFileDescriptor(), fd);
+    EXPECT_EQ(pInfo->GetCpuClockId(), CLOCK_THREAD_CPUTIME_ID);
+
+    // the stat file and the CPU clock of the previous OS thread must not be used anymore
+    threads.SetThreadOsInfo(1, 1002, static_cast<HANDLE>(nullptr));
+    EXPECT_EQ(pInfo->GetCpuClockId(), ManagedThreadInfo::InvalidCpuClockId);
+
+    // the sampler thread might be reading the stat file: it is closed by the sampler thread, not by the CLR callback
+    EXPECT_NE(fcntl(fd, F_GETFD), -1);
+    EXPECT_EQ(pInfo->GetProcStatFileDescriptor(), -1);
+    EXPECT_EQ(fcntl(fd, F_GETFD), -1);
+
+    pInfo->Release();
+}
+#endif
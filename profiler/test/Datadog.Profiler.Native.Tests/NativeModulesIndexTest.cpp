@@ -0,0 +1,126 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "NativeModulesIndex.h"
+
+#include <string>
+#include <string_view>
+
+#ifdef _WINDOWS
+
+TEST(NativeModulesIndexTest, CheckNoFrameIsResolvedOnWindows)
+{
+    NativeModulesIndex index;
+    std::string_view moduleName;
+    std::string_view frame;
+
+    ASSERT_FALSE(index.TryGetFrame(reinterpret_cast<uintptr_t>(&malloc), moduleName, frame));
+}
+
+#else
+
+#include <dlfcn.h>
+#include <thread>
+#include <vector>
+
+extern "C" __attribute__((noinline)) int NativeModulesIndexTest_KnownFunction(int value)
+{
+    return value * 2;
+}
+
+TEST(NativeModulesIndexTest, CheckFunctionIsResolvedFromSymbols)
+{
+    NativeModulesIndex index;
+    std::string_view moduleName;
+    std::string_view frame;
+
+    // use an address inside the function, not only its first instruction
+    auto ip = reinterpret_cast<uintptr_t>(&NativeModulesIndexTest_KnownFunction) + 1;
+    ASSERT_TRUE(index.TryGetFrame(ip, moduleName, frame));
+
+    ASSERT_FALSE(moduleName.empty());
+    ASSERT_THAT(std::string(frame), ::testing::EndsWith(" |fn:NativeModulesIndexTest_KnownFunction"));
+}
+
+TEST(NativeModulesIndexTest, CheckSharedLibraryIsResolved)
+{
+    NativeModulesIndex index;
+    std::string_view moduleName;
+    std::string_view frame;
+
+    Dl_info info;
+    ASSERT_NE(0, dladdr(reinterpret_cast<void*>(&dlsym), &info));
+
+    ASSERT_TRUE(index.TryGetFrame(reinterpret_cast<uintptr_t>(&dlsym), moduleName, frame));
+    ASSERT_EQ(std::string(info.dli_fname), moduleName);
+    ASSERT_THAT(std::string(frame), ::testing::StartsWith("|lm:"));
+    ASSERT_THAT(std::string(frame), ::testing::HasSubstr(" |ns:NativeCode |ct:"));
+}
+
+TEST(NativeModulesIndexTest, CheckSameFrameIsReturnedForSameFunction)
+{
+    NativeModulesIndex index;
+    std::string_view firstModuleName;
+    std::string_view firstFrame;
+    std::string_view secondModuleName;
+    std::string_view secondFrame;
+
+    auto start = reinterpret_cast<uintptr_t>(&NativeModulesIndexTest_KnownFunction);
+    ASSERT_TRUE(index.TryGetFrame(start, firstModuleName, firstFrame));
+    ASSERT_TRUE(index.TryGetFrame(start + 2, secondModuleName, secondFrame));
+
+    ASSERT_EQ(firstModuleName, secondModuleName);
+    ASSERT_EQ(firstFrame, secondFrame);
+
+    // the frame is built once and shared by all the lookups
+    ASSERT_EQ(firstModuleName.data(), secondModuleName.data());
+    ASSERT_EQ(firstFrame.data(), secondFrame.data());
+}
+
+TEST(NativeModulesIndexTest, CheckFrameIsSharedBetweenThreads)
+{
+    NativeModulesIndex index;
+    auto ip = reinterpret_cast<uintptr_t>(&NativeModulesIndexTest_KnownFunction) + 1;
+
+    std::vector<const char*> frames(8, nullptr);
+    std::vector<std::thread> threads;
+    for (auto& frame : frames)
+    {
+        threads.emplace_back(
+            [&index, &frame, ip] {
+                std::string_view moduleName;
+                std::string_view frameView;
+                if (index.TryGetFrame(ip, moduleName, frameView))
+                {
+                    frame = frameView.data();
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto* frame : frames)
+    {
+        EXPECT_NE(frame, nullptr);
+        EXPECT_EQ(frame, frames[0]);
+    }
+}
+
+TEST(NativeModulesIndexTest, CheckUnknownAddressIsNotResolved)
+{
+    NativeModulesIndex index;
+    std::string_view moduleName;
+    std::string_view frame;
+
+    int onTheStack = 0;
+    ASSERT_FALSE(index.TryGetFrame(reinterpret_cast<uintptr_t>(&onTheStack), moduleName, frame));
+    ASSERT_FALSE(index.TryGetFrame(0, moduleName, frame));
+}
+
+#endif
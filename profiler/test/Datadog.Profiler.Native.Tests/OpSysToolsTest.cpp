@@ -87,4 +87,35 @@ TEST(GetThreadInfoTest, Check_SpaceAndParenthesisInThreadName_And_FinalParenthes
     ASSERT_EQ(' ', state);
     ASSERT_EQ(0, userTime);
     ASSERT_EQ(0, kernelTime);
-}
\ No newline at end of file
+}
+
+TEST(GetThreadInfoTest, Check_BufferWithTrailingNewLine)
+{
+    const char line[] = "377 (Thread Name With Space) S 46 369 46 34817 369 4194368 95 0 0 0 1862 609 0 0 20 0 1 0\n";
+    char state = ' ';
+    int userTime = 0;
+    int kernelTime = 0;
+
+    bool result = OpSysTools::ParseThreadInfo(line, sizeof(line) - 1, state, userTime, kernelTime);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ('S', state);
+    ASSERT_EQ(1862, userTime);
+    ASSERT_EQ(609, kernelTime);
+}
+
+TEST(GetThreadInfoTest, Check_TruncatedBuffer)
+{
+    const char line[] = "377 (ThreadName) R 46 369 46 34817 369 4194368 95 0 0 0 18";
+    char state = ' ';
+    int userTime = 0;
+    int kernelTime = 0;
+
+    // the kernel time is missing
+    bool result = OpSysTools::ParseThreadInfo(line, sizeof(line) - 1, state, userTime, kernelTime);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(' ', state);
+    ASSERT_EQ(0, userTime);
+    ASSERT_EQ(0, kernelTime);
+}
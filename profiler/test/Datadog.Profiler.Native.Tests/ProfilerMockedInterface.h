@@ -12,6 +12,7 @@
 #include "Sample.h"
 #include "TagsHelper.h"
 #include "IApplicationStore.h"
+#include "IManagedThreadList.h"
 #include "IRuntimeIdStore.h"
 #include "ISamplesCollector.h"
 
@@ -22,6 +23,7 @@ public:
     MOCK_METHOD(bool, IsDebugLogEnabled, (), (const override));
     MOCK_METHOD(fs::path const&, GetLogDirectory, (), (const override));
     MOCK_METHOD(fs::path const&, GetProfilesOutputDirectory, (), (const override));
+    MOCK_METHOD(fs::path const&, GetExportSpoolDirectory, (), (const override));
     MOCK_METHOD(bool, IsNativeFramesEnabled, (), (const override));
     MOCK_METHOD(bool, IsOperationalMetricsEnabled, (), (const override));
     MOCK_METHOD(std::chrono::seconds, GetUploadInterval, (), (const override));
@@ -41,6 +43,11 @@ public:
     MOCK_METHOD(bool, IsCpuProfilingEnabled, (), (const override));
     MOCK_METHOD(bool, IsExceptionProfilingEnabled, (), (const override));
     MOCK_METHOD(int, ExceptionSampleLimit, (), (const override));
+    MOCK_METHOD(bool, IsAllocationProfilingEnabled, (), (const override));
+    MOCK_METHOD(bool, IsContentionProfilingEnabled, (), (const override));
+    MOCK_METHOD(int, ContentionSampleLimit, (), (const override));
+    MOCK_METHOD(bool, IsBatchedSamplingEnabled, (), (const override));
+    MOCK_METHOD(std::chrono::milliseconds, GetCpuTimerInterval, (), (const override));
 };
 
 class MockExporter : public IExporter
@@ -110,6 +117,24 @@ public:
     MOCK_METHOD(const char*, GetId, (AppDomainID appDomainId), (override));
 };
 
+class MockManagedThreadList : public IManagedThreadList
+{
+public:
+    MOCK_METHOD(const char*, GetName, (), (override));
+    MOCK_METHOD(bool, Start, (), (override));
+    MOCK_METHOD(bool, Stop, (), (override));
+    MOCK_METHOD(bool, GetOrCreateThread, (ThreadID clrThreadId), (override));
+    MOCK_METHOD(bool, UnregisterThread, (ThreadID clrThreadId, ManagedThreadInfo** ppThreadInfo), (override));
+    MOCK_METHOD(bool, SetThreadOsInfo, (ThreadID clrThreadId, DWORD osThreadId, HANDLE osThreadHandle), (override));
+    MOCK_METHOD(bool, SetThreadName, (ThreadID clrThreadId, const shared::WSTRING& threadName), (override));
+    MOCK_METHOD(uint32_t, Count, (), (override));
+    MOCK_METHOD(uint32_t, CreateIterator, (), (override));
+    MOCK_METHOD(ManagedThreadInfo*, LoopNext, (uint32_t iterator), (override));
+    MOCK_METHOD(bool, TryGetThreadInfo, (const uint32_t profilerThreadInfoId, ThreadID* pClrThreadId, DWORD* pOsThreadId, HANDLE* pOsThreadHandle, WCHAR* pThreadNameBuff, const uint32_t threadNameBuffLen, uint32_t* pActualThreadNameLen), (override));
+    MOCK_METHOD(HRESULT, TryGetCurrentThreadInfo, (ManagedThreadInfo** ppThreadInfo), (override));
+    MOCK_METHOD(ManagedThreadInfo*, GetThreadInfo, (ThreadID clrThreadId), (override));
+};
+
 template <typename T, typename U, typename... Args>
 std::pair<std::unique_ptr<T>, U&> CreateMockForUniquePtr(Args... args)
 {
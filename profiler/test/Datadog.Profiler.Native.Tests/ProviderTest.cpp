@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
 #include <chrono>
 
 #include "ProfilerMockedInterface.h"
@@ -15,11 +16,19 @@
 #include "FrameStoreHelper.h"
 #include "WallTimeProvider.h"
 #include "CpuTimeProvider.h"
+#include "AllocationsProvider.h"
+#include "ContentionProvider.h"
 #include "RawCpuSample.h"
 #include "RawWallTimeSample.h"
+#include "RawAllocationSample.h"
+#include "RawContentionSample.h"
 #include "ThreadsCpuManagerHelper.h"
 
 using namespace std::chrono_literals;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Return;
+using ::testing::SetArgPointee;
 
 
 RawWallTimeSample GetWallTimeRawSample(
@@ -61,7 +70,7 @@ RawCpuSample GetRawCpuSample(
 {
     RawCpuSample raw;
     raw.Timestamp = timeStamp;
-    raw.Duration = duration;  // in milliseconds
+    raw.Duration = duration;  // in nanoseconds
     raw.AppDomainId = appDomainId;
     raw.LocalRootSpanId = traceId;
     raw.SpanId = spanId;
@@ -326,8 +335,7 @@ TEST(CpuTimeProviderTest, CheckValuesAndTimestamp)
         {
             if (current == (size_t)SampleValue::CpuTimeDuration)
             {
-                //                             V-- in nanoseconds
-                ASSERT_EQ(currentSample * 10 * 1000000, values[current]);
+                ASSERT_EQ(currentSample * 10, values[current]);
             }
             else // all other values must be 0
             {
@@ -338,3 +346,297 @@ TEST(CpuTimeProviderTest, CheckValuesAndTimestamp)
         currentSample++;
     }
 }
+
+RawAllocationSample GetRawAllocationSample(std::uint64_t timeStamp, std::uint64_t size, const std::string& type)
+{
+    RawAllocationSample raw;
+    raw.Timestamp = timeStamp;
+    raw.AppDomainId = static_cast<AppDomainID>(1);
+    raw.AllocationSize = size;
+    raw.AllocationClass = type;
+    raw.Stack.push_back(1);
+
+    // skip thread info resolution
+    raw.ThreadInfo = nullptr;
+
+    return raw;
+}
+
+TEST(AllocationsProviderTest, CheckUpscaledValuesAndClass)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+
+    AllocationsProvider provider(nullptr, nullptr, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore);
+    provider.Start();
+
+    // a small object is rarely the one crossing the ~100 KB AllocationTick threshold
+    provider.Add(GetRawAllocationSample(1000, 24, "System.String"));
+    // an object larger than the threshold is always sampled
+    provider.Add(GetRawAllocationSample(2000, 1024 * 1024, "System.Byte[]"));
+
+    auto samples = provider.GetSamples();
+    provider.Stop();
+    ASSERT_EQ(2, samples.size());
+
+    const auto& small = samples.front();
+    auto values = small.GetValues();
+    // the sampled bytes stand for the ~100 KB allocated since the previous event
+    ASSERT_NEAR(RawAllocationSample::AllocationTickThreshold, values[(size_t)SampleValue::AllocationSize], 100);
+    ASSERT_NEAR(RawAllocationSample::AllocationTickThreshold / 24, values[(size_t)SampleValue::AllocationCount], 1);
+    ASSERT_EQ(0, values[(size_t)SampleValue::WallTimeDuration]);
+
+    const auto& large = samples.back();
+    values = large.GetValues();
+    ASSERT_EQ(1, values[(size_t)SampleValue::AllocationCount]);
+    ASSERT_NEAR(1024 * 1024, values[(size_t)SampleValue::AllocationSize], 100);
+
+    auto labels = large.GetLabels();
+    auto allocationClass = std::find_if(labels.begin(), labels.end(), [](const Label& label) { return label.first == Sample::AllocationClassLabel; });
+    ASSERT_NE(labels.end(), allocationClass);
+    ASSERT_EQ("System.Byte[]", allocationClass->second);
+}
+
+std::vector<BYTE> GetAllocationTickPayload(const shared::WSTRING& typeName, std::uint64_t objectSize)
+{
+    std::vector<BYTE> payload(4 + 4 + 2 + 8 + sizeof(void*), 0xAA);
+    const auto name = reinterpret_cast<const BYTE*>(typeName.c_str());
+    payload.insert(payload.end(), name, name + (typeName.size() + 1) * sizeof(WCHAR));
+    payload.insert(payload.end(), 4 + sizeof(void*), 0xBB); // HeapIndex and Address
+    const auto size = reinterpret_cast<const BYTE*>(&objectSize);
+    payload.insert(payload.end(), size, size + sizeof(objectSize));
+
+    return payload;
+}
+
+TEST(AllocationsProviderTest, CheckAllocationTickPayloadParsing)
+{
+    std::string typeName;
+    std::uint64_t objectSize = 0;
+
+    auto payload = GetAllocationTickPayload(WStr("System.Collections.Generic.List`1[System.Int32]"), 4242);
+    ASSERT_TRUE(AllocationsProvider::TryParseAllocationTick(4, static_cast<ULONG>(payload.size()), payload.data(), typeName, objectSize));
+    ASSERT_EQ("System.Collections.Generic.List`1[System.Int32]", typeName);
+    ASSERT_EQ(4242, objectSize);
+
+    // fields added by later versions are ignored
+    payload.push_back(0xCC);
+    ASSERT_TRUE(AllocationsProvider::TryParseAllocationTick(5, static_cast<ULONG>(payload.size()), payload.data(), typeName, objectSize));
+    ASSERT_EQ(4242, objectSize);
+    payload.pop_back();
+
+    // the object size is not known before v4
+    ASSERT_FALSE(AllocationsProvider::TryParseAllocationTick(3, static_cast<ULONG>(payload.size()), payload.data(), typeName, objectSize));
+
+    // truncated payloads
+    ASSERT_FALSE(AllocationsProvider::TryParseAllocationTick(4, static_cast<ULONG>(payload.size() - 1), payload.data(), typeName, objectSize));
+    ASSERT_FALSE(AllocationsProvider::TryParseAllocationTick(4, 20, payload.data(), typeName, objectSize));
+}
+
+TEST(AllocationsProviderTest, CheckAllocationTickEventIsDelivered)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    MockManagedThreadList managedThreadList;
+
+    AllocationsProvider provider(nullptr, &managedThreadList, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore);
+    auto payload = GetAllocationTickPayload(WStr("System.String"), 24);
+
+    // the stack of the allocating thread is only collected for the AllocationTick event (id 10)
+    EXPECT_CALL(managedThreadList, TryGetCurrentThreadInfo(_)).Times(1).WillOnce(Return(E_FAIL));
+    ASSERT_FALSE(provider.OnEventPipeEvent(ContentionProvider::ContentionStartEventId, 4, static_cast<ULONG>(payload.size()), payload.data()));
+    ASSERT_FALSE(provider.OnEventPipeEvent(AllocationsProvider::AllocationTickEventId, 4, static_cast<ULONG>(payload.size()), payload.data()));
+    ASSERT_EQ(10, AllocationsProvider::AllocationTickEventId);
+}
+
+TEST(AllocationsProviderTest, CheckAllocationsOfUntrackedThreadsAreIgnored)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    MockManagedThreadList managedThreadList;
+
+    AllocationsProvider provider(nullptr, &managedThreadList, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore);
+    auto payload = GetAllocationTickPayload(WStr("System.String"), 24);
+
+    // no stack is collected for a thread unknown to the profiler
+    EXPECT_CALL(managedThreadList, TryGetCurrentThreadInfo(_)).Times(1).WillOnce(DoAll(SetArgPointee<0>(nullptr), Return(S_FALSE)));
+    ASSERT_FALSE(provider.OnEventPipeEvent(AllocationsProvider::AllocationTickEventId, 4, static_cast<ULONG>(payload.size()), payload.data()));
+}
+
+RawContentionSample GetRawContentionSample(std::uint64_t timeStamp, std::int64_t duration, std::uint64_t traceId, std::uint64_t spanId)
+{
+    RawContentionSample raw;
+    raw.Timestamp = timeStamp;
+    raw.AppDomainId = static_cast<AppDomainID>(1);
+    raw.LocalRootSpanId = traceId;
+    raw.SpanId = spanId;
+    raw.Duration = duration;
+    raw.Stack.push_back(1);
+
+    // skip thread info resolution
+    raw.ThreadInfo = nullptr;
+
+    return raw;
+}
+
+TEST(ContentionProviderTest, CheckValuesAndSpanLabels)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, nullptr, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+    provider.Start();
+
+    provider.Add(GetRawContentionSample(1000, 1500000, 0, 0));
+    provider.Add(GetRawContentionSample(2000, 2500000, 42, 21));
+
+    auto samples = provider.GetSamples();
+    provider.Stop();
+    ASSERT_EQ(2, samples.size());
+
+    std::int64_t expectedDuration = 1500000;
+    for (const auto& sample : samples)
+    {
+        auto values = sample.GetValues();
+        for (size_t current = 0; current < values.size(); current++)
+        {
+            if (current == (size_t)SampleValue::ContentionCount)
+            {
+                ASSERT_EQ(1, values[current]);
+            }
+            else if (current == (size_t)SampleValue::ContentionDuration)
+            {
+                ASSERT_EQ(expectedDuration, values[current]);
+            }
+            else // all other values must be 0
+            {
+                ASSERT_EQ(0, values[current]);
+            }
+        }
+
+        expectedDuration += 1000000;
+    }
+
+    // the span of the waiting thread is kept
+    auto labels = samples.back().GetLabels();
+    auto spanId = std::find_if(labels.begin(), labels.end(), [](const Label& label) { return label.first == Sample::SpanIdLabel; });
+    ASSERT_NE(labels.end(), spanId);
+    ASSERT_EQ("21", spanId->second);
+}
+
+TEST(ContentionProviderTest, CheckWaitDurationsAreUpscaled)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, nullptr, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+    provider.Start();
+
+    // sampled when 1 wait out of 4 was kept
+    auto rawSample = GetRawContentionSample(1000, 1500000, 0, 0);
+    rawSample.SamplingProbability = 0.25;
+    provider.Add(std::move(rawSample));
+
+    auto samples = provider.GetSamples();
+    provider.Stop();
+    ASSERT_EQ(1, samples.size());
+
+    auto values = samples.front().GetValues();
+    ASSERT_EQ(4, values[(size_t)SampleValue::ContentionCount]);
+    ASSERT_EQ(4 * 1500000, values[(size_t)SampleValue::ContentionDuration]);
+}
+
+TEST(ContentionProviderTest, CheckContentionEventsAreDeliveredWithTheDefaultLimit)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    MockManagedThreadList managedThreadList;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    // defaults: less samples per recording than 500 ms windows
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, &managedThreadList, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+
+    // the stack of the waiting thread is collected when the ContentionStop event (id 91) follows ContentionStart (id 81)
+    EXPECT_CALL(managedThreadList, TryGetCurrentThreadInfo(_)).Times(1).WillOnce(Return(E_FAIL));
+    ASSERT_FALSE(provider.OnEventPipeEvent(AllocationsProvider::AllocationTickEventId));
+    ASSERT_TRUE(provider.OnEventPipeEvent(81));
+    ASSERT_FALSE(provider.OnEventPipeEvent(91));
+}
+
+TEST(ContentionProviderTest, CheckContentionsOfUntrackedThreadsAreIgnored)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    MockManagedThreadList managedThreadList;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, &managedThreadList, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+
+    // no stack is collected for a thread unknown to the profiler
+    EXPECT_CALL(managedThreadList, TryGetCurrentThreadInfo(_)).Times(1).WillOnce(DoAll(SetArgPointee<0>(nullptr), Return(S_FALSE)));
+    provider.OnContentionStart();
+    ASSERT_FALSE(provider.OnContentionStop());
+}
+
+TEST(ContentionProviderTest, CheckSamplingBoundsTheCollectedStacks)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    MockManagedThreadList managedThreadList;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, &managedThreadList, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+
+    // 1 sample per 600 ms window: the first window can use the budget of the 16 next ones,
+    // and another window may start while the waits are sent
+    EXPECT_CALL(managedThreadList, TryGetCurrentThreadInfo(_)).Times(::testing::Between(1, 2 * 17)).WillRepeatedly(Return(E_FAIL));
+    for (int i = 0; i < 1000; i++)
+    {
+        provider.OnContentionStart();
+        provider.OnContentionStop();
+    }
+}
+
+TEST(ContentionProviderTest, CheckStopWithoutStartIsIgnored)
+{
+    auto frameStore = new FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = new AppDomainStoreHelper(1);
+    auto threadscpuManager = new ThreadsCpuManagerHelper();
+    RuntimeIdStoreHelper runtimeIdStore;
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).WillRepeatedly(Return(60s));
+    EXPECT_CALL(mockConfiguration, ContentionSampleLimit()).WillRepeatedly(Return(100));
+
+    ContentionProvider provider(nullptr, nullptr, frameStore, threadscpuManager, appDomainStore, &runtimeIdStore, configuration.get());
+
+    // the session started while this thread was already waiting for the lock
+    ASSERT_FALSE(provider.OnContentionStop());
+}
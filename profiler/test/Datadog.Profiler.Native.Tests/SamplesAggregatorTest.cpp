@@ -228,4 +228,68 @@ TEST(SamplesAggregatorTest, MustdNotAddSampleInExporterIfEmptyCallstack)
     aggregator.Start();
     std::this_thread::sleep_for(100ms);
     aggregator.Stop();
-}
\ No newline at end of file
+}
+Sample CreateSpanSample(std::string_view rid, const std::string& localRootSpanId, std::int64_t cpuTime, std::int64_t wallTime)
+{
+    Sample s = CreateSample(rid);
+
+    s.AddValue(cpuTime, SampleValue::CpuTimeDuration);
+    s.AddValue(wallTime, SampleValue::WallTimeDuration);
+    s.AddLabel(Label{Sample::LocalRootSpanIdLabel, localRootSpanId});
+    s.AddLabel(Label{Sample::SpanIdLabel, "1"});
+
+    return s;
+}
+
+TEST(SamplesAggregatorTest, MustAggregateTimesPerRootSpan)
+{
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).Times(1).WillOnce(Return(10s));
+
+    auto [exporter, mockExporter] = CreateExporter();
+    EXPECT_CALL(mockExporter, Add(_)).Times(4);
+    EXPECT_CALL(mockExporter, Export()).Times(1).WillRepeatedly(Return(true));
+
+    auto metricsSender = MockMetricsSender();
+    auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
+
+    auto [collector, mockCollector] = CreateSamplesCollector();
+
+    std::string runtimeId = "MyRid";
+    std::list<Sample> samples;
+    samples.push_back(CreateSpanSample(runtimeId, "42", 10, 100));
+    samples.push_back(CreateSpanSample(runtimeId, "42", 20, 0));
+    samples.push_back(CreateSpanSample(runtimeId, "7", 0, 300));
+    // samples without span are not aggregated
+    samples.push_back(CreateSample(runtimeId));
+    EXPECT_CALL(mockCollector, GetSamples()).Times(1).WillOnce(Return(ByMove(std::move(samples))));
+
+    auto aggregator = SamplesAggregator(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender, collector.get());
+
+    aggregator.Start();
+    std::this_thread::sleep_for(100ms);
+    aggregator.Stop();
+
+    // the times of several root spans are read at once, they are still available after the export
+    const std::uint64_t localRootSpanIds[] = {42, 7, 1};
+    std::int64_t cpuTimes[] = {-1, -1, -1};
+    std::int64_t wallTimes[] = {-1, -1, -1};
+    aggregator.GetRootSpansTimes(localRootSpanIds, cpuTimes, wallTimes, 3);
+
+    ASSERT_EQ(30, cpuTimes[0]);
+    ASSERT_EQ(100, wallTimes[0]);
+
+    ASSERT_EQ(0, cpuTimes[1]);
+    ASSERT_EQ(300, wallTimes[1]);
+
+    // no sample for this root span
+    ASSERT_EQ(0, cpuTimes[2]);
+    ASSERT_EQ(0, wallTimes[2]);
+
+    // the times are forgotten once read
+    aggregator.GetRootSpansTimes(localRootSpanIds, cpuTimes, wallTimes, 3);
+    ASSERT_EQ(0, cpuTimes[0]);
+    ASSERT_EQ(0, wallTimes[0]);
+    ASSERT_EQ(0, cpuTimes[1]);
+    ASSERT_EQ(0, wallTimes[1]);
+}
@@ -24,6 +24,16 @@ Sample GetTestSample(std::string_view runtimeId, const std::string& framePrefix,
     sample.AddValue(4, SampleValue::ExceptionCount);
     sample.AddValue(5, SampleValue::ExceptionCount);
     sample.AddValue(6, SampleValue::ExceptionCount);
+    // allocation values
+    sample.AddValue(7, SampleValue::AllocationCount);
+    sample.AddValue(8, SampleValue::AllocationCount);
+    sample.AddValue(1024, SampleValue::AllocationSize);
+    sample.AddValue(2048, SampleValue::AllocationSize);
+    // contention values
+    sample.AddValue(9, SampleValue::ContentionCount);
+    sample.AddValue(10, SampleValue::ContentionCount);
+    sample.AddValue(1000, SampleValue::ContentionDuration);
+    sample.AddValue(2000, SampleValue::ContentionDuration);
     // --> only the last one should be kept
 
     Label l;
@@ -41,16 +51,20 @@ Sample GetTestSample(std::string_view runtimeId, const std::string& framePrefix,
 void ValidateTestSample(const Sample& sample, const std::string& framePrefix, const std::string& labelId, const std::string& labelValue)
 {
     // Check values
-    // Today, only 3 values in the array
+    // Today, only 7 values in the array
     //    WallTime
     //    CpuTime
     //    ExceptionCount
+    //    AllocationCount
+    //    AllocationSize
+    //    ContentionCount
+    //    ContentionDuration
     // --> should be increased when a new profiler is added
     //     this is a good reminder to add dedicated tests  :^)
     auto values = sample.GetValues();
-    ASSERT_EQ(3, values.size());
+    ASSERT_EQ(7, values.size());
 
-    for (size_t current = 0; current < 3; current++)
+    for (size_t current = 0; current < 7; current++)
     {
         // for the same SampleValue, only the last "added" value is kept
         // update GetTestSample() for new profilers
@@ -66,6 +80,22 @@ void ValidateTestSample(const Sample& sample, const std::string& framePrefix, co
         {
             ASSERT_EQ(6, values[current]);
         }
+        else if (current == (size_t)SampleValue::AllocationCount)
+        {
+            ASSERT_EQ(8, values[current]);
+        }
+        else if (current == (size_t)SampleValue::AllocationSize)
+        {
+            ASSERT_EQ(2048, values[current]);
+        }
+        else if (current == (size_t)SampleValue::ContentionCount)
+        {
+            ASSERT_EQ(10, values[current]);
+        }
+        else if (current == (size_t)SampleValue::ContentionDuration)
+        {
+            ASSERT_EQ(2000, values[current]);
+        }
         else
         {
             FAIL();
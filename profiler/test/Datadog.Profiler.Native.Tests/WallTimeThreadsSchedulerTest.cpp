@@ -0,0 +1,137 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ManagedThreadInfo.h"
+#include "ManagedThreadList.h"
+#include "WallTimeThreadsScheduler.h"
+
+using namespace std::chrono_literals;
+
+constexpr std::int64_t CurrentTimestampNs = std::chrono::nanoseconds(100s).count();
+constexpr std::int64_t RecentSampleTimestampNs = CurrentTimestampNs - std::chrono::nanoseconds(100ms).count();
+
+// Creates threads with an OS handle, sampled 100 ms ago and returns their info (not AddRef'ed)
+std::vector<ManagedThreadInfo*> CreateSampledThreads(ManagedThreadList& threads, ThreadID threadsCount)
+{
+    for (ThreadID clrThreadId = 1; clrThreadId <= threadsCount; clrThreadId++)
+    {
+        threads.GetOrCreateThread(clrThreadId);
+        threads.SetThreadOsInfo(clrThreadId, static_cast<DWORD>(clrThreadId), reinterpret_cast<HANDLE>(clrThreadId));
+    }
+
+    std::vector<ManagedThreadInfo*> infos;
+    auto iterator = threads.CreateIterator();
+    for (ThreadID i = 0; i < threadsCount; i++)
+    {
+        auto* pInfo = threads.LoopNext(iterator);
+        pInfo->SetLastSampleHighPrecisionTimestampNanoseconds(RecentSampleTimestampNs);
+        infos.push_back(pInfo);
+        pInfo->Release();
+    }
+
+    return infos;
+}
+
+void ReleaseThreads(std::vector<ManagedThreadInfo*>& selectedThreads)
+{
+    for (auto* pInfo : selectedThreads)
+    {
+        pInfo->Release();
+    }
+    selectedThreads.clear();
+}
+
+TEST(WallTimeThreadsSchedulerTest, CheckNoMoreThreadsThanBudgetAreSelected)
+{
+    ManagedThreadList threads(nullptr);
+    CreateSampledThreads(threads, 10);
+    WallTimeThreadsScheduler scheduler(&threads);
+
+    std::vector<ManagedThreadInfo*> selectedThreads;
+    scheduler.SelectThreads(CurrentTimestampNs, 3, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 3);
+    ReleaseThreads(selectedThreads);
+
+    scheduler.SelectThreads(CurrentTimestampNs, 20, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 10);
+    ReleaseThreads(selectedThreads);
+}
+
+TEST(WallTimeThreadsSchedulerTest, CheckThreadsWithoutOsHandleAreSkipped)
+{
+    ManagedThreadList threads(nullptr);
+    CreateSampledThreads(threads, 2);
+    threads.GetOrCreateThread(3);
+    WallTimeThreadsScheduler scheduler(&threads);
+
+    std::vector<ManagedThreadInfo*> selectedThreads;
+    scheduler.SelectThreads(CurrentTimestampNs, 3, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 2);
+    for (auto* pInfo : selectedThreads)
+    {
+        ASSERT_NE(pInfo->GetClrThreadId(), 3);
+    }
+    ReleaseThreads(selectedThreads);
+}
+
+TEST(WallTimeThreadsSchedulerTest, CheckThreadsWithActiveSpanArePreferred)
+{
+    ManagedThreadList threads(nullptr);
+    auto infos = CreateSampledThreads(threads, 4);
+    WallTimeThreadsScheduler scheduler(&threads);
+
+    // thread 3 is running a traced request (same span as during the previous sample)
+    auto* pTraceContext = infos[2]->GetTraceContextPointer();
+    pTraceContext->_currentLocalRootSpanId = 42;
+    pTraceContext->_currentSpanId = 43;
+    infos[2]->SetLastSampledSpanId(43);
+
+    std::vector<ManagedThreadInfo*> selectedThreads;
+    scheduler.SelectThreads(CurrentTimestampNs, 1, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 1);
+    ASSERT_EQ(selectedThreads[0]->GetClrThreadId(), 3);
+    ReleaseThreads(selectedThreads);
+}
+
+TEST(WallTimeThreadsSchedulerTest, CheckThreadsWithSpanChangeArePreferred)
+{
+    ManagedThreadList threads(nullptr);
+    auto infos = CreateSampledThreads(threads, 4);
+    WallTimeThreadsScheduler scheduler(&threads);
+
+    // thread 2 has just finished working on a span
+    infos[1]->SetLastSampledSpanId(43);
+
+    std::vector<ManagedThreadInfo*> selectedThreads;
+    scheduler.SelectThreads(CurrentTimestampNs, 1, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 1);
+    ASSERT_EQ(selectedThreads[0]->GetClrThreadId(), 2);
+
+    // selecting the thread does not mean that it is sampled: the sampler thread updates it after the collection
+    ASSERT_EQ(infos[1]->GetLastSampledSpanId(), 43);
+    ReleaseThreads(selectedThreads);
+}
+
+TEST(WallTimeThreadsSchedulerTest, CheckStarvedThreadsAreSelectedFirst)
+{
+    ManagedThreadList threads(nullptr);
+    auto infos = CreateSampledThreads(threads, 4);
+    WallTimeThreadsScheduler scheduler(&threads);
+
+    // thread 1 is running a traced request but thread 4 was not sampled for too long
+    auto* pTraceContext = infos[0]->GetTraceContextPointer();
+    pTraceContext->_currentLocalRootSpanId = 42;
+    pTraceContext->_currentSpanId = 42;
+    infos[0]->SetLastSampledSpanId(41);
+    infos[3]->SetLastSampleHighPrecisionTimestampNanoseconds(CurrentTimestampNs - WallTimeThreadsScheduler::MaxSampleGap.count());
+
+    std::vector<ManagedThreadInfo*> selectedThreads;
+    scheduler.SelectThreads(CurrentTimestampNs, 1, selectedThreads);
+    ASSERT_EQ(selectedThreads.size(), 1);
+    ASSERT_EQ(selectedThreads[0]->GetClrThreadId(), 4);
+    ReleaseThreads(selectedThreads);
+}
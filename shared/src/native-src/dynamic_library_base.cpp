@@ -94,6 +94,12 @@ bool DynamicLibraryBase::Unload()
 {
     _logger->Debug("Unload");
 
+    // dlclose crashes on a library that failed to load (or was never loaded)
+    if (_instance == nullptr)
+    {
+        return true;
+    }
+
 #if _WIN32
     auto result = FreeLibrary((HMODULE) _instance);
 #else
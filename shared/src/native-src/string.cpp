@@ -1,13 +1,226 @@
 #include "string.h"
-#ifdef _WIN32
-#include <Windows.h>
-#define tmp_buffer_size 512
-#else
-#include "miniutf.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DD_STRING_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define DD_STRING_NEON
 #endif
 
 namespace shared {
 
+    namespace {
+
+        const uint32_t ReplacementCharacter = 0xFFFD;
+
+        // Number of characters converted at once by the ASCII fast path
+        const std::size_t AsciiBlockSize = 16;
+
+        // Converts the block of AsciiBlockSize UTF-16 characters at src if they are all ASCII
+        inline bool TryNarrowAsciiBlock(const uint16_t* src, char* dst)
+        {
+#if defined(DD_STRING_SSE2)
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+            const __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAsciiBits, _mm_setzero_si128())) != 0xFFFF)
+            {
+                return false;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(low, high));
+            return true;
+#elif defined(DD_STRING_NEON)
+            const uint16x8_t low = vld1q_u16(src);
+            const uint16x8_t high = vld1q_u16(src + 8);
+            if (vmaxvq_u16(vorrq_u16(low, high)) > 0x7F)
+            {
+                return false;
+            }
+
+            vst1q_u8(reinterpret_cast<uint8_t*>(dst), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+            return true;
+#else
+            uint16_t bits = 0;
+            for (std::size_t i = 0; i < AsciiBlockSize; i++)
+            {
+                bits |= src[i];
+            }
+
+            if (bits > 0x7F)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < AsciiBlockSize; i++)
+            {
+                dst[i] = static_cast<char>(src[i]);
+            }
+            return true;
+#endif
+        }
+
+        // Converts the block of AsciiBlockSize UTF-8 bytes at src if they are all ASCII
+        inline bool TryWidenAsciiBlock(const uint8_t* src, uint16_t* dst)
+        {
+#if defined(DD_STRING_SSE2)
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            if (_mm_movemask_epi8(bytes) != 0)
+            {
+                return false;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(bytes, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(bytes, _mm_setzero_si128()));
+            return true;
+#elif defined(DD_STRING_NEON)
+            const uint8x16_t bytes = vld1q_u8(src);
+            if (vmaxvq_u8(bytes) > 0x7F)
+            {
+                return false;
+            }
+
+            vst1q_u16(dst, vmovl_u8(vget_low_u8(bytes)));
+            vst1q_u16(dst + 8, vmovl_u8(vget_high_u8(bytes)));
+            return true;
+#else
+            uint8_t bits = 0;
+            for (std::size_t i = 0; i < AsciiBlockSize; i++)
+            {
+                bits |= src[i];
+            }
+
+            if (bits > 0x7F)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < AsciiBlockSize; i++)
+            {
+                dst[i] = src[i];
+            }
+            return true;
+#endif
+        }
+
+        inline std::size_t WriteUtf8(uint32_t codePoint, char* dst)
+        {
+            if (codePoint < 0x80)
+            {
+                dst[0] = static_cast<char>(codePoint);
+                return 1;
+            }
+
+            if (codePoint < 0x800)
+            {
+                dst[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                dst[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+
+            if (codePoint < 0x10000)
+            {
+                dst[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                dst[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                dst[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+
+            dst[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            dst[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            dst[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            dst[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+
+        // Number of UTF-8 bytes written by ToUtf8 for the same characters
+        inline std::size_t Utf8Length(const uint16_t* src, std::size_t nbChars)
+        {
+            std::size_t length = nbChars;
+            for (std::size_t i = 0; i < nbChars; i++)
+            {
+                const uint16_t c = src[i];
+                if (c < 0x80)
+                {
+                    continue;
+                }
+
+                if (c < 0x800)
+                {
+                    length += 1;
+                }
+                else if (c <= 0xDBFF && c >= 0xD800 && i + 1 < nbChars && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF)
+                {
+                    // a surrogate pair (2 characters) is written in 4 bytes
+                    length += 2;
+                    i++;
+                }
+                else
+                {
+                    // other characters, including the replacement character of an unpaired surrogate
+                    length += 2;
+                }
+            }
+
+            return length;
+        }
+
+        // Decodes the UTF-8 sequence starting at src[0] (not ASCII) and returns the number of bytes read.
+        // An invalid sequence is decoded as the replacement character and only its longest valid prefix is read.
+        inline std::size_t ReadUtf8(const uint8_t* src, std::size_t available, uint32_t& codePoint)
+        {
+            const uint8_t lead = src[0];
+            std::size_t length;
+            // the range of the second byte excludes overlong encodings, surrogates and values above U+10FFFF
+            uint8_t secondMin = 0x80;
+            uint8_t secondMax = 0xBF;
+
+            if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                length = 2;
+                codePoint = lead & 0x1F;
+            }
+            else if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                length = 3;
+                codePoint = lead & 0x0F;
+                secondMin = lead == 0xE0 ? 0xA0 : 0x80;
+                secondMax = lead == 0xED ? 0x9F : 0xBF;
+            }
+            else if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                length = 4;
+                codePoint = lead & 0x07;
+                secondMin = lead == 0xF0 ? 0x90 : 0x80;
+                secondMax = lead == 0xF4 ? 0x8F : 0xBF;
+            }
+            else
+            {
+                codePoint = ReplacementCharacter;
+                return 1;
+            }
+
+            for (std::size_t i = 1; i < length; i++)
+            {
+                const uint8_t min = i == 1 ? secondMin : 0x80;
+                const uint8_t max = i == 1 ? secondMax : 0xBF;
+                if (i >= available || src[i] < min || src[i] > max)
+                {
+                    codePoint = ReplacementCharacter;
+                    return i;
+                }
+
+                codePoint = (codePoint << 6) | (src[i] & 0x3F);
+            }
+
+            return length;
+        }
+    } // namespace
+
     std::string ToString(const std::string& str) { return str; }
     std::string ToString(const char* str) { return std::string(str); }
     std::string ToString(const uint64_t i) { return std::to_string(i); }
@@ -16,42 +229,118 @@ namespace shared {
 
     std::string ToString(const WCHAR* wstr, std::size_t nbChars)
     {
-#ifdef _WIN32
-        if (nbChars == 0) return std::string();
+        std::string result;
+        ToString(wstr, nbChars, result);
+        return result;
+    }
 
-        char tmpStr[tmp_buffer_size] = {0};
-        int size_needed = WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)nbChars, &tmpStr[0], tmp_buffer_size, NULL, NULL);
-        if (size_needed < tmp_buffer_size)
+    void ToString(const WCHAR* wstr, std::size_t nbChars, std::string& result)
+    {
+        // size the result exactly instead of MaxUtf8Length, which would leave up to 3 times the needed capacity
+        result.resize(Utf8Length(reinterpret_cast<const uint16_t*>(wstr), nbChars));
+        ToUtf8(wstr, nbChars, &result[0]);
+    }
+
+    std::size_t ToUtf8(const WCHAR* wstr, std::size_t nbChars, char* buffer)
+    {
+        static_assert(sizeof(WCHAR) == sizeof(uint16_t), "WCHAR is expected to be a UTF-16 character");
+
+        const auto* src = reinterpret_cast<const uint16_t*>(wstr);
+        std::size_t i = 0;
+        std::size_t length = 0;
+
+        while (i < nbChars)
         {
-            return std::string(tmpStr, size_needed);
+            while (i + AsciiBlockSize <= nbChars && TryNarrowAsciiBlock(src + i, buffer + length))
+            {
+                i += AsciiBlockSize;
+                length += AsciiBlockSize;
+            }
+
+            // convert the characters one by one up to the next block
+            const std::size_t blockEnd = (std::min)(nbChars, i + AsciiBlockSize);
+            while (i < blockEnd)
+            {
+                uint32_t codePoint = src[i++];
+                if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+                {
+                    if (codePoint <= 0xDBFF && i < nbChars && src[i] >= 0xDC00 && src[i] <= 0xDFFF)
+                    {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (src[i++] - 0xDC00);
+                    }
+                    else
+                    {
+                        codePoint = ReplacementCharacter;
+                    }
+                }
+
+                length += WriteUtf8(codePoint, buffer + length);
+            }
         }
 
-        std::string strTo(size_needed, 0);
-        WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)nbChars, &strTo[0], size_needed, NULL, NULL);
-        return strTo;
-#else
-        std::u16string ustr(reinterpret_cast<const char16_t*>(wstr), nbChars);
-        return miniutf::to_utf8(ustr);
-#endif
+        return length;
+    }
+
+    WSTRING ToWSTRING(const std::string& str)
+    {
+        return ToWSTRING(str.data(), str.size());
+    }
+
+    WSTRING ToWSTRING(const char* str, std::size_t nbBytes)
+    {
+        WSTRING result;
+        ToWSTRING(str, nbBytes, result);
+        return result;
+    }
+
+    void ToWSTRING(const char* str, std::size_t nbBytes, WSTRING& result)
+    {
+        result.resize(MaxUtf16Length(nbBytes));
+        result.resize(ToUtf16(str, nbBytes, &result[0]));
     }
 
-    WSTRING ToWSTRING(const std::string& str) {
-#ifdef _WIN32
-        if (str.empty()) return std::wstring();
+    std::size_t ToUtf16(const char* str, std::size_t nbBytes, WCHAR* buffer)
+    {
+        const auto* src = reinterpret_cast<const uint8_t*>(str);
+        auto* dst = reinterpret_cast<uint16_t*>(buffer);
+        std::size_t i = 0;
+        std::size_t length = 0;
+
+        while (i < nbBytes)
+        {
+            while (i + AsciiBlockSize <= nbBytes && TryWidenAsciiBlock(src + i, dst + length))
+            {
+                i += AsciiBlockSize;
+                length += AsciiBlockSize;
+            }
 
-        wchar_t tmpStr[tmp_buffer_size] = {0};
-        int size_needed = MultiByteToWideChar(CP_UTF8, 0, &str[0], (int)str.size(), &tmpStr[0], tmp_buffer_size);
-        if (size_needed < tmp_buffer_size) {
-            return std::wstring(tmpStr, size_needed);
+            // convert the characters one by one up to the next block
+            const std::size_t blockEnd = (std::min)(nbBytes, i + AsciiBlockSize);
+            while (i < blockEnd)
+            {
+                if (src[i] < 0x80)
+                {
+                    dst[length++] = src[i++];
+                    continue;
+                }
+
+                uint32_t codePoint;
+                i += ReadUtf8(src + i, nbBytes - i, codePoint);
+
+                if (codePoint >= 0x10000)
+                {
+                    codePoint -= 0x10000;
+                    dst[length++] = static_cast<uint16_t>(0xD800 + (codePoint >> 10));
+                    dst[length++] = static_cast<uint16_t>(0xDC00 + (codePoint & 0x3FF));
+                }
+                else
+                {
+                    dst[length++] = static_cast<uint16_t>(codePoint);
+                }
+            }
         }
 
-        std::wstring wstrTo(size_needed, 0);
-        MultiByteToWideChar(CP_UTF8, 0, &str[0], (int)str.size(), &wstrTo[0], size_needed);
-        return wstrTo;
-#else
-        auto ustr = miniutf::to_utf16(str);
-        return WSTRING(reinterpret_cast<const WCHAR*>(ustr.c_str()));
-#endif
+        return length;
     }
 
     WSTRING ToWSTRING(const uint64_t i) {
@@ -27,8 +27,28 @@ namespace shared {
     std::string ToString(const WCHAR* wstr, std::size_t nbChars);
 
     WSTRING ToWSTRING(const std::string& str);
+    WSTRING ToWSTRING(const char* str, std::size_t nbBytes);
     WSTRING ToWSTRING(const uint64_t i);
 
+    // Conversions into a caller-provided buffer, to avoid allocating a string per conversion on hot paths.
+    // Invalid sequences (unpaired surrogates, malformed UTF-8) are replaced by U+FFFD.
+
+    // Maximum number of UTF-8 bytes needed to convert nbChars UTF-16 characters
+    constexpr std::size_t MaxUtf8Length(std::size_t nbChars) { return nbChars * 3; }
+
+    // Maximum number of UTF-16 characters needed to convert nbBytes UTF-8 bytes
+    constexpr std::size_t MaxUtf16Length(std::size_t nbBytes) { return nbBytes; }
+
+    // Writes the UTF-8 conversion of wstr to buffer (at least MaxUtf8Length(nbChars) bytes) and returns its length
+    std::size_t ToUtf8(const WCHAR* wstr, std::size_t nbChars, char* buffer);
+
+    // Writes the UTF-16 conversion of str to buffer (at least MaxUtf16Length(nbBytes) characters) and returns its length
+    std::size_t ToUtf16(const char* str, std::size_t nbBytes, WCHAR* buffer);
+
+    // Same as ToString/ToWSTRING but reuse the capacity of the given result
+    void ToString(const WCHAR* wstr, std::size_t nbChars, std::string& result);
+    void ToWSTRING(const char* str, std::size_t nbBytes, WSTRING& result);
+
     bool TryParse(WSTRING const& s, int& result);
 
     bool EndsWith(const std::string& str, const std::string& suffix);
@@ -11,43 +11,63 @@ using namespace shared;
 namespace datadog::shared::nativeloader
 {
 #define STR(x) #x
-#define RunInAllProfilers(EXPR)                                                                                        \
-    HRESULT gHR = S_OK;                                                                                                \
-    if (m_cpProfiler != nullptr)                                                                                       \
-    {                                                                                                                  \
-        HRESULT hr = m_cpProfiler->EXPR;                                                                               \
-        if (FAILED(hr))                                                                                                \
-        {                                                                                                              \
-            std::ostringstream hexValue;                                                                               \
-            hexValue << std::hex << hr;                                                                                \
-            Log::Warn("CorProfiler::", STR(EXPR), ": [Continuous Profiler] Error in ", STR(EXPR),                           \
-                 " call: ", hexValue.str());                                                                           \
-            gHR = hr;                                                                                                  \
-        }                                                                                                              \
-    }                                                                                                                  \
-    if (m_tracerProfiler != nullptr)                                                                                   \
-    {                                                                                                                  \
-        HRESULT hr = m_tracerProfiler->EXPR;                                                                           \
-        if (FAILED(hr))                                                                                                \
-        {                                                                                                              \
-            std::ostringstream hexValue;                                                                               \
-            hexValue << std::hex << hr;                                                                                \
-            Log::Warn("CorProfiler::", STR(EXPR), ": [Tracer] Error in ", STR(EXPR), " call: ", hexValue.str());            \
-            gHR = hr;                                                                                                  \
-        }                                                                                                              \
-    }                                                                                                                  \
-    if (m_customProfiler != nullptr)                                                                                   \
-    {                                                                                                                  \
-        HRESULT hr = m_customProfiler->EXPR;                                                                           \
-        if (FAILED(hr))                                                                                                \
-        {                                                                                                              \
-            std::ostringstream hexValue;                                                                               \
-            hexValue << std::hex << hr;                                                                                \
-            Log::Warn("CorProfiler::", STR(EXPR), ": [Custom] Error in ", STR(EXPR), " call: ", hexValue.str());            \
-            gHR = hr;                                                                                                  \
-        }                                                                                                              \
-    }                                                                                                                  \
+#define RunInSubscribedProfilers(GROUP, EXPR)                                                                           \
+    HRESULT gHR = S_OK;                                                                                                 \
+    const CallbackSubscribers& subscribers =                                                                            \
+        (*m_callbackSubscribers.load(std::memory_order_acquire))[static_cast<int>(CallbackGroup::GROUP)];               \
+    for (int i = 0; i < subscribers.Count; i++)                                                                         \
+    {                                                                                                                   \
+        const CallbackSubscriber& subscriber = subscribers.Items[i];                                                    \
+        HRESULT hr = subscriber.Profiler->EXPR;                                                                         \
+        if (FAILED(hr))                                                                                                 \
+        {                                                                                                               \
+            std::ostringstream hexValue;                                                                                \
+            hexValue << std::hex << hr;                                                                                 \
+            Log::Warn("CorProfiler::", STR(EXPR), ": [", subscriber.Name, "] Error in ", STR(EXPR),                     \
+                 " call: ", hexValue.str());                                                                            \
+            gHR = hr;                                                                                                   \
+        }                                                                                                               \
+    }                                                                                                                   \
     return gHR;
+#define RunInAllProfilers(EXPR) RunInSubscribedProfilers(All, EXPR)
+
+    namespace
+    {
+        struct CallbackGroupMask
+        {
+            DWORD Low;
+            DWORD High;
+        };
+
+        // Event mask flags enabling the callbacks of each group (indexed by CallbackGroup)
+        const CallbackGroupMask CallbackGroupMasks[] = {
+            {0, 0}, // All
+            {COR_PRF_MONITOR_APPDOMAIN_LOADS, 0},
+            {COR_PRF_MONITOR_ASSEMBLY_LOADS, 0},
+            {COR_PRF_MONITOR_MODULE_LOADS, 0},
+            {COR_PRF_MONITOR_CLASS_LOADS, 0},
+            {COR_PRF_MONITOR_FUNCTION_UNLOADS, 0},
+            {COR_PRF_MONITOR_JIT_COMPILATION, 0},
+            {COR_PRF_MONITOR_CACHE_SEARCHES, 0},
+            {COR_PRF_MONITOR_THREADS, 0},
+            {COR_PRF_MONITOR_REMOTING, 0},
+            {COR_PRF_MONITOR_CODE_TRANSITIONS, 0},
+            {COR_PRF_MONITOR_SUSPENDS, 0},
+            {COR_PRF_MONITOR_GC, COR_PRF_HIGH_BASIC_GC | COR_PRF_HIGH_MONITOR_GC_MOVED_OBJECTS},
+            {COR_PRF_MONITOR_OBJECT_ALLOCATED | COR_PRF_ENABLE_OBJECT_ALLOCATED, COR_PRF_HIGH_MONITOR_LARGEOBJECT_ALLOCATED},
+            {COR_PRF_MONITOR_EXCEPTIONS | COR_PRF_MONITOR_CLR_EXCEPTIONS, 0},
+            {COR_PRF_MONITOR_CCW, 0},
+            {0, COR_PRF_HIGH_ADD_ASSEMBLY_REFERENCES},
+            {0, COR_PRF_HIGH_IN_MEMORY_SYMBOLS_UPDATED},
+            {0, COR_PRF_HIGH_MONITOR_DYNAMIC_FUNCTION_UNLOADS},
+        };
+
+        static_assert(sizeof(CallbackGroupMasks) / sizeof(CallbackGroupMasks[0]) == static_cast<int>(CallbackGroup::Count),
+                      "A mask must be defined for each callback group.");
+
+        // Used when the event mask of a profiler is unknown
+        const DWORD AllEventsMask = 0xFFFFFFFF;
+    }
 
     CorProfiler* CorProfiler::m_this = nullptr;
 
@@ -55,6 +75,9 @@ namespace datadog::shared::nativeloader
         m_refCount(0), m_dispatcher(dispatcher), m_cpProfiler(nullptr), m_tracerProfiler(nullptr), m_customProfiler(nullptr)
     {
         Log::Debug("CorProfiler::.ctor");
+        m_allProfilersSubscribers = {};
+        m_maskSubscribers = {};
+        m_callbackSubscribers.store(&m_allProfilersSubscribers, std::memory_order_release);
     }
 
     CorProfiler::~CorProfiler()
@@ -134,6 +157,9 @@ namespace datadog::shared::nativeloader
             m_customProfiler = customInstance->GetProfilerCallback();
         }
 
+        // Until the event masks are known, all profilers receive all callbacks
+        SetAllProfilersAsCallbackSubscribers();
+
         // *******************************************************************************************************
         // We get the ICorProfilerInfo4 and ICorProfilerInfo5 interface from the pICorProfilerInfoUnk
         // given by the runtime.
@@ -194,6 +220,14 @@ namespace datadog::shared::nativeloader
         Log::Debug("CorProfiler::Initialize: MaskLow: ", mask_low);
         Log::Debug("CorProfiler::Initialize: MaskHi : ", mask_hi);
 
+        // Event mask set by each profiler, used to only dispatch the callbacks they asked for
+        DWORD cp_mask_low = AllEventsMask;
+        DWORD cp_mask_hi = AllEventsMask;
+        DWORD tracer_mask_low = AllEventsMask;
+        DWORD tracer_mask_hi = AllEventsMask;
+        DWORD custom_mask_low = AllEventsMask;
+        DWORD custom_mask_hi = AllEventsMask;
+
         if (instrumented_assembly_generator::IsInstrumentedAssemblyGeneratorEnabled())
         {
             m_writeToDiskCorProfilerInfo = std::make_shared<instrumented_assembly_generator::CorProfilerInfo>(
@@ -232,6 +266,8 @@ namespace datadog::shared::nativeloader
                 {
                     mask_low = mask_low | local_mask_low;
                     mask_hi = mask_hi | local_mask_hi;
+                    cp_mask_low = local_mask_low;
+                    cp_mask_hi = local_mask_hi;
 
                     Log::Debug("CorProfiler::Initialize: *LocalMaskLow: ", local_mask_low);
                     Log::Debug("CorProfiler::Initialize: *LocalMaskHi : ", local_mask_hi);
@@ -275,6 +311,8 @@ namespace datadog::shared::nativeloader
                 {
                     mask_low = mask_low | local_mask_low;
                     mask_hi = mask_hi | local_mask_hi;
+                    tracer_mask_low = local_mask_low;
+                    tracer_mask_hi = local_mask_hi;
 
                     Log::Debug("CorProfiler::Initialize: *LocalMaskLow: ", local_mask_low);
                     Log::Debug("CorProfiler::Initialize: *LocalMaskHi : ", local_mask_hi);
@@ -318,6 +356,8 @@ namespace datadog::shared::nativeloader
                 {
                     mask_low = mask_low | local_mask_low;
                     mask_hi = mask_hi | local_mask_hi;
+                    custom_mask_low = local_mask_low;
+                    custom_mask_hi = local_mask_hi;
 
                     Log::Debug("CorProfiler::Initialize: *LocalMaskLow: ", local_mask_low);
                     Log::Debug("CorProfiler::Initialize: *LocalMaskHi : ", local_mask_hi);
@@ -341,6 +381,10 @@ namespace datadog::shared::nativeloader
         Log::Debug("CorProfiler::Initialize: *MaskLow: ", mask_low);
         Log::Debug("CorProfiler::Initialize: *MaskHi : ", mask_hi);
 
+        // Callbacks are routed before being enabled by the final event mask
+        UpdateCallbackSubscribers(cp_mask_low, cp_mask_hi, tracer_mask_low, tracer_mask_hi, custom_mask_low,
+                                  custom_mask_hi);
+
         // Sets the final event mask for the profiler
         if (info5 != nullptr)
         {
@@ -365,55 +409,63 @@ namespace datadog::shared::nativeloader
 
     HRESULT STDMETHODCALLTYPE CorProfiler::Shutdown()
     {
-        RunInAllProfilers(Shutdown());
+        const HRESULT hr = [this]() -> HRESULT { RunInAllProfilers(Shutdown()); }();
+
+        if (m_writeToDiskCorProfilerInfo != nullptr)
+        {
+            // Write the instrumentation verification records still queued before the process exits
+            instrumented_assembly_generator::InstrumentationLogWriter::Instance().Stop();
+        }
+
+        return hr;
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AppDomainCreationStarted(AppDomainID appDomainId)
     {
-        RunInAllProfilers(AppDomainCreationStarted(appDomainId));
+        RunInSubscribedProfilers(AppDomainLoads, AppDomainCreationStarted(appDomainId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AppDomainCreationFinished(AppDomainID appDomainId, HRESULT hrStatus)
     {
-        RunInAllProfilers(AppDomainCreationFinished(appDomainId, hrStatus));
+        RunInSubscribedProfilers(AppDomainLoads, AppDomainCreationFinished(appDomainId, hrStatus));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AppDomainShutdownStarted(AppDomainID appDomainId)
     {
-        RunInAllProfilers(AppDomainShutdownStarted(appDomainId));
+        RunInSubscribedProfilers(AppDomainLoads, AppDomainShutdownStarted(appDomainId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AppDomainShutdownFinished(AppDomainID appDomainId, HRESULT hrStatus)
     {
-        RunInAllProfilers(AppDomainShutdownFinished(appDomainId, hrStatus));
+        RunInSubscribedProfilers(AppDomainLoads, AppDomainShutdownFinished(appDomainId, hrStatus));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AssemblyLoadStarted(AssemblyID assemblyId)
     {
-        RunInAllProfilers(AssemblyLoadStarted(assemblyId));
+        RunInSubscribedProfilers(AssemblyLoads, AssemblyLoadStarted(assemblyId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AssemblyLoadFinished(AssemblyID assemblyId, HRESULT hrStatus)
     {
-        RunInAllProfilers(AssemblyLoadFinished(assemblyId, hrStatus));
+        RunInSubscribedProfilers(AssemblyLoads, AssemblyLoadFinished(assemblyId, hrStatus));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AssemblyUnloadStarted(AssemblyID assemblyId)
     {
-        RunInAllProfilers(AssemblyUnloadStarted(assemblyId));
+        RunInSubscribedProfilers(AssemblyLoads, AssemblyUnloadStarted(assemblyId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::AssemblyUnloadFinished(AssemblyID assemblyId, HRESULT hrStatus)
     {
-        RunInAllProfilers(AssemblyUnloadFinished(assemblyId, hrStatus));
+        RunInSubscribedProfilers(AssemblyLoads, AssemblyUnloadFinished(assemblyId, hrStatus));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleLoadStarted(ModuleID moduleId)
     {
-        RunInAllProfilers(ModuleLoadStarted(moduleId));
+        RunInSubscribedProfilers(ModuleLoads, ModuleLoadStarted(moduleId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleLoadFinished(ModuleID moduleId, HRESULT hrStatus)
@@ -458,187 +510,187 @@ namespace datadog::shared::nativeloader
             Log::Warn("InstrumentationVerification: fail to write module load to disk on ModuleLoadFinished");
         }
 
-        RunInAllProfilers(ModuleLoadFinished(moduleId, hrStatus));
+        RunInSubscribedProfilers(ModuleLoads, ModuleLoadFinished(moduleId, hrStatus));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadStarted(ModuleID moduleId)
     {
-        RunInAllProfilers(ModuleUnloadStarted(moduleId));
+        RunInSubscribedProfilers(ModuleLoads, ModuleUnloadStarted(moduleId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadFinished(ModuleID moduleId, HRESULT hrStatus)
     {
-        RunInAllProfilers(ModuleUnloadFinished(moduleId, hrStatus));
+        RunInSubscribedProfilers(ModuleLoads, ModuleUnloadFinished(moduleId, hrStatus));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleAttachedToAssembly(ModuleID moduleId, AssemblyID AssemblyId)
     {
-        RunInAllProfilers(ModuleAttachedToAssembly(moduleId, AssemblyId));
+        RunInSubscribedProfilers(ModuleLoads, ModuleAttachedToAssembly(moduleId, AssemblyId));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ClassLoadStarted(ClassID classId)
     {
-        RunInAllProfilers(ClassLoadStarted(classId));
+        RunInSubscribedProfilers(ClassLoads, ClassLoadStarted(classId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ClassLoadFinished(ClassID classId, HRESULT hrStatus)
     {
-        RunInAllProfilers(ClassLoadFinished(classId, hrStatus));
+        RunInSubscribedProfilers(ClassLoads, ClassLoadFinished(classId, hrStatus));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ClassUnloadStarted(ClassID classId)
     {
-        RunInAllProfilers(ClassUnloadStarted(classId));
+        RunInSubscribedProfilers(ClassLoads, ClassUnloadStarted(classId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ClassUnloadFinished(ClassID classId, HRESULT hrStatus)
     {
-        RunInAllProfilers(ClassUnloadFinished(classId, hrStatus));
+        RunInSubscribedProfilers(ClassLoads, ClassUnloadFinished(classId, hrStatus));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::FunctionUnloadStarted(FunctionID functionId)
     {
-        RunInAllProfilers(FunctionUnloadStarted(functionId));
+        RunInSubscribedProfilers(FunctionUnloads, FunctionUnloadStarted(functionId));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITCompilationStarted(FunctionID functionId, BOOL fIsSafeToBlock)
     {
-        RunInAllProfilers(JITCompilationStarted(functionId, fIsSafeToBlock));
+        RunInSubscribedProfilers(JitCompilation, JITCompilationStarted(functionId, fIsSafeToBlock));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITCompilationFinished(FunctionID functionId, HRESULT hrStatus,
                                                                   BOOL fIsSafeToBlock)
     {
-        RunInAllProfilers(JITCompilationFinished(functionId, hrStatus, fIsSafeToBlock));
+        RunInSubscribedProfilers(JitCompilation, JITCompilationFinished(functionId, hrStatus, fIsSafeToBlock));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITCachedFunctionSearchStarted(FunctionID functionId,
                                                                           BOOL* pbUseCachedFunction)
     {
-        RunInAllProfilers(JITCachedFunctionSearchStarted(functionId, pbUseCachedFunction));
+        RunInSubscribedProfilers(CacheSearches, JITCachedFunctionSearchStarted(functionId, pbUseCachedFunction));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITCachedFunctionSearchFinished(FunctionID functionId,
                                                                            COR_PRF_JIT_CACHE result)
     {
-        RunInAllProfilers(JITCachedFunctionSearchFinished(functionId, result));
+        RunInSubscribedProfilers(CacheSearches, JITCachedFunctionSearchFinished(functionId, result));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITFunctionPitched(FunctionID functionId)
     {
-        RunInAllProfilers(JITFunctionPitched(functionId));
+        RunInSubscribedProfilers(JitCompilation, JITFunctionPitched(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::JITInlining(FunctionID callerId, FunctionID calleeId, BOOL* pfShouldInline)
     {
-        RunInAllProfilers(JITInlining(callerId, calleeId, pfShouldInline));
+        RunInSubscribedProfilers(JitCompilation, JITInlining(callerId, calleeId, pfShouldInline));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ThreadCreated(ThreadID threadId)
     {
-        RunInAllProfilers(ThreadCreated(threadId));
+        RunInSubscribedProfilers(Threads, ThreadCreated(threadId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ThreadDestroyed(ThreadID threadId)
     {
-        RunInAllProfilers(ThreadDestroyed(threadId));
+        RunInSubscribedProfilers(Threads, ThreadDestroyed(threadId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ThreadAssignedToOSThread(ThreadID managedThreadId, DWORD osThreadId)
     {
-        RunInAllProfilers(ThreadAssignedToOSThread(managedThreadId, osThreadId));
+        RunInSubscribedProfilers(Threads, ThreadAssignedToOSThread(managedThreadId, osThreadId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingClientInvocationStarted()
     {
-        RunInAllProfilers(RemotingClientInvocationStarted());
+        RunInSubscribedProfilers(Remoting, RemotingClientInvocationStarted());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingClientSendingMessage(GUID* pCookie, BOOL fIsAsync)
     {
-        RunInAllProfilers(RemotingClientSendingMessage(pCookie, fIsAsync));
+        RunInSubscribedProfilers(Remoting, RemotingClientSendingMessage(pCookie, fIsAsync));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingClientReceivingReply(GUID* pCookie, BOOL fIsAsync)
     {
-        RunInAllProfilers(RemotingClientReceivingReply(pCookie, fIsAsync));
+        RunInSubscribedProfilers(Remoting, RemotingClientReceivingReply(pCookie, fIsAsync));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingClientInvocationFinished()
     {
-        RunInAllProfilers(RemotingClientInvocationFinished());
+        RunInSubscribedProfilers(Remoting, RemotingClientInvocationFinished());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingServerReceivingMessage(GUID* pCookie, BOOL fIsAsync)
     {
-        RunInAllProfilers(RemotingServerReceivingMessage(pCookie, fIsAsync));
+        RunInSubscribedProfilers(Remoting, RemotingServerReceivingMessage(pCookie, fIsAsync));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingServerInvocationStarted()
     {
-        RunInAllProfilers(RemotingServerInvocationStarted());
+        RunInSubscribedProfilers(Remoting, RemotingServerInvocationStarted());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingServerInvocationReturned()
     {
-        RunInAllProfilers(RemotingServerInvocationReturned());
+        RunInSubscribedProfilers(Remoting, RemotingServerInvocationReturned());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RemotingServerSendingReply(GUID* pCookie, BOOL fIsAsync)
     {
-        RunInAllProfilers(RemotingServerSendingReply(pCookie, fIsAsync));
+        RunInSubscribedProfilers(Remoting, RemotingServerSendingReply(pCookie, fIsAsync));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::UnmanagedToManagedTransition(FunctionID functionId,
                                                                         COR_PRF_TRANSITION_REASON reason)
     {
-        RunInAllProfilers(UnmanagedToManagedTransition(functionId, reason));
+        RunInSubscribedProfilers(CodeTransitions, UnmanagedToManagedTransition(functionId, reason));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ManagedToUnmanagedTransition(FunctionID functionId,
                                                                         COR_PRF_TRANSITION_REASON reason)
     {
-        RunInAllProfilers(ManagedToUnmanagedTransition(functionId, reason));
+        RunInSubscribedProfilers(CodeTransitions, ManagedToUnmanagedTransition(functionId, reason));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeSuspendStarted(COR_PRF_SUSPEND_REASON suspendReason)
     {
-        RunInAllProfilers(RuntimeSuspendStarted(suspendReason));
+        RunInSubscribedProfilers(Suspends, RuntimeSuspendStarted(suspendReason));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeSuspendFinished()
     {
-        RunInAllProfilers(RuntimeSuspendFinished());
+        RunInSubscribedProfilers(Suspends, RuntimeSuspendFinished());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeSuspendAborted()
     {
-        RunInAllProfilers(RuntimeSuspendAborted());
+        RunInSubscribedProfilers(Suspends, RuntimeSuspendAborted());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeResumeStarted()
     {
-        RunInAllProfilers(RuntimeResumeStarted());
+        RunInSubscribedProfilers(Suspends, RuntimeResumeStarted());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeResumeFinished()
     {
-        RunInAllProfilers(RuntimeResumeFinished());
+        RunInSubscribedProfilers(Suspends, RuntimeResumeFinished());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeThreadSuspended(ThreadID threadId)
     {
-        RunInAllProfilers(RuntimeThreadSuspended(threadId));
+        RunInSubscribedProfilers(Suspends, RuntimeThreadSuspended(threadId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RuntimeThreadResumed(ThreadID threadId)
     {
-        RunInAllProfilers(RuntimeThreadResumed(threadId));
+        RunInSubscribedProfilers(Suspends, RuntimeThreadResumed(threadId));
     }
 
 
@@ -646,173 +698,173 @@ namespace datadog::shared::nativeloader
                                                            ObjectID newObjectIDRangeStart[],
                                                            ULONG cObjectIDRangeLength[])
     {
-        RunInAllProfilers(
-            MovedReferences(cMovedObjectIDRanges, oldObjectIDRangeStart, newObjectIDRangeStart, cObjectIDRangeLength));
+        RunInSubscribedProfilers(
+            Gc, MovedReferences(cMovedObjectIDRanges, oldObjectIDRangeStart, newObjectIDRangeStart, cObjectIDRangeLength));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ObjectAllocated(ObjectID objectId, ClassID classId)
     {
-        RunInAllProfilers(ObjectAllocated(objectId, classId));
+        RunInSubscribedProfilers(ObjectAllocated, ObjectAllocated(objectId, classId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ObjectsAllocatedByClass(ULONG cClassCount, ClassID classIds[],
                                                                    ULONG cObjects[])
     {
-        RunInAllProfilers(ObjectsAllocatedByClass(cClassCount, classIds, cObjects));
+        RunInSubscribedProfilers(Gc, ObjectsAllocatedByClass(cClassCount, classIds, cObjects));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ObjectReferences(ObjectID objectId, ClassID classId, ULONG cObjectRefs,
                                                             ObjectID objectRefIds[])
     {
-        RunInAllProfilers(ObjectReferences(objectId, classId, cObjectRefs, objectRefIds));
+        RunInSubscribedProfilers(Gc, ObjectReferences(objectId, classId, cObjectRefs, objectRefIds));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RootReferences(ULONG cRootRefs, ObjectID rootRefIds[])
     {
-        RunInAllProfilers(RootReferences(cRootRefs, rootRefIds));
+        RunInSubscribedProfilers(Gc, RootReferences(cRootRefs, rootRefIds));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionThrown(ObjectID thrownObjectId)
     {
-        RunInAllProfilers(ExceptionThrown(thrownObjectId));
+        RunInSubscribedProfilers(Exceptions, ExceptionThrown(thrownObjectId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionSearchFunctionEnter(FunctionID functionId)
     {
-        RunInAllProfilers(ExceptionSearchFunctionEnter(functionId));
+        RunInSubscribedProfilers(Exceptions, ExceptionSearchFunctionEnter(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionSearchFunctionLeave()
     {
-        RunInAllProfilers(ExceptionSearchFunctionLeave());
+        RunInSubscribedProfilers(Exceptions, ExceptionSearchFunctionLeave());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionSearchFilterEnter(FunctionID functionId)
     {
-        RunInAllProfilers(ExceptionSearchFilterEnter(functionId));
+        RunInSubscribedProfilers(Exceptions, ExceptionSearchFilterEnter(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionSearchFilterLeave()
     {
-        RunInAllProfilers(ExceptionSearchFilterLeave());
+        RunInSubscribedProfilers(Exceptions, ExceptionSearchFilterLeave());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionSearchCatcherFound(FunctionID functionId)
     {
-        RunInAllProfilers(ExceptionSearchCatcherFound(functionId));
+        RunInSubscribedProfilers(Exceptions, ExceptionSearchCatcherFound(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionOSHandlerEnter(UINT_PTR unused_variable)
     {
-        RunInAllProfilers(ExceptionOSHandlerEnter(unused_variable));
+        RunInSubscribedProfilers(Exceptions, ExceptionOSHandlerEnter(unused_variable));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionOSHandlerLeave(UINT_PTR unused_variable)
     {
-        RunInAllProfilers(ExceptionOSHandlerLeave(unused_variable));
+        RunInSubscribedProfilers(Exceptions, ExceptionOSHandlerLeave(unused_variable));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionUnwindFunctionEnter(FunctionID functionId)
     {
-        RunInAllProfilers(ExceptionUnwindFunctionEnter(functionId));
+        RunInSubscribedProfilers(Exceptions, ExceptionUnwindFunctionEnter(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionUnwindFunctionLeave()
     {
-        RunInAllProfilers(ExceptionUnwindFunctionLeave());
+        RunInSubscribedProfilers(Exceptions, ExceptionUnwindFunctionLeave());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionUnwindFinallyEnter(FunctionID functionId)
     {
-        RunInAllProfilers(ExceptionUnwindFinallyEnter(functionId));
+        RunInSubscribedProfilers(Exceptions, ExceptionUnwindFinallyEnter(functionId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionUnwindFinallyLeave()
     {
-        RunInAllProfilers(ExceptionUnwindFinallyLeave());
+        RunInSubscribedProfilers(Exceptions, ExceptionUnwindFinallyLeave());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionCatcherEnter(FunctionID functionId, ObjectID objectId)
     {
-        RunInAllProfilers(ExceptionCatcherEnter(functionId, objectId));
+        RunInSubscribedProfilers(Exceptions, ExceptionCatcherEnter(functionId, objectId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionCatcherLeave()
     {
-        RunInAllProfilers(ExceptionCatcherLeave());
+        RunInSubscribedProfilers(Exceptions, ExceptionCatcherLeave());
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::COMClassicVTableCreated(ClassID wrappedClassId, REFGUID implementedIID,
                                                                    void* pVTable, ULONG cSlots)
     {
-        RunInAllProfilers(COMClassicVTableCreated(wrappedClassId, implementedIID, pVTable, cSlots));
+        RunInSubscribedProfilers(Ccw, COMClassicVTableCreated(wrappedClassId, implementedIID, pVTable, cSlots));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::COMClassicVTableDestroyed(ClassID wrappedClassId, REFGUID implementedIID,
                                                                      void* pVTable)
     {
-        RunInAllProfilers(COMClassicVTableDestroyed(wrappedClassId, implementedIID, pVTable));
+        RunInSubscribedProfilers(Ccw, COMClassicVTableDestroyed(wrappedClassId, implementedIID, pVTable));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionCLRCatcherFound()
     {
-        RunInAllProfilers(ExceptionCLRCatcherFound());
+        RunInSubscribedProfilers(Exceptions, ExceptionCLRCatcherFound());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ExceptionCLRCatcherExecute()
     {
-        RunInAllProfilers(ExceptionCLRCatcherExecute());
+        RunInSubscribedProfilers(Exceptions, ExceptionCLRCatcherExecute());
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ThreadNameChanged(ThreadID threadId, ULONG cchName, WCHAR name[])
     {
-        RunInAllProfilers(ThreadNameChanged(threadId, cchName, name));
+        RunInSubscribedProfilers(Threads, ThreadNameChanged(threadId, cchName, name));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::GarbageCollectionStarted(int cGenerations, BOOL generationCollected[],
                                                                     COR_PRF_GC_REASON reason)
     {
-        RunInAllProfilers(GarbageCollectionStarted(cGenerations, generationCollected, reason));
+        RunInSubscribedProfilers(Gc, GarbageCollectionStarted(cGenerations, generationCollected, reason));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::SurvivingReferences(ULONG cSurvivingObjectIDRanges,
                                                                ObjectID objectIDRangeStart[],
                                                                ULONG cObjectIDRangeLength[])
     {
-        RunInAllProfilers(SurvivingReferences(cSurvivingObjectIDRanges, objectIDRangeStart, cObjectIDRangeLength));
+        RunInSubscribedProfilers(Gc, SurvivingReferences(cSurvivingObjectIDRanges, objectIDRangeStart, cObjectIDRangeLength));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::GarbageCollectionFinished()
     {
-        RunInAllProfilers(GarbageCollectionFinished());
+        RunInSubscribedProfilers(Gc, GarbageCollectionFinished());
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::FinalizeableObjectQueued(DWORD finalizerFlags, ObjectID objectID)
     {
-        RunInAllProfilers(FinalizeableObjectQueued(finalizerFlags, objectID));
+        RunInSubscribedProfilers(Gc, FinalizeableObjectQueued(finalizerFlags, objectID));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::RootReferences2(ULONG cRootRefs, ObjectID rootRefIds[],
                                                            COR_PRF_GC_ROOT_KIND rootKinds[],
                                                            COR_PRF_GC_ROOT_FLAGS rootFlags[], UINT_PTR rootIds[])
     {
-        RunInAllProfilers(RootReferences2(cRootRefs, rootRefIds, rootKinds, rootFlags, rootIds));
+        RunInSubscribedProfilers(Gc, RootReferences2(cRootRefs, rootRefIds, rootKinds, rootFlags, rootIds));
     }
 
 
     HRESULT STDMETHODCALLTYPE CorProfiler::HandleCreated(GCHandleID handleId, ObjectID initialObjectId)
     {
-        RunInAllProfilers(HandleCreated(handleId, initialObjectId));
+        RunInSubscribedProfilers(Gc, HandleCreated(handleId, initialObjectId));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::HandleDestroyed(GCHandleID handleId)
     {
-        RunInAllProfilers(HandleDestroyed(handleId));
+        RunInSubscribedProfilers(Gc, HandleDestroyed(handleId));
     }
 
 
@@ -876,33 +928,33 @@ namespace datadog::shared::nativeloader
                                                             ObjectID newObjectIDRangeStart[],
                                                             SIZE_T cObjectIDRangeLength[])
     {
-        RunInAllProfilers(
-            MovedReferences2(cMovedObjectIDRanges, oldObjectIDRangeStart, newObjectIDRangeStart, cObjectIDRangeLength));
+        RunInSubscribedProfilers(
+            Gc, MovedReferences2(cMovedObjectIDRanges, oldObjectIDRangeStart, newObjectIDRangeStart, cObjectIDRangeLength));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::SurvivingReferences2(ULONG cSurvivingObjectIDRanges,
                                                                 ObjectID objectIDRangeStart[],
                                                                 SIZE_T cObjectIDRangeLength[])
     {
-        RunInAllProfilers(SurvivingReferences2(cSurvivingObjectIDRanges, objectIDRangeStart, cObjectIDRangeLength));
+        RunInSubscribedProfilers(Gc, SurvivingReferences2(cSurvivingObjectIDRanges, objectIDRangeStart, cObjectIDRangeLength));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ConditionalWeakTableElementReferences(ULONG cRootRefs, ObjectID keyRefIds[],
                                                                                  ObjectID valueRefIds[],
                                                                                  GCHandleID rootIds[])
     {
-        RunInAllProfilers(ConditionalWeakTableElementReferences(cRootRefs, keyRefIds, valueRefIds, rootIds));
+        RunInSubscribedProfilers(Gc, ConditionalWeakTableElementReferences(cRootRefs, keyRefIds, valueRefIds, rootIds));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::GetAssemblyReferences(const WCHAR* wszAssemblyPath,
                                                                  ICorProfilerAssemblyReferenceProvider* pAsmRefProvider)
     {
-        RunInAllProfilers(GetAssemblyReferences(wszAssemblyPath, pAsmRefProvider));
+        RunInSubscribedProfilers(AssemblyReferences, GetAssemblyReferences(wszAssemblyPath, pAsmRefProvider));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::ModuleInMemorySymbolsUpdated(ModuleID moduleId)
     {
-        RunInAllProfilers(ModuleInMemorySymbolsUpdated(moduleId));
+        RunInSubscribedProfilers(InMemorySymbols, ModuleInMemorySymbolsUpdated(moduleId));
     }
 
 
@@ -910,18 +962,18 @@ namespace datadog::shared::nativeloader
                                                                               BOOL fIsSafeToBlock, LPCBYTE ilHeader,
                                                                               ULONG cbILHeader)
     {
-        RunInAllProfilers(DynamicMethodJITCompilationStarted(functionId, fIsSafeToBlock, ilHeader, cbILHeader));
+        RunInSubscribedProfilers(JitCompilation, DynamicMethodJITCompilationStarted(functionId, fIsSafeToBlock, ilHeader, cbILHeader));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::DynamicMethodJITCompilationFinished(FunctionID functionId, HRESULT hrStatus,
                                                                                BOOL fIsSafeToBlock)
     {
-        RunInAllProfilers(DynamicMethodJITCompilationFinished(functionId, hrStatus, fIsSafeToBlock));
+        RunInSubscribedProfilers(JitCompilation, DynamicMethodJITCompilationFinished(functionId, hrStatus, fIsSafeToBlock));
     }
 
     HRESULT STDMETHODCALLTYPE CorProfiler::DynamicMethodUnloaded(FunctionID functionId)
     {
-        RunInAllProfilers(DynamicMethodUnloaded(functionId));
+        RunInSubscribedProfilers(DynamicFunctionUnloads, DynamicMethodUnloaded(functionId));
     }
 
 
@@ -932,6 +984,7 @@ namespace datadog::shared::nativeloader
                                                                    LPCGUID pRelatedActivityId, ThreadID eventThread,
                                                                    ULONG numStackFrames, UINT_PTR stackFrames[])
     {
+        // A profiler can start its own EventPipe session without COR_PRF_HIGH_MONITOR_EVENT_PIPE in its event mask
         RunInAllProfilers(EventPipeEventDelivered(provider, eventId, eventVersion, cbMetadataBlob, metadataBlob,
                                                   cbEventData, eventData, pActivityId, pRelatedActivityId, eventThread,
                                                   numStackFrames, stackFrames));
@@ -942,6 +995,47 @@ namespace datadog::shared::nativeloader
         RunInAllProfilers(EventPipeProviderCreated(provider));
     }
 
+    void CorProfiler::AddCallbackSubscriber(CallbackSubscribersTable& table, ICorProfilerCallback10* profiler,
+                                            const char* name, DWORD maskLow, DWORD maskHi)
+    {
+        if (profiler == nullptr)
+        {
+            return;
+        }
+
+        for (int group = 0; group < static_cast<int>(CallbackGroup::Count); group++)
+        {
+            const CallbackGroupMask& groupMask = CallbackGroupMasks[group];
+            if (group == static_cast<int>(CallbackGroup::All) || (maskLow & groupMask.Low) != 0 ||
+                (maskHi & groupMask.High) != 0)
+            {
+                CallbackSubscribers& subscribers = table[group];
+                subscribers.Items[subscribers.Count] = {profiler, name};
+                subscribers.Count++;
+            }
+        }
+    }
+
+    void CorProfiler::SetAllProfilersAsCallbackSubscribers()
+    {
+        m_allProfilersSubscribers = {};
+        AddCallbackSubscriber(m_allProfilersSubscribers, m_cpProfiler, "Continuous Profiler", AllEventsMask, AllEventsMask);
+        AddCallbackSubscriber(m_allProfilersSubscribers, m_tracerProfiler, "Tracer", AllEventsMask, AllEventsMask);
+        AddCallbackSubscriber(m_allProfilersSubscribers, m_customProfiler, "Custom", AllEventsMask, AllEventsMask);
+        m_callbackSubscribers.store(&m_allProfilersSubscribers, std::memory_order_release);
+    }
+
+    void CorProfiler::UpdateCallbackSubscribers(DWORD cpMaskLow, DWORD cpMaskHi, DWORD tracerMaskLow,
+                                                DWORD tracerMaskHi, DWORD customMaskLow, DWORD customMaskHi)
+    {
+        // Called from Initialize: the runtime does not send any other callback concurrently
+        m_maskSubscribers = {};
+        AddCallbackSubscriber(m_maskSubscribers, m_cpProfiler, "Continuous Profiler", cpMaskLow, cpMaskHi);
+        AddCallbackSubscriber(m_maskSubscribers, m_tracerProfiler, "Tracer", tracerMaskLow, tracerMaskHi);
+        AddCallbackSubscriber(m_maskSubscribers, m_customProfiler, "Custom", customMaskLow, customMaskHi);
+        m_callbackSubscribers.store(&m_maskSubscribers, std::memory_order_release);
+    }
+
     void CorProfiler::InspectRuntimeCompatibility(IUnknown* corProfilerInfoUnk)
     {
         if (corProfilerInfoUnk == nullptr)
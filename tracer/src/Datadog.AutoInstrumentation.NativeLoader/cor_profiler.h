@@ -1,6 +1,7 @@
 #pragma once
 #include "../../../shared/src/native-src/com_ptr.h"
 
+#include <array>
 #include <atomic>
 #include <corhlpr.h>
 #include <corprof.h>
@@ -16,11 +17,68 @@ namespace datadog::shared::nativeloader
 {
     class IDynamicDispatcher;
 
+    // Each callback belongs to the group of the event mask flag(s) that enables it
+    enum class CallbackGroup : int
+    {
+        All, // always sent to all profilers (lifetime, ReJIT, EventPipe...)
+        AppDomainLoads,
+        AssemblyLoads,
+        ModuleLoads,
+        ClassLoads,
+        FunctionUnloads,
+        JitCompilation,
+        CacheSearches,
+        Threads,
+        Remoting,
+        CodeTransitions,
+        Suspends,
+        Gc,
+        ObjectAllocated,
+        Exceptions,
+        Ccw,
+        AssemblyReferences,
+        InMemorySymbols,
+        DynamicFunctionUnloads,
+        Count
+    };
+
+    struct CallbackSubscriber
+    {
+        ICorProfilerCallback10* Profiler;
+        const char* Name;
+    };
+
+    // Profilers to call for each group of callbacks, in loading order
+    struct CallbackSubscribers
+    {
+        std::array<CallbackSubscriber, 3> Items;
+        int Count;
+    };
+
+    using CallbackSubscribersTable = std::array<CallbackSubscribers, static_cast<int>(CallbackGroup::Count)>;
+
     class CorProfiler : public ICorProfilerCallback10
     {
+    protected:
+        // Only the profilers that requested the events of a group in their event mask receive its callbacks.
+        // A child profiler that could not report its mask receives all callbacks.
+        // Until the masks are known (or if Initialize fails), all callbacks are sent to all profilers.
+        void UpdateCallbackSubscribers(DWORD cpMaskLow, DWORD cpMaskHi, DWORD tracerMaskLow, DWORD tracerMaskHi,
+                                       DWORD customMaskLow, DWORD customMaskHi);
+        void SetAllProfilersAsCallbackSubscribers();
+
     private:
         static CorProfiler* m_this;
 
+        // The tables are only filled during Initialize, before the runtime sends any other callback.
+        // Callbacks might then be received concurrently so they only read the published table.
+        std::atomic<const CallbackSubscribersTable*> m_callbackSubscribers;
+        CallbackSubscribersTable m_allProfilersSubscribers;
+        CallbackSubscribersTable m_maskSubscribers;
+
+        void AddCallbackSubscriber(CallbackSubscribersTable& table, ICorProfilerCallback10* profiler, const char* name,
+                                   DWORD maskLow, DWORD maskHi);
+
         std::atomic<int> m_refCount;
         IDynamicDispatcher* m_dispatcher;
         ICorProfilerCallback10* m_cpProfiler;
@@ -8,6 +8,7 @@ const shared::WSTRING TextFilePrefix = WStr("txt@");
 const shared::WSTRING ModuleMembersFileExtension = WStr(".modulemembers");
 const shared::WSTRING InstrumentedLogFileExtension = WStr(".instrlog");
 const shared::WSTRING ModulesFileName = WStr("ModulesLoaded.modules");
+const shared::WSTRING InstrumentationLogFileName = WStr("InstrumentationLog.records");
 const shared::WSTRING InstrumentedAssemblyGeneratorLogsFolder = WStr("InstrumentationVerification");
 const shared::WSTRING InstrumentedAssemblyGeneratorInputFolder = WStr("INPUT_InstrumentationLogs");
 const shared::WSTRING OriginalModulesFolder = WStr("INPUT_OriginalAssemblies");
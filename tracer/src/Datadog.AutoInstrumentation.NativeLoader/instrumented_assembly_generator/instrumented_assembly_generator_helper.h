@@ -4,6 +4,7 @@
 #include "../log.h"
 #include "../util.h"
 #include "instrumented_assembly_generator_consts.h"
+#include "instrumented_assembly_generator_log_writer.h"
 #include "method_info.h"
 #include <fstream>
 #include <iomanip>
@@ -185,49 +186,15 @@ inline void CopyOriginalModuleForInstrumentationVerification(const shared::WSTRI
     }
 }
 
+// The files are written to the instrumentation log by a background thread (see InstrumentationLogWriter)
 inline void WriteTextToFile(const shared::WSTRING& fileName, const shared::WSTRING& stringStream)
 {
-    try
-    {
-        const auto instrumentedLogsDir = GetInstrumentedAssemblyGeneratorCurrentProcessFolder();
-        const auto inputFolder = instrumentedLogsDir / InstrumentedAssemblyGeneratorInputFolder;
-        std::basic_ofstream<WCHAR> outStream;
-        outStream.exceptions(std::ofstream::badbit);
-        outStream.open(inputFolder / fileName, std::ios::out | std::ios_base::app);
-        outStream << stringStream;
-        outStream.close();
-    }
-    catch (const std::ofstream::failure& e)
-    {
-        Log::Error("WriteTextToFile: failed to write text to a file: ", fileName, " - Error: ", e.what());
-    }
-    catch (...)
-    {
-        Log::Error("WriteTextToFile: failed to write text to a file: ", fileName);
-    }
+    InstrumentationLogWriter::Instance().AppendText(fileName, stringStream);
 }
 
 inline void WriteBytesToFile(const shared::WSTRING& fileName, const unsigned char* buffer, const ULONG size)
 {
-    try
-    {
-        const auto instrumentedLogsDir = GetInstrumentedAssemblyGeneratorCurrentProcessFolder();
-        const auto inputFolder = instrumentedLogsDir / InstrumentedAssemblyGeneratorInputFolder;
-        std::ofstream outBinStream;
-        outBinStream.exceptions(std::ofstream::badbit);
-        outBinStream.open(inputFolder / fileName, std::ios::out | std::ios::binary);
-        outBinStream.write((char*) buffer, size);
-        outBinStream.close();
-    }
-    catch (std::ofstream::failure& e)
-    {
-        Log::Error("WriteBytesToFile: failed to write bytes to file, full path was: ", fileName,
-                   " - Error: ", e.what());
-    }
-    catch (...)
-    {
-        Log::Error("WriteBytesToFile: failed to write bytes to file, full path was: ", fileName);
-    }
+    InstrumentationLogWriter::Instance().WriteBytes(fileName, buffer, size);
 }
 
 inline shared::WSTRING GetLocalsTypes(const ComPtr<IMetaDataImport>& metadataImport, LPCBYTE pbNewILMethodHeader)
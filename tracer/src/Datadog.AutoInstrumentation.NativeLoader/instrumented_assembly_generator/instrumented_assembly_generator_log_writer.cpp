@@ -0,0 +1,147 @@
+#include "instrumented_assembly_generator_log_writer.h"
+#include "instrumented_assembly_generator_helper.h"
+
+namespace instrumented_assembly_generator
+{
+InstrumentationLogWriter::InstrumentationLogWriter(fs::path logFilePath) : m_logFilePath(std::move(logFilePath))
+{
+}
+
+InstrumentationLogWriter::~InstrumentationLogWriter()
+{
+    Stop();
+}
+
+InstrumentationLogWriter& InstrumentationLogWriter::Instance()
+{
+    // Never destroyed: the writer thread is joined in Stop, not while the module is unloading
+    static auto* instance = new InstrumentationLogWriter();
+    return *instance;
+}
+
+void InstrumentationLogWriter::AppendText(const shared::WSTRING& fileName, const shared::WSTRING& text)
+{
+    Enqueue({RecordKind::Text, shared::ToString(fileName), shared::ToString(text)});
+}
+
+void InstrumentationLogWriter::WriteBytes(const shared::WSTRING& fileName, const unsigned char* buffer,
+                                          const ULONG size)
+{
+    Enqueue({RecordKind::Bytes, shared::ToString(fileName), std::string(reinterpret_cast<const char*>(buffer), size)});
+}
+
+void InstrumentationLogWriter::Enqueue(Record&& record)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    if (!m_isStarted && !m_isStopped)
+    {
+        try
+        {
+            if (m_logFilePath.empty())
+            {
+                m_logFilePath = GetInstrumentedAssemblyGeneratorCurrentProcessFolder() /
+                                InstrumentedAssemblyGeneratorInputFolder / InstrumentationLogFileName;
+            }
+
+            m_stream.exceptions(std::ofstream::badbit);
+            m_stream.open(m_logFilePath, std::ios::out | std::ios::binary | std::ios::app);
+            m_writerThread = std::thread(&InstrumentationLogWriter::WriteRecords, this);
+            m_isStarted = true;
+        }
+        catch (const std::exception& e)
+        {
+            Log::Error("InstrumentationLogWriter: failed to open the instrumentation log. Error: ", e.what());
+            m_isStopped = true;
+        }
+    }
+
+    m_spaceAvailable.wait(lock, [this] { return m_isStopped || m_records.size() < MaxQueuedRecords; });
+
+    if (m_isStopped)
+    {
+        Log::Debug("InstrumentationLogWriter: the log is closed, dropping the record for ", record.fileName);
+        return;
+    }
+
+    m_records.push_back(std::move(record));
+    m_recordsAvailable.notify_one();
+}
+
+void InstrumentationLogWriter::WriteRecords()
+{
+    std::deque<Record> records;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_recordsAvailable.wait(lock, [this] { return m_isStopped || !m_records.empty(); });
+
+            if (m_records.empty())
+            {
+                // Stopped and drained
+                break;
+            }
+
+            records.swap(m_records);
+        }
+
+        m_spaceAvailable.notify_all();
+
+        for (const auto& record : records)
+        {
+            WriteRecord(record);
+        }
+
+        records.clear();
+        m_stream.flush();
+    }
+
+    m_stream.close();
+}
+
+void InstrumentationLogWriter::WriteRecord(const Record& record)
+{
+    const auto writeInt32 = [this](uint32_t value) {
+        const char bytes[] = {static_cast<char>(value), static_cast<char>(value >> 8), static_cast<char>(value >> 16),
+                              static_cast<char>(value >> 24)};
+        m_stream.write(bytes, sizeof(bytes));
+    };
+
+    try
+    {
+        m_stream.put(static_cast<char>(record.kind));
+        writeInt32(static_cast<uint32_t>(record.fileName.size()));
+        m_stream.write(record.fileName.data(), record.fileName.size());
+        writeInt32(static_cast<uint32_t>(record.payload.size()));
+        m_stream.write(record.payload.data(), record.payload.size());
+    }
+    catch (const std::ofstream::failure& e)
+    {
+        Log::Error("InstrumentationLogWriter: failed to write the record for ", record.fileName, " - Error: ",
+                   e.what());
+    }
+}
+
+void InstrumentationLogWriter::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_isStopped)
+        {
+            return;
+        }
+
+        m_isStopped = true;
+    }
+
+    m_recordsAvailable.notify_one();
+    m_spaceAvailable.notify_all();
+
+    if (m_writerThread.joinable())
+    {
+        m_writerThread.join();
+    }
+}
+} // namespace instrumented_assembly_generator
@@ -0,0 +1,68 @@
+#pragma once
+#include <condition_variable>
+#include <corhlpr.h>
+#include <corprof.h>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "../../../../shared/src/native-src/dd_filesystem.hpp"
+#include "../../../../shared/src/native-src/string.h"
+
+namespace instrumented_assembly_generator
+{
+// Writes the instrumentation verification records to a single log file per process (InstrumentationLogFileName).
+// The JIT and ReJIT threads only copy their record to a bounded queue, a background thread appends them to the file.
+//
+// Each record is: kind (1 byte), file name length (int32) and UTF-8 bytes, payload length (int32) and bytes.
+// Integers are little endian. The managed Datadog.InstrumentedAssemblyGenerator expands the log back to one file
+// per record file name: Text records are appended to their file, Bytes records replace its content.
+class InstrumentationLogWriter
+{
+private:
+    enum class RecordKind : uint8_t
+    {
+        Text = 0,
+        Bytes = 1,
+    };
+
+    struct Record
+    {
+        RecordKind kind;
+        std::string fileName;
+        std::string payload;
+    };
+
+    static const size_t MaxQueuedRecords = 4096;
+
+    std::mutex m_lock;
+    std::condition_variable m_recordsAvailable;
+    std::condition_variable m_spaceAvailable;
+    std::deque<Record> m_records;
+    std::thread m_writerThread;
+    // Empty until the first record for the process log (the folder depends on the process)
+    fs::path m_logFilePath;
+    std::ofstream m_stream;
+    bool m_isStarted = false;
+    bool m_isStopped = false;
+
+    void Enqueue(Record&& record);
+    void WriteRecords();
+    void WriteRecord(const Record& record);
+
+public:
+    InstrumentationLogWriter() = default;
+    explicit InstrumentationLogWriter(fs::path logFilePath);
+    ~InstrumentationLogWriter();
+
+    static InstrumentationLogWriter& Instance();
+
+    void AppendText(const shared::WSTRING& fileName, const shared::WSTRING& text);
+    void WriteBytes(const shared::WSTRING& fileName, const unsigned char* buffer, ULONG size);
+
+    // Writes the queued records and closes the log, the records enqueued afterwards are dropped
+    void Stop();
+};
+} // namespace instrumented_assembly_generator
@@ -0,0 +1,3 @@
+using System.Runtime.CompilerServices;
+
+[assembly: InternalsVisibleTo("Datadog.Trace.Tests, PublicKey=002400000480000094000000060200000024000052534131000400000100010071199d8b058c0eb78fce058d551fdaa764da7336f3b23a5e71cd013dcaf4b6693de5a398a2f2cddc05484bb55622034dd64ad75aa23adad8fde3b01b6e212254963f081ea86c7dae6c4800500dde59e268e7f9e4eec2e0437b662a39db7a5fbf3b0a789da7aa0151b7b6336fcc82cd7a149df7f666f5396c8de92ca644d7a2d1")]
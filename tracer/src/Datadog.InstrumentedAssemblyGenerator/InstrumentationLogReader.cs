@@ -0,0 +1,75 @@
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace Datadog.InstrumentedAssemblyGenerator
+{
+    /// <summary>
+    /// Reads the single instrumentation log written by the native loader (InstrumentationLogWriter)
+    /// and expands it to the files the generator reads (one file per record file name).
+    /// </summary>
+    internal static class InstrumentationLogReader
+    {
+        private const byte TextRecord = 0;
+        private const byte BytesRecord = 1;
+
+        /// <summary>
+        /// Expands the instrumentation log of the input folder, if any.
+        /// Text records are appended to their file and Bytes records replace its content,
+        /// the files are recreated on each expansion so it can be run again on the same input.
+        /// </summary>
+        /// <returns>The number of records that were expanded</returns>
+        internal static int Expand(string inputFolder)
+        {
+            string logPath = Path.Combine(inputFolder, InstrumentedAssemblyGeneratorConsts.InstrumentationLogFileName);
+            if (!File.Exists(logPath))
+            {
+                return 0;
+            }
+
+            var expandedFiles = new HashSet<string>();
+            int records = 0;
+
+            using (var reader = new BinaryReader(File.OpenRead(logPath), Encoding.UTF8))
+            {
+                try
+                {
+                    while (reader.BaseStream.Position < reader.BaseStream.Length)
+                    {
+                        byte kind = reader.ReadByte();
+                        string fileName = Encoding.UTF8.GetString(reader.ReadBytes(reader.ReadInt32()));
+                        int payloadLength = reader.ReadInt32();
+                        byte[] payload = reader.ReadBytes(payloadLength);
+
+                        if (payload.Length != payloadLength)
+                        {
+                            throw new EndOfStreamException();
+                        }
+
+                        if (kind != TextRecord && kind != BytesRecord)
+                        {
+                            Logger.Warn($"Unknown record kind {kind} in the instrumentation log {logPath}");
+                            break;
+                        }
+
+                        string filePath = Path.Combine(inputFolder, fileName);
+                        bool append = !expandedFiles.Add(filePath) && kind == TextRecord;
+                        using (var stream = new FileStream(filePath, append ? FileMode.Append : FileMode.Create, FileAccess.Write))
+                        {
+                            stream.Write(payload, 0, payload.Length);
+                        }
+
+                        records++;
+                    }
+                }
+                catch (EndOfStreamException)
+                {
+                    // The process exited while the record was written
+                    Logger.Warn($"The instrumentation log {logPath} ends with a truncated record");
+                }
+            }
+
+            return records;
+        }
+    }
+}
@@ -34,6 +34,7 @@ namespace Datadog.InstrumentedAssemblyGenerator
         /// <returns>The list of instrumented assemblies that were generated, and the list of methods that were instrumented in each.</returns>
         public static List<(string modulePath, List<string> methods)> Generate(AssemblyGeneratorArgs assemblyGeneratorArgs)
         {
+            ExpandInstrumentationLog(assemblyGeneratorArgs);
             ValidateInputFolders(assemblyGeneratorArgs);
             CreateOutputFolders(assemblyGeneratorArgs);
 
@@ -56,6 +57,20 @@ namespace Datadog.InstrumentedAssemblyGenerator
             return assemblyGenerator.ExportedModulesPathAndMethods;
         }
 
+        private static void ExpandInstrumentationLog(AssemblyGeneratorArgs args)
+        {
+            if (!Directory.Exists(args.InstrumentationInputLogs))
+            {
+                return;
+            }
+
+            int records = InstrumentationLogReader.Expand(args.InstrumentationInputLogs);
+            if (records > 0)
+            {
+                Logger.Info($"Expanded {records} records of the instrumentation log in {args.InstrumentationInputLogs}");
+            }
+        }
+
         private static void ValidateInputFolders(AssemblyGeneratorArgs args)
         {
             if (!Directory.Exists(args.InstrumentationInputLogs))
@@ -18,6 +18,7 @@ namespace Datadog.InstrumentedAssemblyGenerator
         internal const string InstrumentedLogFileExtension = ".instrlog";
         internal const string ModuleMembersFileExtension = ".modulemembers";
         internal const string ModulesFileName = "ModulesLoaded.modules";
+        internal const string InstrumentationLogFileName = "InstrumentationLog.records";
         internal const string InstrumentedMethodsInstructionsFolderName = "InstrumentedMethodsInstructions";
     }
 }
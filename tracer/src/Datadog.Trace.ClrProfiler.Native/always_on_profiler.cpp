@@ -1,8 +1,11 @@
 // We want to use std::min, not the windows.h macro
 #define NOMINMAX
 #include "always_on_profiler.h"
+#include "always_on_profiler_pprof.h"
 #include "logger.h"
 #include <chrono>
+#include <cstring>
+#include <fstream>
 #include <map>
 #include <algorithm>
 #include <shared_mutex>
@@ -31,6 +34,13 @@ constexpr auto kDefaultMaxAllocsPerMinute = 200;
 // variable)
 constexpr auto kMaxFunctionNameCacheSize = 5000;
 constexpr auto kMaxVolatileFunctionNameCacheSize = 2000;
+constexpr auto kMaxSourceLineCacheSize = 10000;
+
+// Larger PDB files are not loaded to bound the memory used for line numbers
+constexpr auto kMaxPdbFileSize = 32 * 1024 * 1024;
+
+// COR_DEBUG_IL_TO_NATIVE_MAP offset of the prolog (CorDebugIlToNativeMappingTypes::PROLOG)
+constexpr auto kPrologILOffset = static_cast<ULONG32>(-2);
 
 
 // If you squint you can make out that the original bones of this came from sample code provided by the dotnet project:
@@ -41,6 +51,12 @@ static std::mutex cpu_buffer_lock = std::mutex();
 static std::vector<unsigned char>* cpu_buffer_a;
 static std::vector<unsigned char>* cpu_buffer_b;
 
+static std::mutex pprof_encoder_lock = std::mutex();
+static always_on_profiler::ThreadSamplesPprofEncoder pprof_encoder;
+static std::vector<unsigned char> pprof_buffer;
+// Frames count of the profile kept in pprof_buffer until it is read with a large enough buffer, -1 if none is pending
+static int32_t pprof_pending_frames = -1;
+
 static std::mutex allocation_buffer_lock = std::mutex();
 static std::vector<unsigned char>* allocation_buffer = new std::vector<unsigned char>();
 
@@ -71,6 +87,23 @@ void ThreadSamplingRecordProducedThreadSample(std::vector<unsigned char>* buf)
         delete buf; // needs to be dropped now
     }
 }
+// Can return nullptr if none are pending, the caller deletes the returned buffer
+static std::vector<unsigned char>* ThreadSamplingTakeOneThreadSample()
+{
+    std::lock_guard<std::mutex> guard(cpu_buffer_lock);
+    std::vector<unsigned char>* to_use = nullptr;
+    if (cpu_buffer_a != nullptr)
+    {
+        to_use = cpu_buffer_a;
+        cpu_buffer_a = nullptr;
+    }
+    else if (cpu_buffer_b != nullptr)
+    {
+        to_use = cpu_buffer_b;
+        cpu_buffer_b = nullptr;
+    }
+    return to_use;
+}
 // Can return 0 if none are pending
 int32_t ThreadSamplingConsumeOneThreadSample(int32_t len, unsigned char* buf)
 {
@@ -79,20 +112,7 @@ int32_t ThreadSamplingConsumeOneThreadSample(int32_t len, unsigned char* buf)
         trace::Logger::Warn("Unexpected 0/null buffer to ThreadSampling_ConsumeOneThreadSample");
         return 0;
     }
-    std::vector<unsigned char>* to_use = nullptr;
-    {
-        std::lock_guard<std::mutex> guard(cpu_buffer_lock);
-        if (cpu_buffer_a != nullptr)
-        {
-            to_use = cpu_buffer_a;
-            cpu_buffer_a = nullptr;
-        }
-        else if (cpu_buffer_b != nullptr)
-        {
-            to_use = cpu_buffer_b;
-            cpu_buffer_b = nullptr;
-        }
-    }
+    std::vector<unsigned char>* to_use = ThreadSamplingTakeOneThreadSample();
     if (to_use == nullptr)
     {
         return 0;
@@ -103,6 +123,50 @@ int32_t ThreadSamplingConsumeOneThreadSample(int32_t len, unsigned char* buf)
     return static_cast<int32_t>(to_use_len);
 }
 
+// Can return 0 if none are pending or if the pending batch has no sample to export.
+// Returns the negated size of the profile if buf is too small, the profile is kept for the next call.
+int32_t ThreadSamplingConsumeOneThreadSampleAsPprof(int32_t len, unsigned char* buf, int64_t samplingPeriodMillis,
+                                                    int32_t* frameCount)
+{
+    if (len <= 0 || buf == nullptr || frameCount == nullptr)
+    {
+        trace::Logger::Warn("Unexpected 0/null buffer to ThreadSampling_ConsumeOneThreadSampleAsPprof");
+        return 0;
+    }
+    *frameCount = 0;
+
+    std::lock_guard<std::mutex> guard(pprof_encoder_lock);
+    if (pprof_pending_frames < 0)
+    {
+        std::vector<unsigned char>* to_use = ThreadSamplingTakeOneThreadSample();
+        if (to_use == nullptr)
+        {
+            return 0;
+        }
+
+        const int32_t encodedFrames =
+            pprof_encoder.Encode(to_use->data(), to_use->size(), samplingPeriodMillis, &pprof_buffer);
+        delete to_use;
+
+        if (pprof_buffer.empty())
+        {
+            return 0;
+        }
+        pprof_pending_frames = encodedFrames;
+    }
+
+    if (pprof_buffer.size() > static_cast<size_t>(len))
+    {
+        // a truncated profile can't be parsed: the caller retries with the returned size
+        trace::Logger::Debug("Thread samples profile of ", pprof_buffer.size(), " bytes kept, buffer is too small.");
+        return -static_cast<int32_t>(pprof_buffer.size());
+    }
+    memcpy(buf, pprof_buffer.data(), pprof_buffer.size());
+    *frameCount = pprof_pending_frames;
+    pprof_pending_frames = -1;
+    return static_cast<int32_t>(pprof_buffer.size());
+}
+
 void AllocationSamplingAppendToBuffer(int32_t appendLen, unsigned char* appendBuf)
 {
     if (appendLen <= 0 || appendBuf == NULL)
@@ -166,14 +230,19 @@ namespace always_on_profiler
 * since the number of frames is not known up-front.
 * 
 * Each buffer can be parsed/decoded independently; the codes and the LRU NameCache are not related.
+*
+* Source lines can't be resolved while the runtime is suspended (PDB files are read), so they are written after
+* all the samples (0x09): an int frameCount then, for each frame of the batch in order, a coded file string
+* (same trick as the frame strings, with its own codes; 0 if the line is unknown) followed by an int line if known.
 */
 
-// defined op codes
+// defined op codes (if you change these, change always_on_profiler_pprof.cpp too)
 constexpr auto kThreadSamplesStartBatch = 0x01;
 constexpr auto kThreadSamplesStartSample = 0x02;
 constexpr auto kThreadSamplesEndBatch = 0x06;
 constexpr auto kThreadSamplesFinalStats = 0x07;
 constexpr auto kAllocationSample = 0x08;
+constexpr auto kThreadSamplesFrameLines = 0x09;
 
 constexpr auto kCurrentThreadSamplesBufferVersion = 1;
 
@@ -229,6 +298,12 @@ void ThreadSamplesBuffer::RecordFrame(FunctionID fid, const shared::WSTRING& fra
     CHECK_SAMPLES_BUFFER_LENGTH()
     WriteCodedFrameString(fid, frame);
 }
+void ThreadSamplesBuffer::RecordFrame(const FrameAddress& address, const shared::WSTRING& frame)
+{
+    CHECK_SAMPLES_BUFFER_LENGTH()
+    WriteCodedFrameString(address.function_id, frame);
+    frame_addresses_.push_back(address);
+}
 void ThreadSamplesBuffer::EndSample() const
 {
     CHECK_SAMPLES_BUFFER_LENGTH()
@@ -249,6 +324,49 @@ void ThreadSamplesBuffer::WriteFinalStats(const SamplingStatistics& stats) const
     WriteInt(stats.name_cache_misses);
 }
 
+void ThreadSamplesBuffer::WriteFrameLines(LineNumberResolver& resolver)
+{
+    CHECK_SAMPLES_BUFFER_LENGTH()
+    if (frame_addresses_.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(resolver.lock_);
+    resolver.ClearFunctionCode();
+
+    WriteByte(kThreadSamplesFrameLines);
+    WriteInt(static_cast<int32_t>(frame_addresses_.size()));
+    std::unordered_map<const shared::WSTRING*, int> file_codes;
+    for (const auto& address : frame_addresses_)
+    {
+        const shared::WSTRING* file = nullptr;
+        const int32_t line = resolver.Resolve(address, &file);
+        if (line == 0 || file == nullptr || file->empty())
+        {
+            WriteShort(0);
+            continue;
+        }
+
+        const auto found = file_codes.find(file);
+        if (found != file_codes.end())
+        {
+            WriteShort(static_cast<int16_t>(found->second));
+        }
+        else
+        {
+            const int code = static_cast<int>(file_codes.size()) + 1;
+            if (file_codes.size() + 1 < kMaxCodesPerBuffer)
+            {
+                file_codes[file] = code;
+            }
+            WriteShort(static_cast<int16_t>(-code));
+            WriteString(*file);
+        }
+        WriteInt(line);
+    }
+}
+
 void ThreadSamplesBuffer::WriteCodedFrameString(FunctionID fid, const shared::WSTRING& str)
 {
     const auto found = codes_.find(fid);
@@ -497,7 +615,8 @@ void NamingHelper::GetFunctionName(FunctionIdentifier function_identifier, share
     }
 }
 
-shared::WSTRING* NamingHelper::Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame, SamplingStatistics & stats)
+shared::WSTRING* NamingHelper::Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame, SamplingStatistics & stats,
+                                      FunctionIdentifier* function_identifier_result)
 {
     // This method is using two layers of caching
     // 1st layer depends on FunctionID which is volatile (and valid only within one thread suspension)
@@ -508,10 +627,18 @@ shared::WSTRING* NamingHelper::Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame,
     if (volatile_answer.first != nullptr)
     {
         function_name_cache_.Refresh(volatile_answer.second);
+        if (function_identifier_result != nullptr)
+        {
+            *function_identifier_result = volatile_answer.second;
+        }
         return volatile_answer.first;
     }
 
     const auto function_identifier = this->GetFunctionIdentifier(fid, frame);
+    if (function_identifier_result != nullptr)
+    {
+        *function_identifier_result = function_identifier;
+    }
 
     shared::WSTRING* answer = function_name_cache_.Get(function_identifier);
     if (answer != nullptr)
@@ -530,6 +657,231 @@ shared::WSTRING* NamingHelper::Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame,
     return answer;
 }
 
+LineNumberResolver::LineNumberResolver() : source_line_cache_(kMaxSourceLineCacheSize, SourceLine{0, -1})
+{
+}
+
+void LineNumberResolver::StartBatch()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    unloaded_modules_.clear();
+}
+
+int32_t LineNumberResolver::Resolve(const FrameAddress& address, const shared::WSTRING** file)
+{
+    *file = nullptr;
+    // dynamic methods have no method definition
+    if (address.function_id == 0 || address.module_id == 0 || RidFromToken(address.function_token) == 0 ||
+        unloaded_modules_.find(address.module_id) != unloaded_modules_.end())
+    {
+        return 0;
+    }
+
+    const FunctionCode& function_code = GetFunctionCode(address.function_id);
+
+    // the IL offset is found with the map of the native code version (e.g. tier) containing the ip
+    bool found = false;
+    uint32_t il_offset = 0;
+    for (const auto& version : function_code.versions)
+    {
+        bool in_version = false;
+        ULONG32 native_offset = 0;
+        for (const auto& code : version.code)
+        {
+            if (address.ip >= code.startAddress && address.ip - code.startAddress < code.size)
+            {
+                native_offset += static_cast<ULONG32>(address.ip - code.startAddress);
+                in_version = true;
+                break;
+            }
+            // the offsets of the cold code follow the hot code
+            native_offset += static_cast<ULONG32>(code.size);
+        }
+        if (!in_version)
+        {
+            continue;
+        }
+
+        for (const auto& entry : version.il_map)
+        {
+            if (native_offset >= entry.nativeStartOffset && native_offset < entry.nativeEndOffset &&
+                (entry.ilOffset == kPrologILOffset || static_cast<int32_t>(entry.ilOffset) >= 0))
+            {
+                il_offset = entry.ilOffset == kPrologILOffset ? 0 : entry.ilOffset;
+                found = true;
+                break;
+            }
+        }
+        break;
+    }
+    if (!found)
+    {
+        return 0;
+    }
+
+    const SourceLineKey key{address.module_id, address.function_token, il_offset};
+    SourceLine source_line = source_line_cache_.Get(key);
+    if (source_line.line < 0)
+    {
+        const auto pdb = GetPdb(address.module_id);
+        if (pdb == nullptr || !pdb->GetSourceLine(RidFromToken(address.function_token), il_offset,
+                                                  source_line.document, source_line.line))
+        {
+            source_line = SourceLine{0, 0};
+        }
+        source_line_cache_.Put(key, source_line);
+    }
+
+    const auto pdb = source_line.document != 0 ? GetPdb(address.module_id) : nullptr;
+    if (pdb == nullptr)
+    {
+        return 0;
+    }
+    *file = &pdb->GetDocumentName(source_line.document);
+    return source_line.line;
+}
+
+void LineNumberResolver::ClearFunctionCode()
+{
+    function_code_.clear();
+}
+
+void LineNumberResolver::ModuleUnloadStarted(ModuleID module_id)
+{
+    // waits for the batch being resolved, the FunctionIDs of the module are used until then
+    std::lock_guard<std::mutex> guard(lock_);
+    unloaded_modules_.insert(module_id);
+    if (pdbs_.erase(module_id) > 0)
+    {
+        // the lines are cached by ModuleID, which can be reused by the next loaded module
+        source_line_cache_.Clear();
+    }
+}
+
+const LineNumberResolver::FunctionCode& LineNumberResolver::GetFunctionCode(FunctionID function_id)
+{
+    const auto found = function_code_.find(function_id);
+    if (found != function_code_.end())
+    {
+        return found->second;
+    }
+
+    FunctionCode& function_code = function_code_[function_id];
+
+    // native code versions of the original IL only (ReJITID 0)
+    ULONG32 count = 0;
+    HRESULT hr = info10_->GetNativeCodeStartAddresses(function_id, 0, 0, &count, nullptr);
+    if (FAILED(hr) || count == 0)
+    {
+        return function_code;
+    }
+    std::vector<UINT_PTR> code_start_addresses(count);
+    hr = info10_->GetNativeCodeStartAddresses(function_id, 0, count, &count, code_start_addresses.data());
+    if (FAILED(hr))
+    {
+        return function_code;
+    }
+    code_start_addresses.resize(std::min(static_cast<size_t>(count), code_start_addresses.size()));
+
+    for (const auto code_start_address : code_start_addresses)
+    {
+        NativeCodeVersion version;
+        ULONG32 code_count = 0;
+        ULONG32 map_count = 0;
+        if (FAILED(info10_->GetCodeInfo4(code_start_address, 0, &code_count, nullptr)) ||
+            FAILED(info10_->GetILToNativeMapping3(code_start_address, 0, &map_count, nullptr)))
+        {
+            continue;
+        }
+
+        version.code.resize(code_count);
+        version.il_map.resize(map_count);
+        if (FAILED(info10_->GetCodeInfo4(code_start_address, code_count, &code_count, version.code.data())) ||
+            FAILED(info10_->GetILToNativeMapping3(code_start_address, map_count, &map_count, version.il_map.data())))
+        {
+            continue;
+        }
+        version.code.resize(std::min(static_cast<size_t>(code_count), version.code.size()));
+        version.il_map.resize(std::min(static_cast<size_t>(map_count), version.il_map.size()));
+        function_code.versions.push_back(std::move(version));
+    }
+
+    return function_code;
+}
+
+PortablePdb* LineNumberResolver::GetPdb(ModuleID module_id)
+{
+    const auto found = pdbs_.find(module_id);
+    if (found != pdbs_.end())
+    {
+        return found->second.get();
+    }
+
+    // stays null if the PDB can't be used, so it is only looked for once
+    auto& pdb = pdbs_[module_id];
+
+    const DWORD module_path_size = 260;
+    WCHAR module_path[module_path_size]{};
+    DWORD module_path_len = 0;
+    LPCBYTE base_load_address = nullptr;
+    AssemblyID assembly_id = 0;
+    DWORD module_flags = 0;
+    const HRESULT hr = info10_->GetModuleInfo2(module_id, &base_load_address, module_path_size, &module_path_len,
+                                               module_path, &assembly_id, &module_flags);
+    if (FAILED(hr) || module_path_len == 0 || base_load_address == nullptr ||
+        (module_flags & COR_PRF_MODULE_DYNAMIC) != 0)
+    {
+        return nullptr;
+    }
+
+    shared::WSTRING pdb_path(module_path);
+    const auto extension = pdb_path.find_last_of(WStr("."));
+    const auto separator = pdb_path.find_last_of(WStr("/\\"));
+    if (extension == shared::WSTRING::npos || (separator != shared::WSTRING::npos && extension < separator))
+    {
+        return nullptr;
+    }
+    pdb_path.replace(extension, shared::WSTRING::npos, WStr(".pdb"));
+
+#ifdef _WIN32
+    std::ifstream stream(pdb_path, std::ios::in | std::ios::binary | std::ios::ate);
+#else
+    std::ifstream stream(shared::ToString(pdb_path), std::ios::in | std::ios::binary | std::ios::ate);
+#endif
+    if (!stream.is_open())
+    {
+        return nullptr;
+    }
+
+    const auto size = static_cast<std::streamoff>(stream.tellg());
+    if (size <= 0 || size > kMaxPdbFileSize)
+    {
+        trace::Logger::Debug("AlwaysOnProfiler: skipping the PDB of ", size, " bytes ", pdb_path);
+        return nullptr;
+    }
+
+    std::vector<unsigned char> data(static_cast<size_t>(size));
+    stream.seekg(0);
+    if (!stream.read(reinterpret_cast<char*>(data.data()), size))
+    {
+        return nullptr;
+    }
+
+    auto portable_pdb = std::make_unique<PortablePdb>();
+    unsigned char module_pdb_guid[16];
+    if (!portable_pdb->Load(std::move(data)) ||
+        !GetCodeViewGuid(base_load_address, (module_flags & COR_PRF_MODULE_FLAT_LAYOUT) != 0, module_pdb_guid) ||
+        memcmp(module_pdb_guid, portable_pdb->Guid(), sizeof(module_pdb_guid)) != 0)
+    {
+        trace::Logger::Debug("AlwaysOnProfiler: not a portable PDB or not matching its module ", pdb_path);
+        return nullptr;
+    }
+
+    trace::Logger::Debug("AlwaysOnProfiler: loaded ", pdb_path);
+    pdb = std::move(portable_pdb);
+    return pdb.get();
+}
+
 // This is slightly messy since we an only pass one parameter to the FrameCallback 
 // but we have some slightly different use cases (but want to use the same stack capture
 // code for allocations and paused thread samples)
@@ -537,7 +889,11 @@ struct DoStackSnapshotParams
 {
     AlwaysOnProfiler* prof;
     ThreadSamplesBuffer* buffer;
-    DoStackSnapshotParams(AlwaysOnProfiler* p, ThreadSamplesBuffer* b) : prof(p), buffer(b)
+    // only the thread samples have line numbers, see ThreadSamplesBuffer::WriteFrameLines
+    bool record_frame_addresses;
+    bool is_leaf_frame = true;
+    DoStackSnapshotParams(AlwaysOnProfiler* p, ThreadSamplesBuffer* b, bool r) :
+        prof(p), buffer(b), record_frame_addresses(r)
     {
     }
 };
@@ -547,9 +903,24 @@ HRESULT __stdcall FrameCallback(_In_ FunctionID func_id, _In_ UINT_PTR ip, _In_
 {
     const auto params = static_cast<DoStackSnapshotParams*>(client_data);
     params->prof->stats_.total_frames++;
-    const shared::WSTRING* name = params->prof->helper.Lookup(func_id, frame_info, params->prof->stats_);
-    // This is where line numbers could be calculated
-    params->buffer->RecordFrame(func_id, *name);
+    if (params->record_frame_addresses)
+    {
+        FunctionIdentifier function_identifier{0, 0, false};
+        const shared::WSTRING* name =
+            params->prof->helper.Lookup(func_id, frame_info, params->prof->stats_, &function_identifier);
+        // The lines are resolved once the runtime is resumed. Except for the leaf frame, ip is a return address:
+        // step back into the call instruction so the line of the call is found.
+        const UINT_PTR call_ip = params->is_leaf_frame || ip == 0 ? ip : ip - 1;
+        const ModuleID module_id = function_identifier.is_valid ? function_identifier.module_id : 0;
+        params->buffer->RecordFrame(FrameAddress{func_id, call_ip, module_id, function_identifier.function_token},
+                                    *name);
+    }
+    else
+    {
+        const shared::WSTRING* name = params->prof->helper.Lookup(func_id, frame_info, params->prof->stats_);
+        params->buffer->RecordFrame(func_id, *name);
+    }
+    params->is_leaf_frame = false;
     return S_OK;
 }
 
@@ -568,7 +939,7 @@ void CaptureSamples(AlwaysOnProfiler* prof, ICorProfilerInfo10* info10)
 
     prof->helper.volatile_function_name_cache_.Clear();
     prof->cur_cpu_writer_->StartBatch();
-    DoStackSnapshotParams dssp = DoStackSnapshotParams(prof, prof->cur_cpu_writer_);
+    DoStackSnapshotParams dssp = DoStackSnapshotParams(prof, prof->cur_cpu_writer_, true);
     while ((hr = thread_enum->Next(1, &thread_id, &num_returned)) == S_OK)
     {
         prof->stats_.num_threads++;
@@ -585,6 +956,7 @@ void CaptureSamples(AlwaysOnProfiler* prof, ICorProfilerInfo10* info10)
         }
 
         // Don't reuse the hr being used for the thread enum, especially since a failed snapshot isn't fatal
+        dssp.is_leaf_frame = true;
         HRESULT snapshotHr = info10->DoStackSnapshot(thread_id, &FrameCallback, COR_PRF_SNAPSHOT_DEFAULT, &dssp, nullptr, 0);
         if (FAILED(snapshotHr))
         {
@@ -673,8 +1045,6 @@ void PauseClrAndCaptureSamples(AlwaysOnProfiler* prof, ICorProfilerInfo10* info1
     prof->cur_cpu_writer_->WriteFinalStats(prof->stats_);
     trace::Logger::Debug("Threads sampled in ", elapsed_micros, " micros. threads=", prof->stats_.num_threads,
                   " frames=", prof->stats_.total_frames, " misses=", prof->stats_.name_cache_misses);
-
-    prof->PublishBuffer();
 }
 
 void SleepMillis(int millis) {
@@ -700,7 +1070,11 @@ DWORD WINAPI SamplingThreadMain(_In_ LPVOID param)
         if (!shouldSample) {
             trace::Logger::Warn("Skipping a thread sample period, buffers are full. ** THIS WILL RESULT IN LOSS OF PROFILING DATA **");
         } else {
+            prof->line_resolver.StartBatch();
             PauseClrAndCaptureSamples(prof, info10);
+            // Once the locks used by the application threads are released: the PDB files may be read
+            prof->cur_cpu_writer_->WriteFrameLines(prof->line_resolver);
+            prof->PublishBuffer();
         }
     }
 }
@@ -710,6 +1084,7 @@ void AlwaysOnProfiler::SetGlobalInfo10(ICorProfilerInfo10* cor_profiler_info10)
     profiler_info = cor_profiler_info10;
     this->info10 = cor_profiler_info10;
     this->helper.info10_ = cor_profiler_info10;
+    this->line_resolver.info10_ = cor_profiler_info10;
 }
 
 void AlwaysOnProfiler::StartThreadSampling()
@@ -735,6 +1110,11 @@ ThreadState* AlwaysOnProfiler::GetCurrentThreadState(ThreadID tid)
     return managed_tid_to_state_[tid];
 }
 
+void AlwaysOnProfiler::ModuleUnloadStarted(ModuleID module_id)
+{
+    line_resolver.ModuleUnloadStarted(module_id);
+}
+
 // You can read about the ETW event format for AllocationTick at
 // https://docs.microsoft.com/en-us/dotnet/framework/performance/garbage-collection-etw-events#gcallocationtick_v3-event
 // or, if that is not working, a search for "GCAllocationTick ETW" will get you there.
@@ -763,7 +1143,7 @@ void CaptureAllocationStack(AlwaysOnProfiler* prof, ThreadSamplesBuffer* buffer)
     std::lock_guard<std::mutex> guard(name_cache_lock);
     // Read explanation of volatile clearing in NamingHelper::Lookup
     prof->helper.volatile_function_name_cache_.Clear();
-    DoStackSnapshotParams dssp = DoStackSnapshotParams(prof, buffer);
+    DoStackSnapshotParams dssp = DoStackSnapshotParams(prof, buffer, false);
     HRESULT hr = prof->info10->DoStackSnapshot((ThreadID) NULL, &FrameCallback, COR_PRF_SNAPSHOT_DEFAULT, &dssp, nullptr, 0);
     if (FAILED(hr))
     {
@@ -1000,6 +1380,11 @@ extern "C"
     {
         return ThreadSamplingConsumeOneThreadSample(len, buf);
     }
+    EXPORTTHIS int32_t SignalFxReadThreadSamplesPprof(int32_t len, unsigned char* buf, int64_t samplingPeriodMillis,
+                                                      int32_t* frameCount)
+    {
+        return ThreadSamplingConsumeOneThreadSampleAsPprof(len, buf, samplingPeriodMillis, frameCount);
+    }
     EXPORTTHIS int32_t SignalFxReadAllocationSamples(int32_t len, unsigned char* buf)
     {
         return AllocationSamplingConsumeAndReplaceBuffer(len, buf);
@@ -1,11 +1,14 @@
 #pragma once
 #include "always_on_profiler_clr_helpers.h"
+#include "always_on_profiler_pdb.h"
+#include <memory>
 #include <mutex>
 #include <cinttypes>
 #include <vector>
 #include <list>
 #include <utility>
 #include <unordered_map>
+#include <unordered_set>
 #include <random>
 
 constexpr auto unknown_managed_thread_id = -1;
@@ -20,6 +23,10 @@ constexpr auto unknown_managed_thread_id = -1;
 extern "C"
 {
     EXPORTTHIS int32_t SignalFxReadThreadSamples(int32_t len, unsigned char* buf);
+    // Same as SignalFxReadThreadSamples but the batch is converted to a pprof Profile.
+    // frameCount receives the number of frames of the exported samples.
+    EXPORTTHIS int32_t SignalFxReadThreadSamplesPprof(int32_t len, unsigned char* buf, int64_t samplingPeriodMillis,
+                                                      int32_t* frameCount);
     EXPORTTHIS int32_t SignalFxReadAllocationSamples(int32_t len, unsigned char* buf);
     // ReSharper disable CppInconsistentNaming
     EXPORTTHIS void SignalFxSetNativeContext(uint64_t traceIdHigh, uint64_t traceIdLow, uint64_t spanId, int32_t managedThreadId);
@@ -79,21 +86,37 @@ public:
     }
 };
 
+class LineNumberResolver;
+
+// Native code address of a sampled frame, resolved to a source line once the runtime is resumed.
+// The module and token are captured while the runtime is suspended, see LineNumberResolver::StartBatch.
+struct FrameAddress
+{
+    FunctionID function_id;
+    UINT_PTR ip;
+    ModuleID module_id;
+    mdToken function_token;
+};
 
 class ThreadSamplesBuffer
 {
 public:
     std::unordered_map<FunctionID, int> codes_;
     std::vector<unsigned char>* buffer_;
+    std::vector<FrameAddress> frame_addresses_;
 
     explicit ThreadSamplesBuffer(std::vector<unsigned char>* buf);
     ~ThreadSamplesBuffer();
     void StartBatch() const;
     void StartSample(ThreadID id, const ThreadState* state, const thread_span_context& span_context) const;
     void RecordFrame(FunctionID fid, const shared::WSTRING& frame);
+    // Same as RecordFrame, the address is kept for WriteFrameLines
+    void RecordFrame(const FrameAddress& address, const shared::WSTRING& frame);
     void EndSample() const;
     void EndBatch() const;
     void WriteFinalStats(const SamplingStatistics& stats) const;
+    // Must not be called while the runtime is suspended: the PDB files may be read
+    void WriteFrameLines(LineNumberResolver& resolver);
     void AllocationSample(uint64_t allocSize, const WCHAR* allocType, size_t allocTypeCharLen, ThreadID id, const ThreadState* state, const thread_span_context& span_context) const;
 
 private:
@@ -118,6 +141,25 @@ struct FunctionIdentifier
         return function_token == p.function_token && module_id == p.module_id && is_valid == p.is_valid;
     }
 };
+
+struct SourceLineKey
+{
+    ModuleID module_id;
+    mdMethodDef method_token;
+    uint32_t il_offset;
+
+    bool operator==(const SourceLineKey& p) const
+    {
+        return module_id == p.module_id && method_token == p.method_token && il_offset == p.il_offset;
+    }
+};
+
+struct SourceLine
+{
+    // row of the Document table of the PDB, 0 if the line is not known
+    uint32_t document;
+    int32_t line;
+};
 } // namespace always_on_profiler
 
 template <>
@@ -136,6 +178,19 @@ struct std::hash<always_on_profiler::FunctionIdentifier>
     }
 };
 
+template <>
+struct std::hash<always_on_profiler::SourceLineKey>
+{
+    std::size_t operator()(const always_on_profiler::SourceLineKey& k) const noexcept
+    {
+        const std::size_t h1 = std::hash<mdToken>()(k.method_token);
+        const std::size_t h2 = std::hash<ModuleID>()(k.module_id);
+        const std::size_t h3 = std::hash<uint32_t>()(k.il_offset);
+
+        return h1 ^ h2 ^ (h3 << 16);
+    }
+};
+
 namespace always_on_profiler
 {
 template <typename TKey, typename TValue>
@@ -167,7 +222,9 @@ public:
     NameCache<FunctionID, std::pair<shared::WSTRING*, FunctionIdentifier>> volatile_function_name_cache_;
 
     NamingHelper();
-    shared::WSTRING* Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame, SamplingStatistics & stats);
+    // function_identifier (optional) receives the module and token of the function
+    shared::WSTRING* Lookup(FunctionID fid, COR_PRF_FRAME_INFO frame, SamplingStatistics & stats,
+                            FunctionIdentifier* function_identifier = nullptr);
 
 private:
     [[nodiscard]] FunctionIdentifier GetFunctionIdentifier(const FunctionID func_id,
@@ -176,6 +233,51 @@ private:
 
 };
 
+// Resolves the IPs of the sampled frames to source lines with the portable PDB next to the module, which is
+// loaded the first time a frame of the module is resolved. Lines are cached by module, method and IL offset.
+// Frames of rejitted code are not resolved: their IL does not match the PDB.
+// The FunctionIDs of a batch are queried after the runtime is resumed. They stay valid while lock_ is held, as
+// ModuleUnloadStarted waits for it, except for the modules which started to unload since the batch was sampled:
+// their frames (and the frames of dynamic methods, which are collected independently) are not resolved.
+class LineNumberResolver
+{
+public:
+    ICorProfilerInfo10* info10_ = nullptr;
+    // Held while resolving: the file names point into the PDBs, which are dropped when their module is unloaded
+    std::mutex lock_;
+
+    LineNumberResolver();
+    // Called before the runtime is suspended to sample a batch
+    void StartBatch();
+    // Returns the line of the frame or 0 if it is not known, file receives the source file of the line
+    int32_t Resolve(const FrameAddress& address, const shared::WSTRING** file);
+    // Forgets the native code of the functions, FunctionIDs are only stable while a batch is resolved
+    void ClearFunctionCode();
+    void ModuleUnloadStarted(ModuleID module_id);
+
+private:
+    struct NativeCodeVersion
+    {
+        std::vector<COR_PRF_CODE_INFO> code;
+        std::vector<COR_DEBUG_IL_TO_NATIVE_MAP> il_map;
+    };
+
+    struct FunctionCode
+    {
+        std::vector<NativeCodeVersion> versions;
+    };
+
+    NameCache<SourceLineKey, SourceLine> source_line_cache_;
+    std::unordered_map<FunctionID, FunctionCode> function_code_;
+    // modules which started to unload since the current batch was sampled
+    std::unordered_set<ModuleID> unloaded_modules_;
+    // nullptr when the module has no matching portable PDB
+    std::unordered_map<ModuleID, std::unique_ptr<PortablePdb>> pdbs_;
+
+    const FunctionCode& GetFunctionCode(FunctionID function_id);
+    PortablePdb* GetPdb(ModuleID module_id);
+};
+
 // We can get more AllocationTick events than we reasonably want to push to the cloud; this
 // structure/logic helps us rate-control this effect.  More details about the algorithm are in the
 // implementation of ShouldSample().
@@ -211,10 +313,12 @@ public:
 
     void SetGlobalInfo10(ICorProfilerInfo10* info10);
     ThreadState* GetCurrentThreadState(ThreadID tid);
+    void ModuleUnloadStarted(ModuleID module_id);
 
     std::unordered_map<ThreadID, ThreadState*> managed_tid_to_state_;
     std::mutex thread_state_lock_;
     NamingHelper helper;
+    LineNumberResolver line_resolver;
     AllocationSubSampler* allocationSubSampler = nullptr;
 
     // These cycle every sample and/or are owned externally
@@ -232,3 +336,7 @@ bool ThreadSamplingShouldProduceThreadSample();
 void ThreadSamplingRecordProducedThreadSample(std::vector<unsigned char>* buf);
 // Can return 0 if none are pending
 int32_t ThreadSamplingConsumeOneThreadSample(int32_t len, unsigned char* buf);
+// Can return 0 if none are pending or if the pending batch has no sample to export.
+// Returns the negated size of the profile if buf is too small, the profile is kept for the next call.
+int32_t ThreadSamplingConsumeOneThreadSampleAsPprof(int32_t len, unsigned char* buf, int64_t samplingPeriodMillis,
+                                                    int32_t* frameCount);
@@ -0,0 +1,549 @@
+#include "always_on_profiler_pdb.h"
+#include <cstring>
+#include <string>
+
+namespace always_on_profiler
+{
+constexpr uint32_t kMetadataSignature = 0x424A5342; // BSJB
+constexpr auto kDocumentTable = 0x30;
+constexpr auto kMethodDebugInformationTable = 0x31;
+constexpr auto kLargeGuidHeap = 0x02;
+constexpr auto kLargeBlobHeap = 0x04;
+constexpr auto kExtraTablesData = 0x40;
+
+constexpr uint32_t kDebugDirectoryIndex = 6;
+constexpr uint32_t kDebugTypeCodeView = 2;
+constexpr uint32_t kCodeViewSignature = 0x53445352; // RSDS
+
+namespace
+{
+    // Bounds-checked little-endian reader, metadata and PE files are little-endian
+    class LittleEndianReader
+    {
+    public:
+        LittleEndianReader(const unsigned char* begin, const unsigned char* end) : position_(begin), end_(end)
+        {
+        }
+
+        const unsigned char* Position() const
+        {
+            return position_;
+        }
+
+        bool Skip(size_t length)
+        {
+            if (static_cast<size_t>(end_ - position_) < length)
+            {
+                return false;
+            }
+            position_ += length;
+            return true;
+        }
+
+        template <typename T>
+        bool Read(T& value)
+        {
+            if (static_cast<size_t>(end_ - position_) < sizeof(T))
+            {
+                return false;
+            }
+            uint64_t result = 0;
+            for (size_t i = 0; i < sizeof(T); i++)
+            {
+                result |= static_cast<uint64_t>(position_[i]) << (8 * i);
+            }
+            value = static_cast<T>(result);
+            position_ += sizeof(T);
+            return true;
+        }
+
+        bool ReadIndex(bool large, uint32_t& value)
+        {
+            if (large)
+            {
+                return Read(value);
+            }
+            uint16_t small;
+            if (!Read(small))
+            {
+                return false;
+            }
+            value = small;
+            return true;
+        }
+
+        // ECMA-335 II.23.2
+        bool ReadCompressedUnsigned(uint32_t& value)
+        {
+            int bits;
+            return ReadCompressed(value, bits);
+        }
+
+        // ECMA-335 II.23.2: the sign bit is rotated to the least significant bit
+        bool ReadCompressedSigned(int32_t& value)
+        {
+            uint32_t rotated;
+            int bits;
+            if (!ReadCompressed(rotated, bits))
+            {
+                return false;
+            }
+            value = static_cast<int32_t>(rotated >> 1);
+            if ((rotated & 1) != 0)
+            {
+                value -= 1 << (bits - 1);
+            }
+            return true;
+        }
+
+    private:
+        const unsigned char* position_;
+        const unsigned char* end_;
+
+        bool ReadCompressed(uint32_t& value, int& bits)
+        {
+            if (position_ >= end_)
+            {
+                return false;
+            }
+            const unsigned char first = position_[0];
+            if ((first & 0x80) == 0)
+            {
+                value = first;
+                bits = 7;
+                position_ += 1;
+                return true;
+            }
+            if ((first & 0xC0) == 0x80 && end_ - position_ >= 2)
+            {
+                value = (static_cast<uint32_t>(first & 0x3F) << 8) | position_[1];
+                bits = 14;
+                position_ += 2;
+                return true;
+            }
+            if ((first & 0xE0) == 0xC0 && end_ - position_ >= 4)
+            {
+                value = (static_cast<uint32_t>(first & 0x1F) << 24) | (static_cast<uint32_t>(position_[1]) << 16) |
+                        (static_cast<uint32_t>(position_[2]) << 8) | position_[3];
+                bits = 29;
+                position_ += 4;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    uint16_t ReadUInt16(const unsigned char* data)
+    {
+        return static_cast<uint16_t>(data[0] | (data[1] << 8));
+    }
+
+    uint32_t ReadUInt32(const unsigned char* data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    int CountBits(uint64_t value)
+    {
+        int count = 0;
+        for (; value != 0; value &= value - 1)
+        {
+            count++;
+        }
+        return count;
+    }
+} // namespace
+
+bool PortablePdb::Load(std::vector<unsigned char> data)
+{
+    data_ = std::move(data);
+    const unsigned char* const begin = data_.data();
+    const unsigned char* const end = begin + data_.size();
+
+    // metadata root, ECMA-335 II.24.2.1
+    LittleEndianReader root(begin, end);
+    uint32_t signature;
+    uint32_t version_length;
+    uint16_t streams;
+    if (!root.Read(signature) || signature != kMetadataSignature || !root.Skip(8) || !root.Read(version_length) ||
+        !root.Skip(version_length) || !root.Skip(2) || !root.Read(streams))
+    {
+        return false;
+    }
+
+    const unsigned char* pdb_stream = nullptr;
+    const unsigned char* tables_stream = nullptr;
+    const unsigned char* tables_stream_end = nullptr;
+    for (uint16_t i = 0; i < streams; i++)
+    {
+        uint32_t offset;
+        uint32_t size;
+        if (!root.Read(offset) || !root.Read(size) || offset > data_.size() || size > data_.size() - offset)
+        {
+            return false;
+        }
+
+        const auto name = reinterpret_cast<const char*>(root.Position());
+        const auto name_length = strnlen(name, end - root.Position());
+        // the name is null-terminated and padded to 4 bytes
+        if (!root.Skip((name_length + 4) & ~static_cast<size_t>(3)))
+        {
+            return false;
+        }
+
+        const std::string stream_name(name, name_length);
+        if (stream_name == "#Pdb")
+        {
+            pdb_stream = begin + offset;
+            if (size < sizeof(guid_))
+            {
+                return false;
+            }
+        }
+        else if (stream_name == "#~")
+        {
+            tables_stream = begin + offset;
+            tables_stream_end = tables_stream + size;
+        }
+        else if (stream_name == "#Blob")
+        {
+            blob_heap_ = begin + offset;
+            blob_heap_size_ = size;
+        }
+    }
+
+    if (pdb_stream == nullptr || tables_stream == nullptr || blob_heap_ == nullptr)
+    {
+        return false;
+    }
+    memcpy(guid_, pdb_stream, sizeof(guid_));
+
+    // #~ stream, ECMA-335 II.24.2.6
+    LittleEndianReader tables(tables_stream, tables_stream_end);
+    uint8_t heap_sizes;
+    uint64_t valid_tables;
+    if (!tables.Skip(6) || !tables.Read(heap_sizes) || !tables.Skip(1) || !tables.Read(valid_tables) ||
+        !tables.Skip(8))
+    {
+        return false;
+    }
+
+    // the type system tables live in the module, only the debug tables (starting with Document) are expected here
+    if ((valid_tables & ((static_cast<uint64_t>(1) << kDocumentTable) - 1)) != 0)
+    {
+        return false;
+    }
+
+    std::vector<uint32_t> rows(CountBits(valid_tables));
+    for (auto& row_count : rows)
+    {
+        if (!tables.Read(row_count))
+        {
+            return false;
+        }
+    }
+    if ((heap_sizes & kExtraTablesData) != 0 && !tables.Skip(4))
+    {
+        return false;
+    }
+
+    large_guid_index_ = (heap_sizes & kLargeGuidHeap) != 0;
+    large_blob_index_ = (heap_sizes & kLargeBlobHeap) != 0;
+    const size_t guid_index_size = large_guid_index_ ? 4 : 2;
+    const size_t blob_index_size = large_blob_index_ ? 4 : 2;
+
+    // Document and MethodDebugInformation are the first two debug tables, so they are stored first
+    size_t table_index = 0;
+    if ((valid_tables & (static_cast<uint64_t>(1) << kDocumentTable)) != 0)
+    {
+        document_count_ = rows[table_index++];
+    }
+    if ((valid_tables & (static_cast<uint64_t>(1) << kMethodDebugInformationTable)) != 0)
+    {
+        method_count_ = rows[table_index++];
+    }
+
+    large_document_index_ = document_count_ > 0xFFFF;
+    // Name, HashAlgorithm, Hash, Language
+    document_row_size_ = 2 * blob_index_size + 2 * guid_index_size;
+    // Document, SequencePoints
+    method_row_size_ = (large_document_index_ ? 4 : 2) + blob_index_size;
+
+    documents_ = tables.Position();
+    if (!tables.Skip(document_row_size_ * document_count_))
+    {
+        return false;
+    }
+    method_debug_information_ = tables.Position();
+    if (!tables.Skip(method_row_size_ * method_count_))
+    {
+        return false;
+    }
+
+    document_names_.resize(document_count_ + 1);
+    document_names_decoded_.resize(document_count_ + 1);
+    return true;
+}
+
+const unsigned char* PortablePdb::Guid() const
+{
+    return guid_;
+}
+
+bool PortablePdb::GetSourceLine(uint32_t method_def_rid, uint32_t il_offset, uint32_t& document, int32_t& line) const
+{
+    if (method_def_rid == 0 || method_def_rid > method_count_)
+    {
+        return false;
+    }
+
+    const unsigned char* row = method_debug_information_ + (method_def_rid - 1) * method_row_size_;
+    LittleEndianReader row_reader(row, row + method_row_size_);
+    uint32_t current_document;
+    uint32_t sequence_points_index;
+    const unsigned char* sequence_points;
+    size_t sequence_points_length;
+    if (!row_reader.ReadIndex(large_document_index_, current_document) ||
+        !row_reader.ReadIndex(large_blob_index_, sequence_points_index) || sequence_points_index == 0 ||
+        !GetBlob(sequence_points_index, sequence_points, sequence_points_length))
+    {
+        return false;
+    }
+
+    // sequence points blob, see the SequencePoints section of the specification
+    LittleEndianReader reader(sequence_points, sequence_points + sequence_points_length);
+    uint32_t local_signature;
+    if (!reader.ReadCompressedUnsigned(local_signature) ||
+        (current_document == 0 && !reader.ReadCompressedUnsigned(current_document)))
+    {
+        return false;
+    }
+
+    bool found = false;
+    bool is_first_record = true;
+    bool has_visible_point = false;
+    uint32_t offset = 0;
+    int32_t start_line = 0;
+    int32_t start_column = 0;
+    while (reader.Position() < sequence_points + sequence_points_length)
+    {
+        uint32_t delta_offset;
+        if (!reader.ReadCompressedUnsigned(delta_offset))
+        {
+            break;
+        }
+
+        if (!is_first_record && delta_offset == 0)
+        {
+            // document-record
+            if (!reader.ReadCompressedUnsigned(current_document))
+            {
+                break;
+            }
+            continue;
+        }
+
+        offset = is_first_record ? delta_offset : offset + delta_offset;
+        is_first_record = false;
+        if (offset > il_offset)
+        {
+            break;
+        }
+
+        uint32_t delta_lines;
+        int32_t delta_columns;
+        uint32_t unsigned_delta_columns;
+        if (!reader.ReadCompressedUnsigned(delta_lines))
+        {
+            break;
+        }
+        if (delta_lines == 0)
+        {
+            if (!reader.ReadCompressedUnsigned(unsigned_delta_columns))
+            {
+                break;
+            }
+            delta_columns = static_cast<int32_t>(unsigned_delta_columns);
+        }
+        else if (!reader.ReadCompressedSigned(delta_columns))
+        {
+            break;
+        }
+
+        if (delta_lines == 0 && delta_columns == 0)
+        {
+            // hidden-sequence-point-record, the previous visible line is kept
+            continue;
+        }
+
+        if (has_visible_point)
+        {
+            int32_t delta_start_line;
+            int32_t delta_start_column;
+            if (!reader.ReadCompressedSigned(delta_start_line) || !reader.ReadCompressedSigned(delta_start_column))
+            {
+                break;
+            }
+            start_line += delta_start_line;
+            start_column += delta_start_column;
+        }
+        else
+        {
+            uint32_t first_start_line;
+            uint32_t first_start_column;
+            if (!reader.ReadCompressedUnsigned(first_start_line) || !reader.ReadCompressedUnsigned(first_start_column))
+            {
+                break;
+            }
+            start_line = static_cast<int32_t>(first_start_line);
+            start_column = static_cast<int32_t>(first_start_column);
+            has_visible_point = true;
+        }
+
+        found = true;
+        document = current_document;
+        line = start_line;
+    }
+
+    return found;
+}
+
+const shared::WSTRING& PortablePdb::GetDocumentName(uint32_t document)
+{
+    if (document == 0 || document > document_count_)
+    {
+        return document_names_[0];
+    }
+    if (document_names_decoded_[document])
+    {
+        return document_names_[document];
+    }
+    document_names_decoded_[document] = true;
+
+    const unsigned char* row = documents_ + (document - 1) * document_row_size_;
+    LittleEndianReader row_reader(row, row + document_row_size_);
+    uint32_t name_index;
+    const unsigned char* name;
+    size_t name_length;
+    if (!row_reader.ReadIndex(large_blob_index_, name_index) || !GetBlob(name_index, name, name_length) ||
+        name_length == 0)
+    {
+        return document_names_[document];
+    }
+
+    // document name blob: a separator followed by the blob indexes of the UTF-8 parts to join
+    const char separator = static_cast<char>(name[0]);
+    LittleEndianReader parts(name + 1, name + name_length);
+    std::string utf8_name;
+    for (bool is_first_part = true; parts.Position() < name + name_length; is_first_part = false)
+    {
+        uint32_t part_index;
+        const unsigned char* part;
+        size_t part_length;
+        if (!parts.ReadCompressedUnsigned(part_index) || !GetBlob(part_index, part, part_length))
+        {
+            return document_names_[document];
+        }
+        if (!is_first_part && separator != 0)
+        {
+            utf8_name.push_back(separator);
+        }
+        utf8_name.append(reinterpret_cast<const char*>(part), part_length);
+    }
+
+    shared::ToWSTRING(utf8_name.data(), utf8_name.size(), document_names_[document]);
+    return document_names_[document];
+}
+
+bool PortablePdb::GetBlob(uint32_t index, const unsigned char*& blob, size_t& length) const
+{
+    if (index >= blob_heap_size_)
+    {
+        return false;
+    }
+
+    LittleEndianReader reader(blob_heap_ + index, blob_heap_ + blob_heap_size_);
+    uint32_t blob_length;
+    if (!reader.ReadCompressedUnsigned(blob_length))
+    {
+        return false;
+    }
+    blob = reader.Position();
+    length = blob_length;
+    return reader.Skip(blob_length);
+}
+
+bool GetCodeViewGuid(const unsigned char* image, bool flat_layout, unsigned char (&guid)[16])
+{
+    // The image is loaded by the runtime, so its headers are trusted and read without bounds checks
+    if (image[0] != 'M' || image[1] != 'Z')
+    {
+        return false;
+    }
+
+    const unsigned char* const pe_header = image + ReadUInt32(image + 0x3C);
+    if (ReadUInt32(pe_header) != 0x00004550) // PE\0\0
+    {
+        return false;
+    }
+    const uint16_t section_count = ReadUInt16(pe_header + 6);
+    const unsigned char* const optional_header = pe_header + 24;
+    const unsigned char* const section_headers = optional_header + ReadUInt16(pe_header + 20);
+
+    // the data directories follow the standard and NT specific fields of PE32 (0x10b) or PE32+ (0x20b)
+    const unsigned char* const debug_directory_entry =
+        optional_header + (ReadUInt16(optional_header) == 0x20b ? 112 : 96) + kDebugDirectoryIndex * 8;
+    if (debug_directory_entry + 8 > section_headers)
+    {
+        return false;
+    }
+    const uint32_t debug_directory_rva = ReadUInt32(debug_directory_entry);
+    const uint32_t debug_directory_size = ReadUInt32(debug_directory_entry + 4);
+    if (debug_directory_rva == 0)
+    {
+        return false;
+    }
+
+    // with the flat layout, RVAs have to be translated to file offsets with the section table
+    const unsigned char* debug_directory = nullptr;
+    if (!flat_layout)
+    {
+        debug_directory = image + debug_directory_rva;
+    }
+    for (uint16_t i = 0; flat_layout && i < section_count; i++)
+    {
+        const unsigned char* const section = section_headers + i * 40;
+        const uint32_t virtual_address = ReadUInt32(section + 12);
+        const uint32_t raw_size = ReadUInt32(section + 16);
+        if (debug_directory_rva >= virtual_address && debug_directory_rva - virtual_address < raw_size)
+        {
+            debug_directory = image + ReadUInt32(section + 20) + (debug_directory_rva - virtual_address);
+            break;
+        }
+    }
+    if (debug_directory == nullptr)
+    {
+        return false;
+    }
+
+    // IMAGE_DEBUG_DIRECTORY entries
+    for (uint32_t entry = 0; entry + 28 <= debug_directory_size; entry += 28)
+    {
+        const unsigned char* const debug_entry = debug_directory + entry;
+        if (ReadUInt32(debug_entry + 12) != kDebugTypeCodeView || ReadUInt32(debug_entry + 16) < 4 + sizeof(guid))
+        {
+            continue;
+        }
+
+        const unsigned char* const code_view = image + ReadUInt32(debug_entry + (flat_layout ? 24 : 20));
+        if (ReadUInt32(code_view) == kCodeViewSignature)
+        {
+            memcpy(guid, code_view + 4, sizeof(guid));
+            return true;
+        }
+    }
+
+    return false;
+}
+} // namespace always_on_profiler
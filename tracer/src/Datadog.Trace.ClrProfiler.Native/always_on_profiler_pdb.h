@@ -0,0 +1,55 @@
+#pragma once
+#include <cinttypes>
+#include <vector>
+
+#include "../../../shared/src/native-src/string.h"
+
+namespace always_on_profiler
+{
+// Minimal reader of the sequence points of a portable PDB, see
+// https://github.com/dotnet/runtime/blob/main/docs/design/specs/PortablePdb-Metadata.md
+// Only the Document and MethodDebugInformation tables are read; Windows PDBs are not supported.
+class PortablePdb
+{
+public:
+    // Returns false if data is not a portable PDB or is malformed
+    bool Load(std::vector<unsigned char> data);
+
+    // First 16 bytes of the PDB id, which match the GUID of the CodeView entry of the module
+    const unsigned char* Guid() const;
+
+    // Finds the line of the last visible sequence point at or before il_offset.
+    // document is a row of the Document table, see GetDocumentName.
+    bool GetSourceLine(uint32_t method_def_rid, uint32_t il_offset, uint32_t& document, int32_t& line) const;
+
+    // Name of a row of the Document table, empty if it is not valid
+    const shared::WSTRING& GetDocumentName(uint32_t document);
+
+private:
+    std::vector<unsigned char> data_;
+    unsigned char guid_[16]{};
+
+    const unsigned char* blob_heap_ = nullptr;
+    size_t blob_heap_size_ = 0;
+    bool large_blob_index_ = false;
+    bool large_guid_index_ = false;
+
+    const unsigned char* documents_ = nullptr;
+    uint32_t document_count_ = 0;
+    size_t document_row_size_ = 0;
+    const unsigned char* method_debug_information_ = nullptr;
+    uint32_t method_count_ = 0;
+    size_t method_row_size_ = 0;
+    bool large_document_index_ = false;
+
+    // decoded lazily, indexed by document row
+    std::vector<shared::WSTRING> document_names_;
+    std::vector<bool> document_names_decoded_;
+
+    bool GetBlob(uint32_t index, const unsigned char*& blob, size_t& length) const;
+};
+
+// Reads the GUID of the CodeView debug directory entry of a module loaded at image.
+// flat_layout tells if the image is loaded as the file (COR_PRF_MODULE_FLAT_LAYOUT) or mapped by sections.
+bool GetCodeViewGuid(const unsigned char* image, bool flat_layout, unsigned char (&guid)[16]);
+} // namespace always_on_profiler
@@ -0,0 +1,582 @@
+#include "always_on_profiler_pprof.h"
+#include "logger.h"
+#include <cstring>
+
+namespace always_on_profiler
+{
+// If you change these, change always_on_profiler.cpp too
+constexpr auto kThreadSamplesStartBatch = 0x01;
+constexpr auto kThreadSamplesStartSample = 0x02;
+constexpr auto kThreadSamplesEndBatch = 0x06;
+constexpr auto kThreadSamplesFinalStats = 0x07;
+constexpr auto kThreadSamplesFrameLines = 0x09;
+constexpr auto kCurrentThreadSamplesBufferVersion = 1;
+
+// Same as ThreadSampler.BackgroundThreadName: the managed thread exporting the samples is not reported
+constexpr auto kBackgroundThreadName = "SignalFx Profiling Sampler Thread";
+
+// pprof Profile fields, see pprof/proto/profile/profile.proto
+constexpr auto kProfileSample = 2;
+constexpr auto kProfileLocation = 4;
+constexpr auto kProfileFunction = 5;
+constexpr auto kProfileStringTable = 6;
+constexpr auto kSampleLocationId = 1;
+constexpr auto kSampleLabel = 3;
+constexpr auto kLabelKey = 1;
+constexpr auto kLabelStr = 2;
+constexpr auto kLabelNum = 3;
+constexpr auto kLocationId = 1;
+constexpr auto kLocationLine = 4;
+constexpr auto kLineFunctionId = 1;
+constexpr auto kLineLine = 2;
+constexpr auto kFunctionId = 1;
+constexpr auto kFunctionName = 2;
+constexpr auto kFunctionFilename = 4;
+
+// code of the frame and file strings which were not defined yet
+constexpr int64_t kUndefinedCode = -1;
+
+constexpr auto kWireTypeVarint = 0;
+constexpr auto kWireTypeLengthDelimited = 2;
+
+namespace
+{
+    // Reads the big-endian values written by ThreadSamplesBuffer, failing instead of reading past the end
+    class BatchReader
+    {
+    public:
+        BatchReader(const unsigned char* data, size_t length) : data_(data), length_(length)
+        {
+        }
+
+        bool ReadByte(uint8_t& value)
+        {
+            uint64_t result;
+            const bool read = ReadBigEndian(1, result);
+            value = static_cast<uint8_t>(result);
+            return read;
+        }
+
+        bool ReadShort(int16_t& value)
+        {
+            uint64_t result;
+            const bool read = ReadBigEndian(2, result);
+            value = static_cast<int16_t>(result);
+            return read;
+        }
+
+        bool ReadInt(int32_t& value)
+        {
+            uint64_t result;
+            const bool read = ReadBigEndian(4, result);
+            value = static_cast<int32_t>(result);
+            return read;
+        }
+
+        bool ReadUInt64(uint64_t& value)
+        {
+            return ReadBigEndian(8, value);
+        }
+
+        bool Skip(size_t count)
+        {
+            if (!CanRead(count))
+            {
+                return false;
+            }
+
+            position_ += count;
+            return true;
+        }
+
+        // Strings are a short length followed by the utf-16 characters
+        bool ReadString(const unsigned char*& chars, size_t& char_len)
+        {
+            int16_t len;
+            if (!ReadShort(len) || len < 0 || !CanRead(len * 2))
+            {
+                return false;
+            }
+
+            chars = data_ + position_;
+            char_len = len;
+            position_ += char_len * 2;
+            return true;
+        }
+
+    private:
+        const unsigned char* data_;
+        size_t length_;
+        size_t position_ = 0;
+
+        bool CanRead(size_t count) const
+        {
+            return length_ - position_ >= count;
+        }
+
+        bool ReadBigEndian(size_t count, uint64_t& value)
+        {
+            if (!CanRead(count))
+            {
+                return false;
+            }
+
+            value = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                value = (value << 8) | data_[position_++];
+            }
+            return true;
+        }
+    };
+
+    std::string ToHex(uint64_t value)
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string result(16, '0');
+        for (int i = 15; i >= 0; i--)
+        {
+            result[i] = digits[value & 0xF];
+            value >>= 4;
+        }
+        return result;
+    }
+} // namespace
+
+ProtobufWriter::ProtobufWriter(std::vector<unsigned char>* buffer) : buffer_(buffer)
+{
+}
+
+size_t ProtobufWriter::VarintSize(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+size_t ProtobufWriter::VarintFieldSize(int field, uint64_t value)
+{
+    return value == 0 ? 0 : VarintSize(field << 3) + VarintSize(value);
+}
+
+size_t ProtobufWriter::LengthDelimitedFieldSize(int field, size_t length)
+{
+    return VarintSize(field << 3) + VarintSize(length) + length;
+}
+
+void ProtobufWriter::WriteVarint(uint64_t value) const
+{
+    while (value >= 0x80)
+    {
+        buffer_->push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buffer_->push_back(static_cast<unsigned char>(value));
+}
+
+void ProtobufWriter::WriteVarintField(int field, uint64_t value) const
+{
+    // default values are not written
+    if (value == 0)
+    {
+        return;
+    }
+
+    WriteVarint((field << 3) | kWireTypeVarint);
+    WriteVarint(value);
+}
+
+void ProtobufWriter::WriteLengthDelimitedHeader(int field, size_t length) const
+{
+    WriteVarint((field << 3) | kWireTypeLengthDelimited);
+    WriteVarint(length);
+}
+
+void ProtobufWriter::WriteBytesField(int field, const char* bytes, size_t length) const
+{
+    WriteLengthDelimitedHeader(field, length);
+    buffer_->insert(buffer_->end(), bytes, bytes + length);
+}
+
+int32_t ThreadSamplesPprofEncoder::Encode(const unsigned char* batch, size_t length, int64_t sampling_period_millis,
+                                          std::vector<unsigned char>* output)
+{
+    output->clear();
+    strings_.clear();
+    functions_.clear();
+    locations_.clear();
+    code_functions_.clear();
+
+    const ProtobufWriter writer(output);
+
+    // 0 is reserved for the empty string
+    GetStringIndex(std::string(), writer);
+    unknown_file_name_ = GetStringIndex("unknown", writer);
+    const auto event_time_key = GetStringIndex("source.event.time", writer);
+    const auto event_period_key = GetStringIndex("source.event.period", writer);
+    const auto span_id_key = GetStringIndex("span_id", writer);
+    const auto trace_id_key = GetStringIndex("trace_id", writer);
+    const auto thread_id_key = GetStringIndex("thread.id", writer);
+    const auto thread_name_key = GetStringIndex("thread.name", writer);
+
+    // the lines are written after the samples, once the runtime is resumed
+    const bool has_frame_lines = ReadFrameLines(batch, length, writer);
+    size_t frame_index = 0;
+
+    BatchReader reader(batch, length);
+    uint64_t batch_start_millis = 0;
+    int32_t frame_count = 0;
+    bool has_samples = false;
+    bool is_valid = true;
+    uint8_t op_code;
+
+    while (is_valid && reader.ReadByte(op_code))
+    {
+        if (op_code == kThreadSamplesStartBatch)
+        {
+            int32_t version;
+            if (!reader.ReadInt(version) || version != kCurrentThreadSamplesBufferVersion ||
+                !reader.ReadUInt64(batch_start_millis))
+            {
+                trace::Logger::Warn("ThreadSamplesPprofEncoder: unexpected thread samples batch version");
+                output->clear();
+                return 0;
+            }
+        }
+        else if (op_code == kThreadSamplesStartSample)
+        {
+            int32_t managed_id;
+            const unsigned char* thread_name;
+            size_t thread_name_len;
+            uint64_t trace_id_high;
+            uint64_t trace_id_low;
+            uint64_t span_id;
+            if (!reader.ReadInt(managed_id) || !reader.ReadString(thread_name, thread_name_len) ||
+                !reader.ReadUInt64(trace_id_high) || !reader.ReadUInt64(trace_id_low) || !reader.ReadUInt64(span_id))
+            {
+                // the buffer was full
+                break;
+            }
+
+            // the name is only added to the string table once the sample is known to be exported
+            ToUtf8(thread_name, thread_name_len, thread_name_);
+            const bool is_exporting_thread = thread_name_ == kBackgroundThreadName;
+
+            sample_locations_.clear();
+            int16_t code;
+            while ((is_valid = reader.ReadShort(code)) && code != 0)
+            {
+                int64_t function_name;
+                if (code < 0)
+                {
+                    // definition of the code, followed by the frame string
+                    const unsigned char* frame;
+                    size_t frame_len;
+                    if (!(is_valid = reader.ReadString(frame, frame_len)))
+                    {
+                        break;
+                    }
+
+                    const size_t defined_code = -code;
+                    if (code_functions_.size() <= defined_code)
+                    {
+                        code_functions_.resize(defined_code + 1, kUndefinedCode);
+                    }
+                    function_name = GetStringIndex(frame, frame_len, writer);
+                    code_functions_[defined_code] = function_name;
+                }
+                else if (static_cast<size_t>(code) < code_functions_.size() &&
+                         code_functions_[code] != kUndefinedCode)
+                {
+                    function_name = code_functions_[code];
+                }
+                else
+                {
+                    trace::Logger::Warn("ThreadSamplesPprofEncoder: unknown frame code ", code);
+                    is_valid = false;
+                    break;
+                }
+
+                // frames of the samples which are not exported have lines too
+                FrameLine frame_line{0, 0};
+                if (has_frame_lines && frame_index < frame_lines_.size())
+                {
+                    frame_line = frame_lines_[frame_index];
+                }
+                frame_index++;
+                sample_locations_.push_back(GetLocationId(function_name, frame_line, writer));
+            }
+
+            // skip the incomplete samples, the empty stacks and the samples of the exporting thread
+            if (!is_valid || sample_locations_.empty() || is_exporting_thread)
+            {
+                continue;
+            }
+
+            sample_labels_.clear();
+            sample_labels_.push_back({event_time_key, 0, static_cast<int64_t>(batch_start_millis)});
+            if (span_id != 0 || trace_id_high != 0 || trace_id_low != 0)
+            {
+                sample_labels_.push_back({span_id_key, GetStringIndex(ToHex(span_id), writer), 0});
+                sample_labels_.push_back(
+                    {trace_id_key, GetStringIndex(ToHex(trace_id_high) + ToHex(trace_id_low), writer), 0});
+            }
+            sample_labels_.push_back({thread_id_key, 0, managed_id});
+            sample_labels_.push_back({thread_name_key, GetStringIndex(thread_name_, writer), 0});
+            sample_labels_.push_back({event_period_key, 0, sampling_period_millis});
+
+            WriteSample(writer);
+            frame_count += static_cast<int32_t>(sample_locations_.size());
+            has_samples = true;
+        }
+        else if (op_code == kThreadSamplesEndBatch)
+        {
+            // end batch, nothing here
+        }
+        else if (op_code == kThreadSamplesFinalStats)
+        {
+            int32_t stat;
+            for (int i = 0; i < 4 && reader.ReadInt(stat); i++)
+            {
+            }
+        }
+        else if (op_code == kThreadSamplesFrameLines)
+        {
+            // already read by ReadFrameLines, nothing follows
+            break;
+        }
+        else
+        {
+            trace::Logger::Warn("ThreadSamplesPprofEncoder: unexpected operation code ", static_cast<int>(op_code));
+            break;
+        }
+    }
+
+    if (!has_samples)
+    {
+        output->clear();
+    }
+
+    return frame_count;
+}
+
+int64_t ThreadSamplesPprofEncoder::GetStringIndex(const std::string& str, const ProtobufWriter& writer)
+{
+    const auto found = strings_.find(str);
+    if (found != strings_.end())
+    {
+        return found->second;
+    }
+
+    const auto index = static_cast<int64_t>(strings_.size());
+    strings_.emplace(str, index);
+    writer.WriteBytesField(kProfileStringTable, str.data(), str.size());
+    return index;
+}
+
+int64_t ThreadSamplesPprofEncoder::GetStringIndex(const unsigned char* utf16, size_t char_len,
+                                                  const ProtobufWriter& writer)
+{
+    ToUtf8(utf16, char_len, utf8_);
+    return GetStringIndex(utf8_, writer);
+}
+
+void ThreadSamplesPprofEncoder::ToUtf8(const unsigned char* utf16, size_t char_len, std::string& utf8)
+{
+    // the characters are copied as the strings of the batch are not aligned
+    utf16_.resize(char_len);
+    memcpy(&utf16_[0], utf16, char_len * sizeof(WCHAR));
+    shared::ToString(utf16_.data(), char_len, utf8);
+}
+
+bool ThreadSamplesPprofEncoder::ReadFrameLines(const unsigned char* batch, size_t length,
+                                               const ProtobufWriter& writer)
+{
+    frame_lines_.clear();
+    file_codes_.clear();
+
+    BatchReader reader(batch, length);
+    const unsigned char* chars;
+    size_t char_len;
+    uint8_t op_code;
+    while (reader.ReadByte(op_code))
+    {
+        if (op_code == kThreadSamplesStartBatch)
+        {
+            // version, start time
+            if (!reader.Skip(4 + 8))
+            {
+                return false;
+            }
+        }
+        else if (op_code == kThreadSamplesStartSample)
+        {
+            // managed id, thread name, trace id and span id
+            if (!reader.Skip(4) || !reader.ReadString(chars, char_len) || !reader.Skip(3 * 8))
+            {
+                return false;
+            }
+            int16_t code;
+            do
+            {
+                if (!reader.ReadShort(code) || (code < 0 && !reader.ReadString(chars, char_len)))
+                {
+                    return false;
+                }
+            } while (code != 0);
+        }
+        else if (op_code == kThreadSamplesEndBatch)
+        {
+        }
+        else if (op_code == kThreadSamplesFinalStats)
+        {
+            if (!reader.Skip(4 * 4))
+            {
+                return false;
+            }
+        }
+        else if (op_code == kThreadSamplesFrameLines)
+        {
+            // frame count, then for each frame: a coded file string (0 if unknown) followed by the line if known
+            int32_t frame_count;
+            if (!reader.ReadInt(frame_count) || frame_count < 0)
+            {
+                return false;
+            }
+            frame_lines_.reserve(frame_count);
+            for (int32_t i = 0; i < frame_count; i++)
+            {
+                int16_t code;
+                if (!reader.ReadShort(code))
+                {
+                    return false;
+                }
+
+                FrameLine frame_line{0, 0};
+                if (code < 0)
+                {
+                    if (!reader.ReadString(chars, char_len))
+                    {
+                        return false;
+                    }
+                    const size_t defined_code = -code;
+                    if (file_codes_.size() <= defined_code)
+                    {
+                        file_codes_.resize(defined_code + 1, kUndefinedCode);
+                    }
+                    file_codes_[defined_code] = GetStringIndex(chars, char_len, writer);
+                    frame_line.file = file_codes_[defined_code];
+                }
+                else if (code > 0)
+                {
+                    if (static_cast<size_t>(code) >= file_codes_.size() || file_codes_[code] == kUndefinedCode)
+                    {
+                        return false;
+                    }
+                    frame_line.file = file_codes_[code];
+                }
+
+                if (code != 0 && !reader.ReadInt(frame_line.line))
+                {
+                    return false;
+                }
+                frame_lines_.push_back(frame_line);
+            }
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+uint64_t ThreadSamplesPprofEncoder::GetLocationId(int64_t function_name, const FrameLine& frame_line,
+                                                  const ProtobufWriter& writer)
+{
+    const auto file_name = frame_line.line != 0 ? frame_line.file : unknown_file_name_;
+    const auto function_key = std::make_pair(function_name, file_name);
+    auto function_id = functions_.find(function_key);
+    if (function_id == functions_.end())
+    {
+        // ids start at 1, 0 is reserved
+        const auto id = static_cast<uint64_t>(functions_.size()) + 1;
+        function_id = functions_.emplace(function_key, id).first;
+
+        writer.WriteLengthDelimitedHeader(kProfileFunction,
+                                          ProtobufWriter::VarintFieldSize(kFunctionId, id) +
+                                              ProtobufWriter::VarintFieldSize(kFunctionName, function_name) +
+                                              ProtobufWriter::VarintFieldSize(kFunctionFilename, file_name));
+        writer.WriteVarintField(kFunctionId, id);
+        writer.WriteVarintField(kFunctionName, function_name);
+        writer.WriteVarintField(kFunctionFilename, file_name);
+    }
+
+    const auto location_key =
+        std::make_pair(static_cast<int64_t>(function_id->second), static_cast<int64_t>(frame_line.line));
+    const auto found = locations_.find(location_key);
+    if (found != locations_.end())
+    {
+        return found->second;
+    }
+
+    const auto id = static_cast<uint64_t>(locations_.size()) + 1;
+    locations_.emplace(location_key, id);
+
+    // a line of 0 (unknown) is the default value and is not written
+    const auto line_size = ProtobufWriter::VarintFieldSize(kLineFunctionId, function_id->second) +
+                           ProtobufWriter::VarintFieldSize(kLineLine, frame_line.line);
+    writer.WriteLengthDelimitedHeader(kProfileLocation, ProtobufWriter::VarintFieldSize(kLocationId, id) +
+                                                             ProtobufWriter::LengthDelimitedFieldSize(kLocationLine, line_size));
+    writer.WriteVarintField(kLocationId, id);
+    writer.WriteLengthDelimitedHeader(kLocationLine, line_size);
+    writer.WriteVarintField(kLineFunctionId, function_id->second);
+    writer.WriteVarintField(kLineLine, frame_line.line);
+
+    return id;
+}
+
+void ThreadSamplesPprofEncoder::WriteSample(const ProtobufWriter& writer) const
+{
+    const auto label_size = [](const Label& label) {
+        return ProtobufWriter::VarintFieldSize(kLabelKey, label.key) +
+               ProtobufWriter::VarintFieldSize(kLabelStr, label.str) +
+               ProtobufWriter::VarintFieldSize(kLabelNum, label.num);
+    };
+
+    size_t locations_size = 0;
+    for (const auto location : sample_locations_)
+    {
+        locations_size += ProtobufWriter::VarintSize(location);
+    }
+
+    size_t sample_size = ProtobufWriter::LengthDelimitedFieldSize(kSampleLocationId, locations_size);
+    for (const auto& label : sample_labels_)
+    {
+        sample_size += ProtobufWriter::LengthDelimitedFieldSize(kSampleLabel, label_size(label));
+    }
+
+    writer.WriteLengthDelimitedHeader(kProfileSample, sample_size);
+
+    // packed repeated field
+    writer.WriteLengthDelimitedHeader(kSampleLocationId, locations_size);
+    for (const auto location : sample_locations_)
+    {
+        writer.WriteVarint(location);
+    }
+
+    for (const auto& label : sample_labels_)
+    {
+        writer.WriteLengthDelimitedHeader(kSampleLabel, label_size(label));
+        writer.WriteVarintField(kLabelKey, label.key);
+        writer.WriteVarintField(kLabelStr, label.str);
+        writer.WriteVarintField(kLabelNum, label.num);
+    }
+}
+} // namespace always_on_profiler
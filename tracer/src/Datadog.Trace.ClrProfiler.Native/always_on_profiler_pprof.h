@@ -0,0 +1,98 @@
+#pragma once
+#include <cinttypes>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../../shared/src/native-src/string.h"
+
+namespace always_on_profiler
+{
+// Minimal streaming protobuf writer: only the varint and length-delimited wire types used by pprof.
+// Nested messages are written by computing their size first (see the *Size helpers) so nothing is buffered.
+class ProtobufWriter
+{
+public:
+    explicit ProtobufWriter(std::vector<unsigned char>* buffer);
+
+    static size_t VarintSize(uint64_t value);
+    // Size of a varint field, 0 for the default value as it is not written
+    static size_t VarintFieldSize(int field, uint64_t value);
+    // Size of a length-delimited field containing length bytes
+    static size_t LengthDelimitedFieldSize(int field, size_t length);
+
+    void WriteVarint(uint64_t value) const;
+    void WriteVarintField(int field, uint64_t value) const;
+    void WriteLengthDelimitedHeader(int field, size_t length) const;
+    void WriteBytesField(int field, const char* bytes, size_t length) const;
+
+private:
+    std::vector<unsigned char>* buffer_;
+};
+
+// Converts a ThreadSamplesBuffer batch (see always_on_profiler.cpp for the format) to a pprof Profile
+// in a single pass: strings, functions and locations are written to the profile as soon as they are first
+// used, which protobuf allows since the order of the repeated fields is preserved even when interleaved.
+//
+// When the batch ends with the lines of its frames, functions are reported per source file and locations per line.
+//
+// Each sample has the same labels as the managed ThreadSampleProcessor used to set:
+// source.event.time, span_id and trace_id (if any), thread.id, thread.name and source.event.period.
+class ThreadSamplesPprofEncoder
+{
+public:
+    // Writes the profile to output and returns the number of frames of the encoded samples.
+    // output is left empty if the batch does not contain any sample to export.
+    int32_t Encode(const unsigned char* batch, size_t length, int64_t sampling_period_millis,
+                   std::vector<unsigned char>* output);
+
+private:
+    struct Label
+    {
+        int64_t key;
+        int64_t str;
+        int64_t num;
+    };
+
+    struct FrameLine
+    {
+        int64_t file;
+        int32_t line;
+    };
+
+    struct IndexPairHash
+    {
+        size_t operator()(const std::pair<int64_t, int64_t>& pair) const noexcept
+        {
+            return std::hash<int64_t>()(pair.first) ^ (std::hash<int64_t>()(pair.second) << 1);
+        }
+    };
+
+    std::unordered_map<std::string, int64_t> strings_;
+    // function id by name and file name
+    std::unordered_map<std::pair<int64_t, int64_t>, uint64_t, IndexPairHash> functions_;
+    // location id by function id and line
+    std::unordered_map<std::pair<int64_t, int64_t>, uint64_t, IndexPairHash> locations_;
+    int64_t unknown_file_name_ = 0;
+    // function name of each frame code of the batch
+    std::vector<int64_t> code_functions_;
+    // file name of each file code and line of each frame of the batch, in the order of the samples
+    std::vector<int64_t> file_codes_;
+    std::vector<FrameLine> frame_lines_;
+
+    // reused between the samples
+    shared::WSTRING utf16_;
+    std::string utf8_;
+    std::string thread_name_;
+    std::vector<uint64_t> sample_locations_;
+    std::vector<Label> sample_labels_;
+
+    int64_t GetStringIndex(const std::string& str, const ProtobufWriter& writer);
+    int64_t GetStringIndex(const unsigned char* utf16, size_t char_len, const ProtobufWriter& writer);
+    void ToUtf8(const unsigned char* utf16, size_t char_len, std::string& utf8);
+    bool ReadFrameLines(const unsigned char* batch, size_t length, const ProtobufWriter& writer);
+    uint64_t GetLocationId(int64_t function_name, const FrameLine& frame_line, const ProtobufWriter& writer);
+    void WriteSample(const ProtobufWriter& writer) const;
+};
+} // namespace always_on_profiler
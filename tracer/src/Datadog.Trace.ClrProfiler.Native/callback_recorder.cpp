@@ -0,0 +1,482 @@
+#include "callback_recorder.h"
+
+#include "clr_helpers.h"
+#include "logger.h"
+
+namespace trace
+{
+
+namespace
+{
+    const char RecordingMagic[] = {'S', 'F', 'X', 'C', 'B', 'R', 'E', 'C'};
+
+    bool ReadByte(std::istream& stream, uint8_t& value)
+    {
+        const auto c = stream.get();
+        if (c == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+
+        value = static_cast<uint8_t>(c);
+        return true;
+    }
+
+    bool ReadInteger(std::istream& stream, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t b;
+            if (!ReadByte(stream, b))
+            {
+                return false;
+            }
+
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ReadString(std::istream& stream, shared::WSTRING& value)
+    {
+        uint64_t length;
+        if (!ReadInteger(stream, length))
+        {
+            return false;
+        }
+
+        value.clear();
+        value.reserve(length);
+        for (uint64_t i = 0; i < length; i++)
+        {
+            uint64_t c;
+            if (!ReadInteger(stream, c))
+            {
+                return false;
+            }
+            value.push_back(static_cast<WCHAR>(c));
+        }
+
+        return true;
+    }
+
+    bool ReadCallback(std::istream& stream, RecordedCallback& callback)
+    {
+        uint64_t hr_status;
+        uint64_t flag;
+        if (!ReadInteger(stream, callback.timestamp) || !ReadInteger(stream, callback.arg0) ||
+            !ReadInteger(stream, callback.arg1) || !ReadInteger(stream, callback.arg2) ||
+            !ReadInteger(stream, hr_status) || !ReadInteger(stream, flag))
+        {
+            return false;
+        }
+
+        callback.hr_status = static_cast<HRESULT>(static_cast<uint32_t>(hr_status));
+        callback.flag = static_cast<BOOL>(flag);
+        return true;
+    }
+} // namespace
+
+const char* RecordKindToString(RecordKind kind)
+{
+    switch (kind)
+    {
+        case RecordKind::RuntimeInformation:
+            return "RuntimeInformation";
+        case RecordKind::AssemblyInfo:
+            return "AssemblyInfo";
+        case RecordKind::ModuleInfo:
+            return "ModuleInfo";
+        case RecordKind::FunctionInfo:
+            return "FunctionInfo";
+        case RecordKind::AssemblyLoadFinished:
+            return "AssemblyLoadFinished";
+        case RecordKind::ModuleLoadFinished:
+            return "ModuleLoadFinished";
+        case RecordKind::ModuleUnloadStarted:
+            return "ModuleUnloadStarted";
+        case RecordKind::JITCompilationStarted:
+            return "JITCompilationStarted";
+        case RecordKind::JITInlining:
+            return "JITInlining";
+        case RecordKind::JITCachedFunctionSearchStarted:
+            return "JITCachedFunctionSearchStarted";
+        case RecordKind::ReJITCompilationStarted:
+            return "ReJITCompilationStarted";
+        case RecordKind::GetReJITParameters:
+            return "GetReJITParameters";
+        case RecordKind::ReJITCompilationFinished:
+            return "ReJITCompilationFinished";
+        case RecordKind::ReJITError:
+            return "ReJITError";
+        case RecordKind::AppDomainShutdownFinished:
+            return "AppDomainShutdownFinished";
+        case RecordKind::Shutdown:
+            return "Shutdown";
+    }
+
+    return "Unknown";
+}
+
+//
+// CallbackRecording
+//
+
+bool CallbackRecording::Load(const std::string& file_path, CallbackRecording& recording)
+{
+    std::ifstream stream(file_path, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    char magic[sizeof(RecordingMagic)];
+    if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), RecordingMagic))
+    {
+        return false;
+    }
+
+    uint64_t version;
+    if (!ReadInteger(stream, version) || version != CallbackRecordingVersion)
+    {
+        return false;
+    }
+
+    // A recording can be truncated if the process exited without calling Shutdown:
+    // the records read until then are kept.
+    uint8_t kind;
+    while (ReadByte(stream, kind))
+    {
+        switch (static_cast<RecordKind>(kind))
+        {
+            case RecordKind::RuntimeInformation:
+            {
+                uint64_t runtime_type, major_version, minor_version, build_version, qfe_version;
+                if (!ReadInteger(stream, runtime_type) || !ReadInteger(stream, major_version) ||
+                    !ReadInteger(stream, minor_version) || !ReadInteger(stream, build_version) ||
+                    !ReadInteger(stream, qfe_version))
+                {
+                    return true;
+                }
+
+                recording.runtime_information = {static_cast<COR_PRF_RUNTIME_TYPE>(runtime_type),
+                                                 static_cast<USHORT>(major_version),
+                                                 static_cast<USHORT>(minor_version),
+                                                 static_cast<USHORT>(build_version), static_cast<USHORT>(qfe_version)};
+                break;
+            }
+            case RecordKind::AssemblyInfo:
+            {
+                RecordedAssembly assembly;
+                uint64_t id, manifest_module_id, app_domain_id;
+                if (!ReadInteger(stream, id) || !ReadString(stream, assembly.name) ||
+                    !ReadInteger(stream, manifest_module_id) || !ReadInteger(stream, app_domain_id) ||
+                    !ReadString(stream, assembly.app_domain_name))
+                {
+                    return true;
+                }
+
+                assembly.id = static_cast<AssemblyID>(id);
+                assembly.manifest_module_id = static_cast<ModuleID>(manifest_module_id);
+                assembly.app_domain_id = static_cast<AppDomainID>(app_domain_id);
+                recording.assemblies[assembly.id] = std::move(assembly);
+                break;
+            }
+            case RecordKind::ModuleInfo:
+            {
+                RecordedModule module;
+                uint64_t id, assembly_id, flags;
+                if (!ReadInteger(stream, id) || !ReadString(stream, module.path) ||
+                    !ReadInteger(stream, assembly_id) || !ReadInteger(stream, flags))
+                {
+                    return true;
+                }
+
+                module.id = static_cast<ModuleID>(id);
+                module.assembly_id = static_cast<AssemblyID>(assembly_id);
+                module.flags = static_cast<DWORD>(flags);
+                recording.modules[module.id] = std::move(module);
+                break;
+            }
+            case RecordKind::FunctionInfo:
+            {
+                uint64_t id, class_id, module_id, token;
+                if (!ReadInteger(stream, id) || !ReadInteger(stream, class_id) || !ReadInteger(stream, module_id) ||
+                    !ReadInteger(stream, token))
+                {
+                    return true;
+                }
+
+                recording.functions[static_cast<FunctionID>(id)] = {
+                    static_cast<FunctionID>(id), static_cast<ClassID>(class_id), static_cast<ModuleID>(module_id),
+                    static_cast<mdToken>(token)};
+                break;
+            }
+            case RecordKind::AssemblyLoadFinished:
+            case RecordKind::ModuleLoadFinished:
+            case RecordKind::ModuleUnloadStarted:
+            case RecordKind::JITCompilationStarted:
+            case RecordKind::JITInlining:
+            case RecordKind::JITCachedFunctionSearchStarted:
+            case RecordKind::ReJITCompilationStarted:
+            case RecordKind::GetReJITParameters:
+            case RecordKind::ReJITCompilationFinished:
+            case RecordKind::ReJITError:
+            case RecordKind::AppDomainShutdownFinished:
+            case RecordKind::Shutdown:
+            {
+                RecordedCallback callback{static_cast<RecordKind>(kind)};
+                if (!ReadCallback(stream, callback))
+                {
+                    return true;
+                }
+
+                recording.callbacks.push_back(callback);
+                break;
+            }
+            default:
+                // Unknown record: the rest of the file cannot be decoded
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// CallbackRecorder
+//
+
+CallbackRecorder::CallbackRecorder(ICorProfilerInfo4* info, const shared::WSTRING& file_path) :
+    m_info(info), m_startTime(std::chrono::steady_clock::now())
+{
+    m_stream.open(shared::ToString(file_path), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_stream.is_open())
+    {
+        Logger::Warn("CallbackRecorder: unable to open the recording file ", file_path);
+        return;
+    }
+
+    m_stream.write(RecordingMagic, sizeof(RecordingMagic));
+    WriteInteger(CallbackRecordingVersion);
+}
+
+bool CallbackRecorder::IsOpen() const
+{
+    return m_stream.is_open();
+}
+
+void CallbackRecorder::WriteByte(uint8_t value)
+{
+    m_stream.put(static_cast<char>(value));
+}
+
+void CallbackRecorder::WriteInteger(uint64_t value)
+{
+    do
+    {
+        uint8_t b = value & 0x7F;
+        value >>= 7;
+        if (value != 0)
+        {
+            b |= 0x80;
+        }
+        WriteByte(b);
+    } while (value != 0);
+}
+
+void CallbackRecorder::WriteString(const shared::WSTRING& value)
+{
+    WriteInteger(value.size());
+    for (const auto c : value)
+    {
+        WriteInteger(static_cast<uint16_t>(c));
+    }
+}
+
+void CallbackRecorder::WriteAssembly(const AssemblyInfo& assembly_info)
+{
+    if (!assembly_info.IsValid() || !m_recordedAssemblies.insert(assembly_info.id).second)
+    {
+        return;
+    }
+
+    WriteByte(static_cast<uint8_t>(RecordKind::AssemblyInfo));
+    WriteInteger(assembly_info.id);
+    WriteString(assembly_info.name);
+    WriteInteger(assembly_info.manifest_module_id);
+    WriteInteger(assembly_info.app_domain_id);
+    WriteString(assembly_info.app_domain_name);
+}
+
+void CallbackRecorder::WriteModuleIfNeeded(ModuleID module_id)
+{
+    if (module_id == 0 || !m_recordedModules.insert(module_id).second)
+    {
+        return;
+    }
+
+    const auto& module_info = GetModuleInfo(m_info, module_id);
+    if (!module_info.IsValid())
+    {
+        return;
+    }
+
+    WriteAssembly(module_info.assembly);
+
+    WriteByte(static_cast<uint8_t>(RecordKind::ModuleInfo));
+    WriteInteger(module_info.id);
+    WriteString(module_info.path);
+    WriteInteger(module_info.assembly.id);
+    WriteInteger(module_info.flags);
+}
+
+void CallbackRecorder::WriteFunctionIfNeeded(FunctionID function_id)
+{
+    if (function_id == 0 || !m_recordedFunctions.insert(function_id).second)
+    {
+        return;
+    }
+
+    ClassID class_id = 0;
+    ModuleID module_id = 0;
+    mdToken function_token = mdTokenNil;
+    const HRESULT hr = m_info->GetFunctionInfo(function_id, &class_id, &module_id, &function_token);
+    if (FAILED(hr))
+    {
+        return;
+    }
+
+    WriteModuleIfNeeded(module_id);
+
+    WriteByte(static_cast<uint8_t>(RecordKind::FunctionInfo));
+    WriteInteger(function_id);
+    WriteInteger(class_id);
+    WriteInteger(module_id);
+    WriteInteger(function_token);
+}
+
+void CallbackRecorder::WriteCallback(const RecordedCallback& callback)
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+
+    WriteByte(static_cast<uint8_t>(callback.kind));
+    WriteInteger(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    WriteInteger(callback.arg0);
+    WriteInteger(callback.arg1);
+    WriteInteger(callback.arg2);
+    WriteInteger(static_cast<uint32_t>(callback.hr_status));
+    WriteInteger(callback.flag);
+}
+
+void CallbackRecorder::RecordRuntimeInformation(const RecordedRuntimeInformation& runtime_information)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteByte(static_cast<uint8_t>(RecordKind::RuntimeInformation));
+    WriteInteger(runtime_information.runtime_type);
+    WriteInteger(runtime_information.major_version);
+    WriteInteger(runtime_information.minor_version);
+    WriteInteger(runtime_information.build_version);
+    WriteInteger(runtime_information.qfe_version);
+}
+
+void CallbackRecorder::RecordAssemblyLoadFinished(AssemblyID assembly_id, HRESULT hr_status)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (SUCCEEDED(hr_status) && m_recordedAssemblies.find(assembly_id) == m_recordedAssemblies.end())
+    {
+        WriteAssembly(GetAssemblyInfo(m_info, assembly_id));
+    }
+    WriteCallback({RecordKind::AssemblyLoadFinished, 0, assembly_id, 0, 0, hr_status});
+}
+
+void CallbackRecorder::RecordModuleLoadFinished(ModuleID module_id, HRESULT hr_status)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (SUCCEEDED(hr_status))
+    {
+        WriteModuleIfNeeded(module_id);
+    }
+    WriteCallback({RecordKind::ModuleLoadFinished, 0, module_id, 0, 0, hr_status});
+}
+
+void CallbackRecorder::RecordModuleUnloadStarted(ModuleID module_id)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteCallback({RecordKind::ModuleUnloadStarted, 0, module_id});
+}
+
+void CallbackRecorder::RecordJITCompilationStarted(FunctionID function_id, BOOL is_safe_to_block)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteFunctionIfNeeded(function_id);
+    WriteCallback({RecordKind::JITCompilationStarted, 0, function_id, 0, 0, S_OK, is_safe_to_block});
+}
+
+void CallbackRecorder::RecordJITInlining(FunctionID caller_id, FunctionID callee_id)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteFunctionIfNeeded(caller_id);
+    WriteFunctionIfNeeded(callee_id);
+    WriteCallback({RecordKind::JITInlining, 0, caller_id, callee_id});
+}
+
+void CallbackRecorder::RecordJITCachedFunctionSearchStarted(FunctionID function_id)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteFunctionIfNeeded(function_id);
+    WriteCallback({RecordKind::JITCachedFunctionSearchStarted, 0, function_id});
+}
+
+void CallbackRecorder::RecordReJITCompilationStarted(FunctionID function_id, ReJITID rejit_id, BOOL is_safe_to_block)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteFunctionIfNeeded(function_id);
+    WriteCallback({RecordKind::ReJITCompilationStarted, 0, function_id, rejit_id, 0, S_OK, is_safe_to_block});
+}
+
+void CallbackRecorder::RecordGetReJITParameters(ModuleID module_id, mdMethodDef method_id)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteModuleIfNeeded(module_id);
+    WriteCallback({RecordKind::GetReJITParameters, 0, module_id, method_id});
+}
+
+void CallbackRecorder::RecordReJITCompilationFinished(FunctionID function_id, ReJITID rejit_id, HRESULT hr_status,
+                                                      BOOL is_safe_to_block)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteFunctionIfNeeded(function_id);
+    WriteCallback(
+        {RecordKind::ReJITCompilationFinished, 0, function_id, rejit_id, 0, hr_status, is_safe_to_block});
+}
+
+void CallbackRecorder::RecordReJITError(ModuleID module_id, mdMethodDef method_id, FunctionID function_id,
+                                        HRESULT hr_status)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteModuleIfNeeded(module_id);
+    WriteFunctionIfNeeded(function_id);
+    WriteCallback({RecordKind::ReJITError, 0, module_id, method_id, function_id, hr_status});
+}
+
+void CallbackRecorder::RecordAppDomainShutdownFinished(AppDomainID app_domain_id, HRESULT hr_status)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteCallback({RecordKind::AppDomainShutdownFinished, 0, app_domain_id, 0, 0, hr_status});
+}
+
+void CallbackRecorder::RecordShutdown()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WriteCallback({RecordKind::Shutdown});
+    m_stream.flush();
+}
+
+} // namespace trace
@@ -0,0 +1,161 @@
+#ifndef DD_CLR_PROFILER_CALLBACK_RECORDER_H_
+#define DD_CLR_PROFILER_CALLBACK_RECORDER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cor.h"
+#include "corprof.h"
+
+#include "../../../shared/src/native-src/string.h"
+
+namespace trace
+{
+
+struct AssemblyInfo;
+
+//
+// Recording of the CLR callbacks received by the profiler, used to replay a startup offline.
+//
+// File layout: the "SFXCBREC" magic, a format version, then a stream of records. Each record starts
+// with its RecordKind byte followed by LEB128 encoded integers; strings are a length followed by UTF-16
+// code units. The ICorProfilerInfo answers about an id are written once, before the first callback using it.
+//
+
+const uint32_t CallbackRecordingVersion = 1;
+
+enum class RecordKind : uint8_t
+{
+    // ICorProfilerInfo answers
+    RuntimeInformation = 1,
+    AssemblyInfo = 2,
+    ModuleInfo = 3,
+    FunctionInfo = 4,
+
+    // Callbacks
+    AssemblyLoadFinished = 16,
+    ModuleLoadFinished = 17,
+    ModuleUnloadStarted = 18,
+    JITCompilationStarted = 19,
+    JITInlining = 20,
+    JITCachedFunctionSearchStarted = 21,
+    ReJITCompilationStarted = 22,
+    GetReJITParameters = 23,
+    ReJITCompilationFinished = 24,
+    ReJITError = 25,
+    AppDomainShutdownFinished = 26,
+    Shutdown = 27,
+};
+
+const char* RecordKindToString(RecordKind kind);
+
+struct RecordedRuntimeInformation
+{
+    COR_PRF_RUNTIME_TYPE runtime_type = (COR_PRF_RUNTIME_TYPE) 0x0;
+    USHORT major_version = 0;
+    USHORT minor_version = 0;
+    USHORT build_version = 0;
+    USHORT qfe_version = 0;
+};
+
+struct RecordedAssembly
+{
+    AssemblyID id = 0;
+    shared::WSTRING name;
+    ModuleID manifest_module_id = 0;
+    AppDomainID app_domain_id = 0;
+    shared::WSTRING app_domain_name;
+};
+
+struct RecordedModule
+{
+    ModuleID id = 0;
+    shared::WSTRING path;
+    AssemblyID assembly_id = 0;
+    DWORD flags = 0;
+};
+
+struct RecordedFunction
+{
+    FunctionID id = 0;
+    ClassID class_id = 0;
+    ModuleID module_id = 0;
+    mdToken token = mdTokenNil;
+};
+
+// A callback and its arguments, in the order of the ICorProfilerCallback signature
+struct RecordedCallback
+{
+    RecordKind kind;
+    // Nanoseconds elapsed since the profiler initialization when the callback was received
+    uint64_t timestamp = 0;
+    uint64_t arg0 = 0;
+    uint64_t arg1 = 0;
+    uint64_t arg2 = 0;
+    HRESULT hr_status = S_OK;
+    BOOL flag = FALSE;
+};
+
+struct CallbackRecording
+{
+    RecordedRuntimeInformation runtime_information;
+    std::unordered_map<AssemblyID, RecordedAssembly> assemblies;
+    std::unordered_map<ModuleID, RecordedModule> modules;
+    std::unordered_map<FunctionID, RecordedFunction> functions;
+    std::vector<RecordedCallback> callbacks;
+
+    static bool Load(const std::string& file_path, CallbackRecording& recording);
+};
+
+class CallbackRecorder
+{
+private:
+    std::mutex m_lock;
+    std::ofstream m_stream;
+    ICorProfilerInfo4* m_info;
+    std::chrono::steady_clock::time_point m_startTime;
+
+    std::unordered_set<AssemblyID> m_recordedAssemblies;
+    std::unordered_set<ModuleID> m_recordedModules;
+    std::unordered_set<FunctionID> m_recordedFunctions;
+
+    void WriteByte(uint8_t value);
+    void WriteInteger(uint64_t value);
+    void WriteString(const shared::WSTRING& value);
+
+    void WriteAssembly(const AssemblyInfo& assembly_info);
+    void WriteModuleIfNeeded(ModuleID module_id);
+    void WriteFunctionIfNeeded(FunctionID function_id);
+    void WriteCallback(const RecordedCallback& callback);
+
+public:
+    CallbackRecorder(ICorProfilerInfo4* info, const shared::WSTRING& file_path);
+
+    bool IsOpen() const;
+
+    void RecordRuntimeInformation(const RecordedRuntimeInformation& runtime_information);
+    void RecordAssemblyLoadFinished(AssemblyID assembly_id, HRESULT hr_status);
+    void RecordModuleLoadFinished(ModuleID module_id, HRESULT hr_status);
+    void RecordModuleUnloadStarted(ModuleID module_id);
+    void RecordJITCompilationStarted(FunctionID function_id, BOOL is_safe_to_block);
+    void RecordJITInlining(FunctionID caller_id, FunctionID callee_id);
+    void RecordJITCachedFunctionSearchStarted(FunctionID function_id);
+    void RecordReJITCompilationStarted(FunctionID function_id, ReJITID rejit_id, BOOL is_safe_to_block);
+    void RecordGetReJITParameters(ModuleID module_id, mdMethodDef method_id);
+    void RecordReJITCompilationFinished(FunctionID function_id, ReJITID rejit_id, HRESULT hr_status,
+                                        BOOL is_safe_to_block);
+    void RecordReJITError(ModuleID module_id, mdMethodDef method_id, FunctionID function_id, HRESULT hr_status);
+    void RecordAppDomainShutdownFinished(AppDomainID app_domain_id, HRESULT hr_status);
+    void RecordShutdown();
+};
+
+} // namespace trace
+
+#endif // DD_CLR_PROFILER_CALLBACK_RECORDER_H_
@@ -38,7 +38,6 @@ private:
     HRESULT EnsureCorLibTokens();
     mdTypeRef GetTargetStateTypeRef();
     mdTypeRef GetTargetVoidReturnTypeRef();
-    mdMemberRef GetCallTargetStateDefaultMemberRef();
     mdMemberRef GetCallTargetReturnVoidDefaultMemberRef();
     mdMemberRef GetCallTargetReturnValueDefaultMemberRef(mdTypeSpec callTargetReturnTypeSpec);
     mdMethodSpec GetCallTargetDefaultValueMethodSpec(TypeSignature* methodArgument);
@@ -77,6 +76,7 @@ protected:
 
 public:
     mdTypeRef GetObjectTypeRef();
+    mdMemberRef GetCallTargetStateDefaultMemberRef();
     mdTypeRef GetExceptionTypeRef();
     mdTypeRef GetRuntimeTypeHandleTypeRef();
     mdTypeRef GetRuntimeMethodHandleTypeRef();
@@ -5,6 +5,7 @@
 #include <string>
 #include <typeinfo>
 
+#include "callback_recorder.h"
 #include "clr_helpers.h"
 #include "dd_profiler_constants.h"
 #include "dllmain.h"
@@ -242,7 +243,29 @@ HRESULT STDMETHODCALLTYPE CorProfiler::Initialize(IUnknown* cor_profiler_info_un
         return E_FAIL;
     }
 
+    const auto& callback_recording_path = shared::GetEnvironmentValue(environment::callback_recording_path);
+    if (!callback_recording_path.empty())
+    {
+        callback_recorder = std::make_unique<CallbackRecorder>(this->info_, callback_recording_path);
+        if (callback_recorder->IsOpen())
+        {
+            Logger::Info("Recording the CLR callbacks to ", callback_recording_path);
+        }
+        else
+        {
+            callback_recorder = nullptr;
+        }
+    }
+
     runtime_information_ = GetRuntimeInformation(this->info_);
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordRuntimeInformation({runtime_information_.runtime_type,
+                                                     runtime_information_.major_version,
+                                                     runtime_information_.minor_version,
+                                                     runtime_information_.build_version,
+                                                     runtime_information_.qfe_version});
+    }
     if (process_name == WStr("w3wp.exe") || process_name == WStr("iisexpress.exe"))
     {
         is_desktop_iis = runtime_information_.is_desktop();
@@ -312,6 +335,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::AssemblyLoadFinished(AssemblyID assembly_
 {
     auto _ = trace::Stats::Instance()->AssemblyLoadFinishedMeasure();
 
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordAssemblyLoadFinished(assembly_id, hr_status);
+    }
+
     if (FAILED(hr_status))
     {
         // if assembly failed to load, skip it entirely,
@@ -511,6 +539,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ModuleLoadFinished(ModuleID module_id, HR
 {
     auto _ = trace::Stats::Instance()->ModuleLoadFinishedMeasure();
 
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordModuleLoadFinished(module_id, hr_status);
+    }
+
     if (FAILED(hr_status))
     {
         // if module failed to load, skip it entirely,
@@ -1059,6 +1092,16 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadStarted(ModuleID module_id)
 {
     auto _ = trace::Stats::Instance()->ModuleUnloadStartedMeasure();
 
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordModuleUnloadStarted(module_id);
+    }
+
+    if (alwaysOnProfiler != nullptr)
+    {
+        alwaysOnProfiler->ModuleUnloadStarted(module_id);
+    }
+
     if (!is_attached_)
     {
         return S_OK;
@@ -1107,8 +1150,28 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadStarted(ModuleID module_id)
     return S_OK;
 }
 
+HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadFinished(ModuleID module_id, HRESULT hr_status)
+{
+    if (!is_attached_ || FAILED(hr_status))
+    {
+        return S_OK;
+    }
+
+    if (debugger_instrumentation_requester != nullptr)
+    {
+        debugger_instrumentation_requester->ModuleUnloadFinished(module_id);
+    }
+
+    return S_OK;
+}
+
 HRESULT STDMETHODCALLTYPE CorProfiler::Shutdown()
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordShutdown();
+    }
+
     is_attached_.store(false);
 
     CorProfilerBase::Shutdown();
@@ -1161,6 +1224,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::JITCompilationStarted(FunctionID function
 {
     auto _ = trace::Stats::Instance()->JITCompilationStartedMeasure();
 
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordJITCompilationStarted(function_id, is_safe_to_block);
+    }
+
     if (!is_attached_ || !is_safe_to_block)
     {
         return S_OK;
@@ -1311,6 +1379,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::JITCompilationStarted(FunctionID function
 
 HRESULT STDMETHODCALLTYPE CorProfiler::AppDomainShutdownFinished(AppDomainID appDomainId, HRESULT hrStatus)
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordAppDomainShutdownFinished(appDomainId, hrStatus);
+    }
+
     if (!is_attached_)
     {
         return S_OK;
@@ -1338,6 +1411,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::JITInlining(FunctionID callerId, Function
 {
     auto _ = trace::Stats::Instance()->JITInliningMeasure();
 
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordJITInlining(callerId, calleeId);
+    }
+
     if (!is_attached_ || rejit_handler == nullptr)
     {
         return S_OK;
@@ -1613,6 +1691,11 @@ int CorProfiler::GetProbesStatuses(WCHAR** probeIds, int probeIdsLength, debugge
     return debugger_instrumentation_requester->GetProbesStatuses(probeIds, probeIdsLength, probeStatuses);
 }
 
+int CorProfiler::GetProbesStatusesSnapshot(debugger::DebuggerProbeStatus* probeStatuses, int probeStatusesLength)
+{
+    return debugger_instrumentation_requester->GetProbesStatusesSnapshot(probeStatuses, probeStatusesLength);
+}
+
 //
 // ICorProfilerCallback6 methods
 //
@@ -3207,6 +3290,11 @@ void CorProfiler::GetAssemblyAndSymbolsBytes(BYTE** pAssemblyArray, int* assembl
 HRESULT STDMETHODCALLTYPE CorProfiler::ReJITCompilationStarted(FunctionID functionId, ReJITID rejitId,
                                                                BOOL fIsSafeToBlock)
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordReJITCompilationStarted(functionId, rejitId, fIsSafeToBlock);
+    }
+
     if (!is_attached_)
     {
         return S_OK;
@@ -3222,6 +3310,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ReJITCompilationStarted(FunctionID functi
 HRESULT STDMETHODCALLTYPE CorProfiler::GetReJITParameters(ModuleID moduleId, mdMethodDef methodId,
                                                           ICorProfilerFunctionControl* pFunctionControl)
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordGetReJITParameters(moduleId, methodId);
+    }
+
     if (!is_attached_)
     {
         return S_OK;
@@ -3236,6 +3329,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::GetReJITParameters(ModuleID moduleId, mdM
 HRESULT STDMETHODCALLTYPE CorProfiler::ReJITCompilationFinished(FunctionID functionId, ReJITID rejitId,
                                                                 HRESULT hrStatus, BOOL fIsSafeToBlock)
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordReJITCompilationFinished(functionId, rejitId, hrStatus, fIsSafeToBlock);
+    }
+
     if (is_attached_ && IsDebugEnabled())
     {
         Logger::Debug("ReJITCompilationFinished: [functionId: ", functionId, ", rejitId: ", rejitId,
@@ -3248,6 +3346,11 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ReJITCompilationFinished(FunctionID funct
 HRESULT STDMETHODCALLTYPE CorProfiler::ReJITError(ModuleID moduleId, mdMethodDef methodId, FunctionID functionId,
                                                   HRESULT hrStatus)
 {
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordReJITError(moduleId, methodId, functionId, hrStatus);
+    }
+
     if (!is_attached_)
     {
         Logger::Warn("ReJITError: [functionId: ", functionId, ", moduleId: ", moduleId, ", methodId: ", methodId,
@@ -3261,6 +3364,12 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ReJITError(ModuleID moduleId, mdMethodDef
 HRESULT STDMETHODCALLTYPE CorProfiler::JITCachedFunctionSearchStarted(FunctionID functionId, BOOL* pbUseCachedFunction)
 {
     auto _ = trace::Stats::Instance()->JITCachedFunctionSearchStartedMeasure();
+
+    if (callback_recorder != nullptr)
+    {
+        callback_recorder->RecordJITCachedFunctionSearchStarted(functionId);
+    }
+
     if (!is_attached_ || !pbUseCachedFunction)
     {
         return S_OK;
@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "callback_recorder.h"
 #include "cor_profiler_base.h"
 #include "environment_variables.h"
 #include "il_rewriter.h"
@@ -59,6 +60,9 @@ private:
 
     always_on_profiler::AlwaysOnProfiler* alwaysOnProfiler;
 
+    // Records the callbacks to be replayed offline (see environment::callback_recording_path)
+    std::unique_ptr<CallbackRecorder> callback_recorder = nullptr;
+
     //
     // CallTarget Members
     //
@@ -133,6 +137,8 @@ public:
 
     HRESULT STDMETHODCALLTYPE ModuleUnloadStarted(ModuleID module_id) override;
 
+    HRESULT STDMETHODCALLTYPE ModuleUnloadFinished(ModuleID module_id, HRESULT hr_status) override;
+
     HRESULT STDMETHODCALLTYPE JITCompilationStarted(FunctionID function_id, BOOL is_safe_to_block) override;
 
     HRESULT STDMETHODCALLTYPE AppDomainShutdownFinished(AppDomainID appDomainId, HRESULT hrStatus) override;
@@ -194,6 +200,7 @@ public:
                    debugger::DebuggerLineProbeDefinition* lineProbes, int lineProbesLength,
                    debugger::DebuggerRemoveProbesDefinition* revertProbes, int revertProbesLength) const;
     int GetProbesStatuses(WCHAR** probeIds, int probeIdsLength, debugger::DebuggerProbeStatus* probeStatuses);
+    int GetProbesStatusesSnapshot(debugger::DebuggerProbeStatus* probeStatuses, int probeStatusesLength);
 
     friend class debugger::DebuggerProbesInstrumentationRequester;
     friend class debugger::DebuggerMethodRewriter;
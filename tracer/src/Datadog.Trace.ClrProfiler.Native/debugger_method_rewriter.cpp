@@ -284,9 +284,10 @@ HRESULT DebuggerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, Rejit
 ///try
 ///{
 ///  - Invoke LineDebuggerInvoker.BeginLine with object instance (or null if static method) 
-///  - Calls to LineDebuggerInvoker.LogArg with original method arguments
-///  - Calls to LineDebuggerInvoker.LogLocal with method locals
-///  - LineDebuggerInvoker.EndLine
+///  - If LineDebuggerInvoker.ShouldCapture returns true:
+///    - Calls to LineDebuggerInvoker.LogLocal with method locals
+///    - Calls to LineDebuggerInvoker.LogArg with original method arguments
+///    - LineDebuggerInvoker.EndLine
 ///}
 ///catch (Exception)
 ///{
@@ -389,6 +390,14 @@ HRESULT DebuggerMethodRewriter::CallLineProbe(
 
     rewriterWrapper.StLocal(lineProbeCallTargetStateIndex);
 
+    // *** Emit ShouldCapture check, skipping the LogLocal, LogArg and EndLine calls when nothing is captured
+    rewriterWrapper.LoadLocalAddress(lineProbeCallTargetStateIndex);
+    hr = debuggerTokens->WriteShouldCapture(&rewriterWrapper, &beginLineCallInstruction, /* isMethodProbe */ false);
+
+    IfFailRet(hr);
+
+    ILInstr* skipLineCaptureInstr = rewriterWrapper.CreateInstr(CEE_BRFALSE_S);
+
     // *** Emit LogLocal call(s)
     hr = WriteCallsToLogLocal(corProfiler, debuggerTokens, isStatic, methodLocals, numLocals, rewriterWrapper,
                               lineProbeCallTargetStateIndex, &beginLineCallInstruction,
@@ -412,6 +421,7 @@ HRESULT DebuggerMethodRewriter::CallLineProbe(
     AdjustExceptionHandlingClauses(lineProbeFirstInstruction, prevInstruction->m_pNext, &rewriter);
 
     ILInstr* pStateLeaveToBeginLineOriginalMethodInstr = rewriterWrapper.CreateInstr(CEE_LEAVE_S);
+    skipLineCaptureInstr->m_pTarget = pStateLeaveToBeginLineOriginalMethodInstr;
 
     // *** BeginMethod call catch
     ILInstr* beginLineCatchFirstInstr = rewriterWrapper.LoadLocalAddress(lineProbeCallTargetStateIndex);
@@ -572,6 +582,14 @@ HRESULT DebuggerMethodRewriter::ApplyMethodProbe(
 
     rewriterWrapper.StLocal(callTargetStateIndex);
 
+    // *** Emit ShouldCapture check, skipping the LogArg and BeginMethod_EndMarker calls when nothing is captured
+    rewriterWrapper.LoadLocalAddress(callTargetStateIndex);
+    hr = debuggerTokens->WriteShouldCapture(&rewriterWrapper, &beginCallInstruction, /* isMethodProbe */ true);
+
+    IfFailRet(hr);
+
+    ILInstr* skipBeginMethodCaptureInstr = rewriterWrapper.CreateInstr(CEE_BRFALSE_S);
+
     // *** Emit LogArg call(s)
     hr = WriteCallsToLogArg(corProfiler, debuggerTokens, isStatic, methodArguments, numArgs, rewriterWrapper,
                             callTargetStateIndex, &beginCallInstruction, /* isMethodProbe */ true);
@@ -585,6 +603,7 @@ HRESULT DebuggerMethodRewriter::ApplyMethodProbe(
     IfFailRet(hr);
 
     ILInstr* pStateLeaveToBeginOriginalMethodInstr = rewriterWrapper.CreateInstr(CEE_LEAVE_S);
+    skipBeginMethodCaptureInstr->m_pTarget = pStateLeaveToBeginOriginalMethodInstr;
 
     // *** BeginMethod call catch
     ILInstr* beginMethodCatchFirstInstr = rewriterWrapper.LoadLocalAddress(callTargetStateIndex);
@@ -652,6 +671,14 @@ HRESULT DebuggerMethodRewriter::ApplyMethodProbe(
     }
     rewriterWrapper.StLocal(callTargetReturnIndex);
 
+    // *** Emit ShouldCapture check, skipping the LogLocal, LogArg and EndMethod_EndMarker calls when nothing is captured
+    rewriterWrapper.LoadLocalAddress(callTargetStateIndex);
+    hr = debuggerTokens->WriteShouldCapture(&rewriterWrapper, &endMethodCallInstr, /* isMethodProbe */ true);
+
+    IfFailRet(hr);
+
+    ILInstr* skipEndMethodCaptureInstr = rewriterWrapper.CreateInstr(CEE_BRFALSE_S);
+
     // *** Emit LogLocal call(s)
     hr = WriteCallsToLogLocal(corProfiler, debuggerTokens, isStatic, methodLocals, numLocals, rewriterWrapper,
                               callTargetStateIndex, &endMethodCallInstr, /* isMethodProbe */ true);
@@ -670,6 +697,8 @@ HRESULT DebuggerMethodRewriter::ApplyMethodProbe(
 
     IfFailRet(hr);
 
+    skipEndMethodCaptureInstr->m_pTarget = rewriterWrapper.NOP();
+
     if (!isVoid)
     {
         ILInstr* callTargetReturnGetReturnInstr;
@@ -11,6 +11,7 @@
 #include "debugger_environment_variables_util.h"
 #include "debugger_rejit_handler_module_method.h"
 #include "probes_tracker.h"
+#include "rejit_work_offloader.h"
 
 namespace debugger
 {
@@ -47,69 +48,139 @@ bool DebuggerProbesInstrumentationRequester::ShouldPerformInstrumentAll(const WS
 }
 
 /**
- * \brief For Testing-Purposes. Requests ReJIT for the given method if certain checks are met. Relevant when the environment variable `SIGNALFX_INTERNAL_DEBUGGER_INSTRUMENT_ALL` is set to true.
- * \param module_info the ModuleInfo of the module entering into instrumentation-all.
+ * \brief For Testing-Purposes. Queues the given method for instrument-all. Relevant when the environment variable `SIGNALFX_INTERNAL_DEBUGGER_INSTRUMENT_ALL` is set to true.
+ * \ Called for every JIT compiled method, so it only queues the method: the queued methods are deduplicated and
+ * \ their ReJIT requested in batches, one per module, by the rejit work offloader thread.
  * \param module_id the ModuleID of the module entering into instrumentation-all.
  * \param function_token the mdToken of the method entering into instrumentation-all.
  */
 void DebuggerProbesInstrumentationRequester::PerformInstrumentAllIfNeeded(const ModuleID& module_id, const mdToken& function_token)
 {
-    if (!IsDebuggerInstrumentAllEnabled())
+    if (!m_is_instrument_all_enabled)
     {
         return;
     }
 
+    bool shouldSchedule;
+    {
+        std::lock_guard lock(m_instrument_all_mutex);
+        m_instrument_all_pending_methods.emplace_back(module_id, function_token);
+        shouldSchedule = !m_is_instrument_all_scheduled;
+        m_is_instrument_all_scheduled = true;
+    }
+
+    if (shouldSchedule)
+    {
+        // The methods JIT compiled until the work item runs are processed in the same batch
+        m_work_offloader->Enqueue(std::make_unique<RejitWorkItem>([this]() { InstrumentAllPendingMethods(); }));
+    }
+}
+
+void DebuggerProbesInstrumentationRequester::InstrumentAllPendingMethods()
+{
+    std::vector<MethodIdentifier> pendingMethods;
+    {
+        std::lock_guard lock(m_instrument_all_mutex);
+        pendingMethods.swap(m_instrument_all_pending_methods);
+        m_is_instrument_all_scheduled = false;
+    }
+
+    std::map<ModuleID, std::vector<mdMethodDef>> methodsByModule;
+    for (const auto& method : pendingMethods)
+    {
+        if (m_instrument_all_requested_methods[method.moduleId].insert(method.methodToken).second)
+        {
+            methodsByModule[method.moduleId].push_back(method.methodToken);
+        }
+    }
+
+    ULONG numReJITs = 0;
+    for (const auto& [module_id, function_tokens] : methodsByModule)
+    {
+        numReJITs += RequestRejitForInstrumentAll(module_id, function_tokens);
+    }
+
+    Logger::Debug("Instrument-All: Total number of ReJIT Requested: ", numReJITs, " for ", pendingMethods.size(),
+                  " JIT compiled methods in ", methodsByModule.size(), " modules");
+}
+
+/**
+ * \brief For Testing-Purposes. Forgets the methods requested for instrument-all in an unloaded module.
+ * \ The removal is queued on the rejit work offloader thread, after the batches already scheduled.
+ * \param module_id the ModuleID of the unloaded module.
+ */
+void DebuggerProbesInstrumentationRequester::ModuleUnloadFinished(const ModuleID& module_id)
+{
+    if (!m_is_instrument_all_enabled)
+    {
+        return;
+    }
+
+    m_work_offloader->Enqueue(std::make_unique<RejitWorkItem>(
+        [this, module_id]() { m_instrument_all_requested_methods.erase(module_id); }));
+}
+
+/**
+ * \brief For Testing-Purposes. Requests ReJIT for the given methods of a module if certain checks are met.
+ * \param module_id the ModuleID of the module entering into instrumentation-all.
+ * \param function_tokens the mdTokens of the methods entering into instrumentation-all.
+ * \return the number of ReJIT requested.
+ */
+ULONG DebuggerProbesInstrumentationRequester::RequestRejitForInstrumentAll(ModuleID module_id,
+                                                                           const std::vector<mdMethodDef>& function_tokens)
+{
     const auto corProfiler = trace::profiler;
     const auto& module_info = GetModuleInfo(corProfiler->info_, module_id);
     const auto assembly_name = module_info.assembly.name;
 
-    if (ShouldPerformInstrumentAll(assembly_name))
+    if (!ShouldPerformInstrumentAll(assembly_name))
+    {
+        return 0;
+    }
+
+    ComPtr<IUnknown> metadataInterfaces;
+    auto hr = corProfiler->info_->GetModuleMetaData(module_id, ofRead, IID_IMetaDataImport2,
+                                                    metadataInterfaces.GetAddressOf());
+    if (FAILED(hr))
     {
-        ComPtr<IUnknown> metadataInterfaces;
-        auto hr = corProfiler->info_->GetModuleMetaData(module_id, ofRead | ofWrite, IID_IMetaDataImport2,
-                                                        metadataInterfaces.GetAddressOf());
+        Logger::Warn("Instrument-All: failed to get the metadata of ModuleId=", module_id,
+                     " ModuleName=", assembly_name);
+        return 0;
+    }
 
-        auto metadataImport = metadataInterfaces.As<IMetaDataImport2>(IID_IMetaDataImport);
-        auto metadataEmit = metadataInterfaces.As<IMetaDataEmit2>(IID_IMetaDataEmit);
-        auto assemblyImport = metadataInterfaces.As<IMetaDataAssemblyImport>(IID_IMetaDataAssemblyImport);
-        auto assemblyEmit = metadataInterfaces.As<IMetaDataAssemblyEmit>(IID_IMetaDataAssemblyEmit);
+    auto metadataImport = metadataInterfaces.As<IMetaDataImport2>(IID_IMetaDataImport);
 
-        Logger::Debug("Temporaly allocating the ModuleMetadata for injection. ModuleId=", module_id,
-                      " ModuleName=", module_info.assembly.name);
+    // In the Debugger product, we don't care about module versioning. Thus we intentionally avoid it.
+    const static Version& minVersion = Version(0, 0, 0, 0);
+    const static Version& maxVersion = Version(65535, 65535, 65535, 0);
 
-        std::unique_ptr<ModuleMetadata> module_metadata = std::make_unique<ModuleMetadata>(
-            metadataImport, metadataEmit, assemblyImport, assemblyEmit, module_info.assembly.name,
-            module_info.assembly.app_domain_id, &corProfiler->corAssemblyProperty,
-            corProfiler->enable_by_ref_instrumentation, corProfiler->enable_calltarget_state_by_ref);
+    std::vector<MethodProbeDefinition> methodProbes;
+    methodProbes.reserve(function_tokens.size());
 
+    for (const auto function_token : function_tokens)
+    {
         // get function info
-        auto caller = GetFunctionInfo(module_metadata->metadata_import, function_token);
+        auto caller = GetFunctionInfo(metadataImport, function_token);
         if (!caller.IsValid())
         {
-            return;
+            continue;
         }
 
         hr = caller.method_signature.TryParse();
         if (FAILED(hr))
         {
-            Logger::Warn(" * DebuggerProbesInstrumentationRequester::PerformInstrumentAllIfNeeded: The method signature: ", caller.method_signature.str(), " cannot be parsed.");
-            return;
+            Logger::Warn(" * DebuggerProbesInstrumentationRequester::RequestRejitForInstrumentAll: The method signature: ", caller.method_signature.str(), " cannot be parsed.");
+            continue;
         }
 
         Logger::Debug("About to perform instrument all for ModuleId=", module_id,
-                      " ModuleName=", module_info.assembly.name,
+                      " ModuleName=", assembly_name,
                      " MethodName=", caller.name, " TypeName=", caller.type.name);
 
-        // In the Debugger product, we don't care about module versioning. Thus we intentionally avoid it.
-        const static Version& minVersion = Version(0, 0, 0, 0);
-        const static Version& maxVersion = Version(65535, 65535, 65535, 0);
-
-        const auto targetAssembly = module_info.assembly.name;
-        
         const auto numOfArgs = caller.method_signature.NumberOfArguments();
         const auto& methodArguments = caller.method_signature.GetMethodArguments();
         std::vector<WSTRING> signatureTypes;
-        
+
         // We should ALWAYS push something in front of the arguments list as the Preprocessor requires the return value to be there,
         // even if there are none (in which case, it should be System.Void).
         // The Preprocessor is not using the return value at all (and merely skipping it), so we insert an empty string.
@@ -120,18 +191,23 @@ void DebuggerProbesInstrumentationRequester::PerformInstrumentAllIfNeeded(const
         {
             signatureTypes.push_back(methodArguments[i].GetTypeTokName(metadataImport));
         }
-        
-        const auto& methodProbe = MethodProbeDefinition(
+
+        methodProbes.emplace_back(
             WStr("ProbeId"),
-            MethodReference(targetAssembly, caller.type.name, caller.name, minVersion, maxVersion, signatureTypes),
+            MethodReference(assembly_name, caller.type.name, caller.name, minVersion, maxVersion, signatureTypes),
             /* is_exact_signature_match */ false);
+    }
 
-        const auto numReJITs = m_debugger_rejit_preprocessor->RequestRejitForLoadedModules(
-            std::vector{module_id},
-            std::vector{methodProbe},
-            /* enqueueInSameThread */ true);
-        Logger::Debug("Instrument-All: Total number of ReJIT Requested: ", numReJITs);
+    if (methodProbes.empty())
+    {
+        return 0;
     }
+
+    // Already on the rejit work offloader thread: one ReJIT request for the whole batch
+    return m_debugger_rejit_preprocessor->RequestRejitForLoadedModules(
+        std::vector{module_id},
+        methodProbes,
+        /* enqueueInSameThread */ true);
 }
 
 
@@ -141,11 +217,56 @@ DebuggerProbesInstrumentationRequester::DebuggerProbesInstrumentationRequester(
     m_rejit_handler(rejit_handler), m_work_offloader(work_offloader)
 {
     m_debugger_rejit_preprocessor = std::make_unique<DebuggerRejitPreprocessor>(rejit_handler, work_offloader);
+    m_is_instrument_all_enabled = IsDebuggerInstrumentAllEnabled();
+}
+
+void DebuggerProbesInstrumentationRequester::RegisterProbe(const ProbeDefinition_S& probe)
+{
+    const auto iter = m_probes_indexes.find(probe->probeId);
+    if (iter != m_probes_indexes.end())
+    {
+        // The probe was received again, keep its latest definition
+        m_probes[iter->second] = probe;
+        return;
+    }
+
+    m_probes_indexes.emplace(probe->probeId, m_probes.size());
+    m_probes.push_back(probe);
 }
 
+bool DebuggerProbesInstrumentationRequester::UnregisterProbe(const shared::WSTRING& probeId)
+{
+    const auto iter = m_probes_indexes.find(probeId);
+    if (iter == m_probes_indexes.end())
+    {
+        return false;
+    }
+
+    // The order of the probes is not meaningful: move the last probe into the removed slot
+    const auto index = iter->second;
+    m_probes_indexes.erase(iter);
+
+    if (index != m_probes.size() - 1)
+    {
+        m_probes[index] = std::move(m_probes.back());
+        m_probes_indexes[m_probes[index]->probeId] = index;
+    }
+
+    m_probes.pop_back();
+    return true;
+}
+
+/// <summary>
+/// Removes the probes from the methods they were instrumenting, grouping them by method so each method handler
+/// is looked up once however many of its probes are removed.
+/// </summary>
+/// <param name="revertRequests">[OUT] Gets populated with the methods to revert.</param>
+/// <param name="reInstrumentRequests">[OUT] Gets populated with the reverted methods that still have probes,
+/// which need to go through re-instrumentation.</param>
 void DebuggerProbesInstrumentationRequester::RemoveProbes(debugger::DebuggerRemoveProbesDefinition* removeProbes,
     int removeProbesLength,
-    std::set<MethodIdentifier>& revertRequests)
+    std::set<MethodIdentifier>& revertRequests,
+    std::set<MethodIdentifier>& reInstrumentRequests)
 {
     if (removeProbes != nullptr)
     {
@@ -154,90 +275,85 @@ void DebuggerProbesInstrumentationRequester::RemoveProbes(debugger::DebuggerRemo
         if (removeProbesLength <= 0) return;
 
         std::vector<WSTRING> probeIdsToRemove;
+        std::map<MethodIdentifier, std::unordered_set<WSTRING>> probeIdsToRemoveByMethod;
 
         for (int i = 0; i < removeProbesLength; i++)
         {
             const DebuggerRemoveProbesDefinition& current = removeProbes[i];
-            probeIdsToRemove.emplace_back(WSTRING(current.probeId));
-        }
+            const auto& probeIdToRemove = probeIdsToRemove.emplace_back(WSTRING(current.probeId));
 
-        for (const auto& probeIdToRemove : probeIdsToRemove)
-        {
-            // Remove from `DebuggerRejitHandlerModuleMethod`
             std::shared_ptr<ProbeMetadata> probeMetadata;
             if (ProbesMetadataTracker::Instance()->TryGetMetadata(probeIdToRemove, probeMetadata))
             {
                 for (const auto& method : probeMetadata->methods)
                 {
-                    const auto moduleHandler = m_rejit_handler->GetOrAddModule(method.moduleId);
-                    if (moduleHandler == nullptr)
-                    {
-                        Logger::Warn("Module handler is returned as null while tried to RemoveProbes, this only "
-                                     "happens if the RejitHandler has been shutdown. Exiting early from RemoveProbes.");
-                        return; // Exit from RemoveProbes
-                    }
-
-                    if (moduleHandler->GetModuleMetadata() == nullptr)
-                    {
-                        Logger::Error("Could not find the module metadata of method mdToken", method.methodToken,
-                                      ", probeId: ", probeIdToRemove, " while trying to remove a probe");
-                        continue;
-                    }
-
-                    RejitHandlerModuleMethod* methodHandler = nullptr;
-                    if (!moduleHandler->TryGetMethod(method.methodToken, &methodHandler))
-                    {
-                        Logger::Error("Could not find the correct method mdToken", method.methodToken,
-                                      ", probeId: ", probeIdToRemove, " while trying to remove a probe");
-                        continue;
-                    }
-
-                    const auto debuggerMethodHandler = dynamic_cast<DebuggerRejitHandlerModuleMethod*>(methodHandler);
-
-                    if (debuggerMethodHandler == nullptr)
-                    {
-                        Logger::Error("The method handler of the probe Id we're trying to remove is not of the correct "
-                                      "type. Probe Id: ",
-                                      probeIdToRemove);
-                        continue;
-                    }
-
-                    if (!debuggerMethodHandler->RemoveProbe(probeIdToRemove))
-                    {
-                        Logger::Error("Could not remove from the method handler Probe Id: ", probeIdToRemove);
-                        continue;
-                    }
-                    else
-                    {
-                        Logger::Info("Removed from the method handler Probe Id: ", probeIdToRemove);
-                    }
-
-                    revertRequests.emplace(method);   
+                    probeIdsToRemoveByMethod[method].emplace(probeIdToRemove);
                 }
             }
             else
             {
                 Logger::Error("Received probeId that does not exist in MethodIdentifier mapping. Probe Id: ", probeIdToRemove);
-                continue;
             }
 
             // Remove from probes_
+            if (!UnregisterProbe(probeIdToRemove))
+            {
+                Logger::Error("Could not find Probe Id", probeIdToRemove, " in probes_.");
+            }
+        }
 
-            auto removedFromProbes_ = false;
-            for (auto probeIter = m_probes.begin(); probeIter != m_probes.end(); ++probeIter)
+        // Remove from `DebuggerRejitHandlerModuleMethod`
+        for (const auto& [method, probeIds] : probeIdsToRemoveByMethod)
+        {
+            const auto moduleHandler = m_rejit_handler->GetOrAddModule(method.moduleId);
+            if (moduleHandler == nullptr)
             {
-                if ((*probeIter)->probeId == probeIdToRemove)
-                {
-                    probeIter->reset();
-                    m_probes.erase(probeIter);
-                    removedFromProbes_ = true;
-                    break;
-                }
+                Logger::Warn("Module handler is returned as null while tried to RemoveProbes, this only "
+                             "happens if the RejitHandler has been shutdown. Exiting early from RemoveProbes.");
+                return; // Exit from RemoveProbes
             }
 
-            if (!removedFromProbes_)
+            if (moduleHandler->GetModuleMetadata() == nullptr)
             {
-                Logger::Error("Could not find Probe Id", probeIdToRemove, " in probes_.");
+                Logger::Error("Could not find the module metadata of method mdToken", method.methodToken,
+                              " while trying to remove ", probeIds.size(), " probes");
+                continue;
+            }
+
+            RejitHandlerModuleMethod* methodHandler = nullptr;
+            if (!moduleHandler->TryGetMethod(method.methodToken, &methodHandler))
+            {
+                Logger::Error("Could not find the correct method mdToken", method.methodToken,
+                              " while trying to remove ", probeIds.size(), " probes");
+                continue;
+            }
+
+            const auto debuggerMethodHandler = dynamic_cast<DebuggerRejitHandlerModuleMethod*>(methodHandler);
+
+            if (debuggerMethodHandler == nullptr)
+            {
+                Logger::Error("The method handler of the probes we're trying to remove is not of the correct "
+                              "type. mdToken: ",
+                              method.methodToken);
+                continue;
+            }
+
+            const auto removedCount = debuggerMethodHandler->RemoveProbes(probeIds);
+            if (removedCount == 0)
+            {
+                Logger::Error("Could not remove ", probeIds.size(), " probes from the method handler of mdToken ",
+                              method.methodToken);
+                continue;
+            }
+
+            Logger::Info("Removed ", removedCount, " probes from the method handler of mdToken ", method.methodToken);
+
+            revertRequests.emplace(method);
+
+            // The method is restored to its original form, re-instrument the probes it still has
+            if (!debuggerMethodHandler->GetProbes().empty())
+            {
+                reInstrumentRequests.emplace(method);
             }
         }
 
@@ -327,7 +443,7 @@ void DebuggerProbesInstrumentationRequester::AddMethodProbes(
         m_probes.reserve(m_probes.size() + methodProbeDefinitions.size());
         for (const auto& methodProbe : methodProbeDefinitions)
         {
-            m_probes.push_back(std::make_shared<MethodProbeDefinition>(methodProbe));
+            RegisterProbe(std::make_shared<MethodProbeDefinition>(methodProbe));
         }
     }
 }
@@ -381,64 +497,13 @@ void DebuggerProbesInstrumentationRequester::AddLineProbes(
         m_probes.reserve(m_probes.size() + lineProbeDefinitions.size());
         for (const auto& lineProbe : lineProbeDefinitions)
         {
-            m_probes.push_back(lineProbe);
+            RegisterProbe(lineProbe);
         }
 
         Logger::Info("LiveDebugger: Total method probes added: ", m_probes.size());
     }
 }
 
-/// <summary>
-/// Re-Instrument is the practice of requesting revert & reijt to restore method(s) to their original form and then re-instrument them.
-/// In case a revert was requested for a method, we need to determine if that method have other probes associated with them,
-/// in which case we should re-instrument them.
-/// </summary>
-/// <param name="revertRequests">Methods to revert.</param>
-/// <param name="reInstrumentRequests">[OUT] Gets populated with methods that needs to go through re-instrumentation.</param>
-void DebuggerProbesInstrumentationRequester::DetermineReInstrumentProbes(std::set<MethodIdentifier>& revertRequests,
-                                                                    std::set<MethodIdentifier>& reInstrumentRequests) const
-{
-    if (revertRequests.empty()) 
-        return;
-    
-    for (const auto& request : revertRequests)
-    {
-        const auto moduleHandler = m_rejit_handler->GetOrAddModule(request.moduleId);
-        if (moduleHandler == nullptr)
-        {
-            Logger::Warn("Module handler is returned as null while tried to RemoveProbes, this only happens if "
-                         "the RejitHandler has been shutdown. Exiting early from RemoveProbes.");
-            return; // Exit from RemoveProbes
-        }
-
-        if (moduleHandler->GetModuleMetadata() == nullptr)
-        {
-            Logger::Error("Could not find the module metadata of method mdToken ", request.methodToken, " while trying to remove a probe");
-            continue;
-        }
-
-        RejitHandlerModuleMethod* methodHandler = nullptr;
-        if (!moduleHandler->TryGetMethod(request.methodToken, &methodHandler))
-        {
-            Logger::Error("Could not find the correct method mdToken ", request.methodToken, " while trying to remove a probe");
-            continue;
-        }
-
-        const auto debuggerMethodHandler = dynamic_cast<DebuggerRejitHandlerModuleMethod*>(methodHandler);
-
-        if (debuggerMethodHandler == nullptr)
-        {
-            Logger::Error("The method handler of the probe Id we're trying to remove is not of the correct type");
-            continue;
-        }
-
-        if (!debuggerMethodHandler->GetProbes().empty())
-        {
-            reInstrumentRequests.emplace(request);
-        }
-    }
-}
-
 void DebuggerProbesInstrumentationRequester::InstrumentProbes(debugger::DebuggerMethodProbeDefinition* methodProbes,
                                                               int methodProbesLength,
                                                               debugger::DebuggerLineProbeDefinition* lineProbes,
@@ -448,16 +513,16 @@ void DebuggerProbesInstrumentationRequester::InstrumentProbes(debugger::Debugger
 {
     std::lock_guard lock(m_probes_mutex);
 
+    // Re-Instrument is the practice of requesting revert & rejit to restore method(s) to their original form and then
+    // re-instrument them: a reverted method that still has other probes associated with it needs it.
     std::set<MethodIdentifier> revertRequests{};
-    RemoveProbes(removeProbes, removeProbesLength, revertRequests);
+    std::set<MethodIdentifier> reInstrumentRequests{};
+    RemoveProbes(removeProbes, removeProbesLength, revertRequests, reInstrumentRequests);
 
     std::set<MethodIdentifier> rejitRequests{};
     AddMethodProbes(methodProbes, methodProbesLength, rejitRequests);
     AddLineProbes(lineProbes, lineProbesLength, rejitRequests);
 
-    std::set<MethodIdentifier> reInstrumentRequests{};
-    DetermineReInstrumentProbes(revertRequests, reInstrumentRequests);
-
     if (!rejitRequests.empty())
     {
         // Treat instrumentation requests as 're-instrument'.
@@ -520,26 +585,20 @@ int DebuggerProbesInstrumentationRequester::GetProbesStatuses(WCHAR** probeIds,
         return 0;
     }
 
-    int probeStatusesCount = 0;
+    // The statuses are read under a single lock of the tracker
+    return ProbesMetadataTracker::Instance()->GetProbesStatuses(probeIds, probeIdsLength, probeStatuses);
+}
 
-    for (auto probeIndex = 0; probeIndex < probeIdsLength; probeIndex++)
+int DebuggerProbesInstrumentationRequester::GetProbesStatusesSnapshot(debugger::DebuggerProbeStatus* probeStatuses,
+                                                                      int probeStatusesLength)
+{
+    if (probeStatuses == nullptr || probeStatusesLength < 0)
     {
-        const auto& probeId = shared::WSTRING(probeIds[probeIndex]);
-        std::shared_ptr<ProbeMetadata> probeMetadata;
-        if (ProbesMetadataTracker::Instance()->TryGetMetadata(probeId, probeMetadata))
-        {
-            probeStatuses[probeStatusesCount] = 
-                {probeMetadata->probeId.c_str(), probeMetadata->status};
-            probeStatusesCount++;
-        }
-        else
-        {
-            Logger::Warn("Failed to get probe metadata for probeId = ", probeId,
-                            " while trying to obtain its probe status.");
-        }
+        // Only query the number of probes
+        probeStatusesLength = 0;
     }
 
-    return probeStatusesCount;
+    return ProbesMetadataTracker::Instance()->GetProbesStatusesSnapshot(probeStatuses, probeStatusesLength);
 }
 
 const std::vector<std::shared_ptr<ProbeDefinition>>& DebuggerProbesInstrumentationRequester::GetProbes() const
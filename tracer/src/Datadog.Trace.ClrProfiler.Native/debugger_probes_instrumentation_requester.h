@@ -5,6 +5,8 @@
 #include "../../../shared/src/native-src/string.h"
 #include <corprof.h>
 #include "debugger_members.h"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace debugger
 {
@@ -14,19 +16,35 @@ class DebuggerProbesInstrumentationRequester
 private:
     std::recursive_mutex m_probes_mutex;
     std::vector<ProbeDefinition_S> m_probes;
+    // Index of each probe in m_probes, by probe id
+    std::unordered_map<shared::WSTRING, size_t> m_probes_indexes;
     std::unique_ptr<DebuggerRejitPreprocessor> m_debugger_rejit_preprocessor = nullptr;
     std::shared_ptr<RejitHandler> m_rejit_handler = nullptr;
     std::shared_ptr<RejitWorkOffloader> m_work_offloader = nullptr;
 
+    // Instrument-all: the JIT callbacks only queue the compiled methods, they are processed in batches by the
+    // rejit work offloader thread.
+    bool m_is_instrument_all_enabled = false;
+    std::mutex m_instrument_all_mutex;
+    std::vector<MethodIdentifier> m_instrument_all_pending_methods;
+    bool m_is_instrument_all_scheduled = false;
+    // Methods already requested for instrument-all by module, only accessed from the rejit work offloader thread.
+    // A module is removed when it is unloaded (its ModuleID can be reused).
+    std::unordered_map<ModuleID, std::unordered_set<mdMethodDef>> m_instrument_all_requested_methods;
+
     static bool ShouldPerformInstrumentAll(const WSTRING& assemblyName);
+    void InstrumentAllPendingMethods();
+    ULONG RequestRejitForInstrumentAll(ModuleID module_id, const std::vector<mdMethodDef>& function_tokens);
+
+    void RegisterProbe(const ProbeDefinition_S& probe);
+    bool UnregisterProbe(const shared::WSTRING& probeId);
 
     void RemoveProbes(debugger::DebuggerRemoveProbesDefinition* removeProbes, int removeProbesLength,
-                      std::set<MethodIdentifier>& revertRequests);
+                      std::set<MethodIdentifier>& revertRequests, std::set<MethodIdentifier>& reInstrumentRequests);
     void AddMethodProbes(debugger::DebuggerMethodProbeDefinition* methodProbes, int methodProbesLength,
                          std::set<trace::MethodIdentifier>& rejitRequests);
     void AddLineProbes(debugger::DebuggerLineProbeDefinition* lineProbes, int lineProbesLength,
                        std::set<MethodIdentifier>& rejitRequests);
-    void DetermineReInstrumentProbes(std::set<MethodIdentifier>& revertRequests, std::set<MethodIdentifier>& reInstrumentRequests) const;
 
 public:
     DebuggerProbesInstrumentationRequester(std::shared_ptr<trace::RejitHandler> rejit_handler,
@@ -36,7 +54,9 @@ public:
                    debugger::DebuggerLineProbeDefinition* lineProbes, int lineProbesLength,
                    debugger::DebuggerRemoveProbesDefinition* removeProbes, int removeProbesLength);
     static int GetProbesStatuses(WCHAR** probeIds, int probeIdsLength, debugger::DebuggerProbeStatus* probeStatuses);
+    static int GetProbesStatusesSnapshot(debugger::DebuggerProbeStatus* probeStatuses, int probeStatusesLength);
     void PerformInstrumentAllIfNeeded(const ModuleID& module_id, const mdToken& function_token);
+    void ModuleUnloadFinished(const ModuleID& module_id);
     const std::vector<std::shared_ptr<ProbeDefinition>>& GetProbes() const;
     DebuggerRejitPreprocessor* GetPreprocessor();
     ULONG RequestRejitForLoadedModule(const ModuleID moduleId);
@@ -1,6 +1,8 @@
 #include "debugger_rejit_handler_module_method.h"
 #include "debugger_method_rewriter.h"
 
+#include <algorithm>
+
 namespace debugger
 {
 
@@ -22,18 +24,17 @@ void DebuggerRejitHandlerModuleMethod::AddProbe(ProbeDefinition_S probe)
     m_probes.push_back(probe);
 }
 
-bool DebuggerRejitHandlerModuleMethod::RemoveProbe(const shared::WSTRING& probeId)
+int DebuggerRejitHandlerModuleMethod::RemoveProbes(const std::unordered_set<shared::WSTRING>& probeIds)
 {
-    for (auto probe = m_probes.begin(); probe != m_probes.end(); ++probe)
-    {
-        if ((*probe)->probeId == probeId)
-        {
-            m_probes.erase(probe);
-            return true;
-        }
-    }
-
-    return false;
+    const auto probesCount = m_probes.size();
+
+    m_probes.erase(std::remove_if(m_probes.begin(), m_probes.end(),
+                                  [&probeIds](const ProbeDefinition_S& probe) {
+                                      return probeIds.find(probe->probeId) != probeIds.end();
+                                  }),
+                   m_probes.end());
+
+    return static_cast<int>(probesCount - m_probes.size());
 }
 
 std::vector<ProbeDefinition_S>& DebuggerRejitHandlerModuleMethod::GetProbes()
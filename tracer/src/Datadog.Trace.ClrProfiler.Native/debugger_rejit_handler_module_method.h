@@ -4,6 +4,8 @@
 #include "rejit_handler.h"
 #include "debugger_members.h"
 
+#include <unordered_set>
+
 using namespace trace;
 
 namespace debugger
@@ -24,7 +26,7 @@ public:
 
     MethodRewriter* GetMethodRewriter() override;
     void AddProbe(ProbeDefinition_S probe);
-    bool RemoveProbe(const shared::WSTRING& probeId);
+    int RemoveProbes(const std::unordered_set<shared::WSTRING>& probeIds);
     std::vector<ProbeDefinition_S>& GetProbes();
 };
 
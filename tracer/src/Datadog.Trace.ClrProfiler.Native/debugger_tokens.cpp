@@ -23,6 +23,7 @@ static const WSTRING managed_profiler_debugger_endmethod_endmarker_name = WStr("
 static const WSTRING managed_profiler_debugger_logexception_name = WStr("LogException");
 static const WSTRING managed_profiler_debugger_logarg_name = WStr("LogArg");
 static const WSTRING managed_profiler_debugger_loglocal_name = WStr("LogLocal");
+static const WSTRING managed_profiler_debugger_shouldcapture_name = WStr("ShouldCapture");
 static const WSTRING managed_profiler_debugger_method_type = WStr("Datadog.Trace.Debugger.Instrumentation.MethodDebuggerInvoker");
 static const WSTRING managed_profiler_debugger_methodstatetype = WStr("Datadog.Trace.Debugger.Instrumentation.MethodDebuggerState");
 static const WSTRING managed_profiler_debugger_returntype = WStr("Datadog.Trace.Debugger.Instrumentation.DebuggerReturn");
@@ -691,6 +692,67 @@ HRESULT DebuggerTokens::WriteLogLocal(void* rewriterWrapperPtr, const TypeSignat
     return WriteLogArgOrLocal(rewriterWrapperPtr, local, instruction, false /* isArg */, isMethodProbe);
 }
 
+HRESULT DebuggerTokens::WriteShouldCapture(void* rewriterWrapperPtr, ILInstr** instruction, bool isMethodProbe)
+{
+    auto hr = EnsureBaseCalltargetTokens();
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    ILRewriterWrapper* rewriterWrapper = (ILRewriterWrapper*) rewriterWrapperPtr;
+    ModuleMetadata* module_metadata = GetMetadata();
+
+    mdMemberRef shouldCaptureRef = isMethodProbe ? methodShouldCaptureRef : lineShouldCaptureRef;
+
+    if (shouldCaptureRef == mdMemberRefNil)
+    {
+        const auto stateTypeRef = isMethodProbe ? callTargetStateTypeRef : lineDebuggerStateTypeRef;
+        const auto invokerTypeRef = isMethodProbe ? callTargetTypeRef : lineInvokerTypeRef;
+
+        unsigned callTargetStateBuffer;
+        auto callTargetStateSize = CorSigCompressToken(stateTypeRef, &callTargetStateBuffer);
+
+        unsigned long signatureLength = 4 + callTargetStateSize;
+
+        signatureLength += 1; // ByRef
+
+        COR_SIGNATURE signature[signatureBufferSize];
+        unsigned offset = 0;
+
+        signature[offset++] = IMAGE_CEE_CS_CALLCONV_DEFAULT;
+        signature[offset++] = 0x01; // arguments count
+        signature[offset++] = ELEMENT_TYPE_BOOLEAN;
+
+        // DebuggerState
+        signature[offset++] = ELEMENT_TYPE_BYREF;
+        signature[offset++] = ELEMENT_TYPE_VALUETYPE;
+        memcpy(&signature[offset], &callTargetStateBuffer, callTargetStateSize);
+        offset += callTargetStateSize;
+
+        hr = module_metadata->metadata_emit->DefineMemberRef(invokerTypeRef,
+                                                             managed_profiler_debugger_shouldcapture_name.data(),
+                                                             signature, signatureLength, &shouldCaptureRef);
+        if (FAILED(hr))
+        {
+            Logger::Warn("Wrapper ShouldCapture could not be defined.");
+            return hr;
+        }
+
+        if (isMethodProbe)
+        {
+            methodShouldCaptureRef = shouldCaptureRef;
+        }
+        else
+        {
+            lineShouldCaptureRef = shouldCaptureRef;
+        }
+    }
+
+    *instruction = rewriterWrapper->CallMember(shouldCaptureRef, false);
+    return S_OK;
+}
+
 HRESULT DebuggerTokens::WriteBeginOrEndMethod_EndMarker(void* rewriterWrapperPtr, bool isBeginMethod,
                                                         ILInstr** instruction)
 {
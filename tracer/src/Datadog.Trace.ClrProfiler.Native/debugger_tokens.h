@@ -37,6 +37,7 @@ private:
     mdMemberRef methodLogLocalRef = mdMemberRefNil;
     mdMemberRef endVoidMemberRef = mdMemberRefNil;
     mdMemberRef methodLogExceptionRef = mdMemberRefNil;
+    mdMemberRef methodShouldCaptureRef = mdMemberRefNil;
     mdMemberRef beginLineRef = mdMemberRefNil;
     mdMemberRef endLineRef = mdMemberRefNil;
     
@@ -46,6 +47,7 @@ private:
     mdMemberRef lineLogExceptionRef = mdMemberRefNil;
     mdMemberRef lineLogArgRef = mdMemberRefNil;
     mdMemberRef lineLogLocalRef = mdMemberRefNil;
+    mdMemberRef lineShouldCaptureRef = mdMemberRefNil;
 
     HRESULT WriteLogArgOrLocal(void* rewriterWrapperPtr, const TypeSignature& argOrLocal, ILInstr** instruction,
                                bool isArg, bool isMethodProbe);
@@ -77,6 +79,8 @@ public:
 
     HRESULT WriteLogLocal(void* rewriterWrapperPtr, const TypeSignature& local, ILInstr** instruction, bool isMethodProbe);
 
+    HRESULT WriteShouldCapture(void* rewriterWrapperPtr, ILInstr** instruction, bool isMethodProbe);
+
     HRESULT WriteBeginOrEndMethod_EndMarker(void* rewriterWrapperPtr, bool isBeginMethod, ILInstr** instruction);
     HRESULT WriteBeginMethod_EndMarker(void* rewriterWrapperPtr, ILInstr** instruction);
     HRESULT WriteEndMethod_EndMarker(void* rewriterWrapperPtr, ILInstr** instruction);
@@ -110,6 +110,10 @@ namespace environment {
     // Sets whether to enable NGEN images.
     const shared::WSTRING clr_enable_ngen = WStr("SIGNALFX_CLR_ENABLE_NGEN");
 
+    // Sets the path of a file where the CLR callbacks received by the profiler are recorded,
+    // to be replayed offline by SignalFx.Tracing.ClrProfiler.Native.Replay. Not set by default.
+    const shared::WSTRING callback_recording_path = WStr("SIGNALFX_TRACE_CALLBACK_RECORDING_PATH");
+
     // If you change this, change corresponding logic in Instrument.cs too
     const shared::WSTRING thread_sampling_enabled = WStr("SIGNALFX_PROFILER_ENABLED");
     const shared::WSTRING allocation_sampling_enabled = WStr("SIGNALFX_PROFILER_MEMORY_ENABLED");
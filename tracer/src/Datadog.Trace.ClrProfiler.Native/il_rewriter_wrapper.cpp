@@ -310,6 +310,15 @@ ILInstr* ILRewriterWrapper::LoadLocalAddress(unsigned index) const
     return pNewInstr;
 }
 
+ILInstr* ILRewriterWrapper::LoadStaticField(mdToken field_ref) const
+{
+    ILInstr* pNewInstr = m_ILRewriter->NewILInstr();
+    pNewInstr->m_opcode = CEE_LDSFLD;
+    pNewInstr->m_Arg32 = field_ref;
+    m_ILRewriter->InsertBefore(m_ILInstr, pNewInstr);
+    return pNewInstr;
+}
+
 ILInstr* ILRewriterWrapper::Return() const
 {
     ILInstr* pNewInstr = m_ILRewriter->NewILInstr();
@@ -40,6 +40,7 @@ public:
     ILInstr* StLocal(unsigned index) const;
     ILInstr* LoadLocal(unsigned index) const;
     ILInstr* LoadLocalAddress(unsigned index) const;
+    ILInstr* LoadStaticField(mdToken field_ref) const;
     ILInstr* Return() const;
     ILInstr* NOP() const;
     ILInstr* Rethrow() const;
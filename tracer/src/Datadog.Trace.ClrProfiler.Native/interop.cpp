@@ -73,6 +73,11 @@ EXTERN_C int STDAPICALLTYPE GetProbesStatuses(WCHAR** probeIds, int probeIdsLeng
     return trace::profiler->GetProbesStatuses(probeIds, probeIdsLength, probeStatuses);
 }
 
+EXTERN_C int STDAPICALLTYPE GetProbesStatusesSnapshot(debugger::DebuggerProbeStatus* probeStatuses, int probeStatusesLength)
+{
+    return trace::profiler->GetProbesStatusesSnapshot(probeStatuses, probeStatusesLength);
+}
+
 #ifndef _WIN32
 EXTERN_C void *dddlopen (const char *__file, int __mode)
 {
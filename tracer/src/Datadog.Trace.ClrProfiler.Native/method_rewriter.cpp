@@ -25,12 +25,15 @@ namespace trace
 ///   {
 ///     try
 ///     {
+///       - If the integration is disabled at runtime, initialize the CallTargetState local and leave to the original
+///       method instructions
 ///       - Invoke BeginMethod with object instance (or null if static method) and original method arguments
 ///       - Store result into CallTargetState local
 ///     }
 ///     catch
 ///     {
 ///       - Invoke LogException(Exception)
+///       - If the integration switch is emitted, store CallTargetState.GetDefault() into CallTargetState local
 ///     }
 ///
 ///     - Execute original method instructions
@@ -45,6 +48,8 @@ namespace trace
 /// }
 /// finally
 /// {
+///   - If the CallTargetState local is still the default value written while the integration was disabled, go to the
+///   end of the finally block
 ///   try
 ///   {
 ///     - Invoke EndMethod with object instance (or null if static method), TReturn local (if non-void method),
@@ -116,6 +121,7 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     bool isStatic = !(caller->method_signature.CallingConvention() & IMAGE_CEE_CS_CALLCONV_HASTHIS);
     std::vector<trace::TypeSignature> methodArguments = caller->method_signature.GetMethodArguments();
     std::vector<trace::TypeSignature> traceAnnotationArguments;
+    COR_SIGNATURE traceAnnotationIdBuffer[1] = {ELEMENT_TYPE_I4};
     COR_SIGNATURE runtimeMethodHandleBuffer[10];
     COR_SIGNATURE runtimeTypeHandleBuffer[10];
     int numArgs = caller->method_signature.NumberOfArguments();
@@ -190,6 +196,31 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     // BEGIN METHOD PART
     // ***
 
+    // *** Skip the BeginMethod call while the integration is disabled at runtime
+    //    ldsfld CallTargetIntegrationSwitch<TIntegration, TTarget>::Disabled
+    //    brfalse.s [BeginMethod call]
+    //    ldloca.s [callTargetStateIndex]
+    //    initobj CallTargetState
+    //    leave.s [Original method body]
+    // The switch is optional: the BeginMethod and EndMethod calls are always emitted if a member ref is missing.
+    mdMemberRef integrationDisabledFieldRef =
+        tracerTokens->GetIntegrationDisabledFieldRef(integration_type_ref, &caller->type);
+    mdMemberRef callTargetStateIsSkippedRef = integrationDisabledFieldRef != mdMemberRefNil
+                                                  ? tracerTokens->GetCallTargetStateIsSkippedMemberRef()
+                                                  : mdMemberRefNil;
+    const bool emitIntegrationSwitch = callTargetStateIsSkippedRef != mdMemberRefNil;
+    ILInstr* integrationEnabledBranchInstr = nullptr;
+    ILInstr* integrationDisabledLeaveInstr = nullptr;
+    if (emitIntegrationSwitch)
+    {
+        reWriterWrapper.LoadStaticField(integrationDisabledFieldRef);
+        integrationEnabledBranchInstr = reWriterWrapper.CreateInstr(CEE_BRFALSE_S);
+        reWriterWrapper.LoadLocalAddress(callTargetStateIndex);
+        reWriterWrapper.InitObj(callTargetStateToken);
+        integrationDisabledLeaveInstr = reWriterWrapper.CreateInstr(CEE_LEAVE_S);
+        integrationEnabledBranchInstr->m_pTarget = reWriterWrapper.NOP();
+    }
+
     // *** Load instance into the stack (if not static)
     if (isStatic)
     {
@@ -307,7 +338,11 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     }
     else
     {
+        // Load the trace annotation id, the managed side caches the span names of the method by this id
+        reWriterWrapper.LoadInt32(tracerMethodHandler->GetTraceAnnotationId());
+
         // Load the methodDef token to produce a RuntimeMethodHandle on the stack
+        // (only used to resolve the method the first time the id is seen)
         reWriterWrapper.LoadToken(caller->id);
 
         runtimeMethodHandleBuffer[0] = ELEMENT_TYPE_VALUETYPE;
@@ -321,7 +356,14 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
         ULONG runtimeTypeHandleTokenLength =
             CorSigCompressToken(tracerTokens->GetRuntimeTypeHandleTypeRef(), &runtimeTypeHandleBuffer[1]);
 
-        // Replace method arguments with one RuntimeMethodHandle argument and one RuntimeTypeHandle argument
+        // Replace method arguments with one int argument, one RuntimeMethodHandle argument and one RuntimeTypeHandle
+        // argument
+        trace::TypeSignature traceAnnotationIdArgument{};
+        traceAnnotationIdArgument.pbBase = traceAnnotationIdBuffer;
+        traceAnnotationIdArgument.length = 1;
+        traceAnnotationIdArgument.offset = 0;
+        traceAnnotationArguments.push_back(traceAnnotationIdArgument);
+
         trace::TypeSignature runtimeMethodHandleArgument{};
         runtimeMethodHandleArgument.pbBase = runtimeMethodHandleBuffer;
         runtimeMethodHandleArgument.length = runtimeMethodHandleTokenLength + 1;
@@ -387,6 +429,14 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     ILInstr* beginMethodCatchFirstInstr = nullptr;
     tracerTokens->WriteLogException(&reWriterWrapper, integration_type_ref, &caller->type,
                                         &beginMethodCatchFirstInstr);
+    if (emitIntegrationSwitch)
+    {
+        // The EndMethod call is only skipped for the initobj state: a failed BeginMethod still gets its EndMethod
+        //    call CallTargetState::GetDefault()
+        //    stloc [callTargetStateIndex]
+        reWriterWrapper.CallMember(tracerTokens->GetCallTargetStateDefaultMemberRef(), false);
+        reWriterWrapper.StLocal(callTargetStateIndex);
+    }
     ILInstr* beginMethodCatchLeaveInstr = reWriterWrapper.CreateInstr(CEE_LEAVE_S);
 
     // *** BeginMethod exception handling clause
@@ -404,6 +454,10 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     ILInstr* beginOriginalMethodInstr = reWriterWrapper.GetCurrentILInstr();
     pStateLeaveToBeginOriginalMethodInstr->m_pTarget = beginOriginalMethodInstr;
     beginMethodCatchLeaveInstr->m_pTarget = beginOriginalMethodInstr;
+    if (integrationDisabledLeaveInstr != nullptr)
+    {
+        integrationDisabledLeaveInstr->m_pTarget = beginOriginalMethodInstr;
+    }
 
     // ***
     // ENDING OF THE METHOD EXECUTION
@@ -425,6 +479,20 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     // ***
     // EXCEPTION FINALLY / END METHOD PART
     // ***
+
+    // *** Skip the EndMethod call if the BeginMethod call was skipped
+    // The switch is not read again: the integration may have been toggled while the original method was running.
+    //    ldloca.s [callTargetStateIndex]
+    //    call CallTargetState::get_IsSkipped()
+    //    brtrue.s [endfinally]
+    ILInstr* integrationDisabledEndBranchInstr = nullptr;
+    if (emitIntegrationSwitch)
+    {
+        reWriterWrapper.LoadLocalAddress(callTargetStateIndex);
+        reWriterWrapper.CallMember(callTargetStateIsSkippedRef, false);
+        integrationDisabledEndBranchInstr = reWriterWrapper.CreateInstr(CEE_BRTRUE_S);
+    }
+
     ILInstr* endMethodTryStartInstr;
 
     // *** Load instance into the stack (if not static)
@@ -543,6 +611,10 @@ HRESULT TracerMethodRewriter::Rewrite(RejitHandlerModule* moduleHandler, RejitHa
     ILInstr* endFinallyInstr = reWriterWrapper.EndFinally();
     endMethodTryLeave->m_pTarget = endFinallyInstr;
     endMethodCatchLeaveInstr->m_pTarget = endFinallyInstr;
+    if (integrationDisabledEndBranchInstr != nullptr)
+    {
+        integrationDisabledEndBranchInstr->m_pTarget = endFinallyInstr;
+    }
 
     // ***
     // METHOD RETURN
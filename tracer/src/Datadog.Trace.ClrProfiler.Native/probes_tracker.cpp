@@ -1,5 +1,7 @@
 #include "probes_tracker.h"
 
+#include "logger.h"
+
  bool debugger::ProbesMetadataTracker::TryGetMetadata(const shared::WSTRING& probeId, /* out */ std::shared_ptr<ProbeMetadata>& probeMetadata)
  {
      std::lock_guard lock(_probeMetadataMapMutex);
@@ -22,24 +24,13 @@
  {
      std::lock_guard lock(_probeMetadataMapMutex);
 
-     const auto lookupMethodIdentifier = trace::MethodIdentifier(moduleId, methodId);
-     std::set<WSTRING> probeIds;
-
-     auto probeMetadataMapIterator = _probeMetadataMap.begin();
-     while (probeMetadataMapIterator != _probeMetadataMap.end())
+     const auto iter = _methodProbeIdsMap.find(trace::MethodIdentifier(moduleId, methodId));
+     if (iter == _methodProbeIdsMap.end())
      {
-         auto probeMetadataPair = *probeMetadataMapIterator;
-         const auto methods = probeMetadataPair.second->methods;
-
-         if (methods.find(lookupMethodIdentifier) != methods.end())
-         {
-             probeIds.emplace(probeMetadataPair.first);
-         }
-
-         probeMetadataMapIterator = ++probeMetadataMapIterator;
+         return {};
      }
 
-     return probeIds;
+     return std::set<WSTRING>(iter->second.begin(), iter->second.end());
  }
 
  void debugger::ProbesMetadataTracker::CreateNewProbeIfNotExists(const shared::WSTRING& probeId)
@@ -61,6 +52,7 @@
      CreateNewProbeIfNotExists(probeId);
 
      _probeMetadataMap[probeId]->methods.emplace(methodIdentifierToAdd);
+     _methodProbeIdsMap[methodIdentifierToAdd].emplace(probeId);
 
      // Mark the probe as Installed (if it was not marked as Error before)
      if (_probeMetadataMap[probeId]->status != ProbeStatus::_ERROR)
@@ -98,6 +90,19 @@ int debugger::ProbesMetadataTracker::RemoveProbes(const std::vector<shared::WSTR
 
             if (iter != _probeMetadataMap.end())
             {
+                for (const auto& method : iter->second->methods)
+                {
+                    const auto methodIter = _methodProbeIdsMap.find(method);
+                    if (methodIter != _methodProbeIdsMap.end())
+                    {
+                        methodIter->second.erase(probe);
+                        if (methodIter->second.empty())
+                        {
+                            _methodProbeIdsMap.erase(methodIter);
+                        }
+                    }
+                }
+
                 removedProbesCount++;
                 _probeMetadataMap.erase(iter);
             }
@@ -106,3 +111,63 @@ int debugger::ProbesMetadataTracker::RemoveProbes(const std::vector<shared::WSTR
 
     return removedProbesCount;
  }
+
+int debugger::ProbesMetadataTracker::GetProbesStatuses(WCHAR** probeIds, int probeIdsLength,
+                                                       DebuggerProbeStatus* probeStatuses)
+{
+    std::lock_guard lock(_probeMetadataMapMutex);
+
+    auto probeStatusesCount = 0;
+
+    for (auto probeIndex = 0; probeIndex < probeIdsLength; probeIndex++)
+    {
+        const auto iter = _probeMetadataMap.find(shared::WSTRING(probeIds[probeIndex]));
+        if (iter != _probeMetadataMap.end())
+        {
+            // The caller owns the probe id: it outlives the removal of the probe
+            probeStatuses[probeStatusesCount] = {probeIds[probeIndex], iter->second->status};
+            probeStatusesCount++;
+        }
+        else
+        {
+            Logger::Warn("Failed to get probe metadata for probeId = ", probeIds[probeIndex],
+                         " while trying to obtain its probe status.");
+        }
+    }
+
+    return probeStatusesCount;
+}
+
+/**
+ * \brief Copies the status of every tracked probe, so the statuses can be polled without sending the probe ids.
+ * \param probeStatuses the buffer receiving the statuses
+ * \param probeStatusesLength the capacity of the buffer
+ * \return the number of tracked probes. When it is greater than the capacity, only the first probeStatusesLength
+ * statuses were copied and the call should be repeated with a larger buffer.
+ * The probe ids are owned by the tracker and stay valid until the next snapshot, even if the probes are removed.
+ */
+int debugger::ProbesMetadataTracker::GetProbesStatusesSnapshot(DebuggerProbeStatus* probeStatuses,
+                                                               int probeStatusesLength)
+{
+    std::lock_guard lock(_probeMetadataMapMutex);
+
+    const auto probesCount = static_cast<int>(_probeMetadataMap.size());
+    const auto copiedCount = (std::min)(probesCount, (std::max)(probeStatusesLength, 0));
+
+    _probeIdsSnapshot.clear();
+    _probeIdsSnapshot.reserve(copiedCount);
+
+    for (const auto& [probeId, probeMetadata] : _probeMetadataMap)
+    {
+        if (static_cast<int>(_probeIdsSnapshot.size()) == copiedCount)
+        {
+            break;
+        }
+
+        const auto probeIndex = _probeIdsSnapshot.size();
+        _probeIdsSnapshot.push_back(probeId);
+        probeStatuses[probeIndex] = {_probeIdsSnapshot.back().c_str(), probeMetadata->status};
+    }
+
+    return probesCount;
+}
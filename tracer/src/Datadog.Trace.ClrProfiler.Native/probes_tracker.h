@@ -6,6 +6,8 @@
 #include <corprof.h>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "../../../shared/src/native-src/util.h"
 #include "../../../shared/src/native-src/string.h"
 #include "debugger_members.h"
@@ -19,6 +21,10 @@ namespace debugger
     private:
         std::recursive_mutex _probeMetadataMapMutex;
         std::unordered_map<shared::WSTRING, std::shared_ptr<ProbeMetadata>> _probeMetadataMap{};
+        // Probe ids by instrumented method (the reverse of ProbeMetadata::methods)
+        std::unordered_map<trace::MethodIdentifier, std::unordered_set<shared::WSTRING>> _methodProbeIdsMap{};
+        // Copies of the probe ids returned by the last snapshot (a probe can be removed once the lock is released)
+        std::vector<shared::WSTRING> _probeIdsSnapshot{};
 
     public:
         ProbesMetadataTracker() = default;
@@ -29,6 +35,8 @@ namespace debugger
         void AddMethodToProbe(const shared::WSTRING& probeId, const ModuleID moduleId, const mdMethodDef methodId);
         bool SetProbeStatus(const shared::WSTRING& probeId, ProbeStatus newStatus);
         int RemoveProbes(const std::vector<shared::WSTRING>& probes);
+        int GetProbesStatuses(WCHAR** probeIds, int probeIdsLength, DebuggerProbeStatus* probeStatuses);
+        int GetProbesStatusesSnapshot(DebuggerProbeStatus* probeStatuses, int probeStatusesLength);
     };
 
 } // namespace debugger
@@ -150,6 +150,23 @@ MethodRewriter* TracerRejitHandlerModuleMethod::GetMethodRewriter()
     return TracerMethodRewriter::Instance();
 }
 
+std::atomic<int> TracerRejitHandlerModuleMethod::s_nextTraceAnnotationId{0};
+
+int TracerRejitHandlerModuleMethod::GetTraceAnnotationId()
+{
+    auto traceAnnotationId = m_traceAnnotationId.load();
+    if (traceAnnotationId < 0)
+    {
+        const auto newTraceAnnotationId = s_nextTraceAnnotationId.fetch_add(1);
+        if (m_traceAnnotationId.compare_exchange_strong(traceAnnotationId, newTraceAnnotationId))
+        {
+            traceAnnotationId = newTraceAnnotationId;
+        }
+    }
+
+    return traceAnnotationId;
+}
+
 //
 // RejitHandlerModule
 //
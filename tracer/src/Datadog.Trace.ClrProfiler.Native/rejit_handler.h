@@ -62,6 +62,9 @@ class TracerRejitHandlerModuleMethod : public RejitHandlerModuleMethod
 {
 private:
     std::unique_ptr<IntegrationDefinition> m_integrationDefinition;
+    std::atomic<int> m_traceAnnotationId{-1};
+
+    static std::atomic<int> s_nextTraceAnnotationId;
 
 public:
     TracerRejitHandlerModuleMethod(
@@ -72,6 +75,10 @@ public:
     
     IntegrationDefinition* GetIntegrationDefinition();
     MethodRewriter* GetMethodRewriter() override;
+
+    // Process wide id of a trace annotated method, allocated on first use and kept across rejits of the method.
+    // The managed TraceAnnotationsIntegration caches the span names of the method at this index.
+    int GetTraceAnnotationId();
 };
 
 using RejitHandlerModuleMethodCreatorFunc = std::function<std::unique_ptr<RejitHandlerModuleMethod>(const mdMethodDef, RejitHandlerModule*)>;
@@ -21,6 +21,10 @@ static const shared::WSTRING managed_profiler_calltarget_returntype_generics = W
 static const shared::WSTRING managed_profiler_calltarget_beginmethod_name = WStr("BeginMethod");
 static const shared::WSTRING managed_profiler_calltarget_endmethod_name = WStr("EndMethod");
 static const shared::WSTRING managed_profiler_calltarget_logexception_name = WStr("LogException");
+static const shared::WSTRING managed_profiler_calltarget_integrationswitch_type =
+    WStr("Datadog.Trace.ClrProfiler.CallTarget.CallTargetIntegrationSwitch`2");
+static const shared::WSTRING managed_profiler_calltarget_integrationswitch_disabled_name = WStr("Disabled");
+static const shared::WSTRING managed_profiler_calltarget_statetype_isskipped_name = WStr("get_IsSkipped");
 
 /**
  * PRIVATE
@@ -292,6 +296,12 @@ HRESULT TracerTokens::WriteBeginMethod(void* rewriterWrapperPtr, mdTypeRef integ
         }
     }
 
+    if (signatureLength > signatureBufferSize)
+    {
+        Logger::Warn("Begin method spec for ", numArguments, " arguments exceeds the signature buffer size.");
+        return E_FAIL;
+    }
+
     COR_SIGNATURE signature[signatureBufferSize];
     unsigned offset = 0;
 
@@ -578,6 +588,119 @@ HRESULT TracerTokens::WriteEndReturnMemberRef(void* rewriterWrapperPtr, mdTypeRe
     return S_OK;
 }
 
+mdMemberRef TracerTokens::GetIntegrationDisabledFieldRef(mdTypeRef integrationTypeRef, const TypeInfo* currentType)
+{
+    auto hr = EnsureBaseCalltargetTokens();
+    if (FAILED(hr))
+    {
+        return mdMemberRefNil;
+    }
+    ModuleMetadata* module_metadata = GetMetadata();
+
+    if (integrationSwitchTypeRef == mdTypeRefNil)
+    {
+        hr = module_metadata->metadata_emit->DefineTypeRefByName(
+            profilerAssemblyRef, managed_profiler_calltarget_integrationswitch_type.data(), &integrationSwitchTypeRef);
+        if (FAILED(hr))
+        {
+            Logger::Warn("Wrapper integrationSwitchTypeRef could not be defined.");
+            return mdMemberRefNil;
+        }
+    }
+
+    // The switch is instantiated with the same generic arguments as the BeginMethod and EndMethod calls
+    unsigned integrationSwitchTypeBuffer;
+    ULONG integrationSwitchTypeSize = CorSigCompressToken(integrationSwitchTypeRef, &integrationSwitchTypeBuffer);
+
+    unsigned integrationTypeBuffer;
+    ULONG integrationTypeSize = CorSigCompressToken(integrationTypeRef, &integrationTypeBuffer);
+
+    bool isValueType = currentType->valueType;
+    mdToken currentTypeRef = GetCurrentTypeRef(currentType, isValueType);
+    if (currentTypeRef == mdTokenNil)
+    {
+        isValueType = false;
+        currentTypeRef = GetObjectTypeRef();
+    }
+
+    unsigned currentTypeBuffer;
+    ULONG currentTypeSize = CorSigCompressToken(currentTypeRef, &currentTypeBuffer);
+
+    auto signatureLength = 5 + integrationSwitchTypeSize + integrationTypeSize + currentTypeSize;
+    COR_SIGNATURE signature[signatureBufferSize];
+    unsigned offset = 0;
+
+    signature[offset++] = ELEMENT_TYPE_GENERICINST;
+    signature[offset++] = ELEMENT_TYPE_CLASS;
+    memcpy(&signature[offset], &integrationSwitchTypeBuffer, integrationSwitchTypeSize);
+    offset += integrationSwitchTypeSize;
+    signature[offset++] = 0x02;
+
+    signature[offset++] = ELEMENT_TYPE_CLASS;
+    memcpy(&signature[offset], &integrationTypeBuffer, integrationTypeSize);
+    offset += integrationTypeSize;
+
+    if (isValueType)
+    {
+        signature[offset++] = ELEMENT_TYPE_VALUETYPE;
+    }
+    else
+    {
+        signature[offset++] = ELEMENT_TYPE_CLASS;
+    }
+    memcpy(&signature[offset], &currentTypeBuffer, currentTypeSize);
+    offset += currentTypeSize;
+
+    mdTypeSpec integrationSwitchTypeSpec = mdTypeSpecNil;
+    hr = module_metadata->metadata_emit->GetTokenFromTypeSpec(signature, signatureLength, &integrationSwitchTypeSpec);
+    if (FAILED(hr))
+    {
+        Logger::Warn("Error creating integration switch type spec.");
+        return mdMemberRefNil;
+    }
+
+    COR_SIGNATURE fieldSignature[] = {IMAGE_CEE_CS_CALLCONV_FIELD, ELEMENT_TYPE_BOOLEAN};
+
+    mdMemberRef disabledFieldRef = mdMemberRefNil;
+    hr = module_metadata->metadata_emit->DefineMemberRef(
+        integrationSwitchTypeSpec, managed_profiler_calltarget_integrationswitch_disabled_name.data(), fieldSignature,
+        sizeof(fieldSignature), &disabledFieldRef);
+    if (FAILED(hr))
+    {
+        Logger::Warn("Wrapper integration switch disabled field could not be defined.");
+        return mdMemberRefNil;
+    }
+
+    return disabledFieldRef;
+}
+
+mdMemberRef TracerTokens::GetCallTargetStateIsSkippedMemberRef()
+{
+    auto hr = EnsureBaseCalltargetTokens();
+    if (FAILED(hr))
+    {
+        return mdMemberRefNil;
+    }
+
+    if (callTargetStateIsSkippedRef == mdMemberRefNil)
+    {
+        ModuleMetadata* module_metadata = GetMetadata();
+
+        COR_SIGNATURE signature[] = {IMAGE_CEE_CS_CALLCONV_HASTHIS, 0x00, ELEMENT_TYPE_BOOLEAN};
+
+        hr = module_metadata->metadata_emit->DefineMemberRef(
+            callTargetStateTypeRef, managed_profiler_calltarget_statetype_isskipped_name.data(), signature,
+            sizeof(signature), &callTargetStateIsSkippedRef);
+        if (FAILED(hr))
+        {
+            Logger::Warn("Wrapper callTargetStateIsSkippedRef could not be defined.");
+            return mdMemberRefNil;
+        }
+    }
+
+    return callTargetStateIsSkippedRef;
+}
+
 // write log exception
 HRESULT TracerTokens::WriteLogException(void* rewriterWrapperPtr, mdTypeRef integrationTypeRef,
                                             const TypeInfo* currentType, ILInstr** instruction)
@@ -3,7 +3,9 @@
 
 #include "calltarget_tokens.h"
 
-#define FASTPATH_COUNT 9
+// Methods with less arguments than FASTPATH_COUNT call the typed BeginMethod overloads (no object[] allocation),
+// CallTargetInvoker has one overload per arity up to FASTPATH_COUNT - 1.
+#define FASTPATH_COUNT 17
 
 namespace trace
 {
@@ -15,6 +17,8 @@ private:
     mdMemberRef beginMethodFastPathRefs[FASTPATH_COUNT];
     mdMemberRef endVoidMemberRef = mdMemberRefNil;
     mdMemberRef logExceptionRef = mdMemberRefNil;
+    mdTypeRef integrationSwitchTypeRef = mdTypeRefNil;
+    mdMemberRef callTargetStateIsSkippedRef = mdMemberRefNil;
 
     HRESULT WriteBeginMethodWithArgumentsArray(void* rewriterWrapperPtr, mdTypeRef integrationTypeRef,
                                                const TypeInfo* currentType, ILInstr** instruction);
@@ -39,6 +43,12 @@ public:
     HRESULT WriteEndReturnMemberRef(void* rewriterWrapperPtr, mdTypeRef integrationTypeRef, const TypeInfo* currentType,
                                     TypeSignature* returnArgument, ILInstr** instruction);
 
+    // Field ref to CallTargetIntegrationSwitch<TIntegration, TTarget>.Disabled, mdMemberRefNil if it can't be defined
+    mdMemberRef GetIntegrationDisabledFieldRef(mdTypeRef integrationTypeRef, const TypeInfo* currentType);
+
+    // Method ref to the CallTargetState.IsSkipped getter, mdMemberRefNil if it can't be defined
+    mdMemberRef GetCallTargetStateIsSkippedMemberRef();
+
     HRESULT WriteLogException(void* rewriterWrapperPtr, mdTypeRef integrationTypeRef, const TypeInfo* currentType,
                               ILInstr** instruction);
 };
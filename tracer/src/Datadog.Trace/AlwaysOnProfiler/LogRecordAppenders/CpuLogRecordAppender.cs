@@ -10,7 +10,7 @@ internal class CpuLogRecordAppender : ILogRecordAppender
 {
     private static readonly IDatadogLogger Log = DatadogLogging.GetLoggerFor(typeof(CpuLogRecordAppender));
     private readonly ThreadSampleProcessor _threadSampleProcessor;
-    private readonly byte[] _buffer;
+    private byte[] _buffer;
 
     public CpuLogRecordAppender(ThreadSampleProcessor processor, byte[] buffer)
     {
@@ -29,8 +29,8 @@ internal class CpuLogRecordAppender : ILogRecordAppender
         try
         {
             // Call twice in quick succession to catch up any blips; the second will likely return 0 (no buffer)
-            AddLogRecordFromThreadSamples(_buffer, results);
-            AddLogRecordFromThreadSamples(_buffer, results);
+            AddLogRecordFromThreadSamples(results);
+            AddLogRecordFromThreadSamples(results);
         }
         catch (Exception ex)
         {
@@ -38,17 +38,25 @@ internal class CpuLogRecordAppender : ILogRecordAppender
         }
     }
 
-    private void AddLogRecordFromThreadSamples(byte[] buffer, List<LogRecord> logRecords)
+    private void AddLogRecordFromThreadSamples(List<LogRecord> logRecords)
     {
-        var read = NativeMethods.SignalFxReadThreadSamples(buffer.Length, buffer);
+        // The native side converts the batch to pprof, no intermediate ThreadSample objects are needed
+        var read = NativeMethods.SignalFxReadThreadSamplesPprof(_buffer.Length, _buffer, _threadSampleProcessor.ThreadSamplingPeriodMilliseconds, out var totalFrameCount);
+        if (read < 0)
+        {
+            // The profile is larger than the buffer: it is kept on the native side until it is read with a larger one.
+            Log.Debug("Growing the cpu samples buffer to {Size} bytes.", -read);
+            _buffer = new byte[-read];
+            read = NativeMethods.SignalFxReadThreadSamplesPprof(_buffer.Length, _buffer, _threadSampleProcessor.ThreadSamplingPeriodMilliseconds, out totalFrameCount);
+        }
+
         if (read <= 0)
         {
             // No data just return.
             return;
         }
 
-        var threadSamples = SampleNativeFormatParser.ParseThreadSamples(buffer, read);
-        var logRecord = _threadSampleProcessor.ProcessThreadSamples(threadSamples);
+        var logRecord = _threadSampleProcessor.ProcessThreadSamplesPprof(_buffer, read, totalFrameCount);
 
         if (logRecord != null)
         {
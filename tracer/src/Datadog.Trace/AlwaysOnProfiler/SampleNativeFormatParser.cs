@@ -116,6 +116,11 @@ namespace Datadog.Trace.AlwaysOnProfiler
                                 new object[] { microsSuspended, numThreads, totalFrames, numCacheMisses });
                         }
                     }
+                    else if (operationCode == OpCodes.FrameLines)
+                    {
+                        // The source lines of the frames are only used by the native pprof encoder, they end the batch.
+                        break;
+                    }
                     else
                     {
                         position = read + 1;
@@ -312,6 +317,11 @@ namespace Datadog.Trace.AlwaysOnProfiler
             /// Marks the start of an allocation sample, see THREAD_SAMPLES_ALLOCATION_SAMPLE on native code.
             /// </summary>
             public const byte AllocationSample = 0x08;
+
+            /// <summary>
+            /// Marks the source lines of the frames of the batch, see kThreadSamplesFrameLines on native code.
+            /// </summary>
+            public const byte FrameLines = 0x09;
         }
     }
 }
@@ -42,6 +42,20 @@ namespace Datadog.Trace.AlwaysOnProfiler
             return BuildLogRecord(cpuProfile, _profilingDataTypeCpu, totalFrameCount);
         }
 
+        public long ThreadSamplingPeriodMilliseconds => (long)_threadSamplingPeriod.TotalMilliseconds;
+
+        public LogRecord ProcessThreadSamplesPprof(byte[] pprofBuffer, int length, int totalFrameCount)
+        {
+            if (pprofBuffer == null || length < 1)
+            {
+                return null;
+            }
+
+            var cpuProfile = Serialize(pprofBuffer, length);
+
+            return BuildLogRecord(cpuProfile, _profilingDataTypeCpu, totalFrameCount);
+        }
+
         public LogRecord ProcessAllocationSamples(List<AllocationSample> allocationSamples)
         {
             if (allocationSamples == null || allocationSamples.Count < 1)
@@ -90,6 +104,19 @@ namespace Datadog.Trace.AlwaysOnProfiler
             return Convert.ToBase64String(byteArray);
         }
 
+        private static string Serialize(byte[] pprofBuffer, int length)
+        {
+            using var memoryStream = new MemoryStream();
+            using (var compressionStream = new GZipStream(memoryStream, CompressionMode.Compress))
+            {
+                compressionStream.Write(pprofBuffer, 0, length);
+                compressionStream.Flush();
+            }
+
+            var byteArray = memoryStream.ToArray();
+            return Convert.ToBase64String(byteArray);
+        }
+
         private static SampleBuilder CreateSampleBuilder(Pprof pprof, ThreadSample threadSample)
         {
             var sampleBuilder = new SampleBuilder();
@@ -6,9 +6,10 @@
 #nullable enable
 
 using System;
-using System.Collections.Concurrent;
 using System.ComponentModel;
 using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Threading;
 using System.Threading.Tasks;
 using Datadog.Trace.ClrProfiler.CallTarget;
 using Datadog.Trace.Configuration;
@@ -24,21 +25,23 @@ namespace Datadog.Trace.ClrProfiler.AutoInstrumentation.TraceAnnotations
     public class TraceAnnotationsIntegration
     {
         internal static readonly IntegrationId IntegrationId = IntegrationId.TraceAnnotations;
-        private static readonly ConcurrentDictionary<RuntimeHandleTuple, TraceAnnotationInfo> InstrumentedMethodCache = new ConcurrentDictionary<RuntimeHandleTuple, TraceAnnotationInfo>();
+        private static readonly object InstrumentedMethodCacheLock = new();
+
+        // Indexed by the id allocated by the native profiler when it rewrites the method
+        private static StrongBox<TraceAnnotationInfo>?[] _instrumentedMethodCache = new StrongBox<TraceAnnotationInfo>?[64];
 
         /// <summary>
         /// OnMethodBegin callback
         /// </summary>
         /// <typeparam name="TTarget">Type of the target</typeparam>
         /// <param name="instance">Instance value, aka `this` of the instrumented method.</param>
+        /// <param name="methodId">The id of the instrumented method, allocated by the native profiler</param>
         /// <param name="methodHandle">The RuntimeMethodHandle representing the instrumented method</param>
         /// <param name="typeHandle">The RuntimeTypeHandle representing the instrumented method's owning type</param>
         /// <returns>Calltarget state value</returns>
-        internal static CallTargetState OnMethodBegin<TTarget>(TTarget instance, RuntimeMethodHandle methodHandle, RuntimeTypeHandle typeHandle)
+        internal static CallTargetState OnMethodBegin<TTarget>(TTarget instance, int methodId, RuntimeMethodHandle methodHandle, RuntimeTypeHandle typeHandle)
         {
-            var info = InstrumentedMethodCache.GetOrAdd(
-                    new RuntimeHandleTuple(methodHandle, typeHandle),
-                    key => TraceAnnotationInfoFactory.Create(MethodBase.GetMethodFromHandle(key.MethodHandle, key.TypeHandle)));
+            var info = GetTraceAnnotationInfo(methodId, methodHandle, typeHandle);
 
             var tags = new TraceAnnotationTags();
             var scope = Tracer.Instance.StartActiveInternal(info.OperationName, tags: tags);
@@ -107,5 +110,37 @@ namespace Datadog.Trace.ClrProfiler.AutoInstrumentation.TraceAnnotations
             state.Scope.DisposeWithException(exception);
             return returnValue;
         }
+
+        private static TraceAnnotationInfo GetTraceAnnotationInfo(int methodId, RuntimeMethodHandle methodHandle, RuntimeTypeHandle typeHandle)
+        {
+            var cache = Volatile.Read(ref _instrumentedMethodCache);
+            if ((uint)methodId < (uint)cache.Length && cache[methodId] is { } cachedInfo)
+            {
+                return cachedInfo.Value;
+            }
+
+            // First call of the method: resolve it once through reflection
+            var info = TraceAnnotationInfoFactory.Create(MethodBase.GetMethodFromHandle(methodHandle, typeHandle));
+            if (methodId < 0)
+            {
+                return info;
+            }
+
+            lock (InstrumentedMethodCacheLock)
+            {
+                cache = _instrumentedMethodCache;
+                if (methodId >= cache.Length)
+                {
+                    var newCache = new StrongBox<TraceAnnotationInfo>?[Math.Max(cache.Length * 2, methodId + 1)];
+                    Array.Copy(cache, newCache, cache.Length);
+                    cache = newCache;
+                }
+
+                cache[methodId] = new StrongBox<TraceAnnotationInfo>(info);
+                Volatile.Write(ref _instrumentedMethodCache, cache);
+            }
+
+            return info;
+        }
     }
 }
@@ -0,0 +1,68 @@
+// <copyright file="CallTargetIntegrationSwitch.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using System.ComponentModel;
+using System.Diagnostics.CodeAnalysis;
+using System.Threading;
+using Datadog.Trace.ClrProfiler.CallTarget.Handlers;
+
+namespace Datadog.Trace.ClrProfiler.CallTarget
+{
+    /// <summary>
+    /// Runtime switch of an integration, checked by the instrumented methods before the CallTarget invoker calls
+    /// </summary>
+    /// <typeparam name="TIntegration">Integration type</typeparam>
+    /// <typeparam name="TTarget">Target type</typeparam>
+    [Browsable(false)]
+    [EditorBrowsable(EditorBrowsableState.Never)]
+    public static class CallTargetIntegrationSwitch<TIntegration, TTarget>
+    {
+        // Static fields are initialized in declaration order: SetEnabled can be called by another thread as soon as
+        // the switch is registered, so Disabled (which registers it) must stay the last one.
+        private static readonly object Lock = new();
+
+        private static bool _switchedOff;
+        private static bool _faulted;
+
+        /// <summary>
+        /// Whether the integration is disabled, the instrumented methods skip BeginMethod and EndMethod while it is set.
+        /// The native profiler loads this field with ldsfld, its name and type must not change.
+        /// </summary>
+        [SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1401:FieldsMustBePrivate", Justification = "Read by the IL of the instrumented methods")]
+        public static bool Disabled = Initialize();
+
+        /// <summary>
+        /// Enables or disables the integration, called by <see cref="IntegrationSwitches"/>
+        /// </summary>
+        internal static void SetEnabled(bool enabled)
+        {
+            lock (Lock)
+            {
+                _switchedOff = !enabled;
+                Volatile.Write(ref Disabled, _switchedOff || _faulted);
+            }
+        }
+
+        /// <summary>
+        /// Disables the integration after an error, it stays disabled even if it is enabled again
+        /// </summary>
+        internal static void DisableDueToError()
+        {
+            lock (Lock)
+            {
+                _faulted = true;
+                Volatile.Write(ref Disabled, true);
+            }
+        }
+
+        private static bool Initialize()
+        {
+            // Only the field initializers run on type initialization (no static constructor),
+            // so the JIT can initialize the type eagerly instead of checking it on each ldsfld.
+            _switchedOff = IntegrationSwitches.Register(typeof(TIntegration), typeof(TTarget), SetEnabled);
+            return _switchedOff;
+        }
+    }
+}
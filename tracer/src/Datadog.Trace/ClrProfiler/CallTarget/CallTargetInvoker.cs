@@ -266,6 +266,402 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
                 return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8);
             }
 
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12, TArg13 arg13)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12, TArg13 arg13, TArg14 arg14)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <typeparam name="TArg15">Fifteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <param name="arg15">Fifteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12, TArg13 arg13, TArg14 arg14, TArg15 arg15)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14, ref arg15);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <typeparam name="TArg15">Fifteenth argument type</typeparam>
+        /// <typeparam name="TArg16">Sixteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <param name="arg15">Fifteenth argument value</param>
+        /// <param name="arg16">Sixteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15, TArg16>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12, TArg13 arg13, TArg14 arg14, TArg15 arg15, TArg16 arg16)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15, TArg16>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14, ref arg15, ref arg16);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1>(TTarget instance, ref TArg1 arg1)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1>.Invoke(instance, ref arg1);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2>.Invoke(instance, ref arg1, ref arg2);
+            }
+
             return CallTargetState.GetDefault();
         }
 
@@ -275,16 +671,20 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TIntegration">Integration type</typeparam>
         /// <typeparam name="TTarget">Target type</typeparam>
         /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1>(TTarget instance, ref TArg1 arg1)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1>.Invoke(instance, ref arg1);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3>.Invoke(instance, ref arg1, ref arg2, ref arg3);
             }
 
             return CallTargetState.GetDefault();
@@ -297,17 +697,21 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TTarget">Target type</typeparam>
         /// <typeparam name="TArg1">First argument type</typeparam>
         /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2>.Invoke(instance, ref arg1, ref arg2);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4);
             }
 
             return CallTargetState.GetDefault();
@@ -321,18 +725,22 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg1">First argument type</typeparam>
         /// <typeparam name="TArg2">Second argument type</typeparam>
         /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
         /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3>.Invoke(instance, ref arg1, ref arg2, ref arg3);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5);
             }
 
             return CallTargetState.GetDefault();
@@ -347,19 +755,23 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg2">Second argument type</typeparam>
         /// <typeparam name="TArg3">Third argument type</typeparam>
         /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
         /// <param name="arg3">Third argument value</param>
         /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6);
             }
 
             return CallTargetState.GetDefault();
@@ -375,20 +787,24 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg3">Third argument type</typeparam>
         /// <typeparam name="TArg4">Fourth argument type</typeparam>
         /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
         /// <param name="arg3">Third argument value</param>
         /// <param name="arg4">Fourth argument value</param>
         /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7);
             }
 
             return CallTargetState.GetDefault();
@@ -405,6 +821,8 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg4">Fourth argument type</typeparam>
         /// <typeparam name="TArg5">Fifth argument type</typeparam>
         /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
@@ -412,14 +830,50 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <param name="arg4">Fourth argument value</param>
         /// <param name="arg5">Fifth argument value</param>
         /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8);
+            }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9);
             }
 
             return CallTargetState.GetDefault();
@@ -437,6 +891,9 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg5">Fifth argument type</typeparam>
         /// <typeparam name="TArg6">Sixth argument type</typeparam>
         /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
@@ -445,14 +902,17 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <param name="arg5">Fifth argument value</param>
         /// <param name="arg6">Sixth argument value</param>
         /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10);
             }
 
             return CallTargetState.GetDefault();
@@ -471,6 +931,9 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <typeparam name="TArg6">Sixth argument type</typeparam>
         /// <typeparam name="TArg7">Seventh argument type</typeparam>
         /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
         /// <param name="instance">Instance value</param>
         /// <param name="arg1">First argument value</param>
         /// <param name="arg2">Second argument value</param>
@@ -480,19 +943,260 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         /// <param name="arg6">Sixth argument value</param>
         /// <param name="arg7">Seventh argument value</param>
         /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
         /// <returns>Call target state</returns>
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8)
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11)
         {
             if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
             {
                 IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
-                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8);
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11, ref TArg12 arg12)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11, ref TArg12 arg12, ref TArg13 arg13)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11, ref TArg12 arg12, ref TArg13 arg13, ref TArg14 arg14)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <typeparam name="TArg15">Fifteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <param name="arg15">Fifteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11, ref TArg12 arg12, ref TArg13 arg13, ref TArg14 arg14, ref TArg15 arg15)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14, ref arg15);
+            }
+
+            return CallTargetState.GetDefault();
+        }
+
+        /// <summary>
+        /// Begin Method Invoker
+        /// </summary>
+        /// <typeparam name="TIntegration">Integration type</typeparam>
+        /// <typeparam name="TTarget">Target type</typeparam>
+        /// <typeparam name="TArg1">First argument type</typeparam>
+        /// <typeparam name="TArg2">Second argument type</typeparam>
+        /// <typeparam name="TArg3">Third argument type</typeparam>
+        /// <typeparam name="TArg4">Fourth argument type</typeparam>
+        /// <typeparam name="TArg5">Fifth argument type</typeparam>
+        /// <typeparam name="TArg6">Sixth argument type</typeparam>
+        /// <typeparam name="TArg7">Seventh argument type</typeparam>
+        /// <typeparam name="TArg8">Eighth argument type</typeparam>
+        /// <typeparam name="TArg9">Ninth argument type</typeparam>
+        /// <typeparam name="TArg10">Tenth argument type</typeparam>
+        /// <typeparam name="TArg11">Eleventh argument type</typeparam>
+        /// <typeparam name="TArg12">Twelfth argument type</typeparam>
+        /// <typeparam name="TArg13">Thirteenth argument type</typeparam>
+        /// <typeparam name="TArg14">Fourteenth argument type</typeparam>
+        /// <typeparam name="TArg15">Fifteenth argument type</typeparam>
+        /// <typeparam name="TArg16">Sixteenth argument type</typeparam>
+        /// <param name="instance">Instance value</param>
+        /// <param name="arg1">First argument value</param>
+        /// <param name="arg2">Second argument value</param>
+        /// <param name="arg3">Third argument value</param>
+        /// <param name="arg4">Fourth argument value</param>
+        /// <param name="arg5">Fifth argument value</param>
+        /// <param name="arg6">Sixth argument value</param>
+        /// <param name="arg7">Seventh argument value</param>
+        /// <param name="arg8">Eighth argument value</param>
+        /// <param name="arg9">Ninth argument value</param>
+        /// <param name="arg10">Tenth argument value</param>
+        /// <param name="arg11">Eleventh argument value</param>
+        /// <param name="arg12">Twelfth argument value</param>
+        /// <param name="arg13">Thirteenth argument value</param>
+        /// <param name="arg14">Fourteenth argument value</param>
+        /// <param name="arg15">Fifteenth argument value</param>
+        /// <param name="arg16">Sixteenth argument value</param>
+        /// <returns>Call target state</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static CallTargetState BeginMethod<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15, TArg16>(TTarget instance, ref TArg1 arg1, ref TArg2 arg2, ref TArg3 arg3, ref TArg4 arg4, ref TArg5 arg5, ref TArg6 arg6, ref TArg7 arg7, ref TArg8 arg8, ref TArg9 arg9, ref TArg10 arg10, ref TArg11 arg11, ref TArg12 arg12, ref TArg13 arg13, ref TArg14 arg14, ref TArg15 arg15, ref TArg16 arg16)
+        {
+            if (IntegrationOptions<TIntegration, TTarget>.IsIntegrationEnabled)
+            {
+                IntegrationOptions<TIntegration, TTarget>.RecordTelemetry();
+                return BeginMethodHandler<TIntegration, TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15, TArg16>.Invoke(instance, ref arg1, ref arg2, ref arg3, ref arg4, ref arg5, ref arg6, ref arg7, ref arg8, ref arg9, ref arg10, ref arg11, ref arg12, ref arg13, ref arg14, ref arg15, ref arg16);
             }
 
             return CallTargetState.GetDefault();
         }
 
+            return CallTargetState.GetDefault();
+        }
+
         /// <summary>
         /// Begin Method Invoker Slow Path
         /// </summary>
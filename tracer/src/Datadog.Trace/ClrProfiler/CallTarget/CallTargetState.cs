@@ -23,6 +23,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         private readonly DateTimeOffset? _startTime;
 
         private readonly IReadOnlyDictionary<string, string> _previousDistributedSpanContext;
+        private readonly bool _isInitialized;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="CallTargetState"/> struct.
@@ -35,6 +36,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
             _state = null;
             _startTime = null;
             _previousDistributedSpanContext = null;
+            _isInitialized = true;
         }
 
         /// <summary>
@@ -49,6 +51,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
             _state = state;
             _startTime = null;
             _previousDistributedSpanContext = null;
+            _isInitialized = true;
         }
 
         /// <summary>
@@ -64,6 +67,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
             _state = state;
             _startTime = startTime;
             _previousDistributedSpanContext = null;
+            _isInitialized = true;
         }
 
         internal CallTargetState(Scope previousScope, IReadOnlyDictionary<string, string> previousDistributedSpanContext, CallTargetState state)
@@ -73,6 +77,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
             _state = state._state;
             _startTime = state._startTime;
             _previousDistributedSpanContext = previousDistributedSpanContext;
+            _isInitialized = true;
         }
 
         /// <summary>
@@ -94,6 +99,13 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
 
         internal IReadOnlyDictionary<string, string> PreviousDistributedSpanContext => _previousDistributedSpanContext;
 
+        /// <summary>
+        /// Gets a value indicating whether the BeginMethod call was skipped.
+        /// Only the zeroed state written with initobj by an instrumented method while its integration was disabled
+        /// is not initialized, the native profiler calls this getter to skip the EndMethod call as well.
+        /// </summary>
+        public bool IsSkipped => !_isInitialized;
+
         /// <summary>
         /// Gets the default call target state (used by the native side to initialize the locals)
         /// </summary>
@@ -101,7 +113,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static CallTargetState GetDefault()
         {
-            return default;
+            return new CallTargetState((Scope)null);
         }
 
         /// <summary>
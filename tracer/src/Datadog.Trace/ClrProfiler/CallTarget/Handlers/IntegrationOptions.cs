@@ -6,6 +6,7 @@
 using System;
 using System.Reflection;
 using System.Runtime.CompilerServices;
+using System.Threading;
 using Datadog.Trace.Configuration;
 using Datadog.Trace.DuckTyping;
 using Datadog.Trace.Logging;
@@ -17,12 +18,12 @@ namespace Datadog.Trace.ClrProfiler.CallTarget.Handlers
         private static readonly IDatadogLogger Log = DatadogLogging.GetLoggerFor(typeof(IntegrationOptions<TIntegration, TTarget>));
 
         private static readonly Lazy<IntegrationId?> _integrationId = new(() => InstrumentationDefinitions.GetIntegrationId(typeof(TIntegration).FullName, typeof(TTarget)));
-        private static volatile bool _disableIntegration = false;
 
-        internal static bool IsIntegrationEnabled => !_disableIntegration;
+        // The instrumented methods check the same switch before calling the invoker
+        internal static bool IsIntegrationEnabled => !Volatile.Read(ref CallTargetIntegrationSwitch<TIntegration, TTarget>.Disabled);
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        internal static void DisableIntegration() => _disableIntegration = true;
+        internal static void DisableIntegration() => CallTargetIntegrationSwitch<TIntegration, TTarget>.DisableDueToError();
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         internal static void LogException(Exception exception, string message = null)
@@ -37,7 +38,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget.Handlers
                     Tracer.Instance.TracerManager.Telemetry.IntegrationDisabledDueToError(_integrationId.Value.Value, nameof(DuckTypeException));
                 }
 
-                _disableIntegration = true;
+                DisableIntegration();
             }
             else if (exception is CallTargetInvokerException)
             {
@@ -47,7 +48,7 @@ namespace Datadog.Trace.ClrProfiler.CallTarget.Handlers
                     Tracer.Instance.TracerManager.Telemetry.IntegrationDisabledDueToError(_integrationId.Value.Value, nameof(CallTargetInvokerException));
                 }
 
-                _disableIntegration = true;
+                DisableIntegration();
             }
         }
 
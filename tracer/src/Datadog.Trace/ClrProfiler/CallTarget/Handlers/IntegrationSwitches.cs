@@ -0,0 +1,75 @@
+// <copyright file="IntegrationSwitches.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using System;
+using System.Collections.Generic;
+using Datadog.Trace.Configuration;
+
+namespace Datadog.Trace.ClrProfiler.CallTarget.Handlers
+{
+    /// <summary>
+    /// Enables and disables the integrations at runtime, without a rejit of the instrumented methods.
+    /// Each CallTargetIntegrationSwitch instantiation registers itself the first time an instrumented method reads it.
+    /// </summary>
+    internal static class IntegrationSwitches
+    {
+        private static readonly object Lock = new();
+        private static readonly List<KeyValuePair<IntegrationId, Action<bool>>> Switches = new();
+        private static readonly HashSet<IntegrationId> DisabledIntegrations = new();
+
+        /// <summary>
+        /// Registers the switch of an integration and target type pair
+        /// </summary>
+        /// <returns>Whether the integration is currently disabled</returns>
+        internal static bool Register(Type integrationType, Type targetType, Action<bool> setEnabled)
+        {
+            if (InstrumentationDefinitions.GetIntegrationId(integrationType.FullName, targetType) is not { } integrationId)
+            {
+                return false;
+            }
+
+            lock (Lock)
+            {
+                Switches.Add(new KeyValuePair<IntegrationId, Action<bool>>(integrationId, setEnabled));
+                return DisabledIntegrations.Contains(integrationId);
+            }
+        }
+
+        /// <summary>
+        /// Applies the Enabled settings of all the integrations, called each time the tracer settings are replaced
+        /// </summary>
+        internal static void ApplySettings(ImmutableIntegrationSettingsCollection integrations)
+        {
+            var settings = integrations.Settings;
+            for (var i = 0; i < settings.Length; i++)
+            {
+                SetIntegrationEnabled((IntegrationId)i, settings[i].Enabled != false);
+            }
+        }
+
+        /// <summary>
+        /// Enables or disables all the instrumented methods of an integration, including the ones instrumented later
+        /// </summary>
+        internal static void SetIntegrationEnabled(IntegrationId integrationId, bool enabled)
+        {
+            lock (Lock)
+            {
+                bool changed = enabled ? DisabledIntegrations.Remove(integrationId) : DisabledIntegrations.Add(integrationId);
+                if (!changed)
+                {
+                    return;
+                }
+
+                foreach (var integrationSwitch in Switches)
+                {
+                    if (integrationSwitch.Key == integrationId)
+                    {
+                        integrationSwitch.Value(enabled);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -125,6 +125,11 @@ namespace Datadog.Trace.ClrProfiler
             return IsWindows ? Windows.SignalFxReadThreadSamples(len, buf) : NonWindows.SignalFxReadThreadSamples(len, buf);
         }
 
+        public static int SignalFxReadThreadSamplesPprof(int len, byte[] buf, long samplingPeriodMillis, out int frameCount)
+        {
+            return IsWindows ? Windows.SignalFxReadThreadSamplesPprof(len, buf, samplingPeriodMillis, out frameCount) : NonWindows.SignalFxReadThreadSamplesPprof(len, buf, samplingPeriodMillis, out frameCount);
+        }
+
         public static int SignalFxReadAllocationSamples(int len, byte[] buf)
         {
             return IsWindows ? Windows.SignalFxReadAllocationSamples(len, buf) : NonWindows.SignalFxReadAllocationSamples(len, buf);
@@ -170,6 +175,9 @@ namespace Datadog.Trace.ClrProfiler
             [DllImport("SignalFx.Tracing.ClrProfiler.Native.dll")]
             public static extern int SignalFxReadThreadSamples(int len, byte[] buf);
 
+            [DllImport("SignalFx.Tracing.ClrProfiler.Native.dll")]
+            public static extern int SignalFxReadThreadSamplesPprof(int len, byte[] buf, long samplingPeriodMillis, out int frameCount);
+
             [DllImport("SignalFx.Tracing.ClrProfiler.Native.dll")]
             public static extern int SignalFxReadAllocationSamples(int len, byte[] buf);
 
@@ -204,6 +212,9 @@ namespace Datadog.Trace.ClrProfiler
             [DllImport("SignalFx.Tracing.ClrProfiler.Native")]
             public static extern int SignalFxReadThreadSamples(int len, byte[] buf);
 
+            [DllImport("SignalFx.Tracing.ClrProfiler.Native")]
+            public static extern int SignalFxReadThreadSamplesPprof(int len, byte[] buf, long samplingPeriodMillis, out int frameCount);
+
             [DllImport("SignalFx.Tracing.ClrProfiler.Native")]
             public static extern int SignalFxReadAllocationSamples(int len, byte[] buf);
 
@@ -62,6 +62,24 @@ namespace Datadog.Trace.ContinuousProfiler
             WriteToNative(SpanContext.Zero);
         }
 
+        public bool GetRootSpansTimes(ulong[] localRootSpanIds, long[] cpuTimes, long[] wallTimes, int count)
+        {
+            if (!IsEnabled)
+            {
+                return false;
+            }
+
+            try
+            {
+                return NativeInterop.GetRootSpansTimes(localRootSpanIds, cpuTimes, wallTimes, count);
+            }
+            catch (Exception e)
+            {
+                Log.Warning(e, "Failed to get the profiling times of {Count} root spans", count);
+                return false;
+            }
+        }
+
         private void EnsureIsInitialized()
         {
             if (_traceContextPtr.IsValueCreated)
@@ -12,5 +12,11 @@ namespace Datadog.Trace.ContinuousProfiler
         void Set(ulong localRootSpanId, ulong spanId);
 
         void Reset();
+
+        /// <summary>
+        /// Reads the CPU and wall time sampled by the profiler while each of the <paramref name="count"/> local root spans was active.
+        /// The profiler forgets the times of a root span once they have been read.
+        /// </summary>
+        bool GetRootSpansTimes(ulong[] localRootSpanIds, long[] cpuTimes, long[] wallTimes, int count);
     }
 }
@@ -29,6 +29,12 @@ namespace Datadog.Trace.ContinuousProfiler
             NativeMethods.SetApplicationInfoForAppDomain(runtimeId, serviceName, environment, version);
         }
 
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        public static bool GetRootSpansTimes(ulong[] localRootSpanIds, long[] cpuTimes, long[] wallTimes, int count)
+        {
+            return NativeMethods.GetRootSpansTimes(localRootSpanIds, cpuTimes, wallTimes, count);
+        }
+
         private static class NativeMethods
         {
             [DllImport(dllName: "Datadog.Profiler.Native", EntryPoint = "GetNativeProfilerIsReadyPtr")]
@@ -39,6 +45,9 @@ namespace Datadog.Trace.ContinuousProfiler
 
             [DllImport(dllName: "Datadog.Profiler.Native", EntryPoint = "SetApplicationInfoForAppDomain")]
             public static extern void SetApplicationInfoForAppDomain(string runtimeId, string serviceName, string environment, string version);
+
+            [DllImport(dllName: "Datadog.Profiler.Native", EntryPoint = "GetRootSpansTimes")]
+            public static extern bool GetRootSpansTimes(ulong[] localRootSpanIds, [Out] long[] cpuTimes, [Out] long[] wallTimes, int count);
         }
     }
 }
@@ -0,0 +1,221 @@
+// <copyright file="ProfilingMetricsWriter.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using System;
+using System.Collections.Concurrent;
+using System.Threading;
+using System.Threading.Tasks;
+using Datadog.Trace.Agent;
+using Datadog.Trace.Logging;
+
+namespace Datadog.Trace.ContinuousProfiler
+{
+    /// <summary>
+    /// Attaches the CPU and wall time sampled by the profiler to the local root spans before writing their trace.
+    /// The profiler aggregates its samples once per <see cref="AggregationPeriod"/>: the traces are held for at least
+    /// one period so the last samples of short root spans are counted, then the times of all the held root spans
+    /// are read with a single call. The traces are therefore exported 1 to 2 periods later, which is why this writer is
+    /// only used when the native profiler is loaded with code hotspots enabled.
+    /// </summary>
+    internal class ProfilingMetricsWriter : IAgentWriter
+    {
+        /// <summary>
+        /// Period of the sample aggregation of the profiler.
+        /// </summary>
+        internal static readonly TimeSpan AggregationPeriod = TimeSpan.FromSeconds(1);
+
+        /// <summary>
+        /// Beyond this number of held traces (e.g. if the profiler stopped aggregating), traces are written without the metrics.
+        /// </summary>
+        internal const int MaxPendingTraces = 10_000;
+
+        private static readonly IDatadogLogger Log = DatadogLogging.GetLoggerFor<ProfilingMetricsWriter>();
+
+        private readonly IAgentWriter _innerWriter;
+        private readonly IContextTracker _contextTracker;
+        private readonly ConcurrentQueue<ArraySegment<Span>> _pendingTraces = new ConcurrentQueue<ArraySegment<Span>>();
+        private readonly TaskCompletionSource<bool> _processExit = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+        private readonly Task _processTask;
+        private readonly object _processLock = new object();
+
+        private int _pendingTracesCount;
+
+        // traces held for a whole period, written by the next ProcessPendingTraces
+        private int _readyTracesCount;
+
+        private ulong[] _localRootSpanIds = new ulong[16];
+        private long[] _cpuTimes = new long[16];
+        private long[] _wallTimes = new long[16];
+        private Span[] _rootSpans = new Span[16];
+
+        public ProfilingMetricsWriter(IAgentWriter innerWriter, IContextTracker contextTracker, bool automaticProcessing = true)
+        {
+            _innerWriter = innerWriter;
+            _contextTracker = contextTracker;
+
+            _processTask = automaticProcessing ? Task.Run(ProcessPendingTracesLoopAsync) : Task.CompletedTask;
+            _processTask.ContinueWith(t => Log.Error(t.Exception, "Error in the profiling metrics task"), TaskContinuationOptions.OnlyOnFaulted);
+        }
+
+        public void WriteTrace(ArraySegment<Span> trace)
+        {
+            // the span ids are only sent to the profiler when the context tracker is enabled
+            if (trace.Count == 0 || _processExit.Task.IsCompleted || !_contextTracker.IsEnabled || GetRootSpan(trace) == null)
+            {
+                _innerWriter.WriteTrace(trace);
+                return;
+            }
+
+            if (Interlocked.Increment(ref _pendingTracesCount) > MaxPendingTraces)
+            {
+                Interlocked.Decrement(ref _pendingTracesCount);
+                _innerWriter.WriteTrace(trace);
+                return;
+            }
+
+            _pendingTraces.Enqueue(trace);
+        }
+
+        public Task<bool> Ping()
+        {
+            return _innerWriter.Ping();
+        }
+
+        public Task FlushTracesAsync()
+        {
+            ProcessPendingTraces(all: true);
+            return _innerWriter.FlushTracesAsync();
+        }
+
+        public async Task FlushAndCloseAsync()
+        {
+            if (_processExit.TrySetResult(true))
+            {
+                await _processTask.ConfigureAwait(false);
+                ProcessPendingTraces(all: true);
+            }
+
+            await _innerWriter.FlushAndCloseAsync().ConfigureAwait(false);
+        }
+
+        /// <summary>
+        /// Writes the traces held for a whole period, or all the held traces when flushing.
+        /// </summary>
+        internal void ProcessPendingTraces(bool all)
+        {
+            lock (_processLock)
+            {
+                var count = all ? Volatile.Read(ref _pendingTracesCount) : _readyTracesCount;
+                var traces = new ArraySegment<Span>[count];
+                var dequeued = 0;
+                while (dequeued < count && _pendingTraces.TryDequeue(out var trace))
+                {
+                    traces[dequeued++] = trace;
+                }
+
+                Interlocked.Add(ref _pendingTracesCount, -dequeued);
+
+                // the traces written since the previous call wait for the next aggregation
+                _readyTracesCount = Volatile.Read(ref _pendingTracesCount);
+
+                if (dequeued == 0)
+                {
+                    return;
+                }
+
+                AddProfilingMetrics(traces, dequeued);
+
+                for (int i = 0; i < dequeued; i++)
+                {
+                    _innerWriter.WriteTrace(traces[i]);
+                }
+            }
+        }
+
+        private static Span GetRootSpan(ArraySegment<Span> trace)
+        {
+            var rootSpan = trace.Array[trace.Offset].Context.TraceContext?.RootSpan;
+            if (rootSpan == null)
+            {
+                return null;
+            }
+
+            // partial flushes write the root span with the last chunk of the trace
+            for (int i = trace.Offset; i < trace.Offset + trace.Count; i++)
+            {
+                if (trace.Array[i] == rootSpan)
+                {
+                    return rootSpan;
+                }
+            }
+
+            return null;
+        }
+
+        private void AddProfilingMetrics(ArraySegment<Span>[] traces, int count)
+        {
+            if (_localRootSpanIds.Length < count)
+            {
+                var length = Math.Max(count, _localRootSpanIds.Length * 2);
+                _localRootSpanIds = new ulong[length];
+                _cpuTimes = new long[length];
+                _wallTimes = new long[length];
+                _rootSpans = new Span[length];
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                _rootSpans[i] = GetRootSpan(traces[i]);
+                _localRootSpanIds[i] = _rootSpans[i].SpanId;
+            }
+
+            try
+            {
+                if (_contextTracker.GetRootSpansTimes(_localRootSpanIds, _cpuTimes, _wallTimes, count))
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        // no sample was collected while the root span was active
+                        if (_cpuTimes[i] == 0 && _wallTimes[i] == 0)
+                        {
+                            continue;
+                        }
+
+                        _rootSpans[i].SetMetric(Metrics.ProfilingCpuTime, _cpuTimes[i]);
+                        _rootSpans[i].SetMetric(Metrics.ProfilingWallTime, _wallTimes[i]);
+                    }
+                }
+            }
+            catch (Exception e)
+            {
+                Log.Warning(e, "Failed to get the profiling times of {Count} root spans", count);
+            }
+
+            Array.Clear(_rootSpans, 0, count);
+        }
+
+        private async Task ProcessPendingTracesLoopAsync()
+        {
+            while (true)
+            {
+                await Task.WhenAny(Task.Delay(AggregationPeriod), _processExit.Task).ConfigureAwait(false);
+
+                if (_processExit.Task.IsCompleted)
+                {
+                    return;
+                }
+
+                try
+                {
+                    ProcessPendingTraces(all: false);
+                }
+                catch (Exception e)
+                {
+                    Log.Error(e, "An error occured while writing the traces with their profiling metrics");
+                }
+            }
+        }
+    }
+}
@@ -64,6 +64,16 @@ namespace Datadog.Trace.Debugger.Instrumentation
             return defaultState;
         }
 
+        /// <summary>
+        /// Determines whether the arguments and locals of the current execution should be captured.
+        /// The instrumented code skips all the LogArg and LogLocal calls when it returns false,
+        /// so an execution that is not captured (e.g. rate limited) only pays for this check.
+        /// </summary>
+        /// <param name="state">Debugger state</param>
+        /// <returns>true if the arguments and locals should be captured, false otherwise</returns>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool ShouldCapture(ref MethodDebuggerState state) => state.IsActive;
+
         /// <summary>
         /// Ends the markering of BeginMethod.
         /// </summary>
@@ -49,6 +49,42 @@ namespace Datadog.Trace.Debugger.PInvoke
                                  .ToArray();
         }
 
+        /// <summary>
+        /// Gets the status of all the probes known by the native side, without sending their ids.
+        /// </summary>
+        /// <param name="expectedProbesCount">The number of probes expected, used to size the statuses buffer</param>
+        public static ProbeStatus[] GetProbesStatusesSnapshot(int expectedProbesCount)
+        {
+            var probesStatuses = new NativeProbeStatus[Math.Max(expectedProbesCount, 1)];
+            int probesLength = GetProbesStatusesSnapshot(probesStatuses);
+
+            if (probesLength > probesStatuses.Length)
+            {
+                // More probes than expected, retry with a buffer large enough
+                probesStatuses = new NativeProbeStatus[probesLength];
+                probesLength = Math.Min(GetProbesStatusesSnapshot(probesStatuses), probesStatuses.Length);
+            }
+
+            if (probesLength == 0)
+            {
+                return Array.Empty<ProbeStatus>();
+            }
+
+            return probesStatuses.Take(probesLength)
+                                 .Select(
+                                      nativeProbeStatus =>
+                                          new ProbeStatus(
+                                              Marshal.PtrToStringUni(nativeProbeStatus.ProbeId), nativeProbeStatus.Status))
+                                 .ToArray();
+        }
+
+        private static int GetProbesStatusesSnapshot(NativeProbeStatus[] probesStatuses)
+        {
+            return FrameworkDescription.Instance.IsWindows() ?
+                       Windows.GetProbesStatusesSnapshot(probesStatuses, probesStatuses.Length) :
+                       NonWindows.GetProbesStatusesSnapshot(probesStatuses, probesStatuses.Length);
+        }
+
         // the "dll" extension is required on .NET Framework
         // and optional on .NET Core
         private static partial class Windows
@@ -67,6 +103,11 @@ namespace Datadog.Trace.Debugger.PInvoke
                 [In, MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr, SizeParamIndex = 1)] string[] probeIds,
                 int probeIdsLength,
                 [In, Out] NativeProbeStatus[] probeStatuses);
+
+            [DllImport("SignalFx.Tracing.ClrProfiler.Native.dll")]
+            public static extern int GetProbesStatusesSnapshot(
+                [In, Out] NativeProbeStatus[] probeStatuses,
+                int probeStatusesLength);
         }
 
         // assume .NET Core if not running on Windows
@@ -86,6 +127,11 @@ namespace Datadog.Trace.Debugger.PInvoke
                 [In, MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr, SizeParamIndex = 1)] string[] probeIds,
                 int probeIdsLength,
                 [In, Out] NativeProbeStatus[] probeStatuses);
+
+            [DllImport("SignalFx.Tracing.ClrProfiler.Native")]
+            public static extern int GetProbesStatusesSnapshot(
+                [In, Out] NativeProbeStatus[] probeStatuses,
+                int probeStatusesLength);
         }
     }
 }
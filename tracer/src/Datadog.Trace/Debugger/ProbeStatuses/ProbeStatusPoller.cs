@@ -5,7 +5,6 @@
 
 using System;
 using System.Collections.Generic;
-using System.Linq;
 using System.Threading;
 using Datadog.Trace.Debugger.PInvoke;
 using Datadog.Trace.Debugger.Sink;
@@ -61,11 +60,15 @@ namespace Datadog.Trace.Debugger.ProbeStatuses
                     return;
                 }
 
-                var probeStatuses = DebuggerNativeMethods.GetProbesStatuses(_probes.ToArray());
+                // A single snapshot of all the native probes, rather than sending every probe id on each poll
+                var probeStatuses = DebuggerNativeMethods.GetProbesStatusesSnapshot(_probes.Count);
 
                 foreach (var probeStatus in probeStatuses)
                 {
-                    _probeStatusSink.AddProbeStatus(probeStatus.ProbeId, probeStatus.Status);
+                    if (_probes.Contains(probeStatus.ProbeId))
+                    {
+                        _probeStatusSink.AddProbeStatus(probeStatus.ProbeId, probeStatus.Status);
+                    }
                 }
             }
         }
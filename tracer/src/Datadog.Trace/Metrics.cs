@@ -53,5 +53,15 @@ namespace Datadog.Trace
         /// The process id.
         /// </summary>
         internal const string ProcessId = "process_id";
+
+        /// <summary>
+        /// CPU time (in nanoseconds) sampled by the profiler while the local root span was active.
+        /// </summary>
+        internal const string ProfilingCpuTime = "profiling.cpu_time_ns";
+
+        /// <summary>
+        /// Wall time (in nanoseconds) sampled by the profiler while the local root span was active.
+        /// </summary>
+        internal const string ProfilingWallTime = "profiling.wall_time_ns";
     }
 }
@@ -13,6 +13,7 @@ using System.Threading;
 using System.Threading.Tasks;
 using Datadog.Trace.Agent;
 using Datadog.Trace.ClrProfiler;
+using Datadog.Trace.ClrProfiler.CallTarget.Handlers;
 using Datadog.Trace.Configuration;
 using Datadog.Trace.Conventions;
 using Datadog.Trace.DogStatsd;
@@ -487,6 +488,7 @@ namespace Datadog.Trace
             }
 
             var newManager = factory.CreateTracerManager(settings, _instance);
+            IntegrationSwitches.ApplySettings(newManager.Settings.Integrations);
 
             if (_firstInitialization)
             {
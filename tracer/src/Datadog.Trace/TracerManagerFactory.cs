@@ -203,7 +203,16 @@ namespace Datadog.Trace
                     var statsAggregator = StatsAggregator.Create(api, settings);
 
                     const int maxBufferSize = 1024 * 1024 * 10;
-                    return new AgentWriter(api, statsAggregator, metrics, maxBufferSize: maxBufferSize);
+                    var agentWriter = new AgentWriter(api, statsAggregator, metrics, maxBufferSize: maxBufferSize);
+
+                    // the traces are held until the native profiler has aggregated the samples of their root span
+                    var contextTracker = Profiler.Instance.ContextTracker;
+                    if (!contextTracker.IsEnabled)
+                    {
+                        return agentWriter;
+                    }
+
+                    return new ProfilingMetricsWriter(agentWriter, contextTracker);
             }
         }
 
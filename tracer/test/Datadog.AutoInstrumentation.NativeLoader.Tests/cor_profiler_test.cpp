@@ -2,6 +2,7 @@
 #include "test_dynamic_instance.h"
 #include "test_dynamic_dispatcher.h"
 #include "test_cor_profiler.h"
+#include "test_routing_cor_profiler.h"
 #include "../../src/Datadog.AutoInstrumentation.NativeLoader/cor_profiler.h"
 
 TEST(cor_profiler, CallBackTests)
@@ -548,3 +549,126 @@ TEST(cor_profiler, CallBackTests)
     delete test_instance_profiler;
     delete test_dispatcher;
 }
+
+TEST(cor_profiler, CallBacksAreOnlyDispatchedToSubscribedProfilers)
+{
+    TestDynamicDispatcherImpl* test_dispatcher = new TestDynamicDispatcherImpl();
+
+    TestDynamicInstanceImpl* test_instance = CreateTestDynamicInstance(false);
+    TestCorProfiler* test_instance_profiler = new TestCorProfiler();
+    test_instance->SetProfilerCallback(test_instance_profiler);
+    test_dispatcher->SetContinuousProfilerInstance(std::unique_ptr<IDynamicInstance>(test_instance));
+
+    TestDynamicInstanceImpl* test_instance2 = CreateTestDynamicInstance(false);
+    TestCorProfiler* test_instance_profiler2 = new TestCorProfiler();
+    test_instance2->SetProfilerCallback(test_instance_profiler2);
+    test_dispatcher->SetTracerInstance(std::unique_ptr<IDynamicInstance>(test_instance2));
+
+    TestDynamicInstanceImpl* test_instance3 = CreateTestDynamicInstance(false);
+    TestCorProfiler* test_instance_profiler3 = new TestCorProfiler();
+    test_instance3->SetProfilerCallback(test_instance_profiler3);
+    test_dispatcher->SetCustomInstance(std::unique_ptr<IDynamicInstance>(test_instance3));
+
+    TestRoutingCorProfiler* profiler = new TestRoutingCorProfiler(test_dispatcher);
+
+    // Initialize fails without a real ICorProfilerInfo but the profilers are set
+    EXPECT_HRESULT_FAILED(profiler->Initialize(test_instance_profiler));
+
+    // Continuous profiler: threads + GC, Tracer: modules + JIT + assembly references, Custom: unknown mask
+    profiler->UpdateCallbackSubscribers(COR_PRF_MONITOR_THREADS | COR_PRF_MONITOR_GC, 0,
+                                        COR_PRF_MONITOR_MODULE_LOADS | COR_PRF_MONITOR_JIT_COMPILATION,
+                                        COR_PRF_HIGH_ADD_ASSEMBLY_REFERENCES, 0xFFFFFFFF, 0xFFFFFFFF);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->ThreadCreated(NULL));
+    EXPECT_EQ(1, test_instance_profiler->m_ThreadCreated);
+    EXPECT_EQ(0, test_instance_profiler2->m_ThreadCreated);
+    EXPECT_EQ(1, test_instance_profiler3->m_ThreadCreated);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->GarbageCollectionFinished());
+    EXPECT_EQ(1, test_instance_profiler->m_GarbageCollectionFinished);
+    EXPECT_EQ(0, test_instance_profiler2->m_GarbageCollectionFinished);
+    EXPECT_EQ(1, test_instance_profiler3->m_GarbageCollectionFinished);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->ModuleLoadStarted(0));
+    EXPECT_EQ(0, test_instance_profiler->m_ModuleLoadStarted);
+    EXPECT_EQ(1, test_instance_profiler2->m_ModuleLoadStarted);
+    EXPECT_EQ(1, test_instance_profiler3->m_ModuleLoadStarted);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->JITInlining(0, 0, nullptr));
+    EXPECT_EQ(0, test_instance_profiler->m_JITInlining);
+    EXPECT_EQ(1, test_instance_profiler2->m_JITInlining);
+    EXPECT_EQ(1, test_instance_profiler3->m_JITInlining);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->GetAssemblyReferences(nullptr, nullptr));
+    EXPECT_EQ(0, test_instance_profiler->m_GetAssemblyReferences);
+    EXPECT_EQ(1, test_instance_profiler2->m_GetAssemblyReferences);
+    EXPECT_EQ(1, test_instance_profiler3->m_GetAssemblyReferences);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->ExceptionThrown(0));
+    EXPECT_EQ(0, test_instance_profiler->m_ExceptionThrown);
+    EXPECT_EQ(0, test_instance_profiler2->m_ExceptionThrown);
+    EXPECT_EQ(1, test_instance_profiler3->m_ExceptionThrown);
+
+    // Callbacks without event flag are sent to all profilers
+    EXPECT_HRESULT_SUCCEEDED(profiler->ProfilerAttachComplete());
+    EXPECT_EQ(1, test_instance_profiler->m_ProfilerAttachComplete);
+    EXPECT_EQ(1, test_instance_profiler2->m_ProfilerAttachComplete);
+    EXPECT_EQ(1, test_instance_profiler3->m_ProfilerAttachComplete);
+
+    // EventPipe sessions can be started without the EventPipe event flag: events are sent to all profilers
+    EXPECT_HRESULT_SUCCEEDED(profiler->EventPipeProviderCreated(NULL));
+    EXPECT_EQ(1, test_instance_profiler->m_EventPipeProviderCreated);
+    EXPECT_EQ(1, test_instance_profiler2->m_EventPipeProviderCreated);
+    EXPECT_EQ(1, test_instance_profiler3->m_EventPipeProviderCreated);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->EventPipeEventDelivered(NULL, NULL, NULL, 0, NULL, 0, NULL, NULL, NULL, NULL, 0, nullptr));
+    EXPECT_EQ(1, test_instance_profiler->m_EventPipeEventDelivered);
+    EXPECT_EQ(1, test_instance_profiler2->m_EventPipeEventDelivered);
+    EXPECT_EQ(1, test_instance_profiler3->m_EventPipeEventDelivered);
+
+    // Clean up
+    delete profiler;
+    delete test_instance_profiler;
+    delete test_dispatcher;
+}
+
+TEST(cor_profiler, CallBacksAreDispatchedToAllProfilersUntilTheirMasksAreKnown)
+{
+    TestDynamicDispatcherImpl* test_dispatcher = new TestDynamicDispatcherImpl();
+
+    TestDynamicInstanceImpl* test_instance = CreateTestDynamicInstance(false);
+    TestCorProfiler* test_instance_profiler = new TestCorProfiler();
+    test_instance->SetProfilerCallback(test_instance_profiler);
+    test_dispatcher->SetContinuousProfilerInstance(std::unique_ptr<IDynamicInstance>(test_instance));
+
+    TestDynamicInstanceImpl* test_instance2 = CreateTestDynamicInstance(false);
+    TestCorProfiler* test_instance_profiler2 = new TestCorProfiler();
+    test_instance2->SetProfilerCallback(test_instance_profiler2);
+    test_dispatcher->SetTracerInstance(std::unique_ptr<IDynamicInstance>(test_instance2));
+
+    TestRoutingCorProfiler* profiler = new TestRoutingCorProfiler(test_dispatcher);
+
+    // Initialize fails without a real ICorProfilerInfo but the profilers are set
+    EXPECT_HRESULT_FAILED(profiler->Initialize(test_instance_profiler));
+
+    BOOL shouldInline = TRUE;
+    EXPECT_HRESULT_SUCCEEDED(profiler->JITInlining(0, 0, &shouldInline));
+    EXPECT_EQ(1, test_instance_profiler->m_JITInlining);
+    EXPECT_EQ(1, test_instance_profiler2->m_JITInlining);
+
+    // only the continuous profiler is subscribed to the JIT callbacks
+    profiler->UpdateCallbackSubscribers(COR_PRF_MONITOR_JIT_COMPILATION, 0, COR_PRF_MONITOR_MODULE_LOADS, 0, 0, 0);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->JITInlining(0, 0, &shouldInline));
+    EXPECT_EQ(2, test_instance_profiler->m_JITInlining);
+    EXPECT_EQ(1, test_instance_profiler2->m_JITInlining);
+
+    EXPECT_HRESULT_SUCCEEDED(profiler->ModuleLoadStarted(0));
+    EXPECT_EQ(0, test_instance_profiler->m_ModuleLoadStarted);
+    EXPECT_EQ(1, test_instance_profiler2->m_ModuleLoadStarted);
+
+    // Clean up
+    delete profiler;
+    delete test_instance_profiler;
+    delete test_dispatcher;
+}
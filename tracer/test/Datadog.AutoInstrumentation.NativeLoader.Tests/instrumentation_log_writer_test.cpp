@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "../../src/Datadog.AutoInstrumentation.NativeLoader/instrumented_assembly_generator/instrumented_assembly_generator_log_writer.h"
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace instrumented_assembly_generator;
+
+namespace
+{
+struct LogRecord
+{
+    uint8_t kind;
+    std::string fileName;
+    std::string payload;
+};
+
+// Same decoding as the managed InstrumentationLogReader
+std::vector<LogRecord> ReadLog(const fs::path& logFilePath)
+{
+    std::ifstream stream(logFilePath, std::ios::in | std::ios::binary);
+    const std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    size_t position = 0;
+    const auto readInt32 = [&content, &position]() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(content[position++])) << (8 * i);
+        }
+        return value;
+    };
+
+    std::vector<LogRecord> records;
+    while (position < content.size())
+    {
+        LogRecord record;
+        record.kind = static_cast<uint8_t>(content[position++]);
+        const auto fileNameLength = readInt32();
+        record.fileName = content.substr(position, fileNameLength);
+        position += fileNameLength;
+        const auto payloadLength = readInt32();
+        record.payload = content.substr(position, payloadLength);
+        position += payloadLength;
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+fs::path GetTestLogFilePath(const char* name)
+{
+    const auto logFilePath = fs::temp_directory_path() / name;
+    fs::remove(logFilePath);
+    return logFilePath;
+}
+} // namespace
+
+TEST(InstrumentationLogWriter, RecordsAreWrittenInOrder)
+{
+    const auto logFilePath = GetTestLogFilePath("InstrumentationLogWriterTest_Order.records");
+
+    {
+        InstrumentationLogWriter writer(logFilePath);
+        const unsigned char bytes[] = {0x00, 0x2A, 0xFF, 0x0A};
+        writer.AppendText(WStr("method.txt"), WStr("first line\n"));
+        writer.WriteBytes(WStr("module.bin"), bytes, sizeof(bytes));
+        writer.AppendText(WStr("method.txt"), WStr("second line \u00E9\n"));
+        writer.Stop();
+    }
+
+    const auto records = ReadLog(logFilePath);
+    ASSERT_EQ(3, records.size());
+
+    EXPECT_EQ(0, records[0].kind);
+    EXPECT_EQ("method.txt", records[0].fileName);
+    EXPECT_EQ("first line\n", records[0].payload);
+
+    EXPECT_EQ(1, records[1].kind);
+    EXPECT_EQ("module.bin", records[1].fileName);
+    EXPECT_EQ(std::string("\x00\x2A\xFF\x0A", 4), records[1].payload);
+
+    // text payloads are UTF-8
+    EXPECT_EQ(0, records[2].kind);
+    EXPECT_EQ("second line \xC3\xA9\n", records[2].payload);
+
+    fs::remove(logFilePath);
+}
+
+TEST(InstrumentationLogWriter, RecordsAfterStopAreDropped)
+{
+    const auto logFilePath = GetTestLogFilePath("InstrumentationLogWriterTest_Stop.records");
+
+    {
+        InstrumentationLogWriter writer(logFilePath);
+        writer.AppendText(WStr("method.txt"), WStr("kept"));
+        writer.Stop();
+        writer.AppendText(WStr("method.txt"), WStr("dropped"));
+    }
+
+    const auto records = ReadLog(logFilePath);
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ("kept", records[0].payload);
+
+    fs::remove(logFilePath);
+}
+
+TEST(InstrumentationLogWriter, ManyRecordsAreNotLost)
+{
+    const auto logFilePath = GetTestLogFilePath("InstrumentationLogWriterTest_Many.records");
+
+    // more records than the queue can hold: the producer waits for the writer thread
+    const int recordsCount = 10000;
+    {
+        InstrumentationLogWriter writer(logFilePath);
+        for (int i = 0; i < recordsCount; i++)
+        {
+            writer.AppendText(WStr("method.txt"), shared::ToWSTRING(std::to_string(i)));
+        }
+    }
+
+    const auto records = ReadLog(logFilePath);
+    ASSERT_EQ(recordsCount, records.size());
+    EXPECT_EQ("0", records.front().payload);
+    EXPECT_EQ(std::to_string(recordsCount - 1), records.back().payload);
+
+    fs::remove(logFilePath);
+}
@@ -29,6 +29,76 @@ TEST(string, ToWSTRING)
     EXPECT_TRUE(WStr("42") == ToWSTRING(42));
 }
 
+TEST(string, ToStringNonAscii)
+{
+    // 2, 3 and 4 (surrogate pair) bytes UTF-8 sequences
+    EXPECT_EQ("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", ToString(WSTRING(WStr("caf\u00E9 \u20AC \U0001F600"))));
+
+    // unpaired surrogates are replaced by U+FFFD
+    const WCHAR loneSurrogates[] = {0xD800, 'a', 0xDC00, 0};
+    EXPECT_EQ("\xEF\xBF\xBD" "a" "\xEF\xBF\xBD", ToString(WSTRING(loneSurrogates)));
+
+    // strings longer than the ASCII fast path block, with non ASCII characters across the blocks
+    const auto asciiPart = WSTRING(WStr("System.Collections.Generic.Dictionary"));
+    const auto longString = asciiPart + WStr("\u00E9") + asciiPart + WStr("\U0001F600") + asciiPart;
+    const auto expected = ToString(asciiPart) + "\xC3\xA9" + ToString(asciiPart) + "\xF0\x9F\x98\x80" + ToString(asciiPart);
+    EXPECT_EQ(expected, ToString(longString));
+    EXPECT_TRUE(longString == ToWSTRING(expected));
+}
+
+TEST(string, ToWSTRINGNonAscii)
+{
+    EXPECT_TRUE(WSTRING(WStr("caf\u00E9 \u20AC \U0001F600")) == ToWSTRING("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80"));
+
+    // embedded null characters are kept
+    EXPECT_EQ(3, ToWSTRING(std::string("a\0b", 3)).size());
+
+    // invalid bytes, overlong encodings and truncated sequences are replaced by U+FFFD
+    EXPECT_TRUE(WSTRING(WStr("\uFFFDa")) == ToWSTRING("\xFF" "a"));
+    EXPECT_TRUE(WSTRING(WStr("\uFFFD\uFFFD")) == ToWSTRING("\xC0\xAF"));
+    EXPECT_TRUE(WSTRING(WStr("\uFFFDa")) == ToWSTRING("\xE2\x82" "a"));
+}
+
+TEST(string, ConvertIntoBuffer)
+{
+    const auto wstr = WSTRING(WStr("Datadog.Trace.\u00C9tat"));
+
+    std::vector<char> utf8(MaxUtf8Length(wstr.size()));
+    const auto utf8Length = ToUtf8(wstr.data(), wstr.size(), utf8.data());
+    EXPECT_EQ("Datadog.Trace.\xC3\x89tat", std::string(utf8.data(), utf8Length));
+
+    std::vector<WCHAR> utf16(MaxUtf16Length(utf8Length));
+    const auto utf16Length = ToUtf16(utf8.data(), utf8Length, utf16.data());
+    EXPECT_TRUE(wstr == WSTRING(utf16.data(), utf16Length));
+
+    // the result capacity is reused
+    std::string result;
+    result.reserve(64);
+    const auto capacity = result.capacity();
+    ToString(wstr.data(), wstr.size(), result);
+    EXPECT_EQ("Datadog.Trace.\xC3\x89tat", result);
+    EXPECT_EQ(capacity, result.capacity());
+
+    WSTRING wresult;
+    ToWSTRING(result.data(), result.size(), wresult);
+    EXPECT_TRUE(wstr == wresult);
+}
+
+TEST(string, ToStringIsSizedExactly)
+{
+    const auto asciiPart = WSTRING(WStr("System.Collections.Generic.Dictionary"));
+    const WCHAR loneSurrogate[] = {0xDC00, 0};
+    const auto wstr = asciiPart + WStr("\u00E9\u20AC\U0001F600") + loneSurrogate + asciiPart;
+
+    std::vector<char> utf8(MaxUtf8Length(wstr.size()));
+    const auto utf8Length = ToUtf8(wstr.data(), wstr.size(), utf8.data());
+
+    // the capacity is not the MaxUtf8Length of the string
+    const auto result = ToString(wstr);
+    EXPECT_EQ(std::string(utf8.data(), utf8Length), result);
+    EXPECT_LT(result.capacity(), MaxUtf8Length(wstr.size()));
+}
+
 TEST(string, Trim)
 {
     EXPECT_TRUE(WStr("WideString") == Trim(WStr("               WideString")));
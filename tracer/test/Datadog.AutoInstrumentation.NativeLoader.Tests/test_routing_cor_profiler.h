@@ -0,0 +1,14 @@
+#pragma once
+#include "../../src/Datadog.AutoInstrumentation.NativeLoader/cor_profiler.h"
+
+using namespace datadog::shared::nativeloader;
+
+class TestRoutingCorProfiler : public CorProfiler
+{
+public:
+    TestRoutingCorProfiler(IDynamicDispatcher* dispatcher) : CorProfiler(dispatcher)
+    {
+    }
+
+    using CorProfiler::UpdateCallbackSubscribers;
+};
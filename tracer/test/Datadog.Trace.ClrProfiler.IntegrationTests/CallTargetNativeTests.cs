@@ -7,6 +7,7 @@
 
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 using System.Text.RegularExpressions;
 using Datadog.Trace.TestHelpers;
 using Xunit;
@@ -24,9 +25,10 @@ namespace Datadog.Trace.ClrProfiler.IntegrationTests
 
         public static IEnumerable<object[]> MethodArgumentsData()
         {
-            for (int i = 0; i < 10; i++)
+            // 10 and 16 are the bounds of the BeginMethod overloads for more than 9 arguments
+            foreach (int i in Enumerable.Range(0, 10).Concat(new[] { 10, 16, 17 }))
             {
-                bool fastPath = i < 9;
+                bool fastPath = i <= 16;
                 yield return new object[] { i, fastPath };
             }
         }
@@ -1,14 +1,250 @@
 #include "pch.h"
 
+#include <algorithm>
 #include <codecvt>
+#include <fstream>
+#include <iterator>
 #include <locale>
+#include <map>
 #include <string>
 #include <vector>
 
 #include "../../src/Datadog.Trace.ClrProfiler.Native/always_on_profiler.h"
+#include "../../src/Datadog.Trace.ClrProfiler.Native/always_on_profiler_pdb.h"
+#include "../../src/Datadog.Trace.ClrProfiler.Native/always_on_profiler_pprof.h"
 
 using namespace always_on_profiler;
 
+namespace
+{
+// Decodes the subset of the pprof Profile message written by ThreadSamplesPprofEncoder
+struct DecodedProfile
+{
+    struct Label
+    {
+        int64_t key = 0;
+        int64_t str = 0;
+        int64_t num = 0;
+    };
+
+    struct Sample
+    {
+        std::vector<uint64_t> location_ids;
+        std::vector<Label> labels;
+    };
+
+    struct Function
+    {
+        int64_t name = 0;
+        int64_t file_name = 0;
+    };
+
+    struct Location
+    {
+        uint64_t function_id = 0;
+        int64_t line = 0;
+    };
+
+    std::vector<std::string> strings;
+    std::map<uint64_t, Function> functions;
+    std::map<uint64_t, Location> locations;
+    std::vector<Sample> samples;
+
+    const std::string& FunctionName(uint64_t location_id) const
+    {
+        return strings.at(functions.at(locations.at(location_id).function_id).name);
+    }
+
+    const std::string& FileName(uint64_t location_id) const
+    {
+        return strings.at(functions.at(locations.at(location_id).function_id).file_name);
+    }
+
+    const Label* FindLabel(const Sample& sample, const std::string& key) const
+    {
+        for (const auto& label : sample.labels)
+        {
+            if (strings.at(label.key) == key)
+            {
+                return &label;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class ProtobufReader
+{
+public:
+    ProtobufReader(const unsigned char* data, size_t length) : data_(data), end_(data + length)
+    {
+    }
+
+    bool AtEnd() const
+    {
+        return data_ >= end_;
+    }
+
+    uint64_t ReadVarint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; data_ < end_; shift += 7)
+        {
+            const auto byte = *data_++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        ADD_FAILURE() << "truncated varint";
+        return 0;
+    }
+
+    // Reads a field key, the wire type is checked against the expected one (varint for the first field if two are given)
+    int ReadField(int expected_wire_type, int other_fields_wire_type = -1)
+    {
+        const auto key = ReadVarint();
+        const auto field = static_cast<int>(key >> 3);
+        const auto wire_type = static_cast<int>(key & 0x07);
+        if (other_fields_wire_type >= 0 && field != 1)
+        {
+            expected_wire_type = other_fields_wire_type;
+        }
+        EXPECT_EQ(expected_wire_type, wire_type) << "field " << field;
+        return field;
+    }
+
+    ProtobufReader ReadLengthDelimited()
+    {
+        const auto length = ReadVarint();
+        EXPECT_LE(length, static_cast<uint64_t>(end_ - data_));
+        const ProtobufReader nested(data_, length);
+        data_ += length;
+        return nested;
+    }
+
+    std::string ReadString()
+    {
+        const auto nested = ReadLengthDelimited();
+        return std::string(reinterpret_cast<const char*>(nested.data_), nested.end_ - nested.data_);
+    }
+
+private:
+    const unsigned char* data_;
+    const unsigned char* end_;
+};
+
+DecodedProfile DecodeProfile(const std::vector<unsigned char>& profile)
+{
+    DecodedProfile decoded;
+    ProtobufReader reader(profile.data(), profile.size());
+    while (!reader.AtEnd())
+    {
+        // all the Profile fields written by the encoder are length delimited
+        const auto field = reader.ReadField(2);
+        if (field == 6)
+        {
+            decoded.strings.push_back(reader.ReadString());
+            continue;
+        }
+
+        auto message = reader.ReadLengthDelimited();
+        if (field == 2)
+        {
+            DecodedProfile::Sample sample;
+            while (!message.AtEnd())
+            {
+                const auto sample_field = message.ReadField(2);
+                auto nested = message.ReadLengthDelimited();
+                if (sample_field == 1)
+                {
+                    while (!nested.AtEnd())
+                    {
+                        sample.location_ids.push_back(nested.ReadVarint());
+                    }
+                }
+                else
+                {
+                    EXPECT_EQ(3, sample_field);
+                    DecodedProfile::Label label;
+                    while (!nested.AtEnd())
+                    {
+                        const auto label_field = nested.ReadField(0);
+                        const auto value = static_cast<int64_t>(nested.ReadVarint());
+                        (label_field == 1 ? label.key : label_field == 2 ? label.str : label.num) = value;
+                    }
+                    sample.labels.push_back(label);
+                }
+            }
+            decoded.samples.push_back(sample);
+        }
+        else if (field == 4)
+        {
+            uint64_t id = 0;
+            DecodedProfile::Location location;
+            while (!message.AtEnd())
+            {
+                const auto location_field = message.ReadField(0, 2);
+                if (location_field == 1)
+                {
+                    id = message.ReadVarint();
+                }
+                else
+                {
+                    EXPECT_EQ(4, location_field);
+                    auto line = message.ReadLengthDelimited();
+                    while (!line.AtEnd())
+                    {
+                        const auto line_field = line.ReadField(0);
+                        const auto value = line.ReadVarint();
+                        if (line_field == 1)
+                        {
+                            location.function_id = value;
+                        }
+                        else
+                        {
+                            location.line = static_cast<int64_t>(value);
+                        }
+                    }
+                }
+            }
+            EXPECT_EQ(0, decoded.locations.count(id));
+            decoded.locations[id] = location;
+        }
+        else
+        {
+            EXPECT_EQ(5, field);
+            uint64_t id = 0;
+            DecodedProfile::Function function;
+            while (!message.AtEnd())
+            {
+                const auto function_field = message.ReadField(0);
+                const auto value = message.ReadVarint();
+                if (function_field == 1)
+                {
+                    id = value;
+                }
+                else
+                {
+                    (function_field == 2 ? function.name : function.file_name) = static_cast<int64_t>(value);
+                }
+            }
+            EXPECT_EQ(0, decoded.functions.count(id));
+            decoded.functions[id] = function;
+        }
+    }
+    return decoded;
+}
+
+// Files copied next to the test executable, which is run from its output directory
+std::vector<unsigned char> ReadTestFile(const char* file_name)
+{
+    std::ifstream stream(file_name, std::ios::in | std::ios::binary);
+    return std::vector<unsigned char>((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+}
+} // namespace
+
 TEST(AlwaysOnProfilerTest, ThreadStateTracking)
 {
     AlwaysOnProfiler ts; // Do NOT call StartSampling on this, which will create a background thread, etc.
@@ -103,6 +339,266 @@ TEST(AlwaysOnProfilerTest, BufferOverrunBehavior)
     ASSERT_TRUE(buf.size() < 210000 && buf.size() >= 200000);
 }
 
+TEST(AlwaysOnProfilerTest, PprofEncoding)
+{
+    auto buf = std::vector<unsigned char>();
+    const shared::WSTRING frame1 = WStr("SomeFairlyLongClassName::SomeMildlyLongMethodName");
+    const shared::WSTRING frame2 = WStr("SomeFairlyLongClassName::ADifferentMethodName");
+    ThreadSamplesBuffer tsb(&buf);
+    ThreadState threadState;
+    threadState.thread_name_.append(WStr("Worker"));
+    ThreadState samplerThreadState;
+    samplerThreadState.thread_name_.append(WStr("SignalFx Profiling Sampler Thread"));
+
+    tsb.StartBatch();
+    tsb.StartSample(1, &threadState, thread_span_context(0x1234, 0x5678, 0x9abc, 1));
+    tsb.RecordFrame(7001, frame1);
+    tsb.RecordFrame(7002, frame2);
+    tsb.RecordFrame(7001, frame1);
+    tsb.EndSample();
+    // Samples of the exporting thread are not exported
+    tsb.StartSample(2, &samplerThreadState, thread_span_context());
+    tsb.RecordFrame(7002, frame2);
+    tsb.EndSample();
+    tsb.EndBatch();
+    tsb.WriteFinalStats(SamplingStatistics());
+
+    std::vector<unsigned char> profile;
+    ThreadSamplesPprofEncoder encoder;
+    ASSERT_EQ(3, encoder.Encode(buf.data(), buf.size(), 10000, &profile));
+    ASSERT_FALSE(profile.empty());
+
+    const auto decoded = DecodeProfile(profile);
+    ASSERT_EQ("", decoded.strings[0]);
+    // Strings are only written once, whatever the number of frames using them
+    for (size_t i = 0; i < decoded.strings.size(); i++)
+    {
+        for (size_t j = i + 1; j < decoded.strings.size(); j++)
+        {
+            EXPECT_NE(decoded.strings[i], decoded.strings[j]);
+        }
+    }
+    ASSERT_EQ(std::find(decoded.strings.begin(), decoded.strings.end(), "SignalFx Profiling Sampler Thread"),
+              decoded.strings.end());
+
+    // Samples of the exporting thread are not exported, the same frame shares its location
+    ASSERT_EQ(1, decoded.samples.size());
+    const auto& sample = decoded.samples[0];
+    ASSERT_EQ(3, sample.location_ids.size());
+    ASSERT_EQ(sample.location_ids[0], sample.location_ids[2]);
+    ASSERT_NE(sample.location_ids[0], sample.location_ids[1]);
+    ASSERT_EQ(2, decoded.locations.size());
+    ASSERT_EQ(2, decoded.functions.size());
+    ASSERT_EQ("SomeFairlyLongClassName::SomeMildlyLongMethodName", decoded.FunctionName(sample.location_ids[0]));
+    ASSERT_EQ("SomeFairlyLongClassName::ADifferentMethodName", decoded.FunctionName(sample.location_ids[1]));
+    ASSERT_EQ("unknown", decoded.FileName(sample.location_ids[0]));
+    ASSERT_EQ(0, decoded.locations.at(sample.location_ids[0]).line);
+
+    const auto thread_name = decoded.FindLabel(sample, "thread.name");
+    ASSERT_NE(nullptr, thread_name);
+    ASSERT_EQ("Worker", decoded.strings.at(thread_name->str));
+    const auto thread_id = decoded.FindLabel(sample, "thread.id");
+    ASSERT_NE(nullptr, thread_id);
+    ASSERT_EQ(1, thread_id->num);
+    const auto span_id = decoded.FindLabel(sample, "span_id");
+    ASSERT_NE(nullptr, span_id);
+    ASSERT_EQ("0000000000009abc", decoded.strings.at(span_id->str));
+    const auto trace_id = decoded.FindLabel(sample, "trace_id");
+    ASSERT_NE(nullptr, trace_id);
+    ASSERT_EQ("00000000000012340000000000005678", decoded.strings.at(trace_id->str));
+    const auto period = decoded.FindLabel(sample, "source.event.period");
+    ASSERT_NE(nullptr, period);
+    ASSERT_EQ(10000, period->num);
+    ASSERT_NE(nullptr, decoded.FindLabel(sample, "source.event.time"));
+
+    // A batch with only the exporting thread does not produce a profile
+    buf.clear();
+    ThreadSamplesBuffer samplerOnly(&buf);
+    samplerOnly.StartBatch();
+    samplerOnly.StartSample(2, &samplerThreadState, thread_span_context());
+    samplerOnly.RecordFrame(7002, frame2);
+    samplerOnly.EndSample();
+    samplerOnly.EndBatch();
+    ASSERT_EQ(0, ThreadSamplesPprofEncoder().Encode(buf.data(), buf.size(), 10000, &profile));
+    ASSERT_TRUE(profile.empty());
+}
+
+TEST(AlwaysOnProfilerTest, PprofEncodingWithFrameLines)
+{
+    auto buf = std::vector<unsigned char>();
+    const shared::WSTRING frame1 = WStr("SomeFairlyLongClassName::SomeMildlyLongMethodName");
+    const shared::WSTRING frame2 = WStr("SomeFairlyLongClassName::ADifferentMethodName");
+    const shared::WSTRING file = WStr("/src/SomeFairlyLongClassName.cs");
+    ThreadSamplesBuffer tsb(&buf);
+    ThreadState threadState;
+    threadState.thread_name_.append(WStr("Worker"));
+
+    tsb.StartBatch();
+    tsb.StartSample(1, &threadState, thread_span_context());
+    tsb.RecordFrame(FrameAddress{7001, 0x1000, 100, 0x06000001}, frame1);
+    tsb.RecordFrame(FrameAddress{7002, 0x2000, 100, 0x06000002}, frame2);
+    tsb.RecordFrame(FrameAddress{7001, 0x1010, 100, 0x06000001}, frame1);
+    tsb.EndSample();
+    tsb.EndBatch();
+    tsb.WriteFinalStats(SamplingStatistics());
+
+    // what WriteFrameLines writes once the lines are resolved: frame1 at lines 12 and 20, frame2 unknown
+    const auto write_int = [&buf](int32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            buf.push_back(static_cast<unsigned char>((value >> shift) & 0xFF));
+        }
+    };
+    buf.push_back(0x09);
+    write_int(3);
+    buf.push_back(0xFF);
+    buf.push_back(0xFF); // -1: definition of the file code 1
+    buf.push_back(0x00);
+    buf.push_back(static_cast<unsigned char>(file.length()));
+    const auto file_bytes = reinterpret_cast<const unsigned char*>(file.c_str());
+    buf.insert(buf.end(), file_bytes, file_bytes + file.length() * sizeof(WCHAR));
+    write_int(12);
+    buf.push_back(0x00);
+    buf.push_back(0x00); // unknown line
+    buf.push_back(0x00);
+    buf.push_back(0x01);
+    write_int(20);
+
+    std::vector<unsigned char> profile;
+    ThreadSamplesPprofEncoder encoder;
+    ASSERT_EQ(3, encoder.Encode(buf.data(), buf.size(), 10000, &profile));
+
+    const auto decoded = DecodeProfile(profile);
+    ASSERT_EQ(1, decoded.samples.size());
+    const auto& locations = decoded.samples[0].location_ids;
+    ASSERT_EQ(3, locations.size());
+    // the same function at two lines has two locations
+    ASSERT_EQ(3, decoded.locations.size());
+    ASSERT_EQ("SomeFairlyLongClassName::SomeMildlyLongMethodName", decoded.FunctionName(locations[0]));
+    ASSERT_EQ("/src/SomeFairlyLongClassName.cs", decoded.FileName(locations[0]));
+    ASSERT_EQ(12, decoded.locations.at(locations[0]).line);
+    // the functions of the frames without a line are reported in an unknown file
+    ASSERT_EQ("SomeFairlyLongClassName::ADifferentMethodName", decoded.FunctionName(locations[1]));
+    ASSERT_EQ("unknown", decoded.FileName(locations[1]));
+    ASSERT_EQ(0, decoded.locations.at(locations[1]).line);
+    ASSERT_EQ("SomeFairlyLongClassName::SomeMildlyLongMethodName", decoded.FunctionName(locations[2]));
+    ASSERT_EQ(20, decoded.locations.at(locations[2]).line);
+    ASSERT_EQ(decoded.locations.at(locations[0]).function_id, decoded.locations.at(locations[2]).function_id);
+    ASSERT_EQ(1, std::count(decoded.strings.begin(), decoded.strings.end(), "/src/SomeFairlyLongClassName.cs"));
+
+    // the lines of a truncated trailer are ignored, not the samples
+    buf.resize(buf.size() - 2);
+    ASSERT_EQ(3, ThreadSamplesPprofEncoder().Encode(buf.data(), buf.size(), 10000, &profile));
+    ASSERT_FALSE(profile.empty());
+}
+
+TEST(AlwaysOnProfilerTest, PprofIsKeptWhenTheBufferIsTooSmall)
+{
+    const auto buf = new std::vector<unsigned char>();
+    const shared::WSTRING frame = WStr("SomeFairlyLongClassName::SomeMildlyLongMethodName");
+    ThreadSamplesBuffer tsb(buf);
+    ThreadState threadState;
+    threadState.thread_name_.append(WStr("Worker"));
+    tsb.StartBatch();
+    tsb.StartSample(1, &threadState, thread_span_context());
+    tsb.RecordFrame(7001, frame);
+    tsb.EndSample();
+    tsb.EndBatch();
+    ThreadSamplingRecordProducedThreadSample(buf);
+
+    // the required size is returned and the batch is not lost
+    unsigned char small_buf[8];
+    int32_t frame_count = -1;
+    const auto required = ThreadSamplingConsumeOneThreadSampleAsPprof(sizeof(small_buf), small_buf, 10000, &frame_count);
+    ASSERT_LT(required, 0);
+    ASSERT_EQ(0, frame_count);
+    ASSERT_TRUE(ThreadSamplingShouldProduceThreadSample());
+
+    std::vector<unsigned char> profile(-required);
+    ASSERT_EQ(-required, ThreadSamplingConsumeOneThreadSampleAsPprof(-required, profile.data(), 10000, &frame_count));
+    ASSERT_EQ(1, frame_count);
+    const auto decoded = DecodeProfile(profile);
+    ASSERT_EQ(1, decoded.samples.size());
+    ASSERT_EQ("SomeFairlyLongClassName::SomeMildlyLongMethodName", decoded.FunctionName(decoded.samples[0].location_ids[0]));
+
+    ASSERT_EQ(0, ThreadSamplingConsumeOneThreadSampleAsPprof(-required, profile.data(), 10000, &frame_count));
+}
+
+TEST(AlwaysOnProfilerTest, PortablePdbRejectsOtherFormats)
+{
+    PortablePdb pdb;
+    ASSERT_FALSE(pdb.Load(std::vector<unsigned char>()));
+    ASSERT_FALSE(pdb.Load(std::vector<unsigned char>{'B', 'S', 'J', 'B', 1, 0, 1, 0}));
+    // Windows PDBs start with the MSF signature
+    const std::string msf = "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0\0";
+    ASSERT_FALSE(pdb.Load(std::vector<unsigned char>(msf.begin(), msf.end())));
+
+    unsigned char guid[16];
+    const unsigned char not_an_image[64]{};
+    ASSERT_FALSE(GetCodeViewGuid(not_an_image, true, guid));
+}
+
+// Samples.LineNumbers.dll/.pdb are built with
+//   csc -target:library -debug:portable -optimize- -deterministic -pathmap:<dir>=/src LineNumbers.cs
+// from /src/LineNumbers.cs:
+//  1 namespace Samples.LineNumbers
+//  2 {
+//  3     public static class Calculator
+//  4     {
+//  5         public static int Add(int a, int b)
+//  6         {
+//  7             return a + b;
+//  8         }
+//  9
+// 10         public static int Twice(int a)
+// 11         {
+// 12             var result = Add(a, a);
+// 13             return result;
+// 14         }
+// 15     }
+// 16 }
+TEST(AlwaysOnProfilerTest, PortablePdbSourceLines)
+{
+    PortablePdb pdb;
+    const auto pdb_data = ReadTestFile("Samples.LineNumbers.pdb");
+    ASSERT_FALSE(pdb_data.empty()) << "Samples.LineNumbers.pdb was not found.";
+    ASSERT_TRUE(pdb.Load(pdb_data));
+
+    // Add (MethodDef row 1): sequence points at IL 0, 1 and 7
+    uint32_t document = 0;
+    int32_t line = 0;
+    ASSERT_TRUE(pdb.GetSourceLine(1, 0, document, line));
+    EXPECT_EQ(6, line);
+    ASSERT_TRUE(pdb.GetSourceLine(1, 3, document, line));
+    EXPECT_EQ(7, line);
+    ASSERT_TRUE(pdb.GetSourceLine(1, 7, document, line));
+    EXPECT_EQ(8, line);
+    EXPECT_EQ(1, document);
+    EXPECT_EQ(WStr("/src/LineNumbers.cs"), pdb.GetDocumentName(document));
+
+    // Twice (MethodDef row 2): sequence points at IL 0, 1, 9 and 13
+    ASSERT_TRUE(pdb.GetSourceLine(2, 8, document, line));
+    EXPECT_EQ(12, line);
+    ASSERT_TRUE(pdb.GetSourceLine(2, 9, document, line));
+    EXPECT_EQ(13, line);
+    ASSERT_TRUE(pdb.GetSourceLine(2, 100, document, line));
+    EXPECT_EQ(14, line);
+
+    // no such method or document
+    ASSERT_FALSE(pdb.GetSourceLine(3, 0, document, line));
+    EXPECT_TRUE(pdb.GetDocumentName(2).empty());
+
+    const auto module_data = ReadTestFile("Samples.LineNumbers.dll");
+    ASSERT_FALSE(module_data.empty()) << "Samples.LineNumbers.dll was not found.";
+    unsigned char guid[16];
+    ASSERT_TRUE(GetCodeViewGuid(module_data.data(), true, guid));
+    EXPECT_TRUE(std::equal(std::begin(guid), std::end(guid), pdb.Guid()));
+    // CodeView GUID effd798b-dfd7-4929-9a29-3c0f10d30c0e, stored in the GUID byte order
+    const unsigned char expected_guid[16] = {0x8B, 0x79, 0xFD, 0xEF, 0xD7, 0xDF, 0x29, 0x49,
+                                             0x9A, 0x29, 0x3C, 0x0F, 0x10, 0xD3, 0x0C, 0x0E};
+    EXPECT_TRUE(std::equal(std::begin(guid), std::end(guid), std::begin(expected_guid)));
+}
+
 TEST(AlwaysOnProfilerTest, StaticBufferManagement)
 {
     const auto buf_a = new std::vector<unsigned char>();
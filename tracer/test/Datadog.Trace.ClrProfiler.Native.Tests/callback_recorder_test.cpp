@@ -0,0 +1,67 @@
+#include "pch.h"
+
+#include <cstdio>
+
+#include "../../src/Datadog.Trace.ClrProfiler.Native/callback_recorder.h"
+#include "../benchmarks/Datadog.Trace.ClrProfiler.Native.Replay/replay_cor_profiler_info.h"
+
+using namespace trace;
+using namespace trace::replay;
+
+TEST(CallbackRecorderTest, RecordingCanBeReplayed)
+{
+    // The answers of the "runtime" are served from a recording, as in the replay
+    CallbackRecording source;
+    source.runtime_information = {COR_PRF_CORE_CLR, 6, 0, 1, 0};
+    source.assemblies[10] = {10, WStr("Samples.Console"), 100, 1, WStr("clrhost")};
+    source.modules[100] = {100, WStr("/app/Samples.Console.dll"), 10, 0};
+    source.functions[1000] = {1000, 0, 100, 0x06000001};
+    source.functions[1001] = {1001, 0, 100, 0x06000002};
+
+    ReplayCorProfilerInfo info(source);
+    const auto file_path = std::string("callback_recorder_test.bin");
+
+    {
+        CallbackRecorder recorder(&info, shared::ToWSTRING(file_path));
+        ASSERT_TRUE(recorder.IsOpen());
+
+        recorder.RecordRuntimeInformation(source.runtime_information);
+        recorder.RecordAssemblyLoadFinished(10, S_OK);
+        recorder.RecordModuleLoadFinished(100, S_OK);
+        recorder.RecordJITCompilationStarted(1000, TRUE);
+        recorder.RecordJITInlining(1000, 1001);
+        recorder.RecordReJITError(100, 0x06000002, 1001, E_FAIL);
+        recorder.RecordShutdown();
+    }
+
+    CallbackRecording recording;
+    ASSERT_TRUE(CallbackRecording::Load(file_path, recording));
+    std::remove(file_path.c_str());
+
+    EXPECT_EQ(COR_PRF_CORE_CLR, recording.runtime_information.runtime_type);
+    EXPECT_EQ(6, recording.runtime_information.major_version);
+
+    ASSERT_EQ(1, recording.assemblies.size());
+    EXPECT_EQ(WStr("Samples.Console"), recording.assemblies[10].name);
+    EXPECT_EQ(100, recording.assemblies[10].manifest_module_id);
+    EXPECT_EQ(WStr("clrhost"), recording.assemblies[10].app_domain_name);
+
+    ASSERT_EQ(1, recording.modules.size());
+    EXPECT_EQ(WStr("/app/Samples.Console.dll"), recording.modules[100].path);
+    EXPECT_EQ(10, recording.modules[100].assembly_id);
+
+    ASSERT_EQ(2, recording.functions.size());
+    EXPECT_EQ(100, recording.functions[1001].module_id);
+    EXPECT_EQ(0x06000002, recording.functions[1001].token);
+
+    ASSERT_EQ(6, recording.callbacks.size());
+    EXPECT_EQ(RecordKind::AssemblyLoadFinished, recording.callbacks[0].kind);
+    EXPECT_EQ(RecordKind::JITCompilationStarted, recording.callbacks[2].kind);
+    EXPECT_EQ(TRUE, recording.callbacks[2].flag);
+    EXPECT_EQ(1001, recording.callbacks[3].arg1);
+    EXPECT_EQ(RecordKind::ReJITError, recording.callbacks[4].kind);
+    EXPECT_EQ(1001, recording.callbacks[4].arg2);
+    EXPECT_EQ(E_FAIL, recording.callbacks[4].hr_status);
+    EXPECT_EQ(RecordKind::Shutdown, recording.callbacks[5].kind);
+    EXPECT_LE(recording.callbacks[0].timestamp, recording.callbacks[5].timestamp);
+}
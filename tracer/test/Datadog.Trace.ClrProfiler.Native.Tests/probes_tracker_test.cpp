@@ -0,0 +1,62 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Trace.ClrProfiler.Native/probes_tracker.h"
+
+using namespace debugger;
+
+TEST(ProbesMetadataTrackerTest, ProbeIdsAreIndexedByMethod)
+{
+    const auto tracker = ProbesMetadataTracker::Instance();
+
+    tracker->AddMethodToProbe(WStr("IndexedProbe1"), 1, 0x06000001);
+    tracker->AddMethodToProbe(WStr("IndexedProbe2"), 1, 0x06000001);
+    tracker->AddMethodToProbe(WStr("IndexedProbe2"), 2, 0x06000002);
+
+    EXPECT_EQ(std::set<shared::WSTRING>({WStr("IndexedProbe1"), WStr("IndexedProbe2")}),
+              tracker->GetProbeIds(1, 0x06000001));
+    EXPECT_EQ(std::set<shared::WSTRING>({WStr("IndexedProbe2")}), tracker->GetProbeIds(2, 0x06000002));
+
+    EXPECT_EQ(1, tracker->RemoveProbes({WStr("IndexedProbe2")}));
+
+    EXPECT_EQ(std::set<shared::WSTRING>({WStr("IndexedProbe1")}), tracker->GetProbeIds(1, 0x06000001));
+    EXPECT_TRUE(tracker->GetProbeIds(2, 0x06000002).empty());
+
+    tracker->RemoveProbes({WStr("IndexedProbe1")});
+    EXPECT_TRUE(tracker->GetProbeIds(1, 0x06000001).empty());
+}
+
+TEST(ProbesMetadataTrackerTest, SnapshotReturnsTheStatusOfEveryProbe)
+{
+    const auto tracker = ProbesMetadataTracker::Instance();
+
+    tracker->CreateNewProbeIfNotExists(WStr("SnapshotProbe1"));
+    tracker->AddMethodToProbe(WStr("SnapshotProbe2"), 3, 0x06000003);
+
+    // Query the number of probes first
+    const auto probesCount = tracker->GetProbesStatusesSnapshot(nullptr, 0);
+    ASSERT_EQ(2, probesCount);
+
+    std::vector<DebuggerProbeStatus> probeStatuses(probesCount);
+    ASSERT_EQ(2, tracker->GetProbesStatusesSnapshot(probeStatuses.data(), probesCount));
+
+    std::map<shared::WSTRING, ProbeStatus> statuses;
+    for (const auto& probeStatus : probeStatuses)
+    {
+        statuses[probeStatus.probeId] = probeStatus.status;
+    }
+
+    EXPECT_EQ(ProbeStatus::RECEIVED, statuses[WStr("SnapshotProbe1")]);
+    EXPECT_EQ(ProbeStatus::INSTALLED, statuses[WStr("SnapshotProbe2")]);
+
+    // A smaller buffer receives the first statuses only
+    DebuggerProbeStatus firstStatus{};
+    EXPECT_EQ(2, tracker->GetProbesStatusesSnapshot(&firstStatus, 1));
+    EXPECT_NE(nullptr, firstStatus.probeId);
+
+    // The probe ids outlive the removal of the probes
+    tracker->RemoveProbes({WStr("SnapshotProbe1"), WStr("SnapshotProbe2")});
+    const shared::WSTRING firstProbeId(firstStatus.probeId);
+    EXPECT_TRUE(firstProbeId == WStr("SnapshotProbe1") || firstProbeId == WStr("SnapshotProbe2"));
+
+    EXPECT_EQ(0, tracker->GetProbesStatusesSnapshot(nullptr, 0));
+}
@@ -303,6 +303,34 @@ public class ThreadSampleProcessorTests
         profilingDataType.Value.IntValue.Should().Be(3);
     }
 
+    [Fact]
+    public void Natively_encoded_cpu_profile_is_compressed_into_logRecord_body()
+    {
+        var exporter = new ThreadSampleProcessor(DefaultSettings());
+
+        var nativeProfile = new Profile();
+        nativeProfile.StringTables.Add(string.Empty);
+        nativeProfile.StringTables.Add("frame1");
+        using var memoryStream = new MemoryStream();
+        Serializer.Serialize(memoryStream, nativeProfile);
+        var encodedLength = (int)memoryStream.Length;
+
+        // the native side writes into a larger, reused buffer
+        var buffer = new byte[encodedLength + 16];
+        memoryStream.ToArray().CopyTo(buffer, 0);
+
+        var logRecord = exporter.ProcessThreadSamplesPprof(buffer, encodedLength, 3);
+
+        using (new AssertionScope())
+        {
+            Deserialize(logRecord.Body.StringValue).StringTables.Should().Equal(string.Empty, "frame1");
+            logRecord.Attributes.Single(kv => kv.Key == "profiling.data.type").Value.StringValue.Should().Be("cpu");
+            logRecord.Attributes.Single(kv => kv.Key == "profiling.data.total.frame.count").Value.IntValue.Should().Be(3);
+        }
+
+        exporter.ProcessThreadSamplesPprof(buffer, 0, 0).Should().BeNull();
+    }
+
     private static ThreadSample DefaultSample(params string[] frames)
     {
         var sample = new ThreadSample
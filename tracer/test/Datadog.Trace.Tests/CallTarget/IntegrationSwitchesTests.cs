@@ -0,0 +1,128 @@
+// <copyright file="IntegrationSwitchesTests.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using Datadog.Trace.ClrProfiler.AutoInstrumentation.Aerospike;
+using Datadog.Trace.ClrProfiler.CallTarget;
+using Datadog.Trace.ClrProfiler.CallTarget.Handlers;
+using Datadog.Trace.Configuration;
+using FluentAssertions;
+using Xunit;
+
+namespace Datadog.Trace.Tests.CallTarget
+{
+    // The switches are process wide and are also updated when the global tracer is replaced
+    [Collection(nameof(TracerInstanceTestCollection))]
+    public class IntegrationSwitchesTests
+    {
+        [Fact]
+        public void SetIntegrationEnabledUpdatesAllTheSwitchesOfTheIntegration()
+        {
+            try
+            {
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeFalse();
+                CallTargetIntegrationSwitch<AsyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeFalse();
+
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, false);
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeTrue();
+                CallTargetIntegrationSwitch<AsyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeTrue();
+                IntegrationOptions<SyncCommandIntegration, SetEnabledTarget>.IsIntegrationEnabled.Should().BeFalse();
+
+                // switches registered while the integration is disabled start disabled
+                CallTargetIntegrationSwitch<SyncCommandIntegration, RegisteredLaterTarget>.Disabled.Should().BeTrue();
+
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, true);
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeFalse();
+                CallTargetIntegrationSwitch<AsyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeFalse();
+                CallTargetIntegrationSwitch<SyncCommandIntegration, RegisteredLaterTarget>.Disabled.Should().BeFalse();
+                IntegrationOptions<SyncCommandIntegration, SetEnabledTarget>.IsIntegrationEnabled.Should().BeTrue();
+            }
+            finally
+            {
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, true);
+            }
+        }
+
+        [Fact]
+        public void DisabledDueToErrorStaysDisabled()
+        {
+            try
+            {
+                IntegrationOptions<SyncCommandIntegration, FaultedTarget>.DisableIntegration();
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, FaultedTarget>.Disabled.Should().BeTrue();
+
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, false);
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, true);
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, FaultedTarget>.Disabled.Should().BeTrue();
+                CallTargetIntegrationSwitch<AsyncCommandIntegration, FaultedTarget>.Disabled.Should().BeFalse();
+            }
+            finally
+            {
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, true);
+            }
+        }
+
+        [Fact]
+        public void UnknownIntegrationIsNotRegistered()
+        {
+            IntegrationSwitches.Register(typeof(IntegrationSwitchesTests), typeof(SetEnabledTarget), _ => { }).Should().BeFalse();
+        }
+
+        [Fact]
+        public void ApplySettingsDisablesTheExplicitlyDisabledIntegrations()
+        {
+            try
+            {
+                var settings = new TracerSettings();
+                settings.Integrations[nameof(IntegrationId.Aerospike)].Enabled = false;
+
+                IntegrationSwitches.ApplySettings(settings.Build().Integrations);
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SettingsTarget>.Disabled.Should().BeTrue();
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeTrue();
+
+                IntegrationSwitches.ApplySettings(new TracerSettings().Build().Integrations);
+
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SettingsTarget>.Disabled.Should().BeFalse();
+                CallTargetIntegrationSwitch<SyncCommandIntegration, SetEnabledTarget>.Disabled.Should().BeFalse();
+            }
+            finally
+            {
+                IntegrationSwitches.SetIntegrationEnabled(IntegrationId.Aerospike, true);
+            }
+        }
+
+        [Fact]
+        public void OnlyTheZeroedCallTargetStateIsSkipped()
+        {
+            // written with initobj by the instrumented methods when the integration is disabled
+            default(CallTargetState).IsSkipped.Should().BeTrue();
+
+            // returned by BeginMethod, or stored by the instrumented methods when BeginMethod threw
+            CallTargetState.GetDefault().IsSkipped.Should().BeFalse();
+            new CallTargetState(null).IsSkipped.Should().BeFalse();
+            new CallTargetState(null, null, default(CallTargetState)).IsSkipped.Should().BeFalse();
+        }
+
+        private class SetEnabledTarget
+        {
+        }
+
+        private class RegisteredLaterTarget
+        {
+        }
+
+        private class FaultedTarget
+        {
+        }
+
+        private class SettingsTarget
+        {
+        }
+    }
+}
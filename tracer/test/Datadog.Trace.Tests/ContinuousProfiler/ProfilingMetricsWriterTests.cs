@@ -0,0 +1,180 @@
+// <copyright file="ProfilingMetricsWriterTests.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using System;
+using System.Threading.Tasks;
+using Datadog.Trace.Agent;
+using Datadog.Trace.ContinuousProfiler;
+using Datadog.Trace.TestHelpers;
+using FluentAssertions;
+using Moq;
+using Xunit;
+
+namespace Datadog.Trace.Tests.ContinuousProfiler
+{
+    // the root spans are decorated with the Azure App Services metadata when added to their trace
+    [Collection(nameof(AzureAppServicesTestCollection))]
+    [AzureAppServicesRestorer]
+    public class ProfilingMetricsWriterTests
+    {
+        private readonly Mock<IAgentWriter> _innerWriter = new Mock<IAgentWriter>();
+        private readonly Mock<IContextTracker> _contextTracker = new Mock<IContextTracker>();
+
+        public ProfilingMetricsWriterTests()
+        {
+            _contextTracker.Setup(t => t.IsEnabled).Returns(true);
+            _contextTracker
+               .Setup(t => t.GetRootSpansTimes(It.IsAny<ulong[]>(), It.IsAny<long[]>(), It.IsAny<long[]>(), It.IsAny<int>()))
+               .Returns((ulong[] ids, long[] cpuTimes, long[] wallTimes, int count) =>
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        cpuTimes[i] = (long)ids[i] * 10;
+                        wallTimes[i] = (long)ids[i] * 100;
+                    }
+
+                    return true;
+                });
+        }
+
+        [Fact]
+        public void TracesAreWrittenWithTheirProfilingMetricsAfterAWholeAggregationPeriod()
+        {
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var first = CreateRootSpan(1);
+            var second = CreateRootSpan(2);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { first }));
+            writer.WriteTrace(new ArraySegment<Span>(new[] { second }));
+
+            // the last samples of the root spans may not be aggregated yet
+            writer.ProcessPendingTraces(all: false);
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Never);
+
+            writer.ProcessPendingTraces(all: false);
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Exactly(2));
+
+            // a single lookup for all the root spans
+            _contextTracker.Verify(t => t.GetRootSpansTimes(It.IsAny<ulong[]>(), It.IsAny<long[]>(), It.IsAny<long[]>(), 2), Times.Once);
+            _contextTracker.Verify(t => t.GetRootSpansTimes(It.IsAny<ulong[]>(), It.IsAny<long[]>(), It.IsAny<long[]>(), It.IsAny<int>()), Times.Once);
+
+            first.GetMetric(Metrics.ProfilingCpuTime).Should().Be(10);
+            first.GetMetric(Metrics.ProfilingWallTime).Should().Be(100);
+            second.GetMetric(Metrics.ProfilingCpuTime).Should().Be(20);
+            second.GetMetric(Metrics.ProfilingWallTime).Should().Be(200);
+        }
+
+        [Fact]
+        public void TracesWrittenDuringAPeriodWaitForTheNextOne()
+        {
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var first = CreateRootSpan(1);
+            var second = CreateRootSpan(2);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { first }));
+            writer.ProcessPendingTraces(all: false);
+            writer.WriteTrace(new ArraySegment<Span>(new[] { second }));
+            writer.ProcessPendingTraces(all: false);
+
+            _innerWriter.Verify(w => w.WriteTrace(It.Is<ArraySegment<Span>>(t => t.Array[0] == first)), Times.Once);
+            _innerWriter.Verify(w => w.WriteTrace(It.Is<ArraySegment<Span>>(t => t.Array[0] == second)), Times.Never);
+            second.GetMetric(Metrics.ProfilingCpuTime).Should().BeNull();
+
+            writer.ProcessPendingTraces(all: false);
+
+            _innerWriter.Verify(w => w.WriteTrace(It.Is<ArraySegment<Span>>(t => t.Array[0] == second)), Times.Once);
+            second.GetMetric(Metrics.ProfilingCpuTime).Should().Be(20);
+        }
+
+        [Fact]
+        public void TracesArePassedThroughWhenTheContextTrackerIsDisabled()
+        {
+            _contextTracker.Setup(t => t.IsEnabled).Returns(false);
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var span = CreateRootSpan(1);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { span }));
+
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Once);
+            _contextTracker.Verify(t => t.GetRootSpansTimes(It.IsAny<ulong[]>(), It.IsAny<long[]>(), It.IsAny<long[]>(), It.IsAny<int>()), Times.Never);
+            span.GetMetric(Metrics.ProfilingCpuTime).Should().BeNull();
+        }
+
+        [Fact]
+        public void PartialChunksWithoutTheRootSpanArePassedThrough()
+        {
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var root = CreateRootSpan(1);
+            var child = new Span(new SpanContext(root.Context, root.Context.TraceContext, "service", spanId: 2), DateTimeOffset.UtcNow);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { child }));
+
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Once);
+            child.GetMetric(Metrics.ProfilingCpuTime).Should().BeNull();
+        }
+
+        [Fact]
+        public void RootSpansWithoutSamplesHaveNoProfilingMetrics()
+        {
+            _contextTracker
+               .Setup(t => t.GetRootSpansTimes(It.IsAny<ulong[]>(), It.IsAny<long[]>(), It.IsAny<long[]>(), It.IsAny<int>()))
+               .Returns((ulong[] ids, long[] cpuTimes, long[] wallTimes, int count) =>
+                {
+                    Array.Clear(cpuTimes, 0, count);
+                    Array.Clear(wallTimes, 0, count);
+                    return true;
+                });
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var span = CreateRootSpan(1);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { span }));
+            writer.ProcessPendingTraces(all: true);
+
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Once);
+            span.GetMetric(Metrics.ProfilingCpuTime).Should().BeNull();
+            span.GetMetric(Metrics.ProfilingWallTime).Should().BeNull();
+        }
+
+        [Fact]
+        public async Task FlushWritesAllThePendingTraces()
+        {
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object, automaticProcessing: false);
+            var span = CreateRootSpan(1);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { span }));
+            await writer.FlushTracesAsync();
+
+            _innerWriter.Verify(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>()), Times.Once);
+            _innerWriter.Verify(w => w.FlushTracesAsync(), Times.Once);
+            span.GetMetric(Metrics.ProfilingCpuTime).Should().Be(10);
+        }
+
+        [Fact]
+        public async Task TracesAreWrittenByTheAggregationLoop()
+        {
+            var written = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+            _innerWriter.Setup(w => w.WriteTrace(It.IsAny<ArraySegment<Span>>())).Callback(() => written.TrySetResult(true));
+            var writer = new ProfilingMetricsWriter(_innerWriter.Object, _contextTracker.Object);
+            var span = CreateRootSpan(1);
+
+            writer.WriteTrace(new ArraySegment<Span>(new[] { span }));
+
+            var completed = await Task.WhenAny(written.Task, Task.Delay(TimeSpan.FromSeconds(30)));
+            completed.Should().Be(written.Task);
+            span.GetMetric(Metrics.ProfilingCpuTime).Should().Be(10);
+
+            await writer.FlushAndCloseAsync();
+            _innerWriter.Verify(w => w.FlushAndCloseAsync(), Times.Once);
+        }
+
+        private static Span CreateRootSpan(ulong spanId)
+        {
+            var traceContext = new TraceContext(Mock.Of<IDatadogTracer>());
+            var span = new Span(new SpanContext(null, traceContext, "service", TraceId.CreateFromInt(1), spanId), DateTimeOffset.UtcNow);
+            traceContext.AddSpan(span);
+            return span;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// <copyright file="InstrumentationLogReaderTests.cs" company="Datadog">
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2017 Datadog, Inc.
+// </copyright>
+
+using System;
+using System.IO;
+using System.Text;
+using Datadog.InstrumentedAssemblyGenerator;
+using FluentAssertions;
+using Xunit;
+
+namespace Datadog.Trace.Tests.InstrumentationVerification
+{
+    public class InstrumentationLogReaderTests : IDisposable
+    {
+        private const byte TextRecord = 0;
+        private const byte BytesRecord = 1;
+
+        private readonly string _inputFolder;
+
+        public InstrumentationLogReaderTests()
+        {
+            _inputFolder = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            Directory.CreateDirectory(_inputFolder);
+        }
+
+        public void Dispose()
+        {
+            Directory.Delete(_inputFolder, recursive: true);
+        }
+
+        [Fact]
+        public void NoLog()
+        {
+            InstrumentationLogReader.Expand(_inputFolder).Should().Be(0);
+        }
+
+        [Fact]
+        public void RecordsAreExpandedToTheirFiles()
+        {
+            using (var writer = CreateLog())
+            {
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("first line\n"));
+                WriteRecord(writer, BytesRecord, "module.bin", new byte[] { 0x00, 0x2A, 0xFF, 0x0A });
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("second line é\n"));
+                WriteRecord(writer, BytesRecord, "module.bin", new byte[] { 0x01 });
+            }
+
+            InstrumentationLogReader.Expand(_inputFolder).Should().Be(4);
+
+            // text records are appended, bytes records replace the content
+            File.ReadAllText(Path.Combine(_inputFolder, "method.txt"), Encoding.UTF8).Should().Be("first line\nsecond line é\n");
+            File.ReadAllBytes(Path.Combine(_inputFolder, "module.bin")).Should().Equal(0x01);
+        }
+
+        [Fact]
+        public void ExpansionCanBeRepeated()
+        {
+            using (var writer = CreateLog())
+            {
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("line\n"));
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("line\n"));
+            }
+
+            InstrumentationLogReader.Expand(_inputFolder).Should().Be(2);
+            InstrumentationLogReader.Expand(_inputFolder).Should().Be(2);
+
+            File.ReadAllText(Path.Combine(_inputFolder, "method.txt")).Should().Be("line\nline\n");
+        }
+
+        [Theory]
+        [InlineData(1)] // after the kind
+        [InlineData(3)] // in the file name length
+        [InlineData(10)] // in the file name
+        [InlineData(17)] // in the payload length
+        [InlineData(24)] // in the payload
+        public void TruncatedLastRecordIsIgnored(int truncatedBytes)
+        {
+            using (var writer = CreateLog())
+            {
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("complete\n"));
+                WriteRecord(writer, TextRecord, "method.txt", Encoding.UTF8.GetBytes("truncated\n"));
+            }
+
+            // the second record is 1 + 4 + 10 + 4 + 10 bytes long
+            string logPath = Path.Combine(_inputFolder, InstrumentedAssemblyGeneratorConsts.InstrumentationLogFileName);
+            using (var stream = new FileStream(logPath, FileMode.Open, FileAccess.Write))
+            {
+                stream.SetLength(stream.Length - 29 + truncatedBytes);
+            }
+
+            InstrumentationLogReader.Expand(_inputFolder).Should().Be(1);
+            File.ReadAllText(Path.Combine(_inputFolder, "method.txt")).Should().Be("complete\n");
+        }
+
+        // Same layout as the native InstrumentationLogWriter
+        private static void WriteRecord(BinaryWriter writer, byte kind, string fileName, byte[] payload)
+        {
+            byte[] fileNameBytes = Encoding.UTF8.GetBytes(fileName);
+            writer.Write(kind);
+            writer.Write(fileNameBytes.Length);
+            writer.Write(fileNameBytes);
+            writer.Write(payload.Length);
+            writer.Write(payload);
+        }
+
+        private BinaryWriter CreateLog()
+        {
+            string logPath = Path.Combine(_inputFolder, InstrumentedAssemblyGeneratorConsts.InstrumentationLogFileName);
+            return new BinaryWriter(File.Create(logPath));
+        }
+    }
+}
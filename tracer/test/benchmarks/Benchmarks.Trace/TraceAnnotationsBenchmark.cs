@@ -34,7 +34,7 @@ namespace Benchmarks.Trace
         [Benchmark]
         public CallTargetReturn RunOnMethodBegin()
         {
-            var state = TraceAnnotationsIntegration.OnMethodBegin<object>(null, MethodHandle, TypeHandle);
+            var state = TraceAnnotationsIntegration.OnMethodBegin<object>(null, 0, MethodHandle, TypeHandle);
             return TraceAnnotationsIntegration.OnMethodEnd<object>(null, null, state);
         }
 
@@ -0,0 +1,115 @@
+// Measures the overhead of forwarding a callback from the native loader to 1, 2 and 3 loaded profilers.
+//
+// Usage: Datadog.AutoInstrumentation.NativeLoader.Dispatch [<iterations>]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "../../Datadog.AutoInstrumentation.NativeLoader.Tests/test_dynamic_instance.h"
+#include "../../Datadog.AutoInstrumentation.NativeLoader.Tests/test_dynamic_dispatcher.h"
+#include "../../Datadog.AutoInstrumentation.NativeLoader.Tests/test_cor_profiler.h"
+#include "../../Datadog.AutoInstrumentation.NativeLoader.Tests/test_routing_cor_profiler.h"
+
+namespace
+{
+    struct DispatchBenchmark
+    {
+        TestDynamicDispatcherImpl* Dispatcher;
+        TestRoutingCorProfiler* Profiler;
+        std::vector<std::unique_ptr<TestCorProfiler>> Children;
+
+        DispatchBenchmark(int childrenCount)
+        {
+            Dispatcher = new TestDynamicDispatcherImpl();
+            for (int i = 0; i < childrenCount; i++)
+            {
+                Children.push_back(std::make_unique<TestCorProfiler>());
+
+                TestDynamicInstanceImpl* instance = CreateTestDynamicInstance(false);
+                instance->SetProfilerCallback(Children.back().get());
+
+                if (i == 0)
+                {
+                    Dispatcher->SetContinuousProfilerInstance(std::unique_ptr<IDynamicInstance>(instance));
+                }
+                else if (i == 1)
+                {
+                    Dispatcher->SetTracerInstance(std::unique_ptr<IDynamicInstance>(instance));
+                }
+                else
+                {
+                    Dispatcher->SetCustomInstance(std::unique_ptr<IDynamicInstance>(instance));
+                }
+            }
+
+            Profiler = new TestRoutingCorProfiler(Dispatcher);
+
+            // fails without a real ICorProfilerInfo but the profilers are set and receive all callbacks
+            Profiler->Initialize(Children.front().get());
+        }
+
+        ~DispatchBenchmark()
+        {
+            delete Profiler;
+            delete Dispatcher;
+        }
+
+        double MeasureNanosecondsPerCall(int iterations)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                BOOL shouldInline = TRUE;
+                Profiler->JITInlining(i, i, &shouldInline);
+            }
+            const auto duration = std::chrono::steady_clock::now() - start;
+
+            return std::chrono::duration<double, std::nano>(duration).count() / iterations;
+        }
+    };
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    if (iterations <= 0)
+    {
+        std::fprintf(stderr, "Usage: %s [<iterations>]\n", argv[0]);
+        return 1;
+    }
+
+    for (int childrenCount = 1; childrenCount <= 3; childrenCount++)
+    {
+        DispatchBenchmark benchmark(childrenCount);
+
+        // all the profilers are subscribed to the callback
+        const double subscribedDuration = benchmark.MeasureNanosecondsPerCall(iterations);
+
+        // only the first profiler is subscribed to the callback
+        benchmark.Profiler->UpdateCallbackSubscribers(COR_PRF_MONITOR_JIT_COMPILATION, 0, COR_PRF_MONITOR_MODULE_LOADS, 0,
+                                                      COR_PRF_MONITOR_MODULE_LOADS, 0);
+        const double routedDuration = benchmark.MeasureNanosecondsPerCall(iterations);
+
+        // the timings are meaningless if the callbacks were not forwarded as expected
+        const ULONG callsCount = static_cast<ULONG>(iterations);
+        bool forwarded = benchmark.Children.front()->m_JITInlining == 2 * callsCount;
+        for (size_t i = 1; i < benchmark.Children.size(); i++)
+        {
+            forwarded = forwarded && benchmark.Children[i]->m_JITInlining == callsCount;
+        }
+
+        if (!forwarded)
+        {
+            std::fprintf(stderr, "JITInlining was not forwarded to the %d profiler(s) as expected\n", childrenCount);
+            return 1;
+        }
+
+        std::printf("JITInlining with %d profiler(s): %.1f ns/call (all subscribed), %.1f ns/call (1 subscribed)\n",
+                    childrenCount, subscribedDuration, routedDuration);
+    }
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+// Replays a recording of the CLR callbacks (see SIGNALFX_TRACE_CALLBACK_RECORDING_PATH) against the tracer
+// CorProfiler, without a running CLR, and reports the time spent in each callback.
+//
+// Usage: SignalFx.Tracing.ClrProfiler.Native.Replay <recording file> [<libcoreclr.so path>]
+//
+// The module metadata is not recorded: when the libcoreclr.so of the recorded runtime is given, the metadata
+// is read from the recorded module paths (they must still exist); otherwise GetModuleMetaData fails and the
+// replay only measures the callback dispatch and filtering, not the metadata-heavy rewriting.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "../../../src/Datadog.Trace.ClrProfiler.Native/callback_recorder.h"
+#include "../../../src/Datadog.Trace.ClrProfiler.Native/cor_profiler.h"
+
+#include "replay_cor_profiler_info.h"
+#include "replay_function_control.h"
+
+using namespace trace;
+using namespace trace::replay;
+
+namespace
+{
+    HRESULT Dispatch(CorProfiler* profiler, const RecordedCallback& callback, ReplayFunctionControl* function_control)
+    {
+        switch (callback.kind)
+        {
+            case RecordKind::AssemblyLoadFinished:
+                return profiler->AssemblyLoadFinished(callback.arg0, callback.hr_status);
+            case RecordKind::ModuleLoadFinished:
+                return profiler->ModuleLoadFinished(callback.arg0, callback.hr_status);
+            case RecordKind::ModuleUnloadStarted:
+                return profiler->ModuleUnloadStarted(callback.arg0);
+            case RecordKind::JITCompilationStarted:
+                return profiler->JITCompilationStarted(callback.arg0, callback.flag);
+            case RecordKind::JITInlining:
+            {
+                BOOL should_inline = TRUE;
+                return profiler->JITInlining(callback.arg0, callback.arg1, &should_inline);
+            }
+            case RecordKind::JITCachedFunctionSearchStarted:
+            {
+                BOOL use_cached_function = TRUE;
+                return profiler->JITCachedFunctionSearchStarted(callback.arg0, &use_cached_function);
+            }
+            case RecordKind::ReJITCompilationStarted:
+                return profiler->ReJITCompilationStarted(callback.arg0, callback.arg1, callback.flag);
+            case RecordKind::GetReJITParameters:
+                return profiler->GetReJITParameters(callback.arg0, static_cast<mdMethodDef>(callback.arg1),
+                                                    function_control);
+            case RecordKind::ReJITCompilationFinished:
+                return profiler->ReJITCompilationFinished(callback.arg0, callback.arg1, callback.hr_status,
+                                                          callback.flag);
+            case RecordKind::ReJITError:
+                return profiler->ReJITError(callback.arg0, static_cast<mdMethodDef>(callback.arg1), callback.arg2,
+                                            callback.hr_status);
+            case RecordKind::AppDomainShutdownFinished:
+                return profiler->AppDomainShutdownFinished(callback.arg0, callback.hr_status);
+            case RecordKind::Shutdown:
+                return profiler->Shutdown();
+            default:
+                return E_INVALIDARG;
+        }
+    }
+
+    uint64_t Percentile(const std::vector<uint64_t>& sorted_durations, double percentile)
+    {
+        const auto index = static_cast<size_t>(percentile * (sorted_durations.size() - 1));
+        return sorted_durations[index];
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::printf("Usage: %s <recording file> [<libcoreclr.so path>]\n", argv[0]);
+        return 1;
+    }
+
+    CallbackRecording recording;
+    if (!CallbackRecording::Load(argv[1], recording))
+    {
+        std::printf("Unable to read the recording %s\n", argv[1]);
+        return 1;
+    }
+
+    std::printf("Recording: %zu callbacks, %zu assemblies, %zu modules, %zu functions\n", recording.callbacks.size(),
+                recording.assemblies.size(), recording.modules.size(), recording.functions.size());
+
+    IMetaDataDispenser* dispenser = nullptr;
+    if (argc > 2)
+    {
+        const HRESULT hr = CreateMetaDataDispenser(argv[2], &dispenser);
+        if (FAILED(hr))
+        {
+            std::printf("Unable to load the metadata dispenser from %s: 0x%08x\n", argv[2], static_cast<unsigned int>(hr));
+            return 1;
+        }
+    }
+    else
+    {
+        std::printf("No libcoreclr.so given: the module metadata is not available during the replay\n");
+    }
+
+    ReplayCorProfilerInfo info(recording, dispenser);
+    if (dispenser != nullptr)
+    {
+        dispenser->Release();
+    }
+    ReplayFunctionControl function_control;
+    auto profiler = new CorProfiler();
+    profiler->AddRef();
+
+    const auto start = std::chrono::steady_clock::now();
+    const HRESULT hr = profiler->Initialize(&info);
+    const auto initialize_duration = std::chrono::steady_clock::now() - start;
+    if (FAILED(hr))
+    {
+        std::printf("CorProfiler::Initialize failed: 0x%08x\n", static_cast<unsigned int>(hr));
+        profiler->Release();
+        return 1;
+    }
+
+    // Durations in nanoseconds, by callback
+    std::map<RecordKind, std::vector<uint64_t>> durations;
+    uint64_t callbacks_duration = 0;
+    bool is_shutdown = false;
+    for (const auto& callback : recording.callbacks)
+    {
+        const auto callback_start = std::chrono::steady_clock::now();
+        Dispatch(profiler, callback, &function_control);
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - callback_start)
+                                  .count();
+
+        durations[callback.kind].push_back(duration);
+        callbacks_duration += duration;
+        is_shutdown = is_shutdown || callback.kind == RecordKind::Shutdown;
+    }
+
+    if (!is_shutdown)
+    {
+        profiler->Shutdown();
+    }
+
+    std::printf("\n%-32s %10s %12s %10s %10s %10s %10s\n", "Callback", "Count", "Total (ms)", "Mean (us)",
+                "P50 (us)", "P99 (us)", "Max (us)");
+    for (auto& entry : durations)
+    {
+        auto& values = entry.second;
+        std::sort(values.begin(), values.end());
+
+        uint64_t total = 0;
+        for (const auto value : values)
+        {
+            total += value;
+        }
+
+        std::printf("%-32s %10zu %12.3f %10.3f %10.3f %10.3f %10.3f\n", RecordKindToString(entry.first),
+                    values.size(), total / 1e6, total / 1e3 / values.size(), Percentile(values, 0.5) / 1e3,
+                    Percentile(values, 0.99) / 1e3, values.back() / 1e3);
+    }
+
+    const auto initialize_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(initialize_duration).count();
+    std::printf("\nInitialize: %.3f ms\n", initialize_ns / 1e6);
+    std::printf("Callbacks: %.3f ms\n", callbacks_duration / 1e6);
+    std::printf("Total startup cost: %.3f ms\n", (initialize_ns + callbacks_duration) / 1e6);
+    if (!recording.callbacks.empty())
+    {
+        std::printf("Recorded duration: %.3f ms\n", recording.callbacks.back().timestamp / 1e6);
+    }
+    std::printf("ReJIT requests: %u, IL bodies set: %u\n", info.GetReJITRequestsCount(),
+                function_control.GetILBodiesCount());
+
+    profiler->Release();
+    return 0;
+}
@@ -0,0 +1,821 @@
+#include "replay_cor_profiler_info.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <dlfcn.h>
+
+namespace trace::replay
+{
+
+namespace
+{
+    // Copies a recorded name the way the CLR does: the length includes the null terminator
+    HRESULT CopyName(const shared::WSTRING& name, ULONG cchName, ULONG* pcchName, WCHAR szName[])
+    {
+        const ULONG length = static_cast<ULONG>(name.size()) + 1;
+        if (pcchName != nullptr)
+        {
+            *pcchName = length;
+        }
+
+        if (szName == nullptr || cchName == 0)
+        {
+            return S_OK;
+        }
+
+        const ULONG copied = std::min(length - 1, cchName - 1);
+        std::memcpy(szName, name.c_str(), copied * sizeof(WCHAR));
+        szName[copied] = 0;
+        return copied == length - 1 ? S_OK : HRESULT_FROM_WIN32(ERROR_INSUFFICIENT_BUFFER);
+    }
+} // namespace
+
+HRESULT CreateMetaDataDispenser(const std::string& coreclr_path, IMetaDataDispenser** ppDispenser)
+{
+    using CoreClrInitializeFunc = int (*)(const char* exePath, const char* appDomainFriendlyName, int propertyCount,
+                                          const char** propertyKeys, const char** propertyValues, void** hostHandle,
+                                          unsigned int* domainId);
+    using MetaDataGetDispenserFunc = HRESULT(STDAPICALLTYPE*)(REFCLSID rclsid, REFIID riid, LPVOID* ppv);
+
+    *ppDispenser = nullptr;
+
+    // The library is never unloaded: the metadata objects are used until the end of the replay
+    void* coreclr = dlopen(coreclr_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (coreclr == nullptr)
+    {
+        return E_FAIL;
+    }
+
+    const auto initialize = reinterpret_cast<CoreClrInitializeFunc>(dlsym(coreclr, "coreclr_initialize"));
+    const auto getDispenser = reinterpret_cast<MetaDataGetDispenserFunc>(dlsym(coreclr, "MetaDataGetDispenser"));
+    if (initialize == nullptr || getDispenser == nullptr)
+    {
+        return E_NOINTERFACE;
+    }
+
+    // The metadata code relies on the PAL which is only initialized with the runtime:
+    // start it (without any profiler attached) but never run managed code
+    unsetenv("CORECLR_ENABLE_PROFILING");
+    const auto directory = coreclr_path.substr(0, coreclr_path.find_last_of('/') + 1);
+    const auto trusted_assemblies = directory + "System.Private.CoreLib.dll";
+    const char* property_keys[] = {"TRUSTED_PLATFORM_ASSEMBLIES"};
+    const char* property_values[] = {trusted_assemblies.c_str()};
+    void* host_handle = nullptr;
+    unsigned int domain_id = 0;
+    const int result = initialize(coreclr_path.c_str(), "Replay", 1, property_keys, property_values, &host_handle,
+                                  &domain_id);
+    if (result < 0)
+    {
+        return static_cast<HRESULT>(result);
+    }
+
+    return getDispenser(CLSID_CorMetaDataDispenser, IID_IMetaDataDispenser, reinterpret_cast<LPVOID*>(ppDispenser));
+}
+
+ReplayCorProfilerInfo::ReplayCorProfilerInfo(const CallbackRecording& recording, IMetaDataDispenser* dispenser) :
+    m_refCount(0), m_recording(recording), m_dispenser(dispenser), m_eventsLow(0), m_eventsHigh(0), m_rejitRequests(0)
+{
+    for (const auto& assembly : recording.assemblies)
+    {
+        m_appDomainNames[assembly.second.app_domain_id] = assembly.second.app_domain_name;
+    }
+
+    if (m_dispenser != nullptr)
+    {
+        m_dispenser->AddRef();
+    }
+}
+
+ReplayCorProfilerInfo::~ReplayCorProfilerInfo()
+{
+    for (const auto& metadata : m_metadata)
+    {
+        metadata.second->Release();
+    }
+
+    if (m_dispenser != nullptr)
+    {
+        m_dispenser->Release();
+    }
+}
+
+ULONG ReplayCorProfilerInfo::GetReJITRequestsCount() const
+{
+    return m_rejitRequests.load();
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::QueryInterface(REFIID riid, void** ppvObject)
+{
+    if (ppvObject == nullptr)
+    {
+        return E_POINTER;
+    }
+
+    if (riid == __uuidof(ICorProfilerInfo12) || riid == __uuidof(ICorProfilerInfo11) ||
+        riid == __uuidof(ICorProfilerInfo10) || riid == __uuidof(ICorProfilerInfo9) ||
+        riid == __uuidof(ICorProfilerInfo8) || riid == __uuidof(ICorProfilerInfo7) ||
+        riid == __uuidof(ICorProfilerInfo6) || riid == __uuidof(ICorProfilerInfo5) ||
+        riid == __uuidof(ICorProfilerInfo4) || riid == __uuidof(ICorProfilerInfo3) ||
+        riid == __uuidof(ICorProfilerInfo2) || riid == __uuidof(ICorProfilerInfo) || riid == IID_IUnknown)
+    {
+        *ppvObject = this;
+        this->AddRef();
+        return S_OK;
+    }
+
+    *ppvObject = nullptr;
+    return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE ReplayCorProfilerInfo::AddRef(void)
+{
+    return std::atomic_fetch_add(&this->m_refCount, 1) + 1;
+}
+
+ULONG STDMETHODCALLTYPE ReplayCorProfilerInfo::Release(void)
+{
+    // The instance is owned by the replay: it is not deleted when the profiler releases it
+    return std::atomic_fetch_sub(&this->m_refCount, 1) - 1;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionInfo(FunctionID functionId, ClassID* pClassId,
+                                                                 ModuleID* pModuleId, mdToken* pToken)
+{
+    const auto function = m_recording.functions.find(functionId);
+    if (function == m_recording.functions.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    if (pClassId != nullptr)
+    {
+        *pClassId = function->second.class_id;
+    }
+    if (pModuleId != nullptr)
+    {
+        *pModuleId = function->second.module_id;
+    }
+    if (pToken != nullptr)
+    {
+        *pToken = function->second.token;
+    }
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetModuleInfo(ModuleID moduleId, LPCBYTE* ppBaseLoadAddress,
+                                                               ULONG cchName, ULONG* pcchName, WCHAR szName[],
+                                                               AssemblyID* pAssemblyId)
+{
+    return GetModuleInfo2(moduleId, ppBaseLoadAddress, cchName, pcchName, szName, pAssemblyId, nullptr);
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetModuleInfo2(ModuleID moduleId, LPCBYTE* ppBaseLoadAddress,
+                                                                ULONG cchName, ULONG* pcchName, WCHAR szName[],
+                                                                AssemblyID* pAssemblyId, DWORD* pdwModuleFlags)
+{
+    const auto module = m_recording.modules.find(moduleId);
+    if (module == m_recording.modules.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    if (ppBaseLoadAddress != nullptr)
+    {
+        *ppBaseLoadAddress = nullptr;
+    }
+    if (pAssemblyId != nullptr)
+    {
+        *pAssemblyId = module->second.assembly_id;
+    }
+    if (pdwModuleFlags != nullptr)
+    {
+        *pdwModuleFlags = module->second.flags;
+    }
+    return CopyName(module->second.path, cchName, pcchName, szName);
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetAssemblyInfo(AssemblyID assemblyId, ULONG cchName,
+                                                                 ULONG* pcchName, WCHAR szName[],
+                                                                 AppDomainID* pAppDomainId, ModuleID* pModuleId)
+{
+    const auto assembly = m_recording.assemblies.find(assemblyId);
+    if (assembly == m_recording.assemblies.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    if (pAppDomainId != nullptr)
+    {
+        *pAppDomainId = assembly->second.app_domain_id;
+    }
+    if (pModuleId != nullptr)
+    {
+        *pModuleId = assembly->second.manifest_module_id;
+    }
+    return CopyName(assembly->second.name, cchName, pcchName, szName);
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetAppDomainInfo(AppDomainID appDomainId, ULONG cchName,
+                                                                  ULONG* pcchName, WCHAR szName[],
+                                                                  ProcessID* pProcessId)
+{
+    const auto appDomainName = m_appDomainNames.find(appDomainId);
+    if (appDomainName == m_appDomainNames.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    if (pProcessId != nullptr)
+    {
+        *pProcessId = 0;
+    }
+    return CopyName(appDomainName->second, cchName, pcchName, szName);
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetRuntimeInformation(
+    USHORT* pClrInstanceId, COR_PRF_RUNTIME_TYPE* pRuntimeType, USHORT* pMajorVersion, USHORT* pMinorVersion,
+    USHORT* pBuildNumber, USHORT* pQFEVersion, ULONG cchVersionString, ULONG* pcchVersionString,
+    WCHAR szVersionString[])
+{
+    const auto& runtime_information = m_recording.runtime_information;
+    if (pClrInstanceId != nullptr)
+    {
+        *pClrInstanceId = 0;
+    }
+    if (pRuntimeType != nullptr)
+    {
+        *pRuntimeType = runtime_information.runtime_type;
+    }
+    if (pMajorVersion != nullptr)
+    {
+        *pMajorVersion = runtime_information.major_version;
+    }
+    if (pMinorVersion != nullptr)
+    {
+        *pMinorVersion = runtime_information.minor_version;
+    }
+    if (pBuildNumber != nullptr)
+    {
+        *pBuildNumber = runtime_information.build_version;
+    }
+    if (pQFEVersion != nullptr)
+    {
+        *pQFEVersion = runtime_information.qfe_version;
+    }
+    if (pcchVersionString != nullptr)
+    {
+        *pcchVersionString = 0;
+    }
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetEventMask(DWORD* pdwEvents)
+{
+    *pdwEvents = m_eventsLow;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEventMask(DWORD dwEvents)
+{
+    m_eventsLow = dwEvents;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetEventMask2(DWORD* pdwEventsLow, DWORD* pdwEventsHigh)
+{
+    *pdwEventsLow = m_eventsLow;
+    *pdwEventsHigh = m_eventsHigh;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEventMask2(DWORD dwEventsLow, DWORD dwEventsHigh)
+{
+    m_eventsLow = dwEventsLow;
+    m_eventsHigh = dwEventsHigh;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::InitializeCurrentThread()
+{
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::RequestReJIT(ULONG cFunctions, ModuleID moduleIds[],
+                                                              mdMethodDef methodIds[])
+{
+    m_rejitRequests += cFunctions;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::RequestRevert(ULONG cFunctions, ModuleID moduleIds[],
+                                                               mdMethodDef methodIds[], HRESULT status[])
+{
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::RequestReJITWithInliners(DWORD dwRejitFlags, ULONG cFunctions,
+                                                                          ModuleID moduleIds[],
+                                                                          mdMethodDef methodIds[])
+{
+    m_rejitRequests += cFunctions;
+    return S_OK;
+}
+
+//
+// Not available in a recording
+//
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassFromObject(ObjectID objectId, ClassID* pClassId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassFromToken(ModuleID moduleId, mdTypeDef typeDef, ClassID* pClassId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetCodeInfo(FunctionID functionId, LPCBYTE* pStart, ULONG* pcSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionFromIP(LPCBYTE ip, FunctionID* pFunctionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionFromToken(ModuleID moduleId, mdToken token, FunctionID* pFunctionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetHandleFromThread(ThreadID threadId, HANDLE* phThread)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetObjectSize(ObjectID objectId, ULONG* pcSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::IsArrayClass(ClassID classId, CorElementType* pBaseElemType, ClassID* pBaseClassId, ULONG* pcRank)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetThreadInfo(ThreadID threadId, DWORD* pdwWin32ThreadId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetCurrentThreadID(ThreadID* pThreadId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassIDInfo(ClassID classId, ModuleID* pModuleId, mdTypeDef* pTypeDefToken)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEnterLeaveFunctionHooks(FunctionEnter* pFuncEnter, FunctionLeave* pFuncLeave, FunctionTailcall* pFuncTailcall)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetFunctionIDMapper(FunctionIDMapper* pFunc)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetTokenAndMetaDataFromFunction(FunctionID functionId, const IID& riid, IUnknown** ppImport, mdToken* pToken)
+{
+    const auto function = m_recording.functions.find(functionId);
+    if (function == m_recording.functions.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    if (pToken != nullptr)
+    {
+        *pToken = function->second.token;
+    }
+    return GetModuleMetaData(function->second.module_id, ofRead, riid, ppImport);
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetModuleMetaData(ModuleID moduleId, DWORD dwOpenFlags, const IID& riid, IUnknown** ppOut)
+{
+    if (m_dispenser == nullptr)
+    {
+        return E_NOTIMPL;
+    }
+
+    const auto module = m_recording.modules.find(moduleId);
+    if (module == m_recording.modules.end())
+    {
+        return E_INVALIDARG;
+    }
+
+    std::lock_guard<std::mutex> guard(m_metadataLock);
+
+    // As the CLR, return the same metadata for all the calls: it is opened for writing
+    // because the profiler defines new tokens in the modules it instruments
+    auto& metadata = m_metadata[moduleId];
+    if (metadata == nullptr)
+    {
+        const HRESULT hr = m_dispenser->OpenScope(module->second.path.c_str(), ofRead | ofWrite, IID_IMetaDataImport2,
+                                                  &metadata);
+        if (FAILED(hr))
+        {
+            m_metadata.erase(moduleId);
+            return hr;
+        }
+    }
+
+    return metadata->QueryInterface(riid, reinterpret_cast<void**>(ppOut));
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetILFunctionBody(ModuleID moduleId, mdMethodDef methodId, LPCBYTE* ppMethodHeader, ULONG* pcbMethodSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetILFunctionBodyAllocator(ModuleID moduleId, IMethodMalloc** ppMalloc)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetILFunctionBody(ModuleID moduleId, mdMethodDef methodid, LPCBYTE pbNewILMethodHeader)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetFunctionReJIT(FunctionID functionId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::ForceGC()
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetILInstrumentedCodeMap(FunctionID functionId, BOOL fStartJit, ULONG cILMapEntries, COR_IL_MAP rgILMapEntries[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetInprocInspectionInterface(IUnknown** ppicd)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetInprocInspectionIThisThread(IUnknown** ppicd)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetThreadContext(ThreadID threadId, ContextID* pContextId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::BeginInprocDebugging(BOOL fThisThreadOnly, DWORD* pdwProfilerContext)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EndInprocDebugging(DWORD dwProfilerContext)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetILToNativeMapping(FunctionID functionId, ULONG32 cMap, ULONG32* pcMap, COR_DEBUG_IL_TO_NATIVE_MAP map[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::DoStackSnapshot(ThreadID thread, StackSnapshotCallback* callback, ULONG32 infoFlags, void* clientData, BYTE context[], ULONG32 contextSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEnterLeaveFunctionHooks2(FunctionEnter2* pFuncEnter, FunctionLeave2* pFuncLeave, FunctionTailcall2* pFuncTailcall)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionInfo2(FunctionID funcId, COR_PRF_FRAME_INFO frameInfo, ClassID* pClassId, ModuleID* pModuleId, mdToken* pToken, ULONG32 cTypeArgs, ULONG32* pcTypeArgs, ClassID typeArgs[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetStringLayout(ULONG* pBufferLengthOffset, ULONG* pStringLengthOffset, ULONG* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassLayout(ClassID classID, COR_FIELD_OFFSET rFieldOffset[], ULONG cFieldOffset, ULONG* pcFieldOffset, ULONG* pulClassSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassIDInfo2(ClassID classId, ModuleID* pModuleId, mdTypeDef* pTypeDefToken, ClassID* pParentClassId, ULONG32 cNumTypeArgs, ULONG32* pcNumTypeArgs, ClassID typeArgs[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetCodeInfo2(FunctionID functionID, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetClassFromTokenAndTypeArgs(ModuleID moduleID, mdTypeDef typeDef, ULONG32 cTypeArgs, ClassID typeArgs[], ClassID* pClassID)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionFromTokenAndTypeArgs(ModuleID moduleID, mdMethodDef funcDef, ClassID classId, ULONG32 cTypeArgs, ClassID typeArgs[], FunctionID* pFunctionID)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumModuleFrozenObjects(ModuleID moduleID, ICorProfilerObjectEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetArrayObjectInfo(ObjectID objectId, ULONG32 cDimensions, ULONG32 pDimensionSizes[], int pDimensionLowerBounds[], BYTE** ppData)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetBoxClassLayout(ClassID classId, ULONG32* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetThreadAppDomain(ThreadID threadId, AppDomainID* pAppDomainId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetRVAStaticAddress(ClassID classId, mdFieldDef fieldToken, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetAppDomainStaticAddress(ClassID classId, mdFieldDef fieldToken, AppDomainID appDomainId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetThreadStaticAddress(ClassID classId, mdFieldDef fieldToken, ThreadID threadId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetContextStaticAddress(ClassID classId, mdFieldDef fieldToken, ContextID contextId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetStaticFieldInfo(ClassID classId, mdFieldDef fieldToken, COR_PRF_STATIC_TYPE* pFieldInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetGenerationBounds(ULONG cObjectRanges, ULONG* pcObjectRanges, COR_PRF_GC_GENERATION_RANGE ranges[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetObjectGeneration(ObjectID objectId, COR_PRF_GC_GENERATION_RANGE* range)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetNotifiedExceptionClauseInfo(COR_PRF_EX_CLAUSE_INFO* pinfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumJITedFunctions(ICorProfilerFunctionEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::RequestProfilerDetach(DWORD dwExpectedCompletionMilliseconds)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetFunctionIDMapper2(FunctionIDMapper2* pFunc, void* clientData)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetStringLayout2(ULONG* pStringLengthOffset, ULONG* pBufferOffset)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEnterLeaveFunctionHooks3(FunctionEnter3* pFuncEnter3, FunctionLeave3* pFuncLeave3, FunctionTailcall3* pFuncTailcall3)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEnterLeaveFunctionHooks3WithInfo( FunctionEnter3WithInfo* pFuncEnter3WithInfo, FunctionLeave3WithInfo* pFuncLeave3WithInfo, FunctionTailcall3WithInfo* pFuncTailcall3WithInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionEnter3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo, ULONG* pcbArgumentInfo, COR_PRF_FUNCTION_ARGUMENT_INFO* pArgumentInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionLeave3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo, COR_PRF_FUNCTION_ARGUMENT_RANGE* pRetvalRange)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionTailcall3Info(FunctionID functionId, COR_PRF_ELT_INFO eltInfo, COR_PRF_FRAME_INFO* pFrameInfo)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumModules(ICorProfilerModuleEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetThreadStaticAddress2(ClassID classId, mdFieldDef fieldToken, AppDomainID appDomainId, ThreadID threadId, void** ppAddress)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetAppDomainsContainingModule(ModuleID moduleId, ULONG32 cAppDomainIds, ULONG32* pcAppDomainIds, AppDomainID appDomainIds[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumThreads(ICorProfilerThreadEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetCodeInfo3(FunctionID functionID, ReJITID reJitId, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionFromIP2(LPCBYTE ip, FunctionID* pFunctionId, ReJITID* pReJitId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetReJITIDs(FunctionID functionId, ULONG cReJitIds, ULONG* pcReJitIds, ReJITID reJitIds[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetILToNativeMapping2(FunctionID functionId, ReJITID reJitId, ULONG32 cMap, ULONG32* pcMap, COR_DEBUG_IL_TO_NATIVE_MAP map[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumJITedFunctions2(ICorProfilerFunctionEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetObjectSize2(ObjectID objectId, SIZE_T* pcSize)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumNgenModuleMethodsInliningThisMethod(ModuleID inlinersModuleId, ModuleID inlineeModuleId, mdMethodDef inlineeMethodId, BOOL* incompleteData, ICorProfilerMethodEnum** ppEnum)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::ApplyMetaData(ModuleID moduleId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetInMemorySymbolsLength(ModuleID moduleId, DWORD* pCountSymbolBytes)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::ReadInMemorySymbols(ModuleID moduleId, DWORD symbolsReadOffset, BYTE* pSymbolBytes, DWORD countSymbolBytes, DWORD* pCountSymbolBytesRead)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::IsFunctionDynamic(FunctionID functionId, BOOL* isDynamic)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetFunctionFromIP3(LPCBYTE ip, FunctionID* functionId, ReJITID* pReJitId)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetDynamicFunctionInfo(FunctionID functionId, ModuleID* moduleId, PCCOR_SIGNATURE* ppvSig, ULONG* pbSig, ULONG cchName, ULONG* pcchName, WCHAR wszName[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetNativeCodeStartAddresses(FunctionID functionID, ReJITID reJitId, ULONG32 cCodeStartAddresses, ULONG32* pcCodeStartAddresses, UINT_PTR codeStartAddresses[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetILToNativeMapping3(UINT_PTR pNativeCodeStartAddress, ULONG32 cMap, ULONG32* pcMap, COR_DEBUG_IL_TO_NATIVE_MAP map[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetCodeInfo4(UINT_PTR pNativeCodeStartAddress, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EnumerateObjectReferences(ObjectID objectId, ObjectReferenceCallback callback, void* clientData)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::IsFrozenObject(ObjectID objectId, BOOL* pbFrozen)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetLOHObjectSizeThreshold(DWORD* pThreshold)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SuspendRuntime()
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::ResumeRuntime()
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::GetEnvironmentVariableW(const WCHAR* szName, ULONG cchValue, ULONG* pcchValue, WCHAR szValue[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::SetEnvironmentVariableW(const WCHAR* szName, const WCHAR* szValue)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeStartSession(UINT32 cProviderConfigs, COR_PRF_EVENTPIPE_PROVIDER_CONFIG pProviderConfigs[], BOOL requestRundown, EVENTPIPE_SESSION* pSession)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeAddProviderToSession(EVENTPIPE_SESSION session, COR_PRF_EVENTPIPE_PROVIDER_CONFIG providerConfig)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeStopSession(EVENTPIPE_SESSION session)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeCreateProvider(const WCHAR* providerName, EVENTPIPE_PROVIDER* pProvider)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeGetProviderInfo(EVENTPIPE_PROVIDER provider, ULONG cchName, ULONG* pcchName, WCHAR providerName[])
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeDefineEvent(EVENTPIPE_PROVIDER provider, const WCHAR* eventName, UINT32 eventID, UINT64 keywords, UINT32 eventVersion, UINT32 level, UINT8 opcode, BOOL needStack, UINT32 cParamDescs, COR_PRF_EVENTPIPE_PARAM_DESC pParamDescs[], EVENTPIPE_EVENT* pEvent)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReplayCorProfilerInfo::EventPipeWriteEvent(EVENTPIPE_EVENT event, UINT32 cData, COR_PRF_EVENT_DATA data[], LPCGUID pActivityId, LPCGUID pRelatedActivityId)
+{
+    return E_NOTIMPL;
+}
+
+} // namespace trace::replay
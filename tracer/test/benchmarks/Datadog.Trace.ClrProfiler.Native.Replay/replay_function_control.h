@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+
+#include "cor.h"
+#include "corprof.h"
+
+namespace trace::replay
+{
+
+// ICorProfilerFunctionControl given to GetReJITParameters: the rewritten IL bodies are accepted and dropped
+class ReplayFunctionControl : public ICorProfilerFunctionControl
+{
+private:
+    std::atomic<ULONG> m_ilBodiesCount{0};
+
+public:
+    ULONG GetILBodiesCount() const
+    {
+        return m_ilBodiesCount.load();
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        if (ppvObject == nullptr)
+        {
+            return E_POINTER;
+        }
+
+        if (riid == __uuidof(ICorProfilerFunctionControl) || riid == IID_IUnknown)
+        {
+            *ppvObject = this;
+            return S_OK;
+        }
+
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+
+    // The instance is owned by the replay
+    ULONG STDMETHODCALLTYPE AddRef(void) override
+    {
+        return 1;
+    }
+
+    ULONG STDMETHODCALLTYPE Release(void) override
+    {
+        return 1;
+    }
+
+    HRESULT STDMETHODCALLTYPE SetCodegenFlags(DWORD flags) override
+    {
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE SetILFunctionBody(ULONG cbNewILMethodHeader, LPCBYTE pbNewILMethodHeader) override
+    {
+        m_ilBodiesCount++;
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE SetILInstrumentedCodeMap(ULONG cILMapEntries, COR_IL_MAP rgILMapEntries[]) override
+    {
+        return S_OK;
+    }
+};
+
+} // namespace trace::replay
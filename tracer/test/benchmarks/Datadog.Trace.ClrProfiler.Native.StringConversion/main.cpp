@@ -0,0 +1,86 @@
+// Measures the UTF-16 <-> UTF-8 conversions of shared/src/native-src/string.h on typical .NET type and method names.
+//
+// Usage: SignalFx.Tracing.ClrProfiler.Native.StringConversion [<iterations>]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../../../../shared/src/native-src/string.h"
+
+using namespace shared;
+
+namespace
+{
+    const std::vector<WSTRING> Names = {
+        WStr("System.Private.CoreLib"),
+        WStr("System.Collections.Generic.Dictionary"),
+        WStr("TryInsert"),
+        WStr("Microsoft.AspNetCore.Server.Kestrel.Core.Internal.Http.HttpProtocol"),
+        WStr("ProcessRequestsAsync"),
+        WStr("System.Threading.Tasks.Task.ExecuteWithThreadLocal"),
+        WStr("Datadog.Trace.ClrProfiler.AutoInstrumentation.AdoNet.CommandExecuteReaderIntegration"),
+        WStr("<Main>b__0_0"),
+        WStr("Caf\u00E9Service.R\u00E9servation"),
+    };
+
+    // keeps the conversions from being optimized away
+    volatile size_t TotalLength = 0;
+
+    template <typename TConversion>
+    double MeasureNanosecondsPerName(int iterations, TConversion&& conversion)
+    {
+        size_t totalLength = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            for (const auto& name : Names)
+            {
+                totalLength += conversion(name);
+            }
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+
+        TotalLength = TotalLength + totalLength;
+
+        return std::chrono::duration<double, std::nano>(duration).count() / (static_cast<double>(iterations) * Names.size());
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    if (iterations <= 0)
+    {
+        std::fprintf(stderr, "Usage: %s [<iterations>]\n", argv[0]);
+        return 1;
+    }
+
+    const double toStringDuration = MeasureNanosecondsPerName(iterations, [](const WSTRING& name) {
+        return ToString(name).size();
+    });
+
+    std::string utf8;
+    const double toStringBufferDuration = MeasureNanosecondsPerName(iterations, [&utf8](const WSTRING& name) {
+        ToString(name.data(), name.size(), utf8);
+        return utf8.size();
+    });
+
+    std::vector<std::string> utf8Names;
+    for (const auto& name : Names)
+    {
+        utf8Names.push_back(ToString(name));
+    }
+
+    size_t current = 0;
+    const double toWStringDuration = MeasureNanosecondsPerName(iterations, [&utf8Names, &current](const WSTRING&) {
+        return ToWSTRING(utf8Names[current++ % utf8Names.size()]).size();
+    });
+
+    std::printf("ToString: %.1f ns/name\n", toStringDuration);
+    std::printf("ToString into a buffer: %.1f ns/name\n", toStringBufferDuration);
+    std::printf("ToWSTRING: %.1f ns/name\n", toWStringDuration);
+    return 0;
+}
@@ -0,0 +1,37 @@
+using System;
+using Datadog.Trace.ClrProfiler.CallTarget;
+
+namespace CallTargetNativeTest.NoOp
+{
+    /// <summary>
+    /// NoOp Integration for 16 Arguments and Void Return
+    /// </summary>
+    public static class Noop16ArgumentsVoidIntegration
+    {
+        public static CallTargetState OnMethodBegin<TTarget, TArg1, TArg2, TArg3, TArg4, TArg5, TArg6, TArg7, TArg8, TArg9, TArg10, TArg11, TArg12, TArg13, TArg14, TArg15, TArg16>(TTarget instance, TArg1 arg1, TArg2 arg2, TArg3 arg3, TArg4 arg4, TArg5 arg5, TArg6 arg6, TArg7 arg7, TArg8 arg8, TArg9 arg9, TArg10 arg10, TArg11 arg11, TArg12 arg12, TArg13 arg13, TArg14 arg14, TArg15 arg15, TArg16 arg16)
+        {
+            CallTargetState returnValue = CallTargetState.GetDefault();
+            Console.WriteLine($"ProfilerOK: BeginMethod(16)<{typeof(Noop16ArgumentsVoidIntegration)}, {typeof(TTarget)}, {typeof(TArg1)}, {typeof(TArg2)}, {typeof(TArg3)}, {typeof(TArg4)}, {typeof(TArg5)}, {typeof(TArg6)}, {typeof(TArg7)}, {typeof(TArg8)}, {typeof(TArg9)}, {typeof(TArg10)}, {typeof(TArg11)}, {typeof(TArg12)}, {typeof(TArg13)}, {typeof(TArg14)}, {typeof(TArg15)}, {typeof(TArg16)}>({instance}, {arg1}, {arg2}, {arg3}, {arg4}, {arg5}, {arg6}, {arg7}, {arg8}, {arg9}, {arg10}, {arg11}, {arg12}, {arg13}, {arg14}, {arg15}, {arg16})");
+            if (instance?.GetType().Name.Contains("ThrowOnBegin") == true)
+            {
+                Console.WriteLine("Exception thrown.");
+                throw new Exception();
+            }
+
+            return returnValue;
+        }
+
+        public static CallTargetReturn OnMethodEnd<TTarget>(TTarget instance, Exception exception, in CallTargetState state)
+        {
+            CallTargetReturn returnValue = CallTargetReturn.GetDefault();
+            Console.WriteLine($"ProfilerOK: EndMethod(0)<{typeof(Noop16ArgumentsVoidIntegration)}, {typeof(TTarget)}>({instance}, {exception?.ToString() ?? "(null)"}, {state})");
+            if (instance?.GetType().Name.Contains("ThrowOnEnd") == true)
+            {
+                Console.WriteLine("Exception thrown.");
+                throw new Exception();
+            }
+
+            return returnValue;
+        }
+    }
+}
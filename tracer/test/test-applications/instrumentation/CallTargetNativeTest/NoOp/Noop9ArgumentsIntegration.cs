@@ -14,7 +14,7 @@ namespace CallTargetNativeTest.NoOp
             where TArg3 : IArg
         {
             CallTargetState returnValue = new CallTargetState(null, ((IDuckType)instance).Instance);
-            Console.WriteLine($"ProfilerOK: BeginMethod(Array)<{typeof(Noop9ArgumentsIntegration)}, {typeof(TTarget)}>({instance})");
+            Console.WriteLine($"ProfilerOK: BeginMethod(9)<{typeof(Noop9ArgumentsIntegration)}, {typeof(TTarget)}, {typeof(TArg1)}, {typeof(TArg2)}, {typeof(TArg3)}, {typeof(TArg4)}, {typeof(TArg5)}, {typeof(TArg6)}, {typeof(TArg7)}, {typeof(TArg8)}, {typeof(TArg9)}>({instance}, {arg1}, {arg2}, {arg3}, {arg4}, {arg5}, {arg6}, {arg7}, {arg8}, {arg9})");
             if (instance.Instance?.GetType().Name.Contains("ThrowOnBegin") == true)
             {
                 Console.WriteLine("Exception thrown.");
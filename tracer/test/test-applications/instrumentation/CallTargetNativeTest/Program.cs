@@ -34,7 +34,9 @@ namespace CallTargetNativeTest
             definitionsList.Add(new(TargetAssembly, typeof(ArgumentsStructParentType.With0ArgumentsThrowOnAsyncEnd).FullName, "Wait2Seconds", new[] { "_" }, 0, 0, 0, 1, 1, 1, integrationAssembly, "CallTargetNativeTest.NoOp.Noop0ArgumentsIntegration"));
             definitionsList.Add(new(TargetAssembly, typeof(ArgumentsGenericParentType<>.With0ArgumentsThrowOnAsyncEnd).FullName, "Wait2Seconds", new[] { "_" }, 0, 0, 0, 1, 1, 1, integrationAssembly, "CallTargetNativeTest.NoOp.Noop0ArgumentsIntegration"));
 
-            for (var i = 0; i < 10; i++)
+            // Besides 0 to 9 arguments, 10 and 16 are the bounds of the BeginMethod overloads for more than 9 arguments
+            // and methods with 17 arguments use the object[] slow path.
+            foreach (var i in Enumerable.Range(0, 10).Concat(new[] { 10, 16, 17 }))
             {
                 var signaturesArray = Enumerable.Range(0, i + 1).Select(i => "_").ToArray();
                 var withTypes = new[]
@@ -209,6 +211,30 @@ namespace CallTargetNativeTest
                         GenericParentArgument9();
                         break;
                     }
+                case "10":
+                    {
+                        Argument10();
+                        ParentArgument10();
+                        StructParentArgument10();
+                        GenericParentArgument10();
+                        break;
+                    }
+                case "16":
+                    {
+                        Argument16();
+                        ParentArgument16();
+                        StructParentArgument16();
+                        GenericParentArgument16();
+                        break;
+                    }
+                case "17":
+                    {
+                        Argument17();
+                        ParentArgument17();
+                        StructParentArgument17();
+                        GenericParentArgument17();
+                        break;
+                    }
                 case "withref":
                     {
                         WithRefArguments();
@@ -286,6 +312,21 @@ namespace CallTargetNativeTest
                         StructParentArgument9();
                         GenericParentArgument9();
                         // .
+                        Argument10();
+                        ParentArgument10();
+                        StructParentArgument10();
+                        GenericParentArgument10();
+                        // .
+                        Argument16();
+                        ParentArgument16();
+                        StructParentArgument16();
+                        GenericParentArgument16();
+                        // .
+                        Argument17();
+                        ParentArgument17();
+                        StructParentArgument17();
+                        GenericParentArgument17();
+                        // .
                         WithRefArguments();
                         ParentWithRefArguments();
                         StructParentWithRefArguments();
@@ -304,7 +345,7 @@ namespace CallTargetNativeTest
                         break;
                     }
                 default:
-                    Console.WriteLine("Run with the profiler and use a number from 0-9/withref/without/abstract/all as an argument.");
+                    Console.WriteLine("Run with the profiler and use a number from 0-10/16/17/withref/without/abstract/all as an argument.");
                     return;
             }
 
@@ -0,0 +1,602 @@
+using System;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CallTargetNativeTest;
+
+partial class Program
+{
+    private static void Argument10()
+    {
+        var w10 = new With10Arguments();
+        Console.WriteLine($"{typeof(With10Arguments).FullName}.VoidMethod");
+        RunMethod(() => w10.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w10.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g1 = new With10ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w10g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g2 = new With10ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w10g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10in = new With10ArgumentsInherits();
+        Console.WriteLine($"{typeof(With10ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w10in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w10in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10inGen = new With10ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(With10ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w10inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w10inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10Struct = new With10ArgumentsStruct();
+        Console.WriteLine($"{typeof(With10ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w10Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w10Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(With10ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => With10ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => With10ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => With10ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => With10ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => With10ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TBegin = new With10ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w10TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TEnd = new With10ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w10TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+    }
+
+    private static void ParentArgument10()
+    {
+        var w10 = new ArgumentsParentType.With10Arguments();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10Arguments).FullName}.VoidMethod");
+        RunMethod(() => w10.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w10.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g1 = new ArgumentsParentType.With10ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w10g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g2 = new ArgumentsParentType.With10ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w10g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10in = new ArgumentsParentType.With10ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w10in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w10in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10inGen = new ArgumentsParentType.With10ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w10inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w10inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10Struct = new ArgumentsParentType.With10ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w10Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w10Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsParentType.With10ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsParentType.With10ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsParentType.With10ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsParentType.With10ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsParentType.With10ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TBegin = new ArgumentsParentType.With10ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w10TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TEnd = new ArgumentsParentType.With10ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w10TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+    }
+
+    private static void StructParentArgument10()
+    {
+        var w10 = new ArgumentsStructParentType.With10Arguments();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10Arguments).FullName}.VoidMethod");
+        RunMethod(() => w10.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w10.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g1 = new ArgumentsStructParentType.With10ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w10g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g2 = new ArgumentsStructParentType.With10ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w10g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10in = new ArgumentsStructParentType.With10ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w10in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w10in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10inGen = new ArgumentsStructParentType.With10ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w10inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w10inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10Struct = new ArgumentsStructParentType.With10ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w10Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w10Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsStructParentType.With10ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsStructParentType.With10ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsStructParentType.With10ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsStructParentType.With10ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsStructParentType.With10ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TBegin = new ArgumentsStructParentType.With10ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w10TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TEnd = new ArgumentsStructParentType.With10ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w10TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+    }
+
+    private static void GenericParentArgument10()
+    {
+        var w10 = new ArgumentsGenericParentType<object>.With10Arguments();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10Arguments).FullName}.VoidMethod");
+        RunMethod(() => w10.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w10.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g1 = new ArgumentsGenericParentType<object>.With10ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w10g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10g2 = new ArgumentsGenericParentType<object>.With10ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w10g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w10g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10in = new ArgumentsGenericParentType<object>.With10ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w10in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w10in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10inGen = new ArgumentsGenericParentType<object>.With10ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w10inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w10inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w10inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10Struct = new ArgumentsGenericParentType<object>.With10ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w10Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w10Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With10ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With10ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With10ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With10ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With10ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TBegin = new ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w10TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+        //
+        var w10TEnd = new ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w10TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w10TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w10TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With10ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w10TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null));
+        Console.WriteLine();
+    }
+}
+
+class With10Arguments
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+    public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+}
+class With10ArgumentsGeneric<T>
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+    public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+}
+class With10ArgumentsInherits : With10Arguments { }
+class With10ArgumentsInheritsGeneric : With10ArgumentsGeneric<int> { }
+struct With10ArgumentsStruct
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+}
+static class With10ArgumentsStatic
+{
+    public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+    public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+    public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+    public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+}
+class With10ArgumentsThrowOnBegin : With10Arguments { }
+class With10ArgumentsThrowOnEnd : With10Arguments { }
+
+partial class ArgumentsParentType
+{
+    public class With10Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsInherits : With10Arguments { }
+    public class With10ArgumentsInheritsGeneric : With10ArgumentsGeneric<int> { }
+    public struct With10ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public static class With10ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsThrowOnBegin : With10Arguments { }
+    public class With10ArgumentsThrowOnEnd : With10Arguments { }
+}
+
+partial struct ArgumentsStructParentType
+{
+    public class With10Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsInherits : With10Arguments { }
+    public class With10ArgumentsInheritsGeneric : With10ArgumentsGeneric<int> { }
+    public struct With10ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public static class With10ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsThrowOnBegin : With10Arguments { }
+    public class With10ArgumentsThrowOnEnd : With10Arguments { }
+}
+
+partial class ArgumentsGenericParentType<PType>
+{
+    public class With10Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsInherits : With10Arguments { }
+    public class With10ArgumentsInheritsGeneric : With10ArgumentsGeneric<int> { }
+    public struct With10ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public static class With10ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10) => default;
+    }
+    public class With10ArgumentsThrowOnBegin : With10Arguments { }
+    public class With10ArgumentsThrowOnEnd : With10Arguments { }
+}
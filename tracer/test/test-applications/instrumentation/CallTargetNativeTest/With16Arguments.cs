@@ -0,0 +1,602 @@
+using System;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CallTargetNativeTest;
+
+partial class Program
+{
+    private static void Argument16()
+    {
+        var w16 = new With16Arguments();
+        Console.WriteLine($"{typeof(With16Arguments).FullName}.VoidMethod");
+        RunMethod(() => w16.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w16.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g1 = new With16ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w16g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g2 = new With16ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w16g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16in = new With16ArgumentsInherits();
+        Console.WriteLine($"{typeof(With16ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w16in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w16in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16inGen = new With16ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(With16ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w16inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w16inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16Struct = new With16ArgumentsStruct();
+        Console.WriteLine($"{typeof(With16ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w16Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w16Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(With16ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => With16ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => With16ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => With16ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => With16ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => With16ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TBegin = new With16ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w16TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TEnd = new With16ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w16TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void ParentArgument16()
+    {
+        var w16 = new ArgumentsParentType.With16Arguments();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16Arguments).FullName}.VoidMethod");
+        RunMethod(() => w16.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w16.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g1 = new ArgumentsParentType.With16ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w16g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g2 = new ArgumentsParentType.With16ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w16g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16in = new ArgumentsParentType.With16ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w16in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w16in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16inGen = new ArgumentsParentType.With16ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w16inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w16inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16Struct = new ArgumentsParentType.With16ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w16Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w16Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsParentType.With16ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsParentType.With16ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsParentType.With16ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsParentType.With16ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsParentType.With16ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TBegin = new ArgumentsParentType.With16ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w16TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TEnd = new ArgumentsParentType.With16ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w16TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void StructParentArgument16()
+    {
+        var w16 = new ArgumentsStructParentType.With16Arguments();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16Arguments).FullName}.VoidMethod");
+        RunMethod(() => w16.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w16.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g1 = new ArgumentsStructParentType.With16ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w16g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g2 = new ArgumentsStructParentType.With16ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w16g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16in = new ArgumentsStructParentType.With16ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w16in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w16in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16inGen = new ArgumentsStructParentType.With16ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w16inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w16inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16Struct = new ArgumentsStructParentType.With16ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w16Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w16Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsStructParentType.With16ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsStructParentType.With16ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsStructParentType.With16ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsStructParentType.With16ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsStructParentType.With16ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TBegin = new ArgumentsStructParentType.With16ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w16TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TEnd = new ArgumentsStructParentType.With16ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w16TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void GenericParentArgument16()
+    {
+        var w16 = new ArgumentsGenericParentType<object>.With16Arguments();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16Arguments).FullName}.VoidMethod");
+        RunMethod(() => w16.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w16.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g1 = new ArgumentsGenericParentType<object>.With16ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w16g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16g2 = new ArgumentsGenericParentType<object>.With16ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w16g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w16g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16in = new ArgumentsGenericParentType<object>.With16ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w16in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w16in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16inGen = new ArgumentsGenericParentType<object>.With16ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w16inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w16inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w16inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16Struct = new ArgumentsGenericParentType<object>.With16ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w16Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w16Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With16ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With16ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With16ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With16ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With16ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TBegin = new ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w16TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w16TEnd = new ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w16TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w16TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w16TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With16ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w16TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+}
+
+class With16Arguments
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+    public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+}
+class With16ArgumentsGeneric<T>
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+    public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+}
+class With16ArgumentsInherits : With16Arguments { }
+class With16ArgumentsInheritsGeneric : With16ArgumentsGeneric<int> { }
+struct With16ArgumentsStruct
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+}
+static class With16ArgumentsStatic
+{
+    public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+    public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+    public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+    public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+}
+class With16ArgumentsThrowOnBegin : With16Arguments { }
+class With16ArgumentsThrowOnEnd : With16Arguments { }
+
+partial class ArgumentsParentType
+{
+    public class With16Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsInherits : With16Arguments { }
+    public class With16ArgumentsInheritsGeneric : With16ArgumentsGeneric<int> { }
+    public struct With16ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public static class With16ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsThrowOnBegin : With16Arguments { }
+    public class With16ArgumentsThrowOnEnd : With16Arguments { }
+}
+
+partial struct ArgumentsStructParentType
+{
+    public class With16Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsInherits : With16Arguments { }
+    public class With16ArgumentsInheritsGeneric : With16ArgumentsGeneric<int> { }
+    public struct With16ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public static class With16ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsThrowOnBegin : With16Arguments { }
+    public class With16ArgumentsThrowOnEnd : With16Arguments { }
+}
+
+partial class ArgumentsGenericParentType<PType>
+{
+    public class With16Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsInherits : With16Arguments { }
+    public class With16ArgumentsInheritsGeneric : With16ArgumentsGeneric<int> { }
+    public struct With16ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public static class With16ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16) => default;
+    }
+    public class With16ArgumentsThrowOnBegin : With16Arguments { }
+    public class With16ArgumentsThrowOnEnd : With16Arguments { }
+}
@@ -0,0 +1,602 @@
+using System;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CallTargetNativeTest;
+
+partial class Program
+{
+    private static void Argument17()
+    {
+        var w17 = new With17Arguments();
+        Console.WriteLine($"{typeof(With17Arguments).FullName}.VoidMethod");
+        RunMethod(() => w17.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w17.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g1 = new With17ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w17g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g2 = new With17ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w17g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17in = new With17ArgumentsInherits();
+        Console.WriteLine($"{typeof(With17ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w17in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w17in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17inGen = new With17ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(With17ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w17inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w17inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17Struct = new With17ArgumentsStruct();
+        Console.WriteLine($"{typeof(With17ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w17Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w17Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(With17ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => With17ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => With17ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => With17ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => With17ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => With17ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TBegin = new With17ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w17TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TEnd = new With17ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w17TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void ParentArgument17()
+    {
+        var w17 = new ArgumentsParentType.With17Arguments();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17Arguments).FullName}.VoidMethod");
+        RunMethod(() => w17.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w17.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g1 = new ArgumentsParentType.With17ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w17g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g2 = new ArgumentsParentType.With17ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w17g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17in = new ArgumentsParentType.With17ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w17in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w17in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17inGen = new ArgumentsParentType.With17ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w17inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w17inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17Struct = new ArgumentsParentType.With17ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w17Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w17Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsParentType.With17ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsParentType.With17ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsParentType.With17ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsParentType.With17ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsParentType.With17ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TBegin = new ArgumentsParentType.With17ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w17TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TEnd = new ArgumentsParentType.With17ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w17TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void StructParentArgument17()
+    {
+        var w17 = new ArgumentsStructParentType.With17Arguments();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17Arguments).FullName}.VoidMethod");
+        RunMethod(() => w17.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w17.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g1 = new ArgumentsStructParentType.With17ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w17g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g2 = new ArgumentsStructParentType.With17ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w17g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17in = new ArgumentsStructParentType.With17ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w17in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w17in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17inGen = new ArgumentsStructParentType.With17ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w17inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w17inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17Struct = new ArgumentsStructParentType.With17ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w17Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w17Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsStructParentType.With17ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsStructParentType.With17ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsStructParentType.With17ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsStructParentType.With17ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsStructParentType.With17ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TBegin = new ArgumentsStructParentType.With17ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w17TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TEnd = new ArgumentsStructParentType.With17ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w17TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsStructParentType.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+
+    private static void GenericParentArgument17()
+    {
+        var w17 = new ArgumentsGenericParentType<object>.With17Arguments();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17Arguments).FullName}.VoidMethod");
+        RunMethod(() => w17.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17Arguments).FullName}.ReturnValueMethod");
+        RunMethod(() => w17.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17Arguments).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17Arguments).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17Arguments).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g1 = new ArgumentsGenericParentType<object>.With17ArgumentsGeneric<string>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<string>).FullName}.VoidMethod", Assembly.GetExecutingAssembly(), null);
+        RunMethod(() => w17g1.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<string>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g1.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<string>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g1.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<string>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g1.ReturnGenericMethod<string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17g2 = new ArgumentsGenericParentType<object>.With17ArgumentsGeneric<int>();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<int>).FullName}.VoidMethod");
+        RunMethod(() => w17g2.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<int>).FullName}.ReturnValueMethod");
+        RunMethod(() => w17g2.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<int>).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17g2.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsGeneric<int>).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17g2.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17in = new ArgumentsGenericParentType<object>.With17ArgumentsInherits();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInherits).FullName}.VoidMethod");
+        RunMethod(() => w17in.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInherits).FullName}.ReturnValueMethod");
+        RunMethod(() => w17in.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInherits).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17in.ReturnReferenceMethod("Hello Wolrd", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInherits).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17in.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInherits).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17in.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17inGen = new ArgumentsGenericParentType<object>.With17ArgumentsInheritsGeneric();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInheritsGeneric).FullName}.VoidMethod");
+        RunMethod(() => w17inGen.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInheritsGeneric).FullName}.ReturnValueMethod");
+        RunMethod(() => w17inGen.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInheritsGeneric).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17inGen.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsInheritsGeneric).FullName}.ReturnGenericMethod");
+        RunMethod(() => w17inGen.ReturnGenericMethod<int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17Struct = new ArgumentsGenericParentType<object>.With17ArgumentsStruct();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStruct).FullName}.VoidMethod");
+        RunMethod(() => w17Struct.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStruct).FullName}.ReturnValueMethod");
+        RunMethod(() => w17Struct.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStruct).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17Struct.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStruct).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStruct).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17Struct.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStatic).FullName}.VoidMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With17ArgumentsStatic.VoidMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStatic).FullName}.ReturnValueMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With17ArgumentsStatic.ReturnValueMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStatic).FullName}.ReturnReferenceMethod");
+        RunMethod(() => ArgumentsGenericParentType<object>.With17ArgumentsStatic.ReturnReferenceMethod("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStatic).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With17ArgumentsStatic.ReturnGenericMethod<string, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsStatic).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => ArgumentsGenericParentType<object>.With17ArgumentsStatic.ReturnGenericMethod<int, string, Tuple<int, int>, ulong>("Hello World", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TBegin = new ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin).FullName}.VoidMethod");
+        RunMethod(() => w17TBegin.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TBegin.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TBegin.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnBegin).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TBegin.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+        //
+        var w17TEnd = new ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd();
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd).FullName}.VoidMethod");
+        RunMethod(() => w17TEnd.VoidMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd).FullName}.ReturnValueMethod");
+        RunMethod(() => w17TEnd.ReturnValueMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd).FullName}.ReturnReferenceMethod");
+        RunMethod(() => w17TEnd.ReturnReferenceMethod("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<string>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<string, string, Tuple<int, int>, ulong>("Hello world", 42, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine($"{typeof(ArgumentsGenericParentType<object>.With17ArgumentsThrowOnEnd).FullName}.ReturnGenericMethod<int>");
+        RunMethod(() => w17TEnd.ReturnGenericMethod<int, int, Tuple<int, int>, ulong>(42, 99, Tuple.Create(1, 2), Task.CompletedTask, CancellationToken.None, 987, "Arg7-Value", Assembly.GetExecutingAssembly(), null, null, null, null, null, null, null, null, null));
+        Console.WriteLine();
+    }
+}
+
+class With17Arguments
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+    public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+}
+class With17ArgumentsGeneric<T>
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+    public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+}
+class With17ArgumentsInherits : With17Arguments { }
+class With17ArgumentsInheritsGeneric : With17ArgumentsGeneric<int> { }
+struct With17ArgumentsStruct
+{
+    public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+    public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+    public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+    public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+}
+static class With17ArgumentsStatic
+{
+    public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+    public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+    public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+    public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+}
+class With17ArgumentsThrowOnBegin : With17Arguments { }
+class With17ArgumentsThrowOnEnd : With17Arguments { }
+
+partial class ArgumentsParentType
+{
+    public class With17Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsInherits : With17Arguments { }
+    public class With17ArgumentsInheritsGeneric : With17ArgumentsGeneric<int> { }
+    public struct With17ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public static class With17ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsThrowOnBegin : With17Arguments { }
+    public class With17ArgumentsThrowOnEnd : With17Arguments { }
+}
+
+partial struct ArgumentsStructParentType
+{
+    public class With17Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsInherits : With17Arguments { }
+    public class With17ArgumentsInheritsGeneric : With17ArgumentsGeneric<int> { }
+    public struct With17ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public static class With17ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsThrowOnBegin : With17Arguments { }
+    public class With17ArgumentsThrowOnEnd : With17Arguments { }
+}
+
+partial class ArgumentsGenericParentType<PType>
+{
+    public class With17Arguments
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg, int arg21, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsGeneric<T>
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsInherits : With17Arguments { }
+    public class With17ArgumentsInheritsGeneric : With17ArgumentsGeneric<int> { }
+    public struct With17ArgumentsStruct
+    {
+        public void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public static class With17ArgumentsStatic
+    {
+        public static void VoidMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) { }
+        public static int ReturnValueMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => 42;
+        public static string ReturnReferenceMethod(string arg1, int arg2, object arg3, Task arg4, CancellationToken arg5, ulong arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => "Hello World";
+        public static T ReturnGenericMethod<T, TArg1, TArg3, TArg6>(TArg1 arg1, int arg2, TArg3 arg3, Task arg4, CancellationToken arg5, TArg6 arg6, string arg7, Assembly arg8, int? arg9, int? arg10, int? arg11, int? arg12, int? arg13, int? arg14, int? arg15, int? arg16, int? arg17) => default;
+    }
+    public class With17ArgumentsThrowOnBegin : With17Arguments { }
+    public class With17ArgumentsThrowOnEnd : With17Arguments { }
+}